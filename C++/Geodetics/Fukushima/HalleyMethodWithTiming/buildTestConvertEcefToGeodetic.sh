@@ -10,7 +10,8 @@
   echo "------------------------------------------------------------------"
   echo ""
 #-------------------------------------------------------------------------------
-  /bin/rm -f ./*.o ./testAndTimeConvertEcefToGeodetic.exe 2>&1 | /dev/null
+  /bin/rm -f ./*.o ./testAndTimeConvertEcefToGeodetic.exe                    \
+             ./sweepAccuracyConvertEcefToGeodetic 2>&1 | /dev/null
 #-------------------------------------------------------------------------------
   g++                                                                          \
       -I .                                                                     \
@@ -60,6 +61,82 @@
       -c                                                                       \
       -o ./convertEcefToGeodetic.o                                             \
          ./convertEcefToGeodetic.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./reportConvertEcefToGeodeticStatus.o                                 \
+         ./reportConvertEcefToGeodeticStatus.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./reportConvertGeodeticToEcefStatus.o                                 \
+         ./reportConvertGeodeticToEcefStatus.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./initializeEarthEllipsoidContext.o                                   \
+         ./initializeEarthEllipsoidContext.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./convertEcefToGeodeticWithEllipsoidContext.o                         \
+         ./convertEcefToGeodeticWithEllipsoidContext.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+# The batch conversion is compiled with the options which let the compiler
+# auto-vectorize its branch free loop.
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O3                                                                      \
+      -fno-math-errno                                                          \
+      -fno-trapping-math                                                       \
+      -c                                                                       \
+      -o ./convertEcefToGeodeticBatch.o                                        \
+         ./convertEcefToGeodeticBatch.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./detectEcefToGeodeticIsaLevel.o                                      \
+         ./detectEcefToGeodeticIsaLevel.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+# The explicit SIMD batch kernels are compiled for their instruction sets
+# only; 'convertEcefToGeodeticBatch' calls them after checking the CPU.
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -mavx2                                                                   \
+      -mfma                                                                    \
+      -c                                                                       \
+      -o ./convertEcefToGeodeticBatchAvx2.o                                    \
+         ./convertEcefToGeodeticBatchAvx2.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -mavx512f                                                                \
+      -mfma                                                                    \
+      -c                                                                       \
+      -o ./convertEcefToGeodeticBatchAvx512.o                                  \
+         ./convertEcefToGeodeticBatchAvx512.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -pthread                                                                 \
+      -c                                                                       \
+      -o ./convertEcefToGeodeticParallelBatch.o                                \
+         ./convertEcefToGeodeticParallelBatch.cpp
 #- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
   g++                                                                          \
       -I .                                                                     \
@@ -67,6 +144,243 @@
       -c                                                                       \
       -o ./convertGeodeticToEcef.o                                             \
          ./convertGeodeticToEcef.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+# The scalar entry points are compiled once more for the x86-64-v3 and
+# x86-64-v4 levels; an indirect function picks the clone at load time.
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -march=x86-64-v3                                                         \
+      -c                                                                       \
+      -o ./convertBetweenEcefAndGeodeticX8664V3.o                              \
+         ./convertBetweenEcefAndGeodeticX8664V3.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -march=x86-64-v4                                                         \
+      -c                                                                       \
+      -o ./convertBetweenEcefAndGeodeticX8664V4.o                              \
+         ./convertBetweenEcefAndGeodeticX8664V4.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+# The forward batch conversion, like the inverse one, is compiled with the
+# options which let the compiler auto-vectorize its branch free loop.
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O3                                                                      \
+      -fno-math-errno                                                          \
+      -fno-trapping-math                                                       \
+      -c                                                                       \
+      -o ./convertGeodeticToEcefBatch.o                                        \
+         ./convertGeodeticToEcefBatch.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -mavx2                                                                   \
+      -mfma                                                                    \
+      -c                                                                       \
+      -o ./convertGeodeticToEcefBatchAvx2.o                                    \
+         ./convertGeodeticToEcefBatchAvx2.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -mavx512f                                                                \
+      -mfma                                                                    \
+      -c                                                                       \
+      -o ./convertGeodeticToEcefBatchAvx512.o                                  \
+         ./convertGeodeticToEcefBatchAvx512.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./summarizeBatchValidityBits.o                                        \
+         ./summarizeBatchValidityBits.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./convertEcefToGeodeticInterleavedBatch.o                             \
+         ./convertEcefToGeodeticInterleavedBatch.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+# The grid conversion row loop is also auto-vectorized.
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O3                                                                      \
+      -fno-math-errno                                                          \
+      -fno-trapping-math                                                       \
+      -c                                                                       \
+      -o ./convertGeodeticGridToEcef.o                                         \
+         ./convertGeodeticGridToEcef.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+# Without errno the square roots of the warm trajectory points are inlined.
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O3                                                                      \
+      -fno-math-errno                                                          \
+      -fno-trapping-math                                                       \
+      -c                                                                       \
+      -o ./convertEcefToGeodeticTrajectory.o                                   \
+         ./convertEcefToGeodeticTrajectory.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+# The display and survey tier batch loops are auto-vectorized, once for
+# each instruction set level; the batch calls the widest the CPU supports.
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O3                                                                      \
+      -fno-math-errno                                                          \
+      -fno-trapping-math                                                       \
+      -c                                                                       \
+      -o ./convertEcefToGeodeticWithAccuracyTier.o                             \
+         ./convertEcefToGeodeticWithAccuracyTier.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O3                                                                      \
+      -mavx2                                                                   \
+      -mfma                                                                    \
+      -fno-math-errno                                                          \
+      -fno-trapping-math                                                       \
+      -c                                                                       \
+      -o ./convertEcefToGeodeticWithAccuracyTierAvx2.o                         \
+         ./convertEcefToGeodeticWithAccuracyTierAvx2.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O3                                                                      \
+      -mavx512f                                                                \
+      -mfma                                                                    \
+      -fno-math-errno                                                          \
+      -fno-trapping-math                                                       \
+      -c                                                                       \
+      -o ./convertEcefToGeodeticWithAccuracyTierAvx512.o                       \
+         ./convertEcefToGeodeticWithAccuracyTierAvx512.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+# The direction cosine batch loop is auto-vectorized.
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O3                                                                      \
+      -fno-math-errno                                                          \
+      -fno-trapping-math                                                       \
+      -c                                                                       \
+      -o ./convertEcefToGeodeticDirectionCosines.o                             \
+         ./convertEcefToGeodeticDirectionCosines.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+# The baseline chunk loops of the partial batch conversions are
+# auto-vectorized.
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O3                                                                      \
+      -fno-math-errno                                                          \
+      -fno-trapping-math                                                       \
+      -c                                                                       \
+      -o ./convertEcefToGeodeticPartialOutputs.o                               \
+         ./convertEcefToGeodeticPartialOutputs.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+# The baseline bounding ellipsoid pass of the altitude band culling is
+# auto-vectorized.
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O3                                                                      \
+      -fno-math-errno                                                          \
+      -fno-trapping-math                                                       \
+      -c                                                                       \
+      -o ./cullEcefPointsToAltitudeBand.o                                      \
+         ./cullEcefPointsToAltitudeBand.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O3                                                                      \
+      -mavx2                                                                   \
+      -mfma                                                                    \
+      -fno-math-errno                                                          \
+      -fno-trapping-math                                                       \
+      -c                                                                       \
+      -o ./cullEcefPointsToAltitudeBandAvx2.o                                  \
+         ./cullEcefPointsToAltitudeBandAvx2.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O3                                                                      \
+      -mavx512f                                                                \
+      -mfma                                                                    \
+      -fno-math-errno                                                          \
+      -fno-trapping-math                                                       \
+      -c                                                                       \
+      -o ./cullEcefPointsToAltitudeBandAvx512.o                                \
+         ./cullEcefPointsToAltitudeBandAvx512.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+# The conversion engines are scalar, and compiled as the batch kernels.
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O3                                                                      \
+      -fno-math-errno                                                          \
+      -fno-trapping-math                                                       \
+      -c                                                                       \
+      -o ./convertEcefToGeodeticWithEngine.o                                   \
+         ./convertEcefToGeodeticWithEngine.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O3                                                                      \
+      -fno-math-errno                                                          \
+      -fno-trapping-math                                                       \
+      -c                                                                       \
+      -o ./convertEcefToGeodeticIterated.o                                     \
+         ./convertEcefToGeodeticIterated.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+# The single precision batch loops are auto-vectorized, with twice the lanes
+# of the double loops, once for each instruction set level.
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O3                                                                      \
+      -fno-math-errno                                                          \
+      -fno-trapping-math                                                       \
+      -c                                                                       \
+      -o ./convertBetweenEcefAndGeodeticWithSinglePrecision.o                  \
+         ./convertBetweenEcefAndGeodeticWithSinglePrecision.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O3                                                                      \
+      -mavx2                                                                   \
+      -mfma                                                                    \
+      -fno-math-errno                                                          \
+      -fno-trapping-math                                                       \
+      -c                                                                       \
+      -o ./convertBetweenEcefAndGeodeticWithSinglePrecisionAvx2.o              \
+         ./convertBetweenEcefAndGeodeticWithSinglePrecisionAvx2.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O3                                                                      \
+      -mavx512f                                                                \
+      -mfma                                                                    \
+      -fno-math-errno                                                          \
+      -fno-trapping-math                                                       \
+      -c                                                                       \
+      -o ./convertBetweenEcefAndGeodeticWithSinglePrecisionAvx512.o            \
+         ./convertBetweenEcefAndGeodeticWithSinglePrecisionAvx512.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./convertGeodeticToEcefWithEllipsoidContext.o                         \
+         ./convertGeodeticToEcefWithEllipsoidContext.cpp
 #- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
   g++                                                                          \
       -I .                                                                     \
@@ -74,6 +388,183 @@
       -c                                                                       \
       -o ./executeOneTrialConvertEcefToGeodetic.o                              \
          ./executeOneTrialConvertEcefToGeodetic.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./reportOneTrialConvertEcefToGeodetic.o                               \
+         ./reportOneTrialConvertEcefToGeodetic.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -pthread                                                                 \
+      -c                                                                       \
+      -o ./executeParallelTrialSweepConvertEcefToGeodetic.o                    \
+         ./executeParallelTrialSweepConvertEcefToGeodetic.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -pthread                                                                 \
+      -c                                                                       \
+      -o ./executeAccuracySweepConvertEcefToGeodetic.o                         \
+         ./executeAccuracySweepConvertEcefToGeodetic.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./reportAccuracySweepConvertEcefToGeodetic.o                          \
+         ./reportAccuracySweepConvertEcefToGeodetic.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./writeAccuracySweepHeatMap.o                                         \
+         ./writeAccuracySweepHeatMap.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./measureConversionTiming.o                                           \
+         ./measureConversionTiming.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./executeBatchTimingConvertEcefToGeodetic.o                           \
+         ./executeBatchTimingConvertEcefToGeodetic.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./executeIsaTimingConvertEcefToGeodetic.o                             \
+         ./executeIsaTimingConvertEcefToGeodetic.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./executeForwardTimingConvertGeodeticToEcef.o                         \
+         ./executeForwardTimingConvertGeodeticToEcef.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./executeGridTimingConvertGeodeticToEcef.o                            \
+         ./executeGridTimingConvertGeodeticToEcef.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./executeTrajectoryTimingConvertEcefToGeodetic.o                      \
+         ./executeTrajectoryTimingConvertEcefToGeodetic.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./executeAccuracyTierTimingConvertEcefToGeodetic.o                    \
+         ./executeAccuracyTierTimingConvertEcefToGeodetic.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./executeDirectionCosineTimingConvertEcefToGeodetic.o                 \
+         ./executeDirectionCosineTimingConvertEcefToGeodetic.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./executeOutputSelectionTimingConvertEcefToGeodetic.o                 \
+         ./executeOutputSelectionTimingConvertEcefToGeodetic.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./executeAltitudeBandTimingConvertEcefToGeodetic.o                    \
+         ./executeAltitudeBandTimingConvertEcefToGeodetic.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./executeEngineTimingConvertEcefToGeodetic.o                          \
+         ./executeEngineTimingConvertEcefToGeodetic.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./executeIterationTimingConvertEcefToGeodetic.o                       \
+         ./executeIterationTimingConvertEcefToGeodetic.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./executeSinglePrecisionTimingConvertEcefToGeodetic.o                 \
+         ./executeSinglePrecisionTimingConvertEcefToGeodetic.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./executeEllipsoidContextTimingConvertEcefToGeodetic.o                \
+         ./executeEllipsoidContextTimingConvertEcefToGeodetic.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./executeTemplateTimingConvertEcefToGeodetic.o                        \
+         ./executeTemplateTimingConvertEcefToGeodetic.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./executeInlineTimingConvertEcefToGeodetic.o                          \
+         ./executeInlineTimingConvertEcefToGeodetic.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./executeScalarCloneTimingConvertEcefToGeodetic.o                     \
+         ./executeScalarCloneTimingConvertEcefToGeodetic.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./executeValidityTimingConvertEcefToGeodetic.o                        \
+         ./executeValidityTimingConvertEcefToGeodetic.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./executeInterleavedTimingConvertEcefToGeodetic.o                     \
+         ./executeInterleavedTimingConvertEcefToGeodetic.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./executeParallelTimingConvertEcefToGeodetic.o                        \
+         ./executeParallelTimingConvertEcefToGeodetic.cpp
 #- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
   g++                                                                          \
       -I .                                                                     \
@@ -81,10 +572,18 @@
       -c                                                                       \
       -o ./testAndTimeConvertEcefToGeodeticMainProgram.o                       \
          ./testAndTimeConvertEcefToGeodeticMainProgram.cpp
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -c                                                                       \
+      -o ./sweepAccuracyConvertEcefToGeodeticMainProgram.o                     \
+         ./sweepAccuracyConvertEcefToGeodeticMainProgram.cpp
 #-------------------------------------------------------------------------------
   g++                                                                          \
       -I .                                                                     \
       -O2                                                                      \
+      -pthread                                                                 \
       -o ./testAndTimeConvertEcefToGeodetic                                    \
          ./testAndTimeConvertEcefToGeodeticMainProgram.o                       \
          ./generateTestProgramOutputHeader.o                                   \
@@ -94,8 +593,94 @@
          ./generateConvertGeodeticToEcefPurposeMessage.o                       \
          ./generateConvertGeodeticToEcefUsageMessage.o                         \
          ./convertEcefToGeodetic.o                                             \
+         ./reportConvertEcefToGeodeticStatus.o                                 \
+         ./reportConvertGeodeticToEcefStatus.o                                 \
+         ./initializeEarthEllipsoidContext.o                                   \
+         ./convertEcefToGeodeticWithEllipsoidContext.o                         \
+         ./convertEcefToGeodeticBatch.o                                        \
+         ./detectEcefToGeodeticIsaLevel.o                                      \
+         ./convertEcefToGeodeticBatchAvx2.o                                    \
+         ./convertEcefToGeodeticBatchAvx512.o                                  \
+         ./convertEcefToGeodeticParallelBatch.o                                \
+         ./convertGeodeticToEcef.o                                             \
+         ./convertBetweenEcefAndGeodeticX8664V3.o                              \
+         ./convertBetweenEcefAndGeodeticX8664V4.o                              \
+         ./convertGeodeticToEcefBatch.o                                        \
+         ./convertGeodeticToEcefBatchAvx2.o                                    \
+         ./convertGeodeticToEcefBatchAvx512.o                                  \
+         ./summarizeBatchValidityBits.o                                        \
+         ./convertEcefToGeodeticInterleavedBatch.o                             \
+         ./convertGeodeticGridToEcef.o                                         \
+         ./convertEcefToGeodeticTrajectory.o                                   \
+         ./convertEcefToGeodeticWithAccuracyTier.o                             \
+         ./convertEcefToGeodeticWithAccuracyTierAvx2.o                         \
+         ./convertEcefToGeodeticWithAccuracyTierAvx512.o                       \
+         ./convertEcefToGeodeticDirectionCosines.o                             \
+         ./convertEcefToGeodeticPartialOutputs.o                               \
+         ./cullEcefPointsToAltitudeBand.o                                      \
+         ./cullEcefPointsToAltitudeBandAvx2.o                                  \
+         ./cullEcefPointsToAltitudeBandAvx512.o                                \
+         ./convertEcefToGeodeticWithEngine.o                                   \
+         ./convertEcefToGeodeticIterated.o                                     \
+         ./convertBetweenEcefAndGeodeticWithSinglePrecision.o                  \
+         ./convertBetweenEcefAndGeodeticWithSinglePrecisionAvx2.o              \
+         ./convertBetweenEcefAndGeodeticWithSinglePrecisionAvx512.o            \
+         ./convertGeodeticToEcefWithEllipsoidContext.o                         \
+         ./executeOneTrialConvertEcefToGeodetic.o                              \
+         ./reportOneTrialConvertEcefToGeodetic.o                               \
+         ./executeParallelTrialSweepConvertEcefToGeodetic.o                    \
+         ./measureConversionTiming.o                                           \
+         ./executeBatchTimingConvertEcefToGeodetic.o                           \
+         ./executeIsaTimingConvertEcefToGeodetic.o                             \
+         ./executeForwardTimingConvertGeodeticToEcef.o                         \
+         ./executeGridTimingConvertGeodeticToEcef.o                            \
+         ./executeTrajectoryTimingConvertEcefToGeodetic.o                      \
+         ./executeAccuracyTierTimingConvertEcefToGeodetic.o                    \
+         ./executeDirectionCosineTimingConvertEcefToGeodetic.o                 \
+         ./executeOutputSelectionTimingConvertEcefToGeodetic.o                 \
+         ./executeAltitudeBandTimingConvertEcefToGeodetic.o                    \
+         ./executeEngineTimingConvertEcefToGeodetic.o                          \
+         ./executeIterationTimingConvertEcefToGeodetic.o                       \
+         ./executeSinglePrecisionTimingConvertEcefToGeodetic.o                 \
+         ./executeAccuracySweepConvertEcefToGeodetic.o                         \
+         ./executeEllipsoidContextTimingConvertEcefToGeodetic.o                \
+         ./executeTemplateTimingConvertEcefToGeodetic.o                        \
+         ./executeInlineTimingConvertEcefToGeodetic.o                          \
+         ./executeScalarCloneTimingConvertEcefToGeodetic.o                     \
+         ./executeValidityTimingConvertEcefToGeodetic.o                        \
+         ./executeInterleavedTimingConvertEcefToGeodetic.o                     \
+         ./executeParallelTimingConvertEcefToGeodetic.o
+#-------------------------------------------------------------------------------
+# The dense accuracy sweep tool.
+#- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  g++                                                                          \
+      -I .                                                                     \
+      -O2                                                                      \
+      -pthread                                                                 \
+      -o ./sweepAccuracyConvertEcefToGeodetic                                  \
+         ./sweepAccuracyConvertEcefToGeodeticMainProgram.o                     \
+         ./executeAccuracySweepConvertEcefToGeodetic.o                         \
+         ./reportAccuracySweepConvertEcefToGeodetic.o                          \
+         ./writeAccuracySweepHeatMap.o                                         \
+         ./convertEcefToGeodeticBatch.o                                        \
+         ./convertEcefToGeodeticWithEllipsoidContext.o                         \
+         ./convertEcefToGeodeticWithAccuracyTier.o                             \
+         ./convertEcefToGeodeticWithAccuracyTierAvx2.o                         \
+         ./convertEcefToGeodeticWithAccuracyTierAvx512.o                       \
+         ./convertEcefToGeodeticWithEngine.o                                   \
+         ./convertEcefToGeodeticIterated.o                                     \
+         ./convertBetweenEcefAndGeodeticWithSinglePrecision.o                  \
+         ./convertBetweenEcefAndGeodeticWithSinglePrecisionAvx2.o              \
+         ./convertBetweenEcefAndGeodeticWithSinglePrecisionAvx512.o            \
+         ./initializeEarthEllipsoidContext.o                                   \
+         ./detectEcefToGeodeticIsaLevel.o                                      \
+         ./convertEcefToGeodeticBatchAvx2.o                                    \
+         ./convertEcefToGeodeticBatchAvx512.o                                  \
+         ./summarizeBatchValidityBits.o                                        \
          ./convertGeodeticToEcef.o                                             \
-         ./executeOneTrialConvertEcefToGeodetic.o
+         ./convertBetweenEcefAndGeodeticX8664V3.o                              \
+         ./convertBetweenEcefAndGeodeticX8664V4.o                              \
+         ./convertGeodeticToEcefWithEllipsoidContext.o
 #-------------------------------------------------------------------------------
   /bin/rm -f ./*.o 2>&1 | /dev/null
 #-------------------------------------------------------------------------------
@@ -105,6 +690,7 @@
   echo "| Finished building Geodetic Conversion program."
   echo "|"
   echo "|    Program is:-->'./testAndTimeConvertEcefToGeodetic.exe'"
+  echo "|    Program is:-->'./sweepAccuracyConvertEcefToGeodetic'"
   echo "|"
   echo "------------------------------------------------------------------"
   echo ""
@@ -17,7 +17,205 @@
             SUCCESSFUL_CONVERSION,
             UNDETERMINED_CONVERSION_STATUS,
             INVALID_ELLIPSOIDAL_FLATTENING,
-            INVALID_EQUATORIAL_RADIUS
+            INVALID_EQUATORIAL_RADIUS,
+            INVALID_ECEF_COORDINATES,
+            INVALID_GEODETIC_ALTITUDE
+          };
+     //-------------------------------------------------------------------------
+        enum
+        ECEF_TO_GEODETIC_ISA_LEVEL
+          {
+            BASELINE_ISA_LEVEL,
+            AVX2_FMA_ISA_LEVEL,
+            AVX512_ISA_LEVEL
+          };
+     //-------------------------------------------------------------------------
+     //
+     //  TYPE:
+     //    ECEF_TO_GEODETIC_ACCURACY_TIER
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The accuracy requested of the accuracy tier overloads of
+     //    'convertEcefToGeodetic' and 'convertEcefToGeodeticBatch', and
+     //    the largest latitude and longitude error and altitude error of
+     //    each tier, for altitudes from -10 km to 50000 km:
+     //
+     //       DISPLAY_ACCURACY_TIER   about 1 meter       (map display)
+     //       SURVEY_ACCURACY_TIER    about 1 millimeter
+     //       FULL_ACCURACY_TIER      the default conversion
+     //
+     //    The angle bounds are 1 m and 1 mm on the Earth's surface.  The
+     //    full tier bounds are those of the single Halley step at 50000 km;
+     //    below 100 km its latitude error is about 1.0E-15 radians.
+     //
+     //-------------------------------------------------------------------------
+        enum
+        ECEF_TO_GEODETIC_ACCURACY_TIER
+          {
+            DISPLAY_ACCURACY_TIER,
+            SURVEY_ACCURACY_TIER,
+            FULL_ACCURACY_TIER
+          };
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        const double DISPLAY_ACCURACY_TIER_ANGLE_BOUND_RADIANS  = 1.5E-7;
+        const double DISPLAY_ACCURACY_TIER_ALTITUDE_BOUND_METERS = 1.0E0;
+        const double SURVEY_ACCURACY_TIER_ANGLE_BOUND_RADIANS   = 1.5E-10;
+        const double SURVEY_ACCURACY_TIER_ALTITUDE_BOUND_METERS  = 1.0E-3;
+        const double FULL_ACCURACY_TIER_ANGLE_BOUND_RADIANS     = 5.0E-11;
+        const double FULL_ACCURACY_TIER_ALTITUDE_BOUND_METERS    = 1.0E-7;
+     //-------------------------------------------------------------------------
+     //
+     //  TYPE:
+     //    ECEF_TO_GEODETIC_OUTPUT_SELECTION
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The outputs computed by the partial batch kernels, which skip the
+     //    arithmetic of the outputs that are not selected:
+     //
+     //       ALTITUDE_ONLY_OUTPUT       both arctangents
+     //       LATITUDE_LONGITUDE_OUTPUT  equation (20) of the altitude
+     //       LATITUDE_ONLY_OUTPUT       the longitude arctangent and
+     //                                  equation (20)
+     //
+     //-------------------------------------------------------------------------
+        enum
+        ECEF_TO_GEODETIC_OUTPUT_SELECTION
+          {
+            ALTITUDE_ONLY_OUTPUT,
+            LATITUDE_LONGITUDE_OUTPUT,
+            LATITUDE_ONLY_OUTPUT
+          };
+     //-------------------------------------------------------------------------
+     //
+     //  TYPE:
+     //    ECEF_TO_GEODETIC_ENGINE
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The conversion engines of the engine overloads of
+     //    'convertEcefToGeodetic' and 'convertEcefToGeodeticBatch':
+     //
+     //       FUKUSHIMA_HALLEY_ENGINE   Fukushima (2006), one Halley step,
+     //                                 the ellipsoid context conversion
+     //       OLSON_ENGINE              Olson (1996), series initial value
+     //                                 and one Newton step
+     //       BOWRING_ONE_ENGINE        Bowring (1976), one iteration
+     //       BOWRING_TWO_ENGINE        Bowring (1976), two iterations
+     //       VERMEILLE_ENGINE          Vermeille (2002), closed form
+     //       HEIKKINEN_ENGINE          Heikkinen (1982), closed form
+     //       FUKUSHIMA_NEWTON_ENGINE   Fukushima (1999), Newton iterations
+     //                                 of the quartic in t = tan( ( pi / 2
+     //                                 - psi ) / 2 ), until convergence
+     //       ITERATED_HALLEY_ENGINE    Fukushima (2006), Halley iterations
+     //                                 of the unnormalized sine and cosine,
+     //                                 until convergence
+     //
+     //    The last two engines are iterative.  The iterated overloads,
+     //    'convertEcefToGeodeticIterated' and
+     //    'convertEcefToGeodeticIteratedBatch', bound their number of
+     //    iterations and report the convergence of every point; the engine
+     //    overloads use ITERATED_ENGINE_DEFAULT_MAXIMUM_ITERATIONS.
+     //
+     //    ECEF_TO_GEODETIC_ENGINE_NAMES are the names of the reports, and
+     //    ECEF_TO_GEODETIC_ENGINE_KEYWORDS those of the command lines.
+     //
+     //-------------------------------------------------------------------------
+        enum
+        ECEF_TO_GEODETIC_ENGINE
+          {
+            FUKUSHIMA_HALLEY_ENGINE,
+            OLSON_ENGINE,
+            BOWRING_ONE_ENGINE,
+            BOWRING_TWO_ENGINE,
+            VERMEILLE_ENGINE,
+            HEIKKINEN_ENGINE,
+            FUKUSHIMA_NEWTON_ENGINE,
+            ITERATED_HALLEY_ENGINE
+          };
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        const int          NUMBER_ECEF_TO_GEODETIC_ENGINES = 8;
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        const char * const ECEF_TO_GEODETIC_ENGINE_NAMES
+                                 [ NUMBER_ECEF_TO_GEODETIC_ENGINES ] =
+                                 { "Fukushima 2006 Halley",
+                                   "Olson 1996",
+                                   "Bowring, 1 iteration",
+                                   "Bowring, 2 iterations",
+                                   "Vermeille 2002",
+                                   "Heikkinen 1982",
+                                   "Fukushima 1999 Newton",
+                                   "Fukushima 2006, iterated" };
+        const char * const ECEF_TO_GEODETIC_ENGINE_KEYWORDS
+                                 [ NUMBER_ECEF_TO_GEODETIC_ENGINES ] =
+                                 { "fukushima",
+                                   "olson",
+                                   "bowring1",
+                                   "bowring2",
+                                   "vermeille",
+                                   "heikkinen",
+                                   "newton",
+                                   "halley" };
+     //-------------------------------------------------------------------------
+     //
+     //  TYPE:
+     //    ECEF_TO_GEODETIC_CONVERGENCE_REPORT
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The convergence of one point of an iterative conversion engine:
+     //    the number of iterations done, the size of the latitude change
+     //    of the last one, and whether that change was within
+     //    ITERATED_ENGINE_CONVERGENCE_RADIANS before the maximum number of
+     //    iterations was reached.
+     //
+     //    A point of an engine which does not iterate, or one which is not
+     //    converted, reports no iterations, a latitude change which is not
+     //    a number, and no convergence.
+     //
+     //-------------------------------------------------------------------------
+        struct
+        ECEF_TO_GEODETIC_CONVERGENCE_REPORT
+          {
+            int    numberIterations;
+            double lastLatitudeCorrectionRadians;
+            bool   isConverged;
+          };
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        const int    ITERATED_ENGINE_DEFAULT_MAXIMUM_ITERATIONS = 8;
+        const double ITERATED_ENGINE_CONVERGENCE_RADIANS        = 1.0e-15;
+     //-------------------------------------------------------------------------
+     //
+     //  TYPE:
+     //    EARTH_ELLIPSOID_CONTEXT
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The validated parameters of a reference ellipsoid together with
+     //    every function of them used by the conversions.  It is built
+     //    once, by 'initializeEarthEllipsoidContext', and then passed to
+     //    the context overloads of the conversion functions, which do no
+     //    validation and no constant setup per point.
+     //
+     //-------------------------------------------------------------------------
+        struct
+        EARTH_ELLIPSOID_CONTEXT
+          {
+            double earthEquatorialRadiusMeters;           // a
+            double earthEllipsoidalFlatteningFactor;      // f
+            double earthEllipticitySquared;               // e^2 = ( 2 - f ) f
+            double oneAndHalf_e4;                         // 1.5 e^4
+            double complimentaryEarthEllipticitySquared;  // ec^2 = 1 - e^2
+            double complimentaryEarthEllipticity;         // ec
+            double earthPolarRadiusMeters;                // b = ec a
+            double inverseEarthEquatorialRadius;          // 1 / a
+            double aEpsSquared;                           // ( 1.0e-16 a )^2
           };
      //-------------------------------------------------------------------------
         void
@@ -43,6 +241,60 @@
      //-------------------------------------------------------------------------
      //
      //  FUNCTION:
+     //    reportConvertEcefToGeodeticStatus
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    Write the purpose, usage and error messages for a conversion
+     //    status returned by 'convertEcefToGeodetic', or by its batch and
+     //    context forms, to stdout.  Nothing is written for
+     //    SUCCESSFUL_CONVERSION.
+     //
+     //    The conversions themselves write no messages; this is the
+     //    optional reporting layer which a caller invokes explicitly.
+     //
+     //-------------------------------------------------------------------------
+        void
+        reportConvertEcefToGeodeticStatus
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                  conversionStatus,
+                    const double  earthEquatorialRadiusMeters,
+                    const double  earthEllipsoidalFlatteningFactor
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    reportConvertGeodeticToEcefStatus
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    Write the purpose, usage and error messages for a conversion
+     //    status returned by 'convertGeodeticToEcef', given the same
+     //    inputs, to stdout.  Nothing is written for SUCCESSFUL_CONVERSION.
+     //
+     //-------------------------------------------------------------------------
+        void
+        reportConvertGeodeticToEcefStatus
+               (
+                //----------------
+                // INPUT(s):
+                //----------------
+                   const ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                  conversionStatus,
+                   const double   earthEquatorialRadiusMeters,
+                   const double   earthEllipsoidalEccentricitySquared,
+                   const double   geodeticNorthLatitudeRadians,
+                   const double   geodeticAltitudeMeters
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
      //    convertEcefToGeodetic 
      //
      //-------------------------------------------------------------------------
@@ -116,6 +368,9 @@
      //        UNDETERMINED_CONVERSION_STATUS
      //        INVALID_ELLIPSOIDAL_FLATTENING
      //        INVALID_EQUATORIAL_REDIUS
+     //        INVALID_ECEF_COORDINATES  (a coordinate is NAN or infinite)
+     //
+     //     On failure the outputs are set to NAN.
      //
      //-------------------------------------------------------------------------
      //
@@ -130,6 +385,17 @@
      //    [ 3 ] The specified ellipsoidal flattening factor is (for the Earth)
      //          a value around 0.00335, (i.e. around 1/298).
      //
+     //    [ 4 ] No messages are written; see
+     //          'reportConvertEcefToGeodeticStatus'.
+     //
+     //    [ 5 ] At load time this function is bound to the widest x86-64
+     //          level clone which the host supports (see
+     //          'convertEcefToGeodeticBaselineClone'), so its results depend
+     //          on the host CPU:  the FMA contracted clones differ from the
+     //          baseline in the last bits.  Call
+     //          'convertEcefToGeodeticBaselineClone' for the same results on
+     //          every host.
+     //
      //-------------------------------------------------------------------------
      //
      //  AUTHOR(s):
@@ -204,257 +470,3600 @@
                );
      //-------------------------------------------------------------------------
      //
-     //
      //  FUNCTION:
-     //    convertGeodeticToEcef
+     //    initializeEarthEllipsoidContext
      //
      //-------------------------------------------------------------------------
      //
      //  PURPOSE:
-     //
-     //    Convert:
-     //      Geodetic   Latitude,
-     //      Geocentric Longitude
-     //      Geodetic   Altitude
-     //    to Earth Centered Earth Fixed (ECEF) rectangular coordinates.
+     //    Validate the parameters of a reference ellipsoid once, and
+     //    compute into an ellipsoid context every function of them which
+     //    the conversions use.
      //
      //-------------------------------------------------------------------------
      //
      //  INPUTS:
      //
      //     earthEquatorialRadiusMeters
-     //       Length of Earth equatorial radius
-     //       Also length of Earth ellipsoid semi-major axis.
-     //       UNITS:  [meters]
-     //
-     //     earthEllipsoidalEccentricitySquared
-     //       Earth ellipsoid eccentricity squared.
-     //       UNITS:  [nondimensional]
+     //     earthEllipsoidalFlatteningFactor
+     //       As for 'convertEcefToGeodetic'.
      //
-     //     geodeticNorthLatitudeRadians
-     //       The North geodetic latitude.
-     //       Northern hemisphere is positive.
-     //       UNITS:  [radians]
+     //-------------------------------------------------------------------------
      //
-     //     geocentricEastLongitudeRadians
-     //       The East Geocentric longitude.
-     //       Eastward is positive.
-     //       UNITS:  [radians]
+     //  OUTPUT:
      //
-     //     geodeticAltitudeMeters
-     //       The geodetic altitude above the specified reference ellipsoid.
-     //       UNITS:  [meters]
+     //     rEllipsoidContext
+     //       Reference to the ellipsoid context to initialize.  When the
+     //       parameters are invalid every member is set to NAN.
      //
      //-------------------------------------------------------------------------
      //
-     //  OUTPUT:
+     //  RETURNED VALUE:
      //
-     //     rXEcefMeters
-     //       Reference to a variable to contain the X ECEF position.
-     //       UNITS:  [meters]
+     //     Validation status:
+     //        SUCCESSFUL_CONVERSION
+     //        INVALID_ELLIPSOIDAL_FLATTENING
+     //        INVALID_EQUATORIAL_RADIUS
      //
-     //     rYEcefMeters
-     //       Reference to a variable to contain the Y ECEF position.
-     //       UNITS:  [meters]
+     //-------------------------------------------------------------------------
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        initializeEarthEllipsoidContext
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double  earthEquatorialRadiusMeters,
+                    const double  earthEllipsoidalFlatteningFactor,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          EARTH_ELLIPSOID_CONTEXT
+                                 &rEllipsoidContext
+               );
+     //-------------------------------------------------------------------------
      //
-     //     rZEcefMeters
-     //       Reference to a variable to contain the Z ECEF position.
-     //       UNITS:  [meters]
+     //  FUNCTION:
+     //    convertEcefToGeodetic  (ellipsoid context overload)
      //
      //-------------------------------------------------------------------------
      //
-     //  RETURNED VALUE:
-     //
-     //    None.
+     //  PURPOSE:
+     //    As 'convertEcefToGeodetic', for an ellipsoid context built by
+     //    'initializeEarthEllipsoidContext'.  Nothing about the ellipsoid
+     //    is validated or computed per call.
      //
      //-------------------------------------------------------------------------
      //
-     //  REFERENCE(s):
-     //
-     //     [ 1 ]  "Geographic coordinate conversion",
-     //            "Coordinate system conversion",
-     //            "From geodetic to ECEF coordinates"
-     //            https://en.wikipedia.org/wiki/
-     //            Geographic_coordinate_conversion
+     //  RETURNED VALUE:
      //
-     //     [ 2 ]  "Geometric Geodesy, Part A",
-     //            "A set of lecture notes which are an introduction to
-     //             ellipsoidal geometry related to geodesy.",
-     //            R. E. Deakin and M. N. Hunter,
-     //            School of Mathematical and Geospatial Sciences,
-     //            RMIT University,
-     //            Melbourne, Australia,
-     //            January 2013
-     //            www.mygeodesy.id.au/documents/Geometric%20Geodesy%20A
-     //            (2013).pdf
+     //     Conversion status:
+     //        SUCCESSFUL_CONVERSION
+     //        INVALID_ECEF_COORDINATES  (a coordinate is not finite; the
+     //                                   outputs are NaN, as for
+     //                                   'convertEcefToGeodeticBatch')
      //
      //-------------------------------------------------------------------------
-        void
-        convertGeodeticToEcef
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertEcefToGeodetic
                (
-                //----------------
-                // INPUT(s):
-                //----------------
-                   const double   earthEquatorialRadiusMeters,
-                   const double   earthEllipsoidalEccentricitySquared,
-                   const double   geodeticNorthLatitudeRadians,
-                   const double   geocentricEastLongitudeRadians,
-                   const double   geodeticAltitudeMeters,
-                //----------------
-                // OUTPUT(s):
-                //----------------
-                         double & rXEcefMeters,
-                         double & rYEcefMeters,
-                         double & rZEcefMeters
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 &rEllipsoidContext,
+                    const double  xEcefMeters,
+                    const double  yEcefMeters,
+                    const double  zEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double &rGeodeticNorthLatitudeRadians,
+                          double &rGeocentricEastLongitudeRadians,
+                          double &rGeodeticAltitudeMeters
                );
      //-------------------------------------------------------------------------
-     // 
+     //
      //  FUNCTION:
-     // 
-     //    executeOneTrialConvertEcefToGeodetic
-     // 
+     //    convertEcefToGeodeticBatch
+     //
      //-------------------------------------------------------------------------
-     // 
+     //
      //  PURPOSE:
-     // 
-     //    To perform one trial of converting Earth-Center Earth-Fixed (ECEF)
-     //    retangular coordinates to geodetic coordinates for a specified
-     //    reference ellipsoid.
-     // 
+     //    Convert a batch of Earth Centered Earth Fixed (ECEF) retangular
+     //    coordinates, stored as a structure of arrays, to geodetic
+     //    coordinates for a specified reference ellipsoid.
+     //
      //-------------------------------------------------------------------------
      //
-     //  INPUT(s):
+     //  METHOD:
+     //    [ 1 ] The ellipsoid parameters are validated and the functions of
+     //          the ellipsoid parameters are computed once per batch.
      //
-     //    specifiedFixedTrueGeocentricEastLongitudeDegrees
-     //      The specified fixed true geocentric east longitude.
-     //      UNIT(s):  [degrees]
+     //    [ 2 ] Each point is converted with the single Halley iteration of
+     //          'convertEcefToGeodetic', in a branch free loop body which
+     //          the compiler can auto-vectorize.
      //
      //-------------------------------------------------------------------------
      //
-     //  OUTPUT(s):
+     //  INPUTS:
      //
-     //    rExecutionTimeOfTrialFunctionCallsMicroSeconds
-     //      A reference to a variable which will contain the sum of the
-     //      execution times of each of the 'convertEcefToGeodetic'
-     //      function calls in the current timing trial.
-     //      UNIT(s):  [microseconds]
+     //     earthEquatorialRadiusMeters
+     //     earthEllipsoidalFlatteningFactor
+     //       As for 'convertEcefToGeodetic'.
      //
-     //    rMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs
-     //      A reference to a variable which will contain the maximum
-     //      geodetic north latitude absolute error over all
-     //      'convertEcefToGeodetic' function calls in the current
-     //      timing trial.
-     //      UNIT(s):  [microarcseconds]
+     //     numberPoints
+     //       Number of points in the batch.
      //
-     //    rMaximumGeodeticAltitudeAbsoluteErrorNanoMeters
-     //      A reference to a variable which will contain the maximum
-     //      geodetic altitude absolute error over all
-     //      'convertEcefToGeodetic' function calls in the current
-     //      timing trial.
-     //      UNIT(s):  [nanometers]
+     //     pXEcefMeters
+     //     pYEcefMeters
+     //     pZEcefMeters
+     //       Contiguous arrays of numberPoints geocentric rectangular
+     //       coordinates.
+     //       UNITS:  [meters]
      //
      //-------------------------------------------------------------------------
-     // 
-     //  A TRIAL CONSISTS OF:
-     // 
-     //    [ 1 ]  Performing the following 32 conversions.
-     // 
-     //    [ 2 ]  Converting ECEF rectangular coordinates at each 15
-     //           degrees of geodetic latitude along the specified
-     //           geocentric longitude meridian from the equator
-     //           to the north pole.
-     // 
-     //    [ 3 ]  At each latitude, perform the conversion at four
-     //           different geodetic altitudes.
-     // 
+     //
+     //  OUTPUT:
+     //
+     //     pGeodeticNorthLatitudeRadians
+     //     pGeocentricEastLongitudeRadians
+     //     pGeodeticAltitudeMeters
+     //       Contiguous arrays of numberPoints elements to contain the
+     //       estimated geodetic coordinates.
+     //       UNITS:  [radians], [radians], [meters]
+     //
+     //     pConversionStatus
+     //       Contiguous array of numberPoints elements to contain the
+     //       conversion status of each point.  A point with a coordinate
+     //       which is not finite has status INVALID_ECEF_COORDINATES and
+     //       NAN geodetic coordinates.
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  RETURNED VALUE:
+     //
+     //     Ellipsoid parameter validation status:
+     //        SUCCESSFUL_CONVERSION
+     //        INVALID_ELLIPSOIDAL_FLATTENING
+     //        INVALID_EQUATORIAL_RADIUS
+     //
+     //-------------------------------------------------------------------------
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertEcefToGeodeticBatch
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double   earthEquatorialRadiusMeters,
+                    const double   earthEllipsoidalFlatteningFactor,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pGeodeticNorthLatitudeRadians,
+                          double * pGeocentricEastLongitudeRadians,
+                          double * pGeodeticAltitudeMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    convertEcefToGeodeticBatch  (ellipsoid context overload)
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    As 'convertEcefToGeodeticBatch', for an ellipsoid context built
+     //    by 'initializeEarthEllipsoidContext'.  Every point status is
+     //    SUCCESSFUL_CONVERSION or INVALID_ECEF_COORDINATES.
+     //
+     //-------------------------------------------------------------------------
+        void
+        convertEcefToGeodeticBatch
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pGeodeticNorthLatitudeRadians,
+                          double * pGeocentricEastLongitudeRadians,
+                          double * pGeodeticAltitudeMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTIONS:
+     //    convertEcefToGeodetic       (accuracy tier overload)
+     //    convertEcefToGeodeticBatch  (accuracy tier overload)
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    As the ellipsoid context overloads, with the cheapest evaluation
+     //    which meets the error bounds of accuracyTier:  the Newton step
+     //    and a short polynomial atan2 for DISPLAY_ACCURACY_TIER, the
+     //    Halley step and a longer polynomial atan2 for
+     //    SURVEY_ACCURACY_TIER, and the ellipsoid context conversion
+     //    itself for FULL_ACCURACY_TIER.
+     //
+     //-------------------------------------------------------------------------
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertEcefToGeodetic
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 &rEllipsoidContext,
+                    const ECEF_TO_GEODETIC_ACCURACY_TIER
+                                  accuracyTier,
+                    const double  xEcefMeters,
+                    const double  yEcefMeters,
+                    const double  zEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double &rEstimatedGeodeticNorthLatitudeRadians,
+                          double &rEstimatedGeocentricEastLongitudeRadians,
+                          double &rEstimatedGeodeticAltitudeMeters
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        void
+        convertEcefToGeodeticBatch
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const ECEF_TO_GEODETIC_ACCURACY_TIER
+                                   accuracyTier,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pGeodeticNorthLatitudeRadians,
+                          double * pGeocentricEastLongitudeRadians,
+                          double * pGeodeticAltitudeMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTIONS:
+     //    convertEcefToGeodeticBatchInSinglePrecision
+     //    convertGeodeticToEcefBatchInSinglePrecision
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    As the ellipsoid context overload of 'convertEcefToGeodeticBatch'
+     //    and as 'convertGeodeticToEcefBatch', with the angle arithmetic,
+     //    the Halley step and atan2 of the inverse conversion and the sines
+     //    and cosines of the forward conversion, in float, for twice the
+     //    SIMD lanes of the double kernels.  The inputs and outputs are
+     //    double and the lengths are evaluated in double, so the altitude
+     //    keeps micrometer accuracy; the angles have the error bounds
+     //    below.
+     //
+     //    The bounds are the largest errors of the dense accuracy sweep,
+     //    'sweepAccuracyConvertEcefToGeodetic' with the "float" kernel,
+     //    for altitudes from -10 km to 50000 km (1.39e-7 radians, 28.6
+     //    milliarcseconds, of latitude and 1.24e-6 m of altitude), and,
+     //    for the forward conversion, of
+     //    'executeSinglePrecisionTimingConvertEcefToGeodetic' for altitudes
+     //    from -10 km to 2000 km (0.90 m), rounded up.  Coordinates beyond
+     //    SINGLE_PRECISION_RANGE_LIMIT_METERS, where the squared direction
+     //    of the normal could overflow float, are converted in double.
+     //
+     //-------------------------------------------------------------------------
+        const double SINGLE_PRECISION_ANGLE_BOUND_RADIANS    = 2.0E-7;
+        const double SINGLE_PRECISION_ALTITUDE_BOUND_METERS  = 2.0E-6;
+        const double SINGLE_PRECISION_FORWARD_BOUND_METERS   = 1.5E0;
+        const double SINGLE_PRECISION_RANGE_LIMIT_METERS     = 5.0E8;
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        void
+        convertEcefToGeodeticBatchInSinglePrecision
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pGeodeticNorthLatitudeRadians,
+                          double * pGeocentricEastLongitudeRadians,
+                          double * pGeodeticAltitudeMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertGeodeticToEcefBatchInSinglePrecision
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const double * pGeodeticNorthLatitudeRadians,
+                    const double * pGeocentricEastLongitudeRadians,
+                    const double * pGeodeticAltitudeMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pXEcefMeters,
+                          double * pYEcefMeters,
+                          double * pZEcefMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTIONS:
+     //    convertEcefToGeodetic       (engine overload)
+     //    convertEcefToGeodeticBatch  (engine overload)
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    As the ellipsoid context overloads, with the conversion engine
+     //    selected by the caller, so that the engines can be compared on
+     //    the same points.  FUKUSHIMA_HALLEY_ENGINE is the ellipsoid
+     //    context conversion itself.  The closed forms and the engines of
+     //    fixed steps return INVALID_ECEF_COORDINATES for a point within
+     //    about 43 km of the Earth's center, around the evolute of the
+     //    ellipsoid, where the closed forms are not defined and the
+     //    iterations may not find the nearest foot point.  The iterative
+     //    engines are as 'convertEcefToGeodeticIterated'.  Every engine
+     //    returns INVALID_ECEF_COORDINATES, with NaN outputs, for a
+     //    coordinate which is not finite.
+     //
+     //-------------------------------------------------------------------------
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertEcefToGeodetic
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 &rEllipsoidContext,
+                    const ECEF_TO_GEODETIC_ENGINE
+                                  conversionEngine,
+                    const double  xEcefMeters,
+                    const double  yEcefMeters,
+                    const double  zEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double &rEstimatedGeodeticNorthLatitudeRadians,
+                          double &rEstimatedGeocentricEastLongitudeRadians,
+                          double &rEstimatedGeodeticAltitudeMeters
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        void
+        convertEcefToGeodeticBatch
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const ECEF_TO_GEODETIC_ENGINE
+                                   conversionEngine,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pGeodeticNorthLatitudeRadians,
+                          double * pGeocentricEastLongitudeRadians,
+                          double * pGeodeticAltitudeMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTIONS:
+     //    convertEcefToGeodeticIterated
+     //    convertEcefToGeodeticIteratedBatch
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    As the engine overloads, with at most maximumNumberIterations
+     //    iterations of FUKUSHIMA_NEWTON_ENGINE or ITERATED_HALLEY_ENGINE
+     //    per point, and the convergence of every point reported, so that
+     //    the time per point can be measured against the accuracy.  An
+     //    iteration stops early once its latitude change is within
+     //    ITERATED_ENGINE_CONVERGENCE_RADIANS.  A maximumNumberIterations
+     //    less than one is taken as one.
+     //
+     //    Both engines convert every finite point, and the Earth's center
+     //    to the north pole at altitude -b.  Within the evolute of the
+     //    ellipsoid, about 43 km from the center, there are several foot
+     //    points, and the iterations may converge to one which is not the
+     //    nearest, or not converge, which the report shows.  The steps of
+     //    ITERATED_HALLEY_ENGINE are kept in the quadrant of the point, so
+     //    that its latitude is within [ -pi/2, pi/2 ] there too.  The other
+     //    engines are converted as by the engine overloads and report no
+     //    iterations.
+     //
+     //    pConvergenceReports may be NULL when the reports are not needed.
+     //
+     //-------------------------------------------------------------------------
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertEcefToGeodeticIterated
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 &rEllipsoidContext,
+                    const ECEF_TO_GEODETIC_ENGINE
+                                  conversionEngine,
+                    const int     maximumNumberIterations,
+                    const double  xEcefMeters,
+                    const double  yEcefMeters,
+                    const double  zEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double &rEstimatedGeodeticNorthLatitudeRadians,
+                          double &rEstimatedGeocentricEastLongitudeRadians,
+                          double &rEstimatedGeodeticAltitudeMeters,
+                          ECEF_TO_GEODETIC_CONVERGENCE_REPORT
+                                 &rConvergenceReport
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        void
+        convertEcefToGeodeticIteratedBatch
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const ECEF_TO_GEODETIC_ENGINE
+                                   conversionEngine,
+                    const int      maximumNumberIterations,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pGeodeticNorthLatitudeRadians,
+                          double * pGeocentricEastLongitudeRadians,
+                          double * pGeodeticAltitudeMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus,
+                          ECEF_TO_GEODETIC_CONVERGENCE_REPORT
+                                 * pConvergenceReports
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION(s):
+     //    convertEcefToGeodeticDirectionCosines
+     //    convertEcefToGeodeticDirectionCosinesBatch
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    As the ellipsoid context 'convertEcefToGeodetic' and
+     //    'convertEcefToGeodeticBatch', returning the sine and cosine of
+     //    the geodetic latitude and of the longitude in place of the
+     //    angles.  They come from the normalized Halley direction and from
+     //    ( x, y ) / p, so no atan2, sin or cos is called.
+     //
+     //-------------------------------------------------------------------------
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertEcefToGeodeticDirectionCosines
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 &rEllipsoidContext,
+                    const double  xEcefMeters,
+                    const double  yEcefMeters,
+                    const double  zEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double &rSineOfGeodeticNorthLatitude,
+                          double &rCosineOfGeodeticNorthLatitude,
+                          double &rSineOfGeocentricEastLongitude,
+                          double &rCosineOfGeocentricEastLongitude,
+                          double &rEstimatedGeodeticAltitudeMeters
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        void
+        convertEcefToGeodeticDirectionCosinesBatch
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pSineOfGeodeticNorthLatitude,
+                          double * pCosineOfGeodeticNorthLatitude,
+                          double * pSineOfGeocentricEastLongitude,
+                          double * pCosineOfGeocentricEastLongitude,
+                          double * pEstimatedGeodeticAltitudeMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION(s):
+     //    convertEcefToGeodeticAltitude
+     //    convertEcefToGeodeticLatitudeLongitude
+     //    convertEcefToGeodeticLatitude
+     //    convertEcefToGeodeticAltitudeBatch
+     //    convertEcefToGeodeticLatitudeLongitudeBatch
+     //    convertEcefToGeodeticLatitudeBatch
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    As the ellipsoid context 'convertEcefToGeodetic' and
+     //    'convertEcefToGeodeticBatch', for the altitude only, for the
+     //    latitude and longitude only, or for the latitude only.  The work
+     //    of the other outputs is skipped, and the outputs computed are
+     //    identical to those of the full conversions.
+     //
+     //-------------------------------------------------------------------------
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertEcefToGeodeticAltitude
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 &rEllipsoidContext,
+                    const double  xEcefMeters,
+                    const double  yEcefMeters,
+                    const double  zEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double &rEstimatedGeodeticAltitudeMeters
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertEcefToGeodeticLatitudeLongitude
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 &rEllipsoidContext,
+                    const double  xEcefMeters,
+                    const double  yEcefMeters,
+                    const double  zEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double &rEstimatedGeodeticNorthLatitudeRadians,
+                          double &rEstimatedGeocentricEastLongitudeRadians
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertEcefToGeodeticLatitude
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 &rEllipsoidContext,
+                    const double  xEcefMeters,
+                    const double  yEcefMeters,
+                    const double  zEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double &rEstimatedGeodeticNorthLatitudeRadians
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        void
+        convertEcefToGeodeticAltitudeBatch
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pEstimatedGeodeticAltitudeMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        void
+        convertEcefToGeodeticLatitudeLongitudeBatch
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pEstimatedGeodeticNorthLatitudeRadians,
+                          double * pEstimatedGeocentricEastLongitudeRadians,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        void
+        convertEcefToGeodeticLatitudeBatch
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pEstimatedGeodeticNorthLatitudeRadians,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  TYPE:
+     //    ALTITUDE_BAND_BOUNDS
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The bounding ellipsoids of the surfaces of constant geodetic
+     //    altitude at the edges of an altitude band, as inverse squared
+     //    semi-axes, and the widened bounds which the values of their
+     //    quadratic forms are tested against.  A point inside the inner
+     //    ellipsoid of an edge is below it, and a point outside the outer
+     //    ellipsoid is above it.
+     //
+     //-------------------------------------------------------------------------
+        struct
+        ALTITUDE_BAND_BOUNDS
+          {
+            double minimumAltitudeMeters;
+            double maximumAltitudeMeters;
+            double minimumInnerInverseASquared;
+            double minimumOuterInverseASquared;
+            double minimumInverseBSquared;
+            double maximumInnerInverseASquared;
+            double maximumOuterInverseASquared;
+            double maximumInverseBSquared;
+            double lowerTestBound;                        // 1 - margin
+            double upperTestBound;                        // 1 + margin
+          };
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION(s):
+     //    cullEcefPointsToAltitudeBand
+     //    cullEcefPointsToAltitudeBandIndices
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    Find the points of a batch whose geodetic altitude lies in the
+     //    band [ minimumGeodeticAltitudeMeters,
+     //    maximumGeodeticAltitudeMeters ], as a bit mask, bit i % 64 of
+     //    word i / 64 for point i, or as the increasing indices of the
+     //    points in the band.  Most points are decided by bounding
+     //    ellipsoid tests, and the rest by the altitude of
+     //    'convertEcefToGeodeticAltitude', so that the selection is that
+     //    of the altitude of 'convertEcefToGeodetic'.  A minimum altitude
+     //    at or below -b^2 / a, -INFINITY included, leaves the band open
+     //    below.  Returns INVALID_GEODETIC_ALTITUDE, and writes no output,
+     //    when an altitude is NAN or the maximum is below the minimum.
+     //
+     //-------------------------------------------------------------------------
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        cullEcefPointsToAltitudeBand
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const double   minimumGeodeticAltitudeMeters,
+                    const double   maximumGeodeticAltitudeMeters,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          unsigned long long
+                                 * pInBandBits,
+                          size_t & rNumberInBandPoints,
+                          size_t & rNumberRefinedPoints
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        cullEcefPointsToAltitudeBandIndices
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const double   minimumGeodeticAltitudeMeters,
+                    const double   maximumGeodeticAltitudeMeters,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          size_t * pInBandIndices,
+                          size_t & rNumberInBandPoints,
+                          size_t & rNumberRefinedPoints
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION(s):
+     //    classifyAltitudeBandBlockAvx2Kernel
+     //    classifyAltitudeBandBlockAvx512Kernel
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The explicit SIMD bounding ellipsoid tests of
+     //    'cullEcefPointsToAltitudeBand', for a block of at most 64
+     //    points.  Bit k of rInBandBits is set when point k is inside the
+     //    band by the bounds, and bit k of rUndecidedBits when the bounds
+     //    decide nothing about point k.  Only call a kernel when
+     //    'detectEcefToGeodeticIsaLevel' reports its level or above.
+     //
+     //-------------------------------------------------------------------------
+        void
+        classifyAltitudeBandBlockAvx2Kernel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const ALTITUDE_BAND_BOUNDS
+                                 & rBounds,
+                    const size_t   blockPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          unsigned long long
+                                 & rInBandBits,
+                          unsigned long long
+                                 & rUndecidedBits
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        void
+        classifyAltitudeBandBlockAvx512Kernel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const ALTITUDE_BAND_BOUNDS
+                                 & rBounds,
+                    const size_t   blockPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          unsigned long long
+                                 & rInBandBits,
+                          unsigned long long
+                                 & rUndecidedBits
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  TYPE:
+     //    ECEF_TO_GEODETIC_THREAD_POOL
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    An opaque work-stealing thread pool for
+     //    'convertEcefToGeodeticParallelBatch'.
+     //
+     //-------------------------------------------------------------------------
+        struct
+        ECEF_TO_GEODETIC_THREAD_POOL;
+     //-------------------------------------------------------------------------
+     // Default chunk size of 'convertEcefToGeodeticParallelBatch': the three
+     // input and four output arrays of a chunk, 208 kilobytes, stay in a
+     // per core level 2 cache.
+     //-------------------------------------------------------------------------
+        const
+        size_t
+         DEFAULT_ECEF_TO_GEODETIC_CHUNK_POINTS = 4096;
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    createEcefToGeodeticThreadPool
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    Create a pool of numberThreads workers, the calling thread of each
+     //    batch being one of them.  Zero selects the number of hardware
+     //    threads.  Release with 'destroyEcefToGeodeticThreadPool'.
+     //
+     //-------------------------------------------------------------------------
+        ECEF_TO_GEODETIC_THREAD_POOL *
+        createEcefToGeodeticThreadPool
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const size_t   numberThreads
+               );
+     //-------------------------------------------------------------------------
+        void
+        destroyEcefToGeodeticThreadPool
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    ECEF_TO_GEODETIC_THREAD_POOL
+                                 * pThreadPool
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    convertEcefToGeodeticParallelBatch
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    As the context overload of 'convertEcefToGeodeticBatch', with the
+     //    batch split into chunks of chunkSizePoints points (zero selects
+     //    DEFAULT_ECEF_TO_GEODETIC_CHUNK_POINTS) which the workers of the
+     //    pool convert with the vectorized kernel, stealing chunks from
+     //    each other to balance the load.  The results are identical to
+     //    those of a single threaded batch.
+     //
+     //-------------------------------------------------------------------------
+        void
+        convertEcefToGeodeticParallelBatch
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    ECEF_TO_GEODETIC_THREAD_POOL
+                                 & rThreadPool,
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   chunkSizePoints,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pGeodeticNorthLatitudeRadians,
+                          double * pGeocentricEastLongitudeRadians,
+                          double * pGeodeticAltitudeMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    detectEcefToGeodeticIsaLevel
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    Determine, with CPUID and XGETBV, the widest batch conversion
+     //    kernel instruction set level which the processor and operating
+     //    system support.  'convertEcefToGeodeticBatch' calls it once, at
+     //    program startup, to select its kernel.
+     //
+     //-------------------------------------------------------------------------
+        ECEF_TO_GEODETIC_ISA_LEVEL
+        detectEcefToGeodeticIsaLevel(  );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    detectEcefToGeodeticScalarCloneLevel
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    Determine the widest x86-64 micro-architecture level clone of the
+     //    scalar conversions which the processor and operating system
+     //    support:  AVX512_ISA_LEVEL for x86-64-v4, AVX2_FMA_ISA_LEVEL for
+     //    x86-64-v3, otherwise BASELINE_ISA_LEVEL.  The load time resolvers
+     //    of 'convertEcefToGeodetic' and 'convertGeodeticToEcef' make the
+     //    same tests inline.
+     //
+     //-------------------------------------------------------------------------
+        ECEF_TO_GEODETIC_ISA_LEVEL
+        detectEcefToGeodeticScalarCloneLevel(  );
+     //-------------------------------------------------------------------------
+     //
+     //  TYPE(s):
+     //    CONVERT_ECEF_TO_GEODETIC_FUNCTION
+     //    CONVERT_GEODETIC_TO_ECEF_FUNCTION
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The signatures of 'convertEcefToGeodetic' and
+     //    'convertGeodeticToEcef' and of their clones, returned by the load
+     //    time resolvers.
+     //
+     //-------------------------------------------------------------------------
+        typedef
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        ( * CONVERT_ECEF_TO_GEODETIC_FUNCTION )
+               (
+                 const double  earthEquatorialRadiusMeters,
+                 const double  ellipsoidalFlatteningFactor,
+                 const double  xEcefMeters,
+                 const double  yEcefMeters,
+                 const double  zEcefMeters,
+                       double &rGeodeticNorthLatitudeRadians,
+                       double &rGeocentricEastLongitudeRadians,
+                       double &rGeodeticAltitudeMeters
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        typedef
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        ( * CONVERT_GEODETIC_TO_ECEF_FUNCTION )
+               (
+                 const double   earthEquatorialRadiusMeters,
+                 const double   earthEllipsoidalEccentricitySquared,
+                 const double   geodeticNorthLatitudeRadians,
+                 const double   geocentricEastLongitudeRadians,
+                 const double   geodeticAltitudeMeters,
+                       double & rXEcefMeters,
+                       double & rYEcefMeters,
+                       double & rZEcefMeters
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION(s):
+     //    convertEcefToGeodeticBaselineClone
+     //    convertEcefToGeodeticX8664V3Clone
+     //    convertEcefToGeodeticX8664V4Clone
+     //    convertGeodeticToEcefBaselineClone
+     //    convertGeodeticToEcefX8664V3Clone
+     //    convertGeodeticToEcefX8664V4Clone
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The clones of 'convertEcefToGeodetic' and 'convertGeodeticToEcef'
+     //    compiled for the x86-64 baseline, x86-64-v3 and x86-64-v4.  At
+     //    load time each of the two entry points is bound to the widest
+     //    clone which 'detectEcefToGeodeticScalarCloneLevel' reports, so
+     //    existing callers get the FMA contracted clones on hosts which
+     //    support them.  Only call a clone when that level or above is
+     //    reported.
+     //
+     //-------------------------------------------------------------------------
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertEcefToGeodeticBaselineClone
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double  earthEquatorialRadiusMeters,
+                    const double  ellipsoidalFlatteningFactor,
+                    const double  xEcefMeters,
+                    const double  yEcefMeters,
+                    const double  zEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double &rGeodeticNorthLatitudeRadians,
+                          double &rGeocentricEastLongitudeRadians,
+                          double &rGeodeticAltitudeMeters
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertEcefToGeodeticX8664V3Clone
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double  earthEquatorialRadiusMeters,
+                    const double  ellipsoidalFlatteningFactor,
+                    const double  xEcefMeters,
+                    const double  yEcefMeters,
+                    const double  zEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double &rGeodeticNorthLatitudeRadians,
+                          double &rGeocentricEastLongitudeRadians,
+                          double &rGeodeticAltitudeMeters
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertEcefToGeodeticX8664V4Clone
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double  earthEquatorialRadiusMeters,
+                    const double  ellipsoidalFlatteningFactor,
+                    const double  xEcefMeters,
+                    const double  yEcefMeters,
+                    const double  zEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double &rGeodeticNorthLatitudeRadians,
+                          double &rGeocentricEastLongitudeRadians,
+                          double &rGeodeticAltitudeMeters
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertGeodeticToEcefBaselineClone
+               (
+                //----------------
+                // INPUT(s):
+                //----------------
+                   const double   earthEquatorialRadiusMeters,
+                   const double   earthEllipsoidalEccentricitySquared,
+                   const double   geodeticNorthLatitudeRadians,
+                   const double   geocentricEastLongitudeRadians,
+                   const double   geodeticAltitudeMeters,
+                //----------------
+                // OUTPUT(s):
+                //----------------
+                         double & rXEcefMeters,
+                         double & rYEcefMeters,
+                         double & rZEcefMeters
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertGeodeticToEcefX8664V3Clone
+               (
+                //----------------
+                // INPUT(s):
+                //----------------
+                   const double   earthEquatorialRadiusMeters,
+                   const double   earthEllipsoidalEccentricitySquared,
+                   const double   geodeticNorthLatitudeRadians,
+                   const double   geocentricEastLongitudeRadians,
+                   const double   geodeticAltitudeMeters,
+                //----------------
+                // OUTPUT(s):
+                //----------------
+                         double & rXEcefMeters,
+                         double & rYEcefMeters,
+                         double & rZEcefMeters
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertGeodeticToEcefX8664V4Clone
+               (
+                //----------------
+                // INPUT(s):
+                //----------------
+                   const double   earthEquatorialRadiusMeters,
+                   const double   earthEllipsoidalEccentricitySquared,
+                   const double   geodeticNorthLatitudeRadians,
+                   const double   geocentricEastLongitudeRadians,
+                   const double   geodeticAltitudeMeters,
+                //----------------
+                // OUTPUT(s):
+                //----------------
+                         double & rXEcefMeters,
+                         double & rYEcefMeters,
+                         double & rZEcefMeters
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    convertEcefToGeodeticBatchForIsaLevel
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    As the ellipsoid context overload of 'convertEcefToGeodeticBatch',
+     //    but with the batch kernel selected by the caller instead of by
+     //    the startup CPU detection:
+     //
+     //       BASELINE_ISA_LEVEL   The auto-vectorized SSE2 chunk loop.
+     //       AVX2_FMA_ISA_LEVEL   The four lane AVX2 and FMA kernel.
+     //       AVX512_ISA_LEVEL     The eight lane AVX-512 kernel.
+     //
+     //    The caller must not request a level above the one reported by
+     //    'detectEcefToGeodeticIsaLevel'.
+     //
+     //-------------------------------------------------------------------------
+        void
+        convertEcefToGeodeticBatchForIsaLevel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const ECEF_TO_GEODETIC_ISA_LEVEL
+                                   isaLevel,
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pGeodeticNorthLatitudeRadians,
+                          double * pGeocentricEastLongitudeRadians,
+                          double * pGeodeticAltitudeMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION(s):
+     //    convertEcefToGeodeticBatchAvx2Kernel
+     //    convertEcefToGeodeticBatchAvx512Kernel
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The explicit SIMD kernels of 'convertEcefToGeodeticBatch', for an
+     //    ellipsoid context built by 'initializeEarthEllipsoidContext'.
+     //    Only call a kernel when 'detectEcefToGeodeticIsaLevel' reports
+     //    its level or above.
+     //
+     //-------------------------------------------------------------------------
+        void
+        convertEcefToGeodeticBatchAvx2Kernel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pGeodeticNorthLatitudeRadians,
+                          double * pGeocentricEastLongitudeRadians,
+                          double * pGeodeticAltitudeMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+        void
+        convertEcefToGeodeticBatchAvx512Kernel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pGeodeticNorthLatitudeRadians,
+                          double * pGeocentricEastLongitudeRadians,
+                          double * pGeodeticAltitudeMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  TYPE:
+     //    ECEF_TO_GEODETIC_BATCH_VALIDITY
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The summary counts of a batch conversion with validity bits:  the
+     //    points converted, the points not converted, and, of these, the
+     //    points with an input coordinate which is NAN or infinite, such
+     //    as the sentinel of a missing fix.
+     //
+     //-------------------------------------------------------------------------
+        struct
+        ECEF_TO_GEODETIC_BATCH_VALIDITY
+          {
+            size_t numberValidPoints;
+            size_t numberInvalidPoints;
+            size_t numberNotFinitePoints;
+          };
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    summarizeBatchValidityBits
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    Count the set and clear validity bits of a batch of numberPoints
+     //    points, and, of the clear ones, the points with an input
+     //    coordinate of pInput0, pInput1 or pInput2 which is not finite.
+     //
+     //-------------------------------------------------------------------------
+        void
+        summarizeBatchValidityBits
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const size_t   numberPoints,
+                    const double * pInput0,
+                    const double * pInput1,
+                    const double * pInput2,
+                    const unsigned long long
+                                 * pValidBits,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          ECEF_TO_GEODETIC_BATCH_VALIDITY
+                                 & rBatchValidity
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    convertEcefToGeodeticBatchWithValidityBits
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    As the ellipsoid context overload of 'convertEcefToGeodeticBatch',
+     //    with a validity bit per point, bit i % 64 of word i / 64 of
+     //    pValidBits for point i, instead of a status per point, and the
+     //    summary counts of the batch.  pValidBits must have
+     //    ( numberPoints + 63 ) / 64 words.  A point with a coordinate
+     //    which is NAN or infinite has NAN outputs and a clear bit, and
+     //    costs the same as any other.
+     //
+     //-------------------------------------------------------------------------
+        void
+        convertEcefToGeodeticBatchWithValidityBits
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pEstimatedGeodeticNorthLatitudeRadians,
+                          double * pEstimatedGeocentricEastLongitudeRadians,
+                          double * pEstimatedGeodeticAltitudeMeters,
+                          unsigned long long
+                                 * pValidBits,
+                          ECEF_TO_GEODETIC_BATCH_VALIDITY
+                                 & rBatchValidity
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION(s):
+     //    convertEcefToGeodeticBatchValidityBitsAvx2Kernel
+     //    convertEcefToGeodeticBatchValidityBitsAvx512Kernel
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The explicit SIMD kernels of
+     //    'convertEcefToGeodeticBatchWithValidityBits', which store the
+     //    validity bits only.  Only call a kernel when
+     //    'detectEcefToGeodeticIsaLevel' reports its level or above.
+     //
+     //-------------------------------------------------------------------------
+        void
+        convertEcefToGeodeticBatchValidityBitsAvx2Kernel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pGeodeticNorthLatitudeRadians,
+                          double * pGeocentricEastLongitudeRadians,
+                          double * pGeodeticAltitudeMeters,
+                          unsigned long long
+                                 * pValidBits
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        void
+        convertEcefToGeodeticBatchValidityBitsAvx512Kernel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pGeodeticNorthLatitudeRadians,
+                          double * pGeocentricEastLongitudeRadians,
+                          double * pGeodeticAltitudeMeters,
+                          unsigned long long
+                                 * pValidBits
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION(s):
+     //    convertEcefToGeodeticInterleavedBatch
+     //    convertEcefToGeodeticInterleavedBatchAvx2Kernel
+     //    convertEcefToGeodeticInterleavedBatchAvx512Kernel
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    As the ellipsoid context overload of 'convertEcefToGeodeticBatch',
+     //    for points stored as records of interleaved x, y and z doubles,
+     //    inputStrideBytes apart, and with the latitude, longitude and
+     //    altitude written as interleaved records outputStrideBytes apart.
+     //    A stride of 3 * sizeof( double ) is a packed array of triples; a
+     //    larger one skips the payload fields of a record.  The strides
+     //    must be multiples of sizeof( double ).  The output records may be
+     //    the input records, with equal strides, but must not otherwise
+     //    overlap them.  The points are deinterleaved in registers, never
+     //    copied to coordinate arrays.  Only call a kernel when
+     //    'detectEcefToGeodeticIsaLevel' reports its level or above.
+     //
+     //-------------------------------------------------------------------------
+        void
+        convertEcefToGeodeticInterleavedBatch
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const double * pXyzEcefMeters,
+                    const size_t   inputStrideBytes,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pEstimatedLatitudeLongitudeAltitude,
+                    const size_t   outputStrideBytes,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        void
+        convertEcefToGeodeticInterleavedBatchAvx2Kernel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const double * pXyzEcefMeters,
+                    const size_t   inputStrideBytes,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pLatitudeLongitudeAltitude,
+                    const size_t   outputStrideBytes,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        void
+        convertEcefToGeodeticInterleavedBatchAvx512Kernel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const double * pXyzEcefMeters,
+                    const size_t   inputStrideBytes,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pLatitudeLongitudeAltitude,
+                    const size_t   outputStrideBytes,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION(s):
+     //    convertEcefToGeodeticBlockInterleavedBatch
+     //    convertEcefToGeodeticBlockInterleavedBatchAvx2Kernel
+     //    convertEcefToGeodeticBlockInterleavedBatchAvx512Kernel
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    As the ellipsoid context overload of 'convertEcefToGeodeticBatch',
+     //    for points stored as blocks of blockPoints x, then blockPoints y,
+     //    then blockPoints z doubles, and with the latitudes, longitudes
+     //    and altitudes written as blocks of the same shape.  The last
+     //    block may be partial; only its first numberPoints % blockPoints
+     //    places of each coordinate are referenced.  The output blocks may
+     //    be the input blocks.  The AVX2 kernel needs blockPoints to be a
+     //    multiple of 4 and the AVX-512 kernel a multiple of 8; only call
+     //    a kernel when 'detectEcefToGeodeticIsaLevel' reports its level
+     //    or above.
+     //
+     //-------------------------------------------------------------------------
+        void
+        convertEcefToGeodeticBlockInterleavedBatch
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const size_t   blockPoints,
+                    const double * pXyzEcefMeterBlocks,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pEstimatedLatitudeLongitudeAltitudeBlocks,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        void
+        convertEcefToGeodeticBlockInterleavedBatchAvx2Kernel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const size_t   blockPoints,
+                    const double * pXyzEcefMeterBlocks,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pLatitudeLongitudeAltitudeBlocks,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        void
+        convertEcefToGeodeticBlockInterleavedBatchAvx512Kernel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const size_t   blockPoints,
+                    const double * pXyzEcefMeterBlocks,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pLatitudeLongitudeAltitudeBlocks,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION(s):
+     //    convertEcefToGeodeticBatchForAccuracyTierAvx2Kernel
+     //    convertEcefToGeodeticBatchForAccuracyTierAvx512Kernel
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The display and survey tier kernels of the accuracy tier
+     //    overload of 'convertEcefToGeodeticBatch'.  Only call a kernel
+     //    when 'detectEcefToGeodeticIsaLevel' reports its level or above.
+     //
+     //-------------------------------------------------------------------------
+        void
+        convertEcefToGeodeticBatchForAccuracyTierAvx2Kernel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const ECEF_TO_GEODETIC_ACCURACY_TIER
+                                   accuracyTier,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pGeodeticNorthLatitudeRadians,
+                          double * pGeocentricEastLongitudeRadians,
+                          double * pGeodeticAltitudeMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+        void
+        convertEcefToGeodeticBatchForAccuracyTierAvx512Kernel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const ECEF_TO_GEODETIC_ACCURACY_TIER
+                                   accuracyTier,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pGeodeticNorthLatitudeRadians,
+                          double * pGeocentricEastLongitudeRadians,
+                          double * pGeodeticAltitudeMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION(s):
+     //    convertEcefToGeodeticBatchInSinglePrecisionAvx2Kernel
+     //    convertEcefToGeodeticBatchInSinglePrecisionAvx512Kernel
+     //    convertGeodeticToEcefBatchInSinglePrecisionAvx2Kernel
+     //    convertGeodeticToEcefBatchInSinglePrecisionAvx512Kernel
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The kernels of 'convertEcefToGeodeticBatchInSinglePrecision' and
+     //    'convertGeodeticToEcefBatchInSinglePrecision'; the forward kernels
+     //    return the number of points which are not converted.  Only call
+     //    a kernel when 'detectEcefToGeodeticIsaLevel' reports its level or
+     //    above.
+     //
+     //-------------------------------------------------------------------------
+        void
+        convertEcefToGeodeticBatchInSinglePrecisionAvx2Kernel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pGeodeticNorthLatitudeRadians,
+                          double * pGeocentricEastLongitudeRadians,
+                          double * pGeodeticAltitudeMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        void
+        convertEcefToGeodeticBatchInSinglePrecisionAvx512Kernel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pGeodeticNorthLatitudeRadians,
+                          double * pGeocentricEastLongitudeRadians,
+                          double * pGeodeticAltitudeMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        size_t
+        convertGeodeticToEcefBatchInSinglePrecisionAvx2Kernel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const double * pGeodeticNorthLatitudeRadians,
+                    const double * pGeocentricEastLongitudeRadians,
+                    const double * pGeodeticAltitudeMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pXEcefMeters,
+                          double * pYEcefMeters,
+                          double * pZEcefMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        size_t
+        convertGeodeticToEcefBatchInSinglePrecisionAvx512Kernel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const double * pGeodeticNorthLatitudeRadians,
+                    const double * pGeocentricEastLongitudeRadians,
+                    const double * pGeodeticAltitudeMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pXEcefMeters,
+                          double * pYEcefMeters,
+                          double * pZEcefMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION(s):
+     //    convertEcefToGeodeticPartialBatchAvx2Kernel
+     //    convertEcefToGeodeticPartialBatchAvx512Kernel
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The kernels of the altitude only, latitude and longitude only and
+     //    latitude only batch conversions.  The output arrays which
+     //    outputSelection does not select are not referenced.  Only call a
+     //    kernel when 'detectEcefToGeodeticIsaLevel' reports its level or
+     //    above.
+     //
+     //-------------------------------------------------------------------------
+        void
+        convertEcefToGeodeticPartialBatchAvx2Kernel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const ECEF_TO_GEODETIC_OUTPUT_SELECTION
+                                   outputSelection,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pGeodeticNorthLatitudeRadians,
+                          double * pGeocentricEastLongitudeRadians,
+                          double * pGeodeticAltitudeMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+        void
+        convertEcefToGeodeticPartialBatchAvx512Kernel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const ECEF_TO_GEODETIC_OUTPUT_SELECTION
+                                   outputSelection,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pGeodeticNorthLatitudeRadians,
+                          double * pGeocentricEastLongitudeRadians,
+                          double * pGeodeticAltitudeMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+     //
+     //
+     //  FUNCTION:
+     //    convertGeodeticToEcef
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    Convert:
+     //      Geodetic   Latitude,
+     //      Geocentric Longitude
+     //      Geodetic   Altitude
+     //    to Earth Centered Earth Fixed (ECEF) rectangular coordinates.
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  INPUTS:
+     //
+     //     earthEquatorialRadiusMeters
+     //       Length of Earth equatorial radius
+     //       Also length of Earth ellipsoid semi-major axis.
+     //       UNITS:  [meters]
+     //
+     //     earthEllipsoidalEccentricitySquared
+     //       Earth ellipsoid eccentricity squared.
+     //       UNITS:  [nondimensional]
+     //
+     //     geodeticNorthLatitudeRadians
+     //       The North geodetic latitude.
+     //       Northern hemisphere is positive.
+     //       UNITS:  [radians]
+     //
+     //     geocentricEastLongitudeRadians
+     //       The East Geocentric longitude.
+     //       Eastward is positive.
+     //       UNITS:  [radians]
+     //
+     //     geodeticAltitudeMeters
+     //       The geodetic altitude above the specified reference ellipsoid.
+     //       UNITS:  [meters]
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  OUTPUT:
+     //
+     //     rXEcefMeters
+     //       Reference to a variable to contain the X ECEF position.
+     //       UNITS:  [meters]
+     //
+     //     rYEcefMeters
+     //       Reference to a variable to contain the Y ECEF position.
+     //       UNITS:  [meters]
+     //
+     //     rZEcefMeters
+     //       Reference to a variable to contain the Z ECEF position.
+     //       UNITS:  [meters]
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  RETURNED VALUE:
+     //
+     //     Conversion status:
+     //        SUCCESSFUL_CONVERSION
+     //        INVALID_GEODETIC_ALTITUDE
+     //          The length quantities rho and rhoz are not both positive,
+     //          and the outputs are set to NAN.
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  NOTE(s):
+     //
+     //    [ 1 ] As 'convertEcefToGeodetic', this function is bound at load
+     //          time to the widest x86-64 level clone which the host
+     //          supports, so its results depend on the host CPU in the last
+     //          bits.  Call 'convertGeodeticToEcefBaselineClone' for the
+     //          same results on every host.
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  REFERENCE(s):
+     //
+     //     [ 1 ]  "Geographic coordinate conversion",
+     //            "Coordinate system conversion",
+     //            "From geodetic to ECEF coordinates"
+     //            https://en.wikipedia.org/wiki/
+     //            Geographic_coordinate_conversion
+     //
+     //     [ 2 ]  "Geometric Geodesy, Part A",
+     //            "A set of lecture notes which are an introduction to
+     //             ellipsoidal geometry related to geodesy.",
+     //            R. E. Deakin and M. N. Hunter,
+     //            School of Mathematical and Geospatial Sciences,
+     //            RMIT University,
+     //            Melbourne, Australia,
+     //            January 2013
+     //            www.mygeodesy.id.au/documents/Geometric%20Geodesy%20A
+     //            (2013).pdf
+     //
+     //-------------------------------------------------------------------------
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertGeodeticToEcef
+               (
+                //----------------
+                // INPUT(s):
+                //----------------
+                   const double   earthEquatorialRadiusMeters,
+                   const double   earthEllipsoidalEccentricitySquared,
+                   const double   geodeticNorthLatitudeRadians,
+                   const double   geocentricEastLongitudeRadians,
+                   const double   geodeticAltitudeMeters,
+                //----------------
+                // OUTPUT(s):
+                //----------------
+                         double & rXEcefMeters,
+                         double & rYEcefMeters,
+                         double & rZEcefMeters
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    convertGeodeticToEcef  (ellipsoid context overload)
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    As 'convertGeodeticToEcef', for an ellipsoid context built by
+     //    'initializeEarthEllipsoidContext'.
+     //
+     //-------------------------------------------------------------------------
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertGeodeticToEcef
+               (
+                //----------------
+                // INPUT(s):
+                //----------------
+                   const EARTH_ELLIPSOID_CONTEXT
+                                & rEllipsoidContext,
+                   const double   geodeticNorthLatitudeRadians,
+                   const double   geocentricEastLongitudeRadians,
+                   const double   geodeticAltitudeMeters,
+                //----------------
+                // OUTPUT(s):
+                //----------------
+                         double & rXEcefMeters,
+                         double & rYEcefMeters,
+                         double & rZEcefMeters
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    convertGeodeticToEcefBatch
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    Convert a batch of geodetic coordinates, stored as a structure of
+     //    arrays, to ECEF rectangular coordinates with the widest SIMD
+     //    kernel which the processor supports.  Each sine and cosine pair
+     //    comes from one fused evaluation and the SIMD kernels replace the
+     //    square root and divide by a refined reciprocal square root.
+     //
+     //    Each point gets the status of 'convertGeodeticToEcef', from a
+     //    lane mask; the returned value is SUCCESSFUL_CONVERSION when every
+     //    point is converted, otherwise INVALID_GEODETIC_ALTITUDE.
+     //
+     //-------------------------------------------------------------------------
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertGeodeticToEcefBatch
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double   earthEquatorialRadiusMeters,
+                    const double   earthEllipsoidalEccentricitySquared,
+                    const size_t   numberPoints,
+                    const double * pGeodeticNorthLatitudeRadians,
+                    const double * pGeocentricEastLongitudeRadians,
+                    const double * pGeodeticAltitudeMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pXEcefMeters,
+                          double * pYEcefMeters,
+                          double * pZEcefMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    convertGeodeticToEcefBatchForIsaLevel
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    As 'convertGeodeticToEcefBatch', with the kernel selected by the
+     //    caller, who must not request a level above the one reported by
+     //    'detectEcefToGeodeticIsaLevel'.  Returns the number of points
+     //    which are not converted.
+     //
+     //-------------------------------------------------------------------------
+        size_t
+        convertGeodeticToEcefBatchForIsaLevel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const ECEF_TO_GEODETIC_ISA_LEVEL
+                                   isaLevel,
+                    const double   earthEquatorialRadiusMeters,
+                    const double   earthEllipsoidalEccentricitySquared,
+                    const size_t   numberPoints,
+                    const double * pGeodeticNorthLatitudeRadians,
+                    const double * pGeocentricEastLongitudeRadians,
+                    const double * pGeodeticAltitudeMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pXEcefMeters,
+                          double * pYEcefMeters,
+                          double * pZEcefMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION(s):
+     //    convertGeodeticToEcefBatchAvx2Kernel
+     //    convertGeodeticToEcefBatchAvx512Kernel
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The explicit SIMD kernels of 'convertGeodeticToEcefBatch'.  Lanes
+     //    with a finite angle beyond FORWARD_SINE_COSINE_ANGLE_LIMIT
+     //    radians, the range of their argument reduction, are converted
+     //    with the scalar 'convertGeodeticToEcef'; NAN and infinite angles
+     //    stay in their lanes.  Each returns the number of points which
+     //    are not converted.
+     //
+     //-------------------------------------------------------------------------
+        const double FORWARD_SINE_COSINE_ANGLE_LIMIT = 1.0E7;
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        size_t
+        convertGeodeticToEcefBatchAvx2Kernel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double   earthEquatorialRadiusMeters,
+                    const double   earthEllipsoidalEccentricitySquared,
+                    const size_t   numberPoints,
+                    const double * pGeodeticNorthLatitudeRadians,
+                    const double * pGeocentricEastLongitudeRadians,
+                    const double * pGeodeticAltitudeMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pXEcefMeters,
+                          double * pYEcefMeters,
+                          double * pZEcefMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        size_t
+        convertGeodeticToEcefBatchAvx512Kernel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double   earthEquatorialRadiusMeters,
+                    const double   earthEllipsoidalEccentricitySquared,
+                    const size_t   numberPoints,
+                    const double * pGeodeticNorthLatitudeRadians,
+                    const double * pGeocentricEastLongitudeRadians,
+                    const double * pGeodeticAltitudeMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pXEcefMeters,
+                          double * pYEcefMeters,
+                          double * pZEcefMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    convertGeodeticToEcefBatchWithValidityBits
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    As 'convertGeodeticToEcefBatch', with a validity bit per point,
+     //    bit i % 64 of word i / 64 of pValidBits for point i, instead of a
+     //    status per point, and the summary counts of the batch.
+     //    pValidBits must have ( numberPoints + 63 ) / 64 words.  A clear
+     //    bit is a point with the INVALID_GEODETIC_ALTITUDE status, or with
+     //    an input which is not finite, and has NAN outputs.
+     //
+     //-------------------------------------------------------------------------
+        void
+        convertGeodeticToEcefBatchWithValidityBits
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double   earthEquatorialRadiusMeters,
+                    const double   earthEllipsoidalEccentricitySquared,
+                    const size_t   numberPoints,
+                    const double * pGeodeticNorthLatitudeRadians,
+                    const double * pGeocentricEastLongitudeRadians,
+                    const double * pGeodeticAltitudeMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pXEcefMeters,
+                          double * pYEcefMeters,
+                          double * pZEcefMeters,
+                          unsigned long long
+                                 * pValidBits,
+                          ECEF_TO_GEODETIC_BATCH_VALIDITY
+                                 & rBatchValidity
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION(s):
+     //    convertGeodeticToEcefBatchValidityBitsAvx2Kernel
+     //    convertGeodeticToEcefBatchValidityBitsAvx512Kernel
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The explicit SIMD kernels of
+     //    'convertGeodeticToEcefBatchWithValidityBits', which store the
+     //    validity bits only.  Each returns the number of points which are
+     //    not converted.
+     //
+     //-------------------------------------------------------------------------
+        size_t
+        convertGeodeticToEcefBatchValidityBitsAvx2Kernel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double   earthEquatorialRadiusMeters,
+                    const double   earthEllipsoidalEccentricitySquared,
+                    const size_t   numberPoints,
+                    const double * pGeodeticNorthLatitudeRadians,
+                    const double * pGeocentricEastLongitudeRadians,
+                    const double * pGeodeticAltitudeMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pXEcefMeters,
+                          double * pYEcefMeters,
+                          double * pZEcefMeters,
+                          unsigned long long
+                                 * pValidBits
+               );
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        size_t
+        convertGeodeticToEcefBatchValidityBitsAvx512Kernel
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double   earthEquatorialRadiusMeters,
+                    const double   earthEllipsoidalEccentricitySquared,
+                    const size_t   numberPoints,
+                    const double * pGeodeticNorthLatitudeRadians,
+                    const double * pGeocentricEastLongitudeRadians,
+                    const double * pGeodeticAltitudeMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pXEcefMeters,
+                          double * pYEcefMeters,
+                          double * pZEcefMeters,
+                          unsigned long long
+                                 * pValidBits
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    convertGeodeticGridToEcef
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    Convert a regular latitude and longitude grid with an altitude per
+     //    cell, such as a DEM tile, to ECEF rectangular coordinates.  Row i
+     //    is at latitude first + i * step and column j at longitude
+     //    first + j * step; the altitudes, coordinates and statuses are
+     //    row major arrays of numberRows x numberColumns elements.
+     //
+     //    The sine, cosine and N( lat ) are computed once per row and the
+     //    sine and cosine of the longitude once per column; each cell is a
+     //    vectorized multiply and add.  The statuses and returned value are
+     //    those of 'convertGeodeticToEcefBatch'.
+     //
+     //-------------------------------------------------------------------------
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertGeodeticGridToEcef
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double   earthEquatorialRadiusMeters,
+                    const double   earthEllipsoidalEccentricitySquared,
+                    const size_t   numberRows,
+                    const size_t   numberColumns,
+                    const double   firstGeodeticNorthLatitudeRadians,
+                    const double   geodeticNorthLatitudeStepRadians,
+                    const double   firstGeocentricEastLongitudeRadians,
+                    const double   geocentricEastLongitudeStepRadians,
+                    const double * pGeodeticAltitudeMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pXEcefMeters,
+                          double * pYEcefMeters,
+                          double * pZEcefMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  TYPE:
+     //    ECEF_TO_GEODETIC_TRAJECTORY_STATE
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The anchor of 'convertEcefToGeodeticTrajectory', the last point
+     //    of the trajectory which took the full stateless conversion, from
+     //    whose latitude correction the iteration of each later point
+     //    starts, and the number of points which took each path:
+     //    the warm Newton step, the warm Halley step, or the full stateless
+     //    conversion.
+     //
+     //    A warm step is kept while it corrects its start by no more than
+     //    the Newton or Halley limit and the point's latitude is within the
+     //    anchor angle limit of the anchor's.  The longitude is found
+     //    without atan2 while it is within the same limit of the anchor's.
+     //    Every TRAJECTORY_ANCHOR_INTERVAL warm points are followed by a
+     //    new anchor.
+     //
+     //-------------------------------------------------------------------------
+        const double TRAJECTORY_NEWTON_STEP_LIMIT_RADIANS  = 1.0E-5;
+        const double TRAJECTORY_HALLEY_STEP_LIMIT_RADIANS  = 3.0E-4;
+        const double TRAJECTORY_ANCHOR_ANGLE_LIMIT_RADIANS = 1.0E-2;
+        const size_t TRAJECTORY_ANCHOR_INTERVAL            = 256;
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        struct
+        ECEF_TO_GEODETIC_TRAJECTORY_STATE
+          {
+            int    isWarm;
+            size_t pointsSinceAnchor;
+            double anchorXEcefMeters;
+            double anchorYEcefMeters;
+            double anchorPolarAxisDistanceMeters;
+            double anchorLongitudeRadians;
+            double anchorAbsoluteLatitudeRadians;
+            double anchorSineAbsoluteLatitude;
+            double anchorCosineLatitude;
+            double anchorSineCorrection;
+            double anchorCosineCorrection;
+            size_t numberNewtonPoints;
+            size_t numberHalleyPoints;
+            size_t numberFullSolutionPoints;
+          };
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    initializeEcefToGeodeticTrajectoryState
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    Start a new trajectory; its first point takes the full solution.
+     //
+     //-------------------------------------------------------------------------
+        void
+        initializeEcefToGeodeticTrajectoryState
+               (
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                    ECEF_TO_GEODETIC_TRAJECTORY_STATE
+                           &rTrajectoryState
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    convertEcefToGeodeticTrajectory
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    Convert a time ordered run of ECEF points, such as a flight track
+     //    or an orbit, starting each point's iteration from the solution of
+     //    a recent anchor point, kept in rTrajectoryState across calls.  The
+     //    warm points need no atan2 for the latitude and, near the anchor,
+     //    none for the longitude.  Points which move too far take the
+     //    stateless 'convertEcefToGeodetic' and become the anchor.  Each
+     //    point's status is set, and the first failure is returned; the
+     //    point after a failure becomes the anchor.
+     //
+     //-------------------------------------------------------------------------
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertEcefToGeodeticTrajectory
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                   &rEllipsoidContext,
+                    const size_t    numberPoints,
+                    const double  * pXEcefMeters,
+                    const double  * pYEcefMeters,
+                    const double  * pZEcefMeters,
+                 //-------------------
+                 // INPUT and OUTPUT:
+                 //-------------------
+                          ECEF_TO_GEODETIC_TRAJECTORY_STATE
+                                   &rTrajectoryState,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double  * pGeodeticNorthLatitudeRadians,
+                          double  * pGeocentricEastLongitudeRadians,
+                          double  * pGeodeticAltitudeMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                  * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  TYPE:
+     //    CONVERSION_TIMING_STATISTICS
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The timing of a run of conversions by 'measureConversionTiming':
+     //    median, median absolute deviation (MAD) and minimum over the timed
+     //    runs of the time per point, with the clock overhead subtracted.
+     //    Cycles are time stamp counter ticks (NAN without a counter).
+     //
+     //-------------------------------------------------------------------------
+        struct
+        CONVERSION_TIMING_STATISTICS
+          {
+            size_t pointsPerRun;
+            int    numberTimedRuns;
+            double timerOverheadNanoSeconds;
+            double medianNanoSecondsPerPoint;
+            double madNanoSecondsPerPoint;
+            double minimumNanoSecondsPerPoint;
+            double medianCyclesPerPoint;
+            double madCyclesPerPoint;
+          };
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    preventConversionTimingReordering
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    A compiler barrier: no memory access is moved across it, so timed
+     //    work stays between the clock reads which bracket it.
+     //
+     //-------------------------------------------------------------------------
+        inline
+        void
+        preventConversionTimingReordering(  )
+          {
+             __asm__ __volatile__( "" : : : "memory" );
+          };
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    measureConversionTiming
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    Call pConvertRun( pRunData ), which converts pointsPerRun points,
+     //    numberWarmUpRuns times untimed and numberTimedRuns times timed by
+     //    the steady clock and the time stamp counter, and return the
+     //    statistics of the time per point with the timer overhead
+     //    subtracted.
+     //
+     //-------------------------------------------------------------------------
+        void
+        measureConversionTiming
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    void        ( * pConvertRun )( void * pRunData ),
+                    void          * pRunData,
+                    const size_t    pointsPerRun,
+                    const int       numberWarmUpRuns,
+                    const int       numberTimedRuns,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                    CONVERSION_TIMING_STATISTICS
+                                  & rTimingStatistics
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  TYPE:
+     //    TIMING_ALTITUDE_SPACING
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The spacing of the altitudes of 'generateTimingGeodeticPoints':
+     //    uniform in the altitude, or uniform in asinh( altitude / 1 km ),
+     //    which puts as many points within a few km of the surface as in
+     //    each decade of altitude above it.
+     //
+     //-------------------------------------------------------------------------
+        enum
+        TIMING_ALTITUDE_SPACING
+          {
+            UNIFORM_TIMING_ALTITUDE_SPACING,
+            ASINH_TIMING_ALTITUDE_SPACING
+          };
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    generateTimingGeodeticPoints
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    Generate the reproducible points of the timing sections: geodetic
+     //    coordinates from a xorshift generator with a fixed seed, with
+     //    every polePointInterval-th point moved to a pole (none when it is
+     //    0), and their ECEF coordinates by
+     //    'convertGeodeticToEcefBaselineClone', so they are the same on
+     //    every host.  A NULL output is not stored; the ECEF coordinates
+     //    are not computed when pXEcefMeters is NULL.  When
+     //    pExtraUniformDeviates is not NULL a fourth deviate in [ 0, 1 ) is
+     //    drawn for each point and stored there.
+     //
+     //-------------------------------------------------------------------------
+        void
+        generateTimingGeodeticPoints
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double    earthEquatorialRadiusMeters,
+                    const double    earthEllipsoidalEccentricitySquared,
+                    const double    minimumAltitudeMeters,
+                    const double    maximumAltitudeMeters,
+                    const TIMING_ALTITUDE_SPACING
+                                    altitudeSpacing,
+                    const size_t    polePointInterval,
+                    const size_t    numberPoints,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double  * pGeodeticNorthLatitudeRadians,
+                          double  * pGeocentricEastLongitudeRadians,
+                          double  * pGeodeticAltitudeMeters,
+                          double  * pXEcefMeters,
+                          double  * pYEcefMeters,
+                          double  * pZEcefMeters,
+                          double  * pExtraUniformDeviates
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  TYPE:
+     //    TRIAL_POINT_RESULT
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The true values, residuals and status of one conversion of a
+     //    trial, recorded by 'executeOneTrialConvertEcefToGeodetic' into a
+     //    preallocated buffer of NUMBER_POINTS_PER_TRIAL entries and
+     //    formatted later by 'reportOneTrialConvertEcefToGeodetic'.  The
+     //    residuals are NAN for a failed conversion.
+     //
+     //-------------------------------------------------------------------------
+        const int NUMBER_POINTS_PER_TRIAL = 32;
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        struct
+        TRIAL_POINT_RESULT
+          {
+            double trueGeodeticNorthLatitudeDegrees;
+            double trueGeodeticAltitudeMeters;
+            double deltaGeodeticLatitudeMicroArcSecs;
+            double deltaGeodeticAltitudeNanoMeters;
+            ECEF_TO_GEODETIC_CONVERSION_STATUS
+                   conversionStatus;
+          };
+     //-------------------------------------------------------------------------
+     //
+     //  TYPE:
+     //    TRIAL_OUTPUT_MODE
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    When the test program writes the per point report of the trials:
+     //    after each trial, after all trials have been timed back to back,
+     //    or never.
+     //
+     //-------------------------------------------------------------------------
+        enum
+        TRIAL_OUTPUT_MODE
+          {
+            IMMEDIATE_TRIAL_OUTPUT,
+            DEFERRED_TRIAL_OUTPUT,
+            QUIET_TRIAL_OUTPUT
+          };
+     //-------------------------------------------------------------------------
+     // 
+     //  FUNCTION:
+     // 
+     //    executeOneTrialConvertEcefToGeodetic
+     // 
+     //-------------------------------------------------------------------------
+     // 
+     //  PURPOSE:
+     // 
+     //    To perform one trial of converting Earth-Center Earth-Fixed (ECEF)
+     //    retangular coordinates to geodetic coordinates for a specified
+     //    reference ellipsoid.
+     // 
+     //-------------------------------------------------------------------------
+     //
+     //  INPUT(s):
+     //
+     //    specifiedFixedTrueGeocentricEastLongitudeDegrees
+     //      The specified fixed true geocentric east longitude.
+     //      UNIT(s):  [degrees]
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  OUTPUT(s):
+     //
+     //    pTrialPointResults
+     //      Pointer to NUMBER_POINTS_PER_TRIAL preallocated point results,
+     //      which will contain the true values, residuals and status of
+     //      each conversion of the trial.  Nothing is written to stdout.
+     //
+     //    rTrialTimingStatistics
+     //      A reference to a variable which will contain the timing of the
+     //      'convertEcefToGeodetic' function calls of the trial, per call.
+     //
+     //    rMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs
+     //      A reference to a variable which will contain the maximum
+     //      geodetic north latitude absolute error over all
+     //      'convertEcefToGeodetic' function calls in the current
+     //      timing trial.
+     //      UNIT(s):  [microarcseconds]
+     //
+     //    rMaximumGeodeticAltitudeAbsoluteErrorNanoMeters
+     //      A reference to a variable which will contain the maximum
+     //      geodetic altitude absolute error over all
+     //      'convertEcefToGeodetic' function calls in the current
+     //      timing trial.
+     //      UNIT(s):  [nanometers]
+     //
+     //-------------------------------------------------------------------------
+     // 
+     //  A TRIAL CONSISTS OF:
+     // 
+     //    [ 1 ]  Performing the following 32 conversions.
+     // 
+     //    [ 2 ]  Converting ECEF rectangular coordinates at each 15
+     //           degrees of geodetic latitude along the specified
+     //           geocentric longitude meridian from the equator
+     //           to the north pole.
+     // 
+     //    [ 3 ]  At each latitude, perform the conversion at four
+     //           different geodetic altitudes.
+     // 
+     //-------------------------------------------------------------------------
+     // 
+     //   METHOD OF EACH ECEF TO GEODETIC CONVERSION:
+     // 
+     //    [ 1 ]  Uses the economic third-order Halley's method to
+     //           approximate a solution for the general non-linear
+     //           geodetic equation numerically.
+     // 
+     //    [ 2 ]  Uses only one iteration of the iterative Halley's
+     //           method to achieve near double precision accuracy.
+     // 
+     //    [ 3 ]  Uses a technique to avoid division operations which
+     //           significantly accelerates the backward transformation
+     //           without degrading the precision.
+     // 
+     //    [ 4 ]  Report the differences between the defined true
+     //           geodetic values and the estimated geodetic
+     //           values.
+     // 
+     //-------------------------------------------------------------------------
+     // 
+     //   AUTHOR(s):
+     // 
+     //    [ 1 ]  Toshio Fukushima <Toshio.Fukushima@nao.ac.jp>
+     //           National Astronomical Observatory of Japan (NAOJ)
+     //           Address:  2-21-1, Ohsawa, Mitaka, Tokyo 181-8588, Japan
+     //           Phone:    +81-422-34-3613
+     // 
+     //-------------------------------------------------------------------------
+     // 
+     //   REFERENCE(s):
+     // 
+     //    [ 1 ]  "Transformation from Cartesian to geodetic
+     //            coordinates accelerated by Halley''s method",
+     //           Toshio Fukushima,
+     //           Journal Of Geodesy (2006),
+     //           Volume 79,
+     //           Pages 689-693
+     // 
+     //    [ 2 ]  "Fast transform from geocentric to geodetic coordinates",
+     //           Toshio Fukushima,
+     //           Journal Of Geodesy (1999),
+     //           Volume 73,
+     //           Pages 603–610
+     // 
+     //    [ 3 ]  "Geometric Geodesy, Part A",
+     //           "A set of lecture notes which are an introduction to
+     //            ellipsoidal geometry related to geodesy.",
+     //            R. E. Deakin and M. N. Hunter,
+     //            School of Mathematical and Geospatial Sciences,
+     //            RMIT University,
+     //            Melbourne, Australia,
+     //            January 2013
+     //            www.mygeodesy.id.au/documents/Geometric%20Geodesy
+     //            %20A(2013).pdf
+     // 
+     //    [ 4 ]  'Various parameterizations of "latitude" equation -
+     //            Cartesian to geodetic coordinates transformation',
+     //            Marcin Ligas,
+     //            Journal of Geodetic Science,
+     //            Pages 87 - 94,
+     //            2013
+     // 
+     //    [ 5 ]  "In numerical analysis, Halley's method is a root-finding
+     //            algorithm used for functions of one real variable with a
+     //            continuous second derivative.",
+     //           "The rate of convergence of the iterative Halley's method
+     //            is cubic.",
+     //           "There exist multidimensional versions of Halley's method.",
+     //           wikipedia.org/wiki/Halley's_method`
+     // 
+     //-------------------------------------------------------------------------
+        void
+        executeOneTrialConvertEcefToGeodetic
+         (
+           //-------------------
+           // INPUT(s):
+           //-------------------
+              const
+              double    specifiedFixedTrueGeocentricEastLongitudeDegrees,
+           //-------------------
+           // OUTPUT(s):
+           //-------------------
+              TRIAL_POINT_RESULT
+                       *pTrialPointResults,
+              CONVERSION_TIMING_STATISTICS
+                       &rTrialTimingStatistics,
+              double   &rMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs,
+              double   &rMaximumGeodeticAltitudeAbsoluteErrorNanoMeters
+         );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    executeParallelTrialSweepConvertEcefToGeodetic
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    Run numberTrials trials of 'executeOneTrialConvertEcefToGeodetic',
+     //    trial t at longitude startingEastGeocentricLongitudeDegrees +
+     //    t * deltaEastGeocentricLongitudeDegrees, over numberThreads
+     //    threads (0 means the hardware threads).  Each trial fills its own
+     //    slots of the numberTrials long buffers, and the maxima over all
+     //    trials are reduced in thread order from per thread accumulators,
+     //    so the results are those of the serial sweep bit for bit.
+     //
+     //-------------------------------------------------------------------------
+        void
+        executeParallelTrialSweepConvertEcefToGeodetic
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const int    numberTrials,
+                    const double startingEastGeocentricLongitudeDegrees,
+                    const double deltaEastGeocentricLongitudeDegrees,
+                    const size_t numberThreads,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                    TRIAL_POINT_RESULT
+                               * pTrialPointResults,
+                    CONVERSION_TIMING_STATISTICS
+                               * pTrialTimingStatistics,
+                    double     * pTrialMaximumLatitudeErrorMicroArcSecs,
+                    double     * pTrialMaximumAltitudeErrorNanoMeters,
+                    double
+                       & rMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs,
+                    double
+                       & rMaximumGeodeticAltitudeAbsoluteErrorNanoMeters
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    reportOneTrialConvertEcefToGeodetic
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    Write the output header, the per point residuals, the timing and
+     //    the maximum errors of one trial, from the outputs of
+     //    'executeOneTrialConvertEcefToGeodetic', to stdout.
+     //
+     //-------------------------------------------------------------------------
+        void
+        reportOneTrialConvertEcefToGeodetic
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double
+                     specifiedFixedTrueGeocentricEastLongitudeDegrees,
+                    const TRIAL_POINT_RESULT
+                    * pTrialPointResults,
+                    const CONVERSION_TIMING_STATISTICS
+                    & rTrialTimingStatistics,
+                    const double
+                     maximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs,
+                    const double
+                     maximumGeodeticAltitudeAbsoluteErrorNanoMeters
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //
+     //    executeBatchTimingConvertEcefToGeodetic
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    To report the execution time per converted point of the
+     //    'convertEcefToGeodeticBatch' function and of scalar
+     //    'convertEcefToGeodetic' function calls, for batch sizes of
+     //    1, 10, 100, ... 10^maximumBatchSizeExponent points.
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  INPUT(s):
+     //
+     //    maximumBatchSizeExponent
+     //      The base ten exponent of the largest batch size.
+     //      A batch of 10^8 points needs about 5.2 gigabytes of storage.
+     //
+     //-------------------------------------------------------------------------
+        void
+        executeBatchTimingConvertEcefToGeodetic
+         (
+           //-------------------
+           // INPUT(s):
+           //-------------------
+              const
+              int       maximumBatchSizeExponent
+         );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //
+     //    executeIsaTimingConvertEcefToGeodetic
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    To report, for each batch kernel instruction set level which the
+     //    processor supports, the execution time per converted point, the
+     //    speedup over scalar 'convertEcefToGeodetic' calls and over the
+     //    baseline kernel, and the maximum latitude and altitude errors.
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  INPUT(s):
+     //
+     //    batchSizeExponent
+     //      The base ten exponent of the timed batch size.
+     //
+     //-------------------------------------------------------------------------
+        void
+        executeIsaTimingConvertEcefToGeodetic
+         (
+           //-------------------
+           // INPUT(s):
+           //-------------------
+              const
+              int       batchSizeExponent
+         );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //
+     //    executeEllipsoidContextTimingConvertEcefToGeodetic
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    To report the execution time per point of 'convertEcefToGeodetic'
+     //    and 'convertGeodeticToEcef' called with the ellipsoid parameters,
+     //    and called with a prebuilt ellipsoid context, and the largest
+     //    difference between the results of the two call paths.
+     //
+     //-------------------------------------------------------------------------
+        void
+        executeEllipsoidContextTimingConvertEcefToGeodetic
+         (
+           //-------------------
+           // INPUT(s):
+           //-------------------
+              const
+              int       numberPointsExponent
+         );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //
+     //    executeTemplateTimingConvertEcefToGeodetic
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    To report the execution time per point of the runtime parameter,
+     //    ellipsoid context and compile time ellipsoid conversions, and the
+     //    largest difference between the template and parameter results.
+     //
+     //-------------------------------------------------------------------------
+        void
+        executeTemplateTimingConvertEcefToGeodetic
+         (
+           //-------------------
+           // INPUT(s):
+           //-------------------
+              const
+              int       numberPointsExponent
+         );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //
+     //    executeInlineTimingConvertEcefToGeodetic
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    To report the execution time per point of the out-of-line scalar
+     //    conversions and of their inline bodies of
+     //    'convertBetweenEcefAndGeodeticInline.h' in a tight caller loop,
+     //    and the number of points whose results differ.
+     //
+     //-------------------------------------------------------------------------
+        void
+        executeInlineTimingConvertEcefToGeodetic
+         (
+           //-------------------
+           // INPUT(s):
+           //-------------------
+              const
+              int       numberPointsExponent
+         );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //
+     //    executeScalarCloneTimingConvertEcefToGeodetic
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    To report the execution time per point and the largest errors of
+     //    each x86-64 level clone of the scalar conversions the host
+     //    supports, and of the entry points as bound at load time.
+     //
+     //-------------------------------------------------------------------------
+        void
+        executeScalarCloneTimingConvertEcefToGeodetic
+         (
+           //-------------------
+           // INPUT(s):
+           //-------------------
+              const
+              int       numberPointsExponent
+         );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //
+     //    executeValidityTimingConvertEcefToGeodetic
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    To compare the execution time per point of the batch conversions
+     //    of both directions with a status per point and with validity bits,
+     //    for shares of NAN or infinite records, and to check their
+     //    validity bits, outputs and summary counts against each other.
+     //
+     //-------------------------------------------------------------------------
+        void
+        executeValidityTimingConvertEcefToGeodetic
+         (
+           //-------------------
+           // INPUT(s):
+           //-------------------
+              const
+              int       numberPointsExponent
+         );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //
+     //    executeInterleavedTimingConvertEcefToGeodetic
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    To compare the execution time per point and the results of
+     //    'convertEcefToGeodeticInterleavedBatch' and
+     //    'convertEcefToGeodeticBlockInterleavedBatch' with those of the
+     //    batch conversion of coordinate arrays, with and without copies
+     //    of the records to and from such arrays.
+     //
+     //-------------------------------------------------------------------------
+        void
+        executeInterleavedTimingConvertEcefToGeodetic
+         (
+           //-------------------
+           // INPUT(s):
+           //-------------------
+              const
+              int       numberPointsExponent
+         );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //
+     //    executeParallelTimingConvertEcefToGeodetic
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    To report the execution time per point, the speedup and the
+     //    parallel efficiency of 'convertEcefToGeodeticParallelBatch' for
+     //    1, 2, ... maximumNumberThreads threads.
+     //
+     //-------------------------------------------------------------------------
+        void
+        executeParallelTimingConvertEcefToGeodetic
+         (
+           //-------------------
+           // INPUT(s):
+           //-------------------
+              const
+              int       numberPointsExponent,
+              const
+              size_t    maximumNumberThreads,
+              const
+              size_t    chunkSizePoints
+         );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //
+     //    executeForwardTimingConvertGeodeticToEcef
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    To report the execution time per point of scalar
+     //    'convertGeodeticToEcef' calls and of 'convertGeodeticToEcefBatch'
+     //    with the kernel of each supported instruction set level, and the
+     //    largest difference of each kernel from the scalar function.
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  INPUT(s):
+     //
+     //    batchSizeExponent
+     //      The base ten exponent of the timed batch size.
+     //
+     //-------------------------------------------------------------------------
+        void
+        executeForwardTimingConvertGeodeticToEcef
+         (
+           //-------------------
+           // INPUT(s):
+           //-------------------
+              const
+              int       batchSizeExponent
+         );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //
+     //    executeGridTimingConvertGeodeticToEcef
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    To report the execution time per cell of a regular grid converted
+     //    by scalar 'convertGeodeticToEcef' calls, by
+     //    'convertGeodeticToEcefBatch' and by 'convertGeodeticGridToEcef',
+     //    and the largest difference of the last two from the first.
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  INPUT(s):
+     //
+     //    numberCellsExponent
+     //      The base ten exponent of the number of grid cells.
+     //
+     //-------------------------------------------------------------------------
+        void
+        executeGridTimingConvertGeodeticToEcef
+         (
+           //-------------------
+           // INPUT(s):
+           //-------------------
+              const
+              int       numberCellsExponent
+         );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //
+     //    executeTrajectoryTimingConvertEcefToGeodetic
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    To compare, on a synthetic 100 Hz aircraft track and a 1 Hz low
+     //    Earth orbit track, the time per point and the maximum errors of
+     //    the stateless conversions with those of the warm started
+     //    'convertEcefToGeodeticTrajectory'.
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  INPUT(s):
+     //
+     //    numberPointsExponent
+     //      The base ten exponent of the number of points of each track.
+     //
+     //-------------------------------------------------------------------------
+        void
+        executeTrajectoryTimingConvertEcefToGeodetic
+         (
+           //-------------------
+           // INPUT(s):
+           //-------------------
+              const
+              int       numberPointsExponent
+         );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //
+     //    executeAccuracyTierTimingConvertEcefToGeodetic
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    To report, for each accuracy tier, the time per point of the
+     //    scalar and batch accuracy tier conversions, their speedup over
+     //    the full tier scalar function and their maximum errors against
+     //    the error bounds of the tier.
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  INPUT(s):
+     //
+     //    numberPointsExponent
+     //      The base ten exponent of the number of points.
+     //
+     //-------------------------------------------------------------------------
+        void
+        executeAccuracyTierTimingConvertEcefToGeodetic
+         (
+           //-------------------
+           // INPUT(s):
+           //-------------------
+              const
+              int       numberPointsExponent
+         );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //
+     //    executeDirectionCosineTimingConvertEcefToGeodetic
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    To compare the time per point of the angle conversions followed
+     //    by sin and cos of both angles with that of the direction cosine
+     //    conversions, scalar and batch, and to report the largest
+     //    difference between their sines and cosines.
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  INPUT(s):
+     //
+     //    numberPointsExponent
+     //      The base ten exponent of the number of points.
+     //
+     //-------------------------------------------------------------------------
+        void
+        executeDirectionCosineTimingConvertEcefToGeodetic
+         (
+           //-------------------
+           // INPUT(s):
+           //-------------------
+              const
+              int       numberPointsExponent
+         );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //
+     //    executeOutputSelectionTimingConvertEcefToGeodetic
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    To compare the time per point of the altitude only, latitude and
+     //    longitude only and latitude only conversions with that of the
+     //    full conversions, scalar and batch, and to check that their
+     //    outputs are those of the full conversions.
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  INPUT(s):
+     //
+     //    numberPointsExponent
+     //      The base ten exponent of the number of points.
+     //
+     //-------------------------------------------------------------------------
+        void
+        executeOutputSelectionTimingConvertEcefToGeodetic
+         (
+           //-------------------
+           // INPUT(s):
+           //-------------------
+              const
+              int       numberPointsExponent
+         );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //
+     //    executeAltitudeBandTimingConvertEcefToGeodetic
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    To compare the time per point of the altitude band culling, as a
+     //    bit mask and as indices, with that of reading the coordinates and
+     //    of the full and altitude only batch conversions followed by a
+     //    comparison, and to check the culling against the exact altitudes.
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  INPUT(s):
+     //
+     //    numberPointsExponent
+     //      The base ten exponent of the number of points.
+     //
      //-------------------------------------------------------------------------
-     // 
-     //   METHOD OF EACH ECEF TO GEODETIC CONVERSION:
-     // 
-     //    [ 1 ]  Uses the economic third-order Halley's method to
-     //           approximate a solution for the general non-linear
-     //           geodetic equation numerically.
-     // 
-     //    [ 2 ]  Uses only one iteration of the iterative Halley's
-     //           method to achieve near double precision accuracy.
-     // 
-     //    [ 3 ]  Uses a technique to avoid division operations which
-     //           significantly accelerates the backward transformation
-     //           without degrading the precision.
-     // 
-     //    [ 4 ]  Report the differences between the defined true
-     //           geodetic values and the estimated geodetic
-     //           values.
-     // 
+        void
+        executeAltitudeBandTimingConvertEcefToGeodetic
+         (
+           //-------------------
+           // INPUT(s):
+           //-------------------
+              const
+              int       numberPointsExponent
+         );
      //-------------------------------------------------------------------------
-     // 
-     //   AUTHOR(s):
-     // 
-     //    [ 1 ]  Toshio Fukushima <Toshio.Fukushima@nao.ac.jp>
-     //           National Astronomical Observatory of Japan (NAOJ)
-     //           Address:  2-21-1, Ohsawa, Mitaka, Tokyo 181-8588, Japan
-     //           Phone:    +81-422-34-3613
-     // 
+     //
+     //  FUNCTION:
+     //
+     //    executeEngineTimingConvertEcefToGeodetic
+     //
      //-------------------------------------------------------------------------
-     // 
-     //   REFERENCE(s):
-     // 
-     //    [ 1 ]  "Transformation from Cartesian to geodetic
-     //            coordinates accelerated by Halley''s method",
-     //           Toshio Fukushima,
-     //           Journal Of Geodesy (2006),
-     //           Volume 79,
-     //           Pages 689-693
-     // 
-     //    [ 2 ]  "Fast transform from geocentric to geodetic coordinates",
-     //           Toshio Fukushima,
-     //           Journal Of Geodesy (1999),
-     //           Volume 73,
-     //           Pages 603–610
-     // 
-     //    [ 3 ]  "Geometric Geodesy, Part A",
-     //           "A set of lecture notes which are an introduction to
-     //            ellipsoidal geometry related to geodesy.",
-     //            R. E. Deakin and M. N. Hunter,
-     //            School of Mathematical and Geospatial Sciences,
-     //            RMIT University,
-     //            Melbourne, Australia,
-     //            January 2013
-     //            www.mygeodesy.id.au/documents/Geometric%20Geodesy
-     //            %20A(2013).pdf
-     // 
-     //    [ 4 ]  'Various parameterizations of "latitude" equation -
-     //            Cartesian to geodetic coordinates transformation',
-     //            Marcin Ligas,
-     //            Journal of Geodetic Science,
-     //            Pages 87 - 94,
-     //            2013
-     // 
-     //    [ 5 ]  "In numerical analysis, Halley's method is a root-finding
-     //            algorithm used for functions of one real variable with a
-     //            continuous second derivative.",
-     //           "The rate of convergence of the iterative Halley's method
-     //            is cubic.",
-     //           "There exist multidimensional versions of Halley's method.",
-     //           wikipedia.org/wiki/Halley's_method`
-     // 
+     //
+     //  PURPOSE:
+     //
+     //    To compare the time per point, scalar and batch, and the errors
+     //    of every conversion engine on the same points, and to sweep the
+     //    accuracy of every engine over the same grid.
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  INPUT(s):
+     //
+     //    numberPointsExponent
+     //      The base ten exponent of the number of points.
+     //
      //-------------------------------------------------------------------------
         void
-        executeOneTrialConvertEcefToGeodetic
+        executeEngineTimingConvertEcefToGeodetic
          (
            //-------------------
            // INPUT(s):
            //-------------------
               const
-              double    specifiedFixedTrueGeocentricEastLongitudeDegrees,
+              int       numberPointsExponent
+         );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //
+     //    executeIterationTimingConvertEcefToGeodetic
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    To measure the time per point of the iterative conversion
+     //    engines against their accuracy and convergence, for a range of
+     //    maximum numbers of iterations, near the Earth's center, about the
+     //    Earth, and at lunar distances.
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  INPUT(s):
+     //
+     //    numberPointsExponent
+     //      The base ten exponent of the number of points.
+     //
+     //-------------------------------------------------------------------------
+        void
+        executeIterationTimingConvertEcefToGeodetic
+         (
            //-------------------
-           // OUTPUT(s):
+           // INPUT(s):
            //-------------------
-              double   &rExecutionTimeOfTrialFunctionCallsMicroSeconds,
-              double   &rMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs,
-              double   &rMaximumGeodeticAltitudeAbsoluteErrorNanoMeters
+              const
+              int       numberPointsExponent
+         );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //
+     //    executeSinglePrecisionTimingConvertEcefToGeodetic
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    To compare the time per point of the single precision batches of
+     //    both conversion directions with that of the double batches, and
+     //    to report their largest errors, in millimeters and micro arc
+     //    seconds, for altitudes from -10 km to 2000 km.
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  INPUT(s):
+     //
+     //    numberPointsExponent
+     //      The base ten exponent of the number of points.
+     //
+     //-------------------------------------------------------------------------
+        void
+        executeSinglePrecisionTimingConvertEcefToGeodetic
+         (
+           //-------------------
+           // INPUT(s):
+           //-------------------
+              const
+              int       numberPointsExponent
          );
      //-------------------------------------------------------------------------
+     //
+     //  TYPE:
+     //    ECEF_TO_GEODETIC_BATCH_FUNCTION
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    A batch conversion with the signature of
+     //    'convertEcefToGeodeticBatch', so the accuracy sweep can evaluate
+     //    any batch kernel.
+     //
+     //-------------------------------------------------------------------------
+        typedef
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        ( * ECEF_TO_GEODETIC_BATCH_FUNCTION )
+               (
+                 const double   earthEquatorialRadiusMeters,
+                 const double   earthEllipsoidalFlatteningFactor,
+                 const size_t   numberPoints,
+                 const double * pXEcefMeters,
+                 const double * pYEcefMeters,
+                 const double * pZEcefMeters,
+                       double * pGeodeticNorthLatitudeRadians,
+                       double * pGeocentricEastLongitudeRadians,
+                       double * pGeodeticAltitudeMeters,
+                       ECEF_TO_GEODETIC_CONVERSION_STATUS
+                              * pConversionStatus
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    getEcefToGeodeticEngineBatchFunction
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The engine overload of 'convertEcefToGeodeticBatch' for
+     //    conversionEngine, as an ECEF_TO_GEODETIC_BATCH_FUNCTION, so the
+     //    accuracy sweep can evaluate every engine.
+     //
+     //-------------------------------------------------------------------------
+        ECEF_TO_GEODETIC_BATCH_FUNCTION
+        getEcefToGeodeticEngineBatchFunction
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const ECEF_TO_GEODETIC_ENGINE
+                                   conversionEngine
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  TYPE:
+     //    ACCURACY_SWEEP_SPECIFICATION
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The grid of an accuracy sweep.  Latitudes and altitudes include
+     //    both ends of their intervals; longitudes exclude the upper end,
+     //    so a full turn has no repeated meridian.  Altitudes are spaced
+     //    evenly in asinh( h / 1 km ), which puts as many of them within
+     //    a few hundred kilometers of the ellipsoid as out to GEO.
+     //
+     //-------------------------------------------------------------------------
+        struct
+        ACCURACY_SWEEP_SPECIFICATION
+          {
+            int    numberLatitudes;
+            double minimumLatitudeDegrees;
+            double maximumLatitudeDegrees;
+            int    numberLongitudes;
+            double minimumLongitudeDegrees;
+            double maximumLongitudeDegrees;
+            int    numberAltitudes;
+            double minimumAltitudeMeters;
+            double maximumAltitudeMeters;
+            size_t numberThreads;                   // 0: hardware threads
+          };
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTIONS:
+     //    computeAccuracySweepLatitudeDegrees
+     //    computeAccuracySweepLongitudeDegrees
+     //    computeAccuracySweepAltitudeMeters
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The coordinates of row, column and layer index of the grid of an
+     //    accuracy sweep.
+     //
+     //-------------------------------------------------------------------------
+        inline
+        double
+        computeAccuracySweepLatitudeDegrees
+               (
+                 const ACCURACY_SWEEP_SPECIFICATION & rSpecification,
+                 const int                            latitudeIndex
+               )
+          {
+             if( rSpecification.numberLatitudes < 2 )
+               {
+                  return( rSpecification.minimumLatitudeDegrees );
+               };
+             return( rSpecification.minimumLatitudeDegrees
+                     +
+                     ( rSpecification.maximumLatitudeDegrees -
+                       rSpecification.minimumLatitudeDegrees  ) *
+                     latitudeIndex / ( rSpecification.numberLatitudes - 1 ) );
+          };
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        inline
+        double
+        computeAccuracySweepLongitudeDegrees
+               (
+                 const ACCURACY_SWEEP_SPECIFICATION & rSpecification,
+                 const int                            longitudeIndex
+               )
+          {
+             return( rSpecification.minimumLongitudeDegrees
+                     +
+                     ( rSpecification.maximumLongitudeDegrees -
+                       rSpecification.minimumLongitudeDegrees  ) *
+                     longitudeIndex / rSpecification.numberLongitudes );
+          };
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        inline
+        double
+        computeAccuracySweepAltitudeMeters
+               (
+                 const ACCURACY_SWEEP_SPECIFICATION & rSpecification,
+                 const int                            altitudeIndex
+               )
+          {
+             const double scaleMeters = 1000.0;
+             if( rSpecification.numberAltitudes < 2 )
+               {
+                  return( rSpecification.minimumAltitudeMeters );
+               };
+             const double u0 = asinh( rSpecification.minimumAltitudeMeters /
+                                      scaleMeters );
+             const double u1 = asinh( rSpecification.maximumAltitudeMeters /
+                                      scaleMeters );
+             return( scaleMeters *
+                     sinh( u0 + ( u1 - u0 ) * altitudeIndex /
+                                ( rSpecification.numberAltitudes - 1 ) ) );
+          };
+     //-------------------------------------------------------------------------
+     //
+     //  CONSTANTS:
+     //    The regions of the accuracy sweep report: bands of absolute
+     //    latitude, with lower bounds ACCURACY_SWEEP_LATITUDE_BAND_DEGREES,
+     //    by bands of altitude, with lower bounds
+     //    ACCURACY_SWEEP_ALTITUDE_BAND_METERS (subsurface, atmosphere,
+     //    LEO, MEO, GEO and beyond).
+     //
+     //-------------------------------------------------------------------------
+        const int    NUMBER_ACCURACY_SWEEP_LATITUDE_BANDS = 4;
+        const int    NUMBER_ACCURACY_SWEEP_ALTITUDE_BANDS = 5;
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        const double ACCURACY_SWEEP_LATITUDE_BAND_DEGREES
+                                 [ NUMBER_ACCURACY_SWEEP_LATITUDE_BANDS ] =
+                                 { 0.0, 15.0, 60.0, 85.0 };
+        const double ACCURACY_SWEEP_ALTITUDE_BAND_METERS
+                                 [ NUMBER_ACCURACY_SWEEP_ALTITUDE_BANDS ] =
+                                 { -INFINITY, 0.0, 1.0E5, 2.0E6, 3.5E7 };
+     //-------------------------------------------------------------------------
+     //
+     //  TYPE:
+     //    ACCURACY_SWEEP_STATISTICS
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The errors of the points of one region, or of the whole sweep.
+     //    The maxima are exact; the percentiles are upper bounds, the
+     //    upper edges of the 1/20 decade histogram bins holding them,
+     //    capped at the maxima.
+     //
+     //-------------------------------------------------------------------------
+        struct
+        ACCURACY_SWEEP_STATISTICS
+          {
+            size_t numberPoints;
+            size_t numberFailedConversions;
+            double maximumLatitudeErrorMicroArcSecs;
+            double percentile50LatitudeErrorMicroArcSecs;
+            double percentile99LatitudeErrorMicroArcSecs;
+            double percentile999LatitudeErrorMicroArcSecs;
+            double maximumAltitudeErrorNanoMeters;
+            double percentile50AltitudeErrorNanoMeters;
+            double percentile99AltitudeErrorNanoMeters;
+            double percentile999AltitudeErrorNanoMeters;
+          };
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    executeAccuracySweepConvertEcefToGeodetic
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    Convert every point of the grid of rSweepSpecification, on the
+     //    GRS80 ellipsoid, from its exact ECEF coordinates with
+     //    pConvertBatch, in parallel over latitude rows, and return the
+     //    error statistics of each region and of the whole sweep.
+     //
+     //    If pHeatMapLatitudeErrorMicroArcSecs and
+     //    pHeatMapAltitudeErrorNanoMeters are not NULL, they receive
+     //    numberLatitudes x numberAltitudes maxima over longitude, row
+     //    major by latitude.  A failed conversion counts as an infinite
+     //    error there and in the maxima.
+     //
+     //    Returns the elapsed time of the sweep.  UNIT(s): [seconds]
+     //
+     //-------------------------------------------------------------------------
+        double
+        executeAccuracySweepConvertEcefToGeodetic
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const ACCURACY_SWEEP_SPECIFICATION
+                                    & rSweepSpecification,
+                    ECEF_TO_GEODETIC_BATCH_FUNCTION
+                                      pConvertBatch,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                    ACCURACY_SWEEP_STATISTICS
+                      regionStatistics[ NUMBER_ACCURACY_SWEEP_LATITUDE_BANDS ]
+                                      [ NUMBER_ACCURACY_SWEEP_ALTITUDE_BANDS ],
+                    ACCURACY_SWEEP_STATISTICS
+                                    & rSweepStatistics,
+                    double          * pHeatMapLatitudeErrorMicroArcSecs,
+                    double          * pHeatMapAltitudeErrorNanoMeters
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    reportAccuracySweepConvertEcefToGeodetic
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    Write the grid, the throughput and the statistics of each region
+     //    and of the whole sweep of 'executeAccuracySweepConvertEcefToGeodetic'
+     //    to stdout, under the title pKernelName.
+     //
+     //-------------------------------------------------------------------------
+        void
+        reportAccuracySweepConvertEcefToGeodetic
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const char      * pKernelName,
+                    const ACCURACY_SWEEP_SPECIFICATION
+                                    & rSweepSpecification,
+                    const ACCURACY_SWEEP_STATISTICS
+                      regionStatistics[ NUMBER_ACCURACY_SWEEP_LATITUDE_BANDS ]
+                                      [ NUMBER_ACCURACY_SWEEP_ALTITUDE_BANDS ],
+                    const ACCURACY_SWEEP_STATISTICS
+                                    & rSweepStatistics,
+                    const double      elapsedSeconds
+               );
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    writeAccuracySweepHeatMap
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    Write the heat maps of 'executeAccuracySweepConvertEcefToGeodetic'
+     //    to the file pFileName: as comma separated values if its name
+     //    ends in ".csv", one line per latitude and altitude, otherwise as
+     //    binary (see the function for the layout).
+     //
+     //    Returns false if the file could not be written.
+     //
+     //-------------------------------------------------------------------------
+        bool
+        writeAccuracySweepHeatMap
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const char      * pFileName,
+                    const ACCURACY_SWEEP_SPECIFICATION
+                                    & rSweepSpecification,
+                    const double    * pHeatMapLatitudeErrorMicroArcSecs,
+                    const double    * pHeatMapAltitudeErrorNanoMeters
+               );
+     //-------------------------------------------------------------------------
 #endif
 //==============================================================================
 
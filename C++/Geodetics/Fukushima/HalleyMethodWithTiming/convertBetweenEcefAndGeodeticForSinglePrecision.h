@@ -0,0 +1,1039 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#ifndef CONVERT_BETWEEN_ECEF_AND_GEODETIC_FOR_SINGLE_PRECISION_H
+     //-------------------------------------------------------------------------
+#       define CONVERT_BETWEEN_ECEF_AND_GEODETIC_FOR_SINGLE_PRECISION_H
+
+#       include <float.h>
+#       include <math.h>
+
+#       include "conversionBetweenEcefAndGeodetic.h"
+
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    The kernels of 'convertEcefToGeodeticBatchInSinglePrecision' and
+     //    'convertGeodeticToEcefBatchInSinglePrecision'.
+     //
+     //    Every function here is static, so each translation unit which
+     //    includes this file compiles its own copy for its instruction set:
+     //    'convertBetweenEcefAndGeodeticWithSinglePrecision.cpp' for the
+     //    baseline, and
+     //    'convertBetweenEcefAndGeodeticWithSinglePrecisionAvx2.cpp' and
+     //    'convertBetweenEcefAndGeodeticWithSinglePrecisionAvx512.cpp' for
+     //    the wider instruction sets.  As in
+     //    'convertEcefToGeodeticForAccuracyTier.h', the kernels call no
+     //    library function and have no branches, so the batch loops are
+     //    vectorized by the compiler, here with twice as many float lanes
+     //    as double lanes.
+     //
+     //    The inputs and outputs stay double.  Only the parts whose errors
+     //    are relative to an angle are evaluated in float:  the Halley
+     //    step and the atan2 of the inverse conversion, and the sine and
+     //    cosine of the forward conversion.  The lengths, which must
+     //    resolve millimeters at 10^7 meters, are evaluated in double, with
+     //    their square roots and divisions seeded in float and refined by
+     //    a Newton step in double.
+     //
+     //-------------------------------------------------------------------------
+
+     //-------------------------------------------------------------------------
+     // The display tier coefficients of atan( t ) / t, see
+     // DISPLAY_TIER_ARC_TANGENT_COEFFICIENTS, rounded to float.  Their
+     // largest error, 6.8e-9 radians, is below half a float unit of pi/4.
+     //-------------------------------------------------------------------------
+        static
+        const
+        float
+         SINGLE_PRECISION_ARC_TANGENT_COEFFICIENTS[ 5 ] =
+           {
+              9.999999812646112E-01f,
+             -3.333278577192369E-01f,
+              1.997408241547598E-01f,
+             -1.3848490211961015E-01f,
+              7.976291805862455E-02f
+           };
+
+     //-------------------------------------------------------------------------
+     // Coefficients of sin( r ) ~ r + r^3 ( s[ 0 ] + s[ 1 ] r^2 + ... ) and
+     // cos( r ) ~ 1 - r^2 / 2 + r^4 ( c[ 0 ] + c[ 1 ] r^2 + ... ) for
+     // | r | <= pi / 4, from the single precision sinf and cosf of the
+     // Cephes Mathematical Library.
+     //-------------------------------------------------------------------------
+        static
+        const
+        float
+         SINGLE_PRECISION_SINE_COEFFICIENTS[ 3 ] =
+           {
+             -1.6666654611E-01f,
+              8.3321608736E-03f,
+             -1.9515295891E-04f
+           };
+     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        static
+        const
+        float
+         SINGLE_PRECISION_COSINE_COEFFICIENTS[ 3 ] =
+           {
+              4.166664568298827E-02f,
+             -1.388731625493765E-03f,
+              2.443315711809948E-05f
+           };
+
+     //-------------------------------------------------------------------------
+     // The points of a cache resident chunk of the batch loops.
+     //-------------------------------------------------------------------------
+        static
+        const
+        size_t
+         SINGLE_PRECISION_CHUNK_POINTS = 256;
+
+     //-------------------------------------------------------------------------
+     // 1 when v >= +0 and 0 when v <= -0, as 'computeStepForAccuracyTier'.
+     //-------------------------------------------------------------------------
+        static
+        inline
+        float
+        computeStepForSinglePrecision
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const float v
+               )
+          {
+          //--------------------------------------------------------------------
+             return( 0.5f + copysignf( 0.5f, v ) );
+          //--------------------------------------------------------------------
+          };
+
+     //-------------------------------------------------------------------------
+     // The nearest integer to v, for | v | < 2^51, by the addition and
+     // subtraction of 1.5 * 2^52.  This file is not compiled with
+     // -ffast-math, so the pair is not folded away, and unlike rint it needs
+     // no SSE4.1 rounding instruction to be vectorized.
+     //-------------------------------------------------------------------------
+        static
+        inline
+        double
+        computeNearestIntegerForSinglePrecision
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double v
+               )
+          {
+          //--------------------------------------------------------------------
+             const double roundingConstant = 6755399441055744.0;
+          //--------------------------------------------------------------------
+             return( ( v + roundingConstant ) - roundingConstant );
+          //--------------------------------------------------------------------
+          };
+
+     //-------------------------------------------------------------------------
+     // 1 / sqrt( v ) for 0 <= v < FLT_MAX, to a relative error of about
+     // 1e-14:  the float estimate, of relative error e ~ 6e-8, and one
+     // Newton step in double, which leaves 1.5 e^2.  The float square root
+     // and division take half the SIMD width of their double forms and
+     // have twice the throughput.  FLT_MIN keeps 1 / 0 out, so that
+     // v * ( 1 / sqrt( v ) ) is 0 for v = 0.
+     //-------------------------------------------------------------------------
+        static
+        inline
+        double
+        computeInverseSquareRootForSinglePrecision
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double v
+               )
+          {
+          //--------------------------------------------------------------------
+             const double r = 1.0f / sqrtf( ( float )v + FLT_MIN );
+          //--------------------------------------------------------------------
+             return( r * ( 1.5 - ( 0.5 * v * r * r ) ) );
+          //--------------------------------------------------------------------
+          };
+
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    computeArcTangent2ForSinglePrecision
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    atan2( y, x ) of float arguments, with the method and the selects
+     //    of 'computeArcTangent2ForAccuracyTier':  the reduction and the
+     //    polynomial in float, the quadrant in double.  FLT_MIN in the
+     //    divisor keeps 0 / 0 out.
+     //
+     //-------------------------------------------------------------------------
+        static
+        inline
+        double
+        computeArcTangent2ForSinglePrecision
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const float y,
+                    const float x
+               )
+          {
+          //--------------------------------------------------------------------
+             const double piRadians = 3.14159265358979323846E0;
+          //--------------------------------------------------------------------
+             const float absX      = fabsf( x );
+             const float absY      = fabsf( y );
+             const float noSwap    = computeStepForSinglePrecision
+                                            (
+                                              absX - absY
+                                            );
+             const float maximum   = (            noSwap   * absX ) +
+                                     ( ( 1.0f - noSwap ) * absY );
+             const float minimum   = (            noSwap   * absY ) +
+                                     ( ( 1.0f - noSwap ) * absX );
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             const float reduce    = computeStepForSinglePrecision
+                                            (
+                                              minimum -
+                                              4.1421356237309503E-01f * maximum
+                                            );
+             const float numerator = minimum - ( reduce * maximum );
+             const float divisor   = maximum + ( reduce * minimum ) + FLT_MIN;
+             const float t         = numerator / divisor;
+             const float tSquared  = t * t;
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             const float * c = SINGLE_PRECISION_ARC_TANGENT_COEFFICIENTS;
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             float polynomial = c[ 4 ];
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             polynomial = ( polynomial * tSquared ) + c[ 3 ];
+             polynomial = ( polynomial * tSquared ) + c[ 2 ];
+             polynomial = ( polynomial * tSquared ) + c[ 1 ];
+             polynomial = ( polynomial * tSquared ) + c[ 0 ];
+          //--------------------------------------------------------------------
+          // The reductions are undone in double, so that the result keeps
+          // the float accuracy of atan( t ), | atan( t ) | <= pi / 8,
+          // rather than a float unit of pi.
+          //--------------------------------------------------------------------
+             const double noReflect = computeStepForSinglePrecision( x );
+             const double unswap    = 1.0f - noSwap;
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             double r = ( double )( t * polynomial ) +
+                        ( reduce * 0.25 * piRadians );
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             r = ( unswap * 0.5 * piRadians ) +
+                 ( ( 1.0 - 2.0 * unswap    ) * r );
+             r = ( ( 1.0 - noReflect ) *       piRadians ) +
+                 ( ( 2.0 * noReflect - 1.0 ) * r );
+          //--------------------------------------------------------------------
+             return( copysign( r, ( double )y ) );
+          //--------------------------------------------------------------------
+          };
+
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    computeSineCosineForSinglePrecision
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    The sine and cosine of a double angle, | angle | <=
+     //    FORWARD_SINE_COSINE_ANGLE_LIMIT, in float.
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  METHOD:
+     //
+     //    [ 1 ] k, the nearest integer to angle / ( pi / 2 ), and the
+     //          reduced angle r = angle - k pi / 2, | r | <= pi / 4, are
+     //          computed in double with the two part pi / 2 of fdlibm, so
+     //          that r is correct to far better than a float unit before it
+     //          is rounded to float.
+     //
+     //    [ 2 ] The polynomials of SINGLE_PRECISION_SINE_COEFFICIENTS and
+     //          SINGLE_PRECISION_COSINE_COEFFICIENTS give sin( r ) and
+     //          cos( r ).
+     //
+     //    [ 3 ] The quadrant q = k - 4 nint( k / 4 ), in -2 ... 2, swaps
+     //          the pair when q = -1 or 1 and sets the signs, with the 0 or
+     //          1 steps of 'computeStepForSinglePrecision'.
+     //
+     //-------------------------------------------------------------------------
+        static
+        inline
+        void
+        computeSineCosineForSinglePrecision
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double angleRadians,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          float &rSine,
+                          float &rCosine
+               )
+          {
+          //--------------------------------------------------------------------
+             const double twoOverPi       = 6.36619772367581382433E-01;
+             const double halfPiHigh      = 1.57079632673412561417E+00;
+             const double halfPiLow       = 6.07710050650619224932E-11;
+          //--------------------------------------------------------------------
+             const double k = computeNearestIntegerForSinglePrecision
+                                     (
+                                       angleRadians * twoOverPi
+                                     );
+             const float  r = ( float )( ( angleRadians - ( k * halfPiHigh ) ) -
+                                         (                k * halfPiLow    ) );
+             const float  q = ( float )( k -
+                                         4.0 *
+                                         computeNearestIntegerForSinglePrecision
+                                                (
+                                                  0.25 * k
+                                                ) );
+          //--------------------------------------------------------------------
+             const float   rSquared = r * r;
+             const float * s        = SINGLE_PRECISION_SINE_COEFFICIENTS;
+             const float * c        = SINGLE_PRECISION_COSINE_COEFFICIENTS;
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             float sinePolynomial   = s[ 2 ];
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             sinePolynomial   = ( sinePolynomial   * rSquared ) + s[ 1 ];
+             sinePolynomial   = ( sinePolynomial   * rSquared ) + s[ 0 ];
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             float cosinePolynomial = c[ 2 ];
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             cosinePolynomial = ( cosinePolynomial * rSquared ) + c[ 1 ];
+             cosinePolynomial = ( cosinePolynomial * rSquared ) + c[ 0 ];
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             const float sineR   = r +
+                                   ( r * rSquared * sinePolynomial );
+             const float cosineR = ( 1.0f - 0.5f * rSquared ) +
+                                   ( rSquared * rSquared * cosinePolynomial );
+          //--------------------------------------------------------------------
+          // q = -1 or 1 swaps the pair; the sine is positive for q = 0 or 1
+          // and the cosine for q = -1 or 0.
+          //--------------------------------------------------------------------
+             const float absQ       = fabsf( q );
+             const float swap       = computeStepForSinglePrecision(
+                                                            absQ - 0.5f ) *
+                                      computeStepForSinglePrecision(
+                                                            1.5f - absQ );
+             const float sineSign   = 2.0f *
+                                      computeStepForSinglePrecision(
+                                                            q + 0.5f    ) *
+                                      computeStepForSinglePrecision(
+                                                            1.5f - q    ) -
+                                      1.0f;
+             const float cosineSign = 2.0f *
+                                      computeStepForSinglePrecision(
+                                                            0.5f - q    ) *
+                                      computeStepForSinglePrecision(
+                                                            q + 1.5f    ) -
+                                      1.0f;
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             rSine   = sineSign   * ( (          swap   * cosineR ) +
+                                      ( ( 1.0f - swap ) * sineR   ) );
+             rCosine = cosineSign * ( (          swap   * sineR   ) +
+                                      ( ( 1.0f - swap ) * cosineR ) );
+          //--------------------------------------------------------------------
+          };
+
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    convertEcefToGeodeticForSinglePrecision
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    The branch free inverse conversion of one point:  the Halley step
+     //    of 'convertEcefToGeodeticForAccuracyTier' and both atan2 in float,
+     //    and the altitude, Equation (20), in double.
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  METHOD:
+     //
+     //    The direction ( Sp, Cp ) is rounded by float to a relative error
+     //    of a few units of 2^-24, about 1e-7 radians, which bounds the
+     //    latitude error.  The altitude of Equation (20) is stationary in
+     //    the direction at the normal, so the same error moves it by about
+     //    ( N + h ) 1e-14 / 2, below a micrometer, as long as Equation (20)
+     //    itself, with its distances of 10^7 meters, is evaluated in
+     //    double.  The float direction converts to double exactly.
+     //
+     //-------------------------------------------------------------------------
+        static
+        inline
+        void
+        convertEcefToGeodeticForSinglePrecision
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 &rEllipsoidContext,
+                    const double  xEcefMeters,
+                    const double  yEcefMeters,
+                    const double  zEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double &rGeodeticNorthLatitudeRadians,
+                          double &rGeocentricEastLongitudeRadians,
+                          double &rGeodeticAltitudeMeters
+               )
+          {
+          //--------------------------------------------------------------------
+             const EARTH_ELLIPSOID_CONTEXT & E = rEllipsoidContext;
+          //--------------------------------------------------------------------
+             const double earthPolarAxisDistanceSquared =
+                                             ( xEcefMeters * xEcefMeters ) +
+                                             ( yEcefMeters * yEcefMeters );
+             const double earthPolarAxisDistanceMeters  =
+                    earthPolarAxisDistanceSquared *
+                    computeInverseSquareRootForSinglePrecision
+                           (
+                             earthPolarAxisDistanceSquared
+                           );
+             const double absZ = fabs( zEcefMeters );
+          //--------------------------------------------------------------------
+          // Equations (2), (17), (14), (12), (13), (15), (10) and (11) of
+          // Reference [ 1 ] of 'convertEcefToGeodetic', in float.
+          //--------------------------------------------------------------------
+             const float ec        = ( float )E.complimentaryEarthEllipticity;
+             const float e2        = ( float )E.earthEllipticitySquared;
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             const float S0        = ( float )
+                                     ( absZ *
+                                       E.inverseEarthEquatorialRadius );
+             const float Pn        = ( float )
+                                     ( earthPolarAxisDistanceMeters *
+                                       E.inverseEarthEquatorialRadius );
+             const float zc        = ec * S0;
+             const float C0        = ec * Pn;
+             const float C0Squared = C0 * C0;
+             const float S0Squared = S0 * S0;
+             const float A0Squared = C0Squared + S0Squared;
+             const float A0        = sqrtf( A0Squared );
+             const float A0Cubed   = A0 * A0Squared;
+             const float D0        = (  zc * A0Cubed ) +
+                                     (  e2 * S0 * S0Squared );
+             const float F0        = (  Pn * A0Cubed ) +
+                                     ( -e2 * C0 * C0Squared );
+             const float B0        = ( float )E.oneAndHalf_e4 *
+                                     S0Squared                *
+                                     C0Squared                *
+                                     Pn                       *
+                                     ( A0 - ec );
+             const float S1        = ( D0 * F0 ) + ( -B0 * S0 );
+             const float C1        = ( F0 * F0 ) + ( -B0 * C0 );
+             const float Cc        = ec * C1;
+          //--------------------------------------------------------------------
+          // Polar axis vicinity, as in 'convertEcefToGeodeticForAccuracyTier'.
+          //--------------------------------------------------------------------
+             const float nearPolarAxis = computeStepForSinglePrecision
+                                          (
+                                            ( float )
+                                            (
+                                              E.aEpsSquared -
+                                              earthPolarAxisDistanceSquared
+                                            )
+                                          );
+             const float offPolarAxis  = 1.0f - nearPolarAxis;
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             const float Sp        = ( offPolarAxis * S1 ) + nearPolarAxis;
+             const float Cp        =   offPolarAxis * Cc;
+          //--------------------------------------------------------------------
+          // Equation (20) of Reference [ 1 ] of 'convertEcefToGeodetic', in
+          // double.
+          //--------------------------------------------------------------------
+             const double SpDouble  = Sp;
+             const double CpDouble  = Cp;
+             const double SpSquared = SpDouble * SpDouble;
+             const double CpSquared = CpDouble * CpDouble;
+             const double a1Squared = ( E.complimentaryEarthEllipticitySquared *
+                                        SpSquared ) +
+                                      CpSquared;
+             const double A1Squared = CpSquared + SpSquared;
+             const double a1        = a1Squared *
+                                      computeInverseSquareRootForSinglePrecision
+                                             (
+                                               a1Squared
+                                             );
+             const double h1        = (
+                                        (  earthPolarAxisDistanceMeters *
+                                           CpDouble                     ) +
+                                        (  absZ * SpDouble              ) +
+                                        ( -E.earthEquatorialRadiusMeters
+                                                                   * a1 )
+                                      ) *
+                                      computeInverseSquareRootForSinglePrecision
+                                             (
+                                               A1Squared
+                                             );
+          //--------------------------------------------------------------------
+             const double latitude  = computeArcTangent2ForSinglePrecision
+                                             (
+                                               Sp,
+                                               Cp
+                                             );
+             const double longitude = computeArcTangent2ForSinglePrecision
+                                             (
+                                               ( float )yEcefMeters,
+                                               ( float )xEcefMeters
+                                             );
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             rGeodeticNorthLatitudeRadians   = copysign( latitude,
+                                                         zEcefMeters );
+             rGeocentricEastLongitudeRadians = longitude;
+             rGeodeticAltitudeMeters         = h1;
+          //--------------------------------------------------------------------
+          };
+
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    convertGeodeticToEcefForSinglePrecision
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    The branch free forward conversion of one point:  the sines and
+     //    cosines in float, N, N + h and the products in double.  Returns
+     //    the smaller of the two lengths rho and rhoz of
+     //    'convertGeodeticToEcef', which must be positive.
+     //
+     //-------------------------------------------------------------------------
+        static
+        inline
+        double
+        convertGeodeticToEcefForSinglePrecision
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 &rEllipsoidContext,
+                    const double  geodeticNorthLatitudeRadians,
+                    const double  geocentricEastLongitudeRadians,
+                    const double  geodeticAltitudeMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double &rXEcefMeters,
+                          double &rYEcefMeters,
+                          double &rZEcefMeters
+               )
+          {
+          //--------------------------------------------------------------------
+             const EARTH_ELLIPSOID_CONTEXT & E = rEllipsoidContext;
+          //--------------------------------------------------------------------
+             float sineLatitude;
+             float cosineLatitude;
+             float sineLongitude;
+             float cosineLongitude;
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             computeSineCosineForSinglePrecision
+                    (
+                      geodeticNorthLatitudeRadians,
+                      sineLatitude,
+                      cosineLatitude
+                    );
+             computeSineCosineForSinglePrecision
+                    (
+                      geocentricEastLongitudeRadians,
+                      sineLongitude,
+                      cosineLongitude
+                    );
+          //--------------------------------------------------------------------
+          // Equations (48) and (277) of Reference [2] of
+          // 'convertGeodeticToEcef'.
+          //--------------------------------------------------------------------
+             const double sinePhi = sineLatitude;
+             const double N       = E.earthEquatorialRadiusMeters *
+                                    computeInverseSquareRootForSinglePrecision
+                                           (
+                                             1.0E0 +
+                                             (
+                                               -E.earthEllipticitySquared *
+                                                sinePhi                   *
+                                                sinePhi
+                                             )
+                                           );
+             const double rho     = N + geodeticAltitudeMeters;
+             const double rhoz    = ( E.complimentaryEarthEllipticitySquared *
+                                      N ) +
+                                    geodeticAltitudeMeters;
+             const double r       = rho * ( double )cosineLatitude;
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             rXEcefMeters = r    * ( double )cosineLongitude;
+             rYEcefMeters = r    * ( double )  sineLongitude;
+             rZEcefMeters = rhoz * sinePhi;
+          //--------------------------------------------------------------------
+             return( ( rho < rhoz ) ? rho : rhoz );
+          //--------------------------------------------------------------------
+          };
+
+     //-------------------------------------------------------------------------
+     // 1 for a point which the inverse float kernel does not convert:  a
+     // coordinate beyond SINGLE_PRECISION_RANGE_LIMIT_METERS, or NAN.  The
+     // comparisons are combined with & rather than &&, which would branch,
+     // so that the loop which counts these points is vectorized.
+     //-------------------------------------------------------------------------
+        static
+        inline
+        size_t
+        isOutsideSinglePrecisionRange
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double xEcefMeters,
+                    const double yEcefMeters,
+                    const double zEcefMeters
+               )
+          {
+          //--------------------------------------------------------------------
+             const double L = SINGLE_PRECISION_RANGE_LIMIT_METERS;
+          //--------------------------------------------------------------------
+             return( 1 - ( ( fabs( xEcefMeters ) <= L ) &
+                           ( fabs( yEcefMeters ) <= L ) &
+                           ( fabs( zEcefMeters ) <= L ) ) );
+          //--------------------------------------------------------------------
+          };
+
+     //-------------------------------------------------------------------------
+     // 1 for a point which the forward float kernel does not convert:  an
+     // angle beyond FORWARD_SINE_COSINE_ANGLE_LIMIT, or NAN, or a length
+     // rho or rhoz which is not positive.
+     //-------------------------------------------------------------------------
+        static
+        inline
+        size_t
+        isForwardSinglePrecisionException
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double geodeticNorthLatitudeRadians,
+                    const double geocentricEastLongitudeRadians,
+                    const double smallerLengthMeters
+               )
+          {
+          //--------------------------------------------------------------------
+             const double L = FORWARD_SINE_COSINE_ANGLE_LIMIT;
+          //--------------------------------------------------------------------
+             return( 1 - ( ( fabs( geodeticNorthLatitudeRadians   ) <= L ) &
+                           ( fabs( geocentricEastLongitudeRadians ) <= L ) &
+                           ( smallerLengthMeters > 0.0 ) ) );
+          //--------------------------------------------------------------------
+          };
+
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    convertEcefToGeodeticBatchChunkForSinglePrecision
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    Convert one cache resident chunk of an inverse batch.  The first
+     //    loop holds all of the arithmetic and is vectorized; the second
+     //    sets the point status, puts NAN on points which are not finite
+     //    and converts points beyond SINGLE_PRECISION_RANGE_LIMIT_METERS,
+     //    where the float Halley step could overflow, with the double
+     //    ellipsoid context 'convertEcefToGeodetic'.
+     //
+     //-------------------------------------------------------------------------
+        static
+        __attribute__(( noinline ))
+        void
+        convertEcefToGeodeticBatchChunkForSinglePrecision
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   chunkPoints,
+                    const double * __restrict__ x,
+                    const double * __restrict__ y,
+                    const double * __restrict__ z,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * __restrict__ latitude,
+                          double * __restrict__ longitude,
+                          double * __restrict__ altitude,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * __restrict__ status
+               )
+          {
+          //--------------------------------------------------------------------
+             const EARTH_ELLIPSOID_CONTEXT
+              ellipsoidContext = rEllipsoidContext;
+          //--------------------------------------------------------------------
+             for( size_t i = 0; i < chunkPoints; i++ )
+               {
+                   convertEcefToGeodeticForSinglePrecision
+                          (
+                            ellipsoidContext,
+                            x[ i ],
+                            y[ i ],
+                            z[ i ],
+                            latitude [ i ],
+                            longitude[ i ],
+                            altitude [ i ]
+                          );
+               };
+          //--------------------------------------------------------------------
+             size_t numberOutOfRange = 0;
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             for( size_t i = 0; i < chunkPoints; i++ )
+               {
+                   status[ i ]       = SUCCESSFUL_CONVERSION;
+                   numberOutOfRange += isOutsideSinglePrecisionRange
+                                              (
+                                                x[ i ],
+                                                y[ i ],
+                                                z[ i ]
+                                              );
+               };
+          //--------------------------------------------------------------------
+             if( numberOutOfRange == 0 )
+               {
+                   return;
+               };
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             for( size_t i = 0; i < chunkPoints; i++ )
+               {
+                //--------------------------------------------------------------
+                   if( !isOutsideSinglePrecisionRange( x[ i ],
+                                                       y[ i ],
+                                                       z[ i ] ) )
+                     {
+                        continue;
+                     };
+                //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                   const bool finiteCoordinates =
+                                ( fabs( x[ i ] ) <= DBL_MAX ) &&
+                                ( fabs( y[ i ] ) <= DBL_MAX ) &&
+                                ( fabs( z[ i ] ) <= DBL_MAX );
+                //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                   if( finiteCoordinates )
+                     {
+                        status   [ i ] = convertEcefToGeodetic
+                                                (
+                                                  rEllipsoidContext,
+                                                  x[ i ],
+                                                  y[ i ],
+                                                  z[ i ],
+                                                  latitude [ i ],
+                                                  longitude[ i ],
+                                                  altitude [ i ]
+                                                );
+                     }
+                   else
+                     {
+                        status   [ i ] = INVALID_ECEF_COORDINATES;
+                        latitude [ i ] = NAN;
+                        longitude[ i ] = NAN;
+                        altitude [ i ] = NAN;
+                     };
+                //--------------------------------------------------------------
+               };
+          //--------------------------------------------------------------------
+          };
+
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    convertGeodeticToEcefBatchChunkForSinglePrecision
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    Convert one cache resident chunk of a forward batch.  The first
+     //    loop is vectorized and keeps the smaller length of each point; the
+     //    second sets the point status, puts NAN on points with a length
+     //    which is not positive, and converts the points with an angle
+     //    beyond FORWARD_SINE_COSINE_ANGLE_LIMIT, or NAN, with the double
+     //    ellipsoid context 'convertGeodeticToEcef'.  Returns the number of
+     //    points which are not converted.
+     //
+     //-------------------------------------------------------------------------
+        static
+        __attribute__(( noinline ))
+        size_t
+        convertGeodeticToEcefBatchChunkForSinglePrecision
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   chunkPoints,
+                    const double * __restrict__ latitude,
+                    const double * __restrict__ longitude,
+                    const double * __restrict__ altitude,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * __restrict__ x,
+                          double * __restrict__ y,
+                          double * __restrict__ z,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * __restrict__ status
+               )
+          {
+          //--------------------------------------------------------------------
+             const EARTH_ELLIPSOID_CONTEXT
+              ellipsoidContext = rEllipsoidContext;
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             double smallerLengthMeters[ SINGLE_PRECISION_CHUNK_POINTS ];
+          //--------------------------------------------------------------------
+             for( size_t i = 0; i < chunkPoints; i++ )
+               {
+                   smallerLengthMeters[ i ] =
+                   convertGeodeticToEcefForSinglePrecision
+                          (
+                            ellipsoidContext,
+                            latitude [ i ],
+                            longitude[ i ],
+                            altitude [ i ],
+                            x[ i ],
+                            y[ i ],
+                            z[ i ]
+                          );
+               };
+          //--------------------------------------------------------------------
+             size_t numberExceptions = 0;
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             for( size_t i = 0; i < chunkPoints; i++ )
+               {
+                   status[ i ]       = SUCCESSFUL_CONVERSION;
+                   numberExceptions += isForwardSinglePrecisionException
+                                              (
+                                                latitude [ i ],
+                                                longitude[ i ],
+                                                smallerLengthMeters[ i ]
+                                              );
+               };
+          //--------------------------------------------------------------------
+             if( numberExceptions == 0 )
+               {
+                   return( 0 );
+               };
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             size_t numberNotConverted = 0;
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             for( size_t i = 0; i < chunkPoints; i++ )
+               {
+                //--------------------------------------------------------------
+                   const bool anglesInRange =
+                      ( fabs( latitude [ i ] ) <=
+                        FORWARD_SINE_COSINE_ANGLE_LIMIT ) &&
+                      ( fabs( longitude[ i ] ) <=
+                        FORWARD_SINE_COSINE_ANGLE_LIMIT );
+                //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                   if( !anglesInRange )
+                     {
+                        status[ i ] = convertGeodeticToEcef
+                                             (
+                                               rEllipsoidContext,
+                                               latitude [ i ],
+                                               longitude[ i ],
+                                               altitude [ i ],
+                                               x[ i ],
+                                               y[ i ],
+                                               z[ i ]
+                                             );
+                     }
+                   else
+                   if( !( smallerLengthMeters[ i ] > 0.0 ) )
+                     {
+                        status[ i ] = INVALID_GEODETIC_ALTITUDE;
+                        x     [ i ] = NAN;
+                        y     [ i ] = NAN;
+                        z     [ i ] = NAN;
+                     };
+                //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                   if( status[ i ] != SUCCESSFUL_CONVERSION )
+                     {
+                        numberNotConverted++;
+                     };
+                //--------------------------------------------------------------
+               };
+          //--------------------------------------------------------------------
+             return( numberNotConverted );
+          //--------------------------------------------------------------------
+          };
+
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    convertEcefToGeodeticBatchForSinglePrecisionInChunks
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    Convert an inverse batch in chunks of SINGLE_PRECISION_CHUNK_POINTS
+     //    points.  The chunk function is called directly rather than
+     //    through 'convertEcefToGeodeticBatchForAccuracyTierInChunks', whose
+     //    function pointer would here be a constant that the compiler
+     //    inlines through, dropping the restrict qualifiers that let the
+     //    chunk loops vectorize; the chunk functions are not inlined.
+     //
+     //-------------------------------------------------------------------------
+        static
+        void
+        convertEcefToGeodeticBatchForSinglePrecisionInChunks
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pGeodeticNorthLatitudeRadians,
+                          double * pGeocentricEastLongitudeRadians,
+                          double * pGeodeticAltitudeMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               )
+          {
+          //--------------------------------------------------------------------
+             for(
+                  size_t chunkStart  = 0;
+                         chunkStart  < numberPoints;
+                         chunkStart += SINGLE_PRECISION_CHUNK_POINTS
+                )
+               {
+                //--------------------------------------------------------------
+                   const
+                   size_t
+                    chunkPoints =
+                      ( numberPoints - chunkStart <
+                        SINGLE_PRECISION_CHUNK_POINTS ) ?
+                      ( numberPoints - chunkStart ) :
+                      SINGLE_PRECISION_CHUNK_POINTS;
+                //--------------------------------------------------------------
+                   convertEcefToGeodeticBatchChunkForSinglePrecision
+                          (
+                            rEllipsoidContext,
+                            chunkPoints,
+                            pXEcefMeters                    + chunkStart,
+                            pYEcefMeters                    + chunkStart,
+                            pZEcefMeters                    + chunkStart,
+                            pGeodeticNorthLatitudeRadians   + chunkStart,
+                            pGeocentricEastLongitudeRadians + chunkStart,
+                            pGeodeticAltitudeMeters         + chunkStart,
+                            pConversionStatus               + chunkStart
+                          );
+                //--------------------------------------------------------------
+               };
+          //--------------------------------------------------------------------
+          };
+
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    convertGeodeticToEcefBatchForSinglePrecisionInChunks
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    Convert a forward batch in chunks of SINGLE_PRECISION_CHUNK_POINTS
+     //    points.  Returns the number of points which are not converted.
+     //
+     //-------------------------------------------------------------------------
+        static
+        size_t
+        convertGeodeticToEcefBatchForSinglePrecisionInChunks
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   numberPoints,
+                    const double * pGeodeticNorthLatitudeRadians,
+                    const double * pGeocentricEastLongitudeRadians,
+                    const double * pGeodeticAltitudeMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pXEcefMeters,
+                          double * pYEcefMeters,
+                          double * pZEcefMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               )
+          {
+          //--------------------------------------------------------------------
+             size_t numberNotConverted = 0;
+          //--------------------------------------------------------------------
+             for(
+                  size_t chunkStart  = 0;
+                         chunkStart  < numberPoints;
+                         chunkStart += SINGLE_PRECISION_CHUNK_POINTS
+                )
+               {
+                //--------------------------------------------------------------
+                   const
+                   size_t
+                    chunkPoints =
+                      ( numberPoints - chunkStart <
+                        SINGLE_PRECISION_CHUNK_POINTS ) ?
+                      ( numberPoints - chunkStart ) :
+                      SINGLE_PRECISION_CHUNK_POINTS;
+                //--------------------------------------------------------------
+                   numberNotConverted +=
+                   convertGeodeticToEcefBatchChunkForSinglePrecision
+                          (
+                            rEllipsoidContext,
+                            chunkPoints,
+                            pGeodeticNorthLatitudeRadians   + chunkStart,
+                            pGeocentricEastLongitudeRadians + chunkStart,
+                            pGeodeticAltitudeMeters         + chunkStart,
+                            pXEcefMeters                    + chunkStart,
+                            pYEcefMeters                    + chunkStart,
+                            pZEcefMeters                    + chunkStart,
+                            pConversionStatus               + chunkStart
+                          );
+                //--------------------------------------------------------------
+               };
+          //--------------------------------------------------------------------
+             return( numberNotConverted );
+          //--------------------------------------------------------------------
+          };
+     //-------------------------------------------------------------------------
+#endif
+//==============================================================================
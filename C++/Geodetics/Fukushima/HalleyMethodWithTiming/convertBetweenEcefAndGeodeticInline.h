@@ -0,0 +1,399 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#ifndef CONVERT_BETWEEN_ECEF_AND_GEODETIC_INLINE_H
+     //-------------------------------------------------------------------------
+#       define CONVERT_BETWEEN_ECEF_AND_GEODETIC_INLINE_H
+
+#       include <float.h>
+#       include <math.h>
+
+#       include "conversionBetweenEcefAndGeodetic.h"
+
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    The bodies of the scalar conversions 'convertEcefToGeodetic' and
+     //    'convertGeodeticToEcef', as inline functions.  The out-of-line
+     //    functions of 'convertEcefToGeodetic.cpp' and
+     //    'convertGeodeticToEcef.cpp' call these, so there is one
+     //    implementation, and a caller which includes this header gets the
+     //    conversion inlined into its loop:  the validation of the
+     //    ellipsoid parameters and the functions of them are loop
+     //    invariant and hoisted by the compiler, and are folded to
+     //    constants when the parameters are constant expressions.
+     //
+     //    The inlined results are those of the options of the caller.  A
+     //    caller compiled for the x86-64 baseline gets the results of
+     //    'convertEcefToGeodeticBaselineClone' and
+     //    'convertGeodeticToEcefBaselineClone' bit for bit; the out-of-line
+     //    entry points are bound to the clone of the host, which on an
+     //    x86-64-v3 or x86-64-v4 host differs in the last bits.
+     //
+     //    The kernels cannot themselves be 'constexpr', since 'sqrt' and
+     //    'atan2' are not; 'computeEarthEllipticitySquared' is.
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  USAGE:
+     //
+     //    for( size_t i = 0; i < numberPoints; i++ )
+     //      {
+     //         ecefToGeodeticConversionStatus =
+     //         convertEcefToGeodeticInline
+     //                (
+     //                  //-------------------
+     //                  // INPUT(s):
+     //                  //-------------------
+     //                     earthEquatorialRadiusMeters,
+     //                     earthEllipsoidalFlatteningFactor,
+     //                     xEcefMeters[ i ],
+     //                     yEcefMeters[ i ],
+     //                     zEcefMeters[ i ],
+     //                  //-------------------
+     //                  // OUTPUT(s):
+     //                  //-------------------
+     //                     latitudeRadians [ i ],
+     //                     longitudeRadians[ i ],
+     //                     altitudeMeters  [ i ]
+     //                );
+     //      };
+     //
+     //-------------------------------------------------------------------------
+
+     //-------------------------------------------------------------------------
+     // The squared eccentricity e^2 = ( 2 - f ) f of the flattening factor f,
+     // in the order of operations of 'convertEcefToGeodetic'.
+     //-------------------------------------------------------------------------
+        constexpr
+        double
+        computeEarthEllipticitySquared
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double earthEllipsoidalFlatteningFactor
+               )
+          {
+             return( ( 2.0 - earthEllipsoidalFlatteningFactor ) *
+                             earthEllipsoidalFlatteningFactor );
+          };
+
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    convertEcefToGeodeticInline
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The inline body of 'convertEcefToGeodetic', which see for the
+     //    inputs, outputs, returned value and references.
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  METHOD:
+     //    The single Halley iteration of Reference [ 1 ] of
+     //    'convertEcefToGeodetic', with the ellipsoid and coordinate
+     //    validation first and the operations in the order of the
+     //    original, so the inlined and the out-of-line results are
+     //    identical.
+     //
+     //-------------------------------------------------------------------------
+        inline
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertEcefToGeodeticInline
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double  earthEquatorialRadiusMeters,
+                    const double  earthEllipsoidalFlatteningFactor,
+                    const double  xEcefMeters,
+                    const double  yEcefMeters,
+                    const double  zEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double &rEstimatedGeodeticNorthLatitudeRadians,
+                          double &rEstimatedGeocentricEastLongitudeRadians,
+                          double &rEstimatedGeodeticAltitudeMeters
+               )
+          {
+          //--------------------------------------------------------------------
+          // Functions of the ellipsoid parameters.
+          //--------------------------------------------------------------------
+             const double eps           = 1.0e-16;
+             const double aEps          = earthEquatorialRadiusMeters * eps;
+             const double aEpsSquared   = aEps                        * aEps;
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             const double earthEllipticitySquared =
+                             computeEarthEllipticitySquared
+                                    (
+                                      earthEllipsoidalFlatteningFactor
+                                    );
+             const double earthEllipticityForth   =
+                             earthEllipticitySquared * earthEllipticitySquared;
+             const double oneAndHalf_e4           =
+                             1.5 * earthEllipticityForth;
+             const double complimentaryEarthEllipticitySquared
+                                                  =
+                             1.0 - earthEllipticitySquared;
+          //--------------------------------------------------------------------
+          // Validate the ellipsoid parameters, in the order of the checks
+          // of 'convertEcefToGeodetic', then the coordinates:  a NAN or an
+          // infinite coordinate would otherwise fall into the polar branch
+          // and be reported as a successful conversion at a pole.
+          //--------------------------------------------------------------------
+             ECEF_TO_GEODETIC_CONVERSION_STATUS
+                     returnValue = SUCCESSFUL_CONVERSION;
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             if(
+                 !(
+                    ( earthEllipsoidalFlatteningFactor >= 0.0 )
+                    &&
+                    ( earthEllipsoidalFlatteningFactor <  1.0 )
+                  )
+               )
+               {
+                  returnValue = INVALID_ELLIPSOIDAL_FLATTENING;
+               }
+             else
+             if( !( earthEquatorialRadiusMeters > 0.0 ) )
+               {
+                  returnValue = INVALID_EQUATORIAL_RADIUS;
+               }
+             else
+             if( !( complimentaryEarthEllipticitySquared > 0.0 ) )
+               {
+                  returnValue = INVALID_ELLIPSOIDAL_FLATTENING;
+               }
+             else
+             if(
+                 !(
+                    ( fabs( xEcefMeters ) <= DBL_MAX )
+                    &&
+                    ( fabs( yEcefMeters ) <= DBL_MAX )
+                    &&
+                    ( fabs( zEcefMeters ) <= DBL_MAX )
+                  )
+               )
+               {
+                  returnValue = INVALID_ECEF_COORDINATES;
+               };
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             if( returnValue != SUCCESSFUL_CONVERSION )
+               {
+                  rEstimatedGeodeticNorthLatitudeRadians   = NAN;
+                  rEstimatedGeocentricEastLongitudeRadians = NAN;
+                  rEstimatedGeodeticAltitudeMeters         = NAN;
+               //---------------------------------------------------------------
+                  return( returnValue );
+               //---------------------------------------------------------------
+               };
+          //--------------------------------------------------------------------
+             const double complimentaryEarthEllipticity =
+                             sqrt( complimentaryEarthEllipticitySquared );
+             const double earthPolarRadiusMeters        =
+                             complimentaryEarthEllipticity *
+                             earthEquatorialRadiusMeters;
+          //--------------------------------------------------------------------
+          // Distance from the polar axis squared, and the geocentric
+          // longitude.
+          //--------------------------------------------------------------------
+             const double earthPolarAxisDistanceSquared =
+                                        ( xEcefMeters * xEcefMeters ) +
+                                        ( yEcefMeters * yEcefMeters );
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             rEstimatedGeocentricEastLongitudeRadians =
+                     ( earthPolarAxisDistanceSquared > 0.0 ) ?
+                                     atan2( yEcefMeters, xEcefMeters ) : 0.0;
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             const double absZ = fabs( zEcefMeters );
+          //--------------------------------------------------------------------
+             if( earthPolarAxisDistanceSquared > aEpsSquared )
+               {
+               //---------------------------------------------------------------
+               // Normalization, Equations (2) and (17) of Reference [ 1 ],
+               // without the factor of ec in Equation (2).
+               //---------------------------------------------------------------
+                  const double earthPolarAxisDistanceMeters =
+                                        sqrt( earthPolarAxisDistanceSquared );
+               //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                  const double S0 = absZ / earthEquatorialRadiusMeters;
+                  const double Pn = earthPolarAxisDistanceMeters /
+                                    earthEquatorialRadiusMeters;
+                  const double zc = complimentaryEarthEllipticity * S0;
+               //---------------------------------------------------------------
+               // The Newton correction factors, Equations (17), (14), (12)
+               // and (13).
+               //---------------------------------------------------------------
+                  const double C0        = complimentaryEarthEllipticity * Pn;
+                  const double C0Squared = C0 * C0;
+                  const double C0Cubed   = C0 * C0Squared;
+                  const double S0Squared = S0 * S0;
+                  const double S0Cubed   = S0 * S0Squared;
+                  const double A0Squared = C0Squared + S0Squared;
+                  const double A0        = sqrt( A0Squared );
+                  const double A0Cubed   = A0 * A0Squared;
+               //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                  const double D0 = (  zc                      * A0Cubed ) +
+                                    (  earthEllipticitySquared * S0Cubed );
+                  const double F0 = (  Pn                      * A0Cubed ) +
+                                    ( -earthEllipticitySquared * C0Cubed );
+               //---------------------------------------------------------------
+               // The Halley correction factors, Equations (15), (10), (11)
+               // and (21).
+               //---------------------------------------------------------------
+                  const double B0 = oneAndHalf_e4 *
+                                    S0Squared     *
+                                    C0Squared     *
+                                    Pn            *
+                                    ( A0 - complimentaryEarthEllipticity );
+                  const double S1 = ( D0 * F0 ) + ( -B0 * S0 );
+                  const double C1 = ( F0 * F0 ) + ( -B0 * C0 );
+                  const double Cc = complimentaryEarthEllipticity * C1;
+               //---------------------------------------------------------------
+               // The geodetic latitude, Equation (19), and altitude,
+               // Equation (20), where a1 is ec times A1 of Equation (14).
+               //---------------------------------------------------------------
+                  rEstimatedGeodeticNorthLatitudeRadians = atan2( S1, Cc );
+               //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                  const double S1Squared = S1 * S1;
+                  const double CcSquared = Cc * Cc;
+                  const double a1        =
+                           sqrt(
+                                 (
+                                   complimentaryEarthEllipticitySquared *
+                                   S1Squared
+                                 )
+                                 +
+                                 CcSquared
+                               );
+               //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                  rEstimatedGeodeticAltitudeMeters
+                      = (
+                          (  earthPolarAxisDistanceMeters * Cc ) +
+                          (  absZ                         * S1 ) +
+                          ( -earthEquatorialRadiusMeters  * a1 )
+                        ) / sqrt( CcSquared + S1Squared );
+               //---------------------------------------------------------------
+               }
+             else
+               {
+               //---------------------------------------------------------------
+               // The vicinity of the polar axis.
+               //---------------------------------------------------------------
+                  const double piOverTwo = 2.0 * atan( 1.0 );
+               //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                  rEstimatedGeodeticNorthLatitudeRadians = piOverTwo;
+                  rEstimatedGeodeticAltitudeMeters       =
+                                        absZ - earthPolarRadiusMeters;
+               //---------------------------------------------------------------
+               };
+          //--------------------------------------------------------------------
+          // Southern hemisphere.
+          //--------------------------------------------------------------------
+             if( zEcefMeters < 0.0 )
+               {
+                  rEstimatedGeodeticNorthLatitudeRadians =
+                                    -rEstimatedGeodeticNorthLatitudeRadians;
+               };
+          //--------------------------------------------------------------------
+             return( SUCCESSFUL_CONVERSION );
+          //--------------------------------------------------------------------
+          };
+
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    convertGeodeticToEcefInline
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The inline body of 'convertGeodeticToEcef', which see for the
+     //    inputs, outputs, returned value and references.
+     //
+     //-------------------------------------------------------------------------
+        inline
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertGeodeticToEcefInline
+               (
+                //----------------
+                // INPUT(s):
+                //----------------
+                   const double   earthEquatorialRadiusMeters,
+                   const double   earthEllipsoidalEccentricitySquared,
+                   const double   geodeticNorthLatitudeRadians,
+                   const double   geocentricEastLongitudeRadians,
+                   const double   geodeticAltitudeMeters,
+                //----------------
+                // OUTPUT(s):
+                //----------------
+                         double & rXEcefMeters,
+                         double & rYEcefMeters,
+                         double & rZEcefMeters
+               )
+          {
+          //--------------------------------------------------------------------
+             const double   sineOfGeodeticNorthLatitude   =
+                                   sin( geodeticNorthLatitudeRadians   );
+             const double cosineOfGeodeticNorthLatitude   =
+                                   cos( geodeticNorthLatitudeRadians   );
+             const double   sineOfGeocentricEastLongitude =
+                                   sin( geocentricEastLongitudeRadians );
+             const double cosineOfGeocentricEastLongitude =
+                                   cos( geocentricEastLongitudeRadians );
+          //--------------------------------------------------------------------
+          // The prime vertical radius of curvature N, Equation (48) of
+          // Reference [ 2 ] of 'convertGeodeticToEcef'.
+          //--------------------------------------------------------------------
+             const double N    = earthEquatorialRadiusMeters /
+                                 sqrt(
+                                       1.0E0 +
+                                       (
+                                         -earthEllipsoidalEccentricitySquared *
+                                          sineOfGeodeticNorthLatitude         *
+                                          sineOfGeodeticNorthLatitude
+                                       )
+                                     );
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             const double rho  = N + geodeticAltitudeMeters;
+             const double rhoz =
+                    ( ( 1.0E0 - earthEllipsoidalEccentricitySquared ) * N ) +
+                    geodeticAltitudeMeters;
+          //--------------------------------------------------------------------
+             if(
+                 ( rho  > 0.0E0 ) &&
+                 ( rhoz > 0.0E0 )
+               )
+               {
+               //---------------------------------------------------------------
+               // Equation (277) of Reference [ 2 ].
+               //---------------------------------------------------------------
+                  const double r = rho * cosineOfGeodeticNorthLatitude;
+               //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                  rXEcefMeters = r    * cosineOfGeocentricEastLongitude;
+                  rYEcefMeters = r    *   sineOfGeocentricEastLongitude;
+                  rZEcefMeters = rhoz *   sineOfGeodeticNorthLatitude;
+               //---------------------------------------------------------------
+                  return( SUCCESSFUL_CONVERSION );
+               //---------------------------------------------------------------
+               };
+          //--------------------------------------------------------------------
+          // The length quantities are not all positive.
+          //--------------------------------------------------------------------
+             rXEcefMeters = NAN;
+             rYEcefMeters = NAN;
+             rZEcefMeters = NAN;
+          //--------------------------------------------------------------------
+             return( INVALID_GEODETIC_ALTITUDE );
+          //--------------------------------------------------------------------
+          };
+     //-------------------------------------------------------------------------
+#endif
+//==============================================================================
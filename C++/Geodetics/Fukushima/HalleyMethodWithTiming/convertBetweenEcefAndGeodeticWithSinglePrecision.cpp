@@ -0,0 +1,286 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include "convertBetweenEcefAndGeodeticForSinglePrecision.h"
+
+//------------------------------------------------------------------------------
+// The instruction set level of this CPU, detected once; the widest
+// supported kernel is used for every single precision batch.
+//------------------------------------------------------------------------------
+static
+const
+ECEF_TO_GEODETIC_ISA_LEVEL
+ supportedIsaLevel = detectEcefToGeodeticIsaLevel( );
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticBatchInSinglePrecision
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pEstimatedGeodeticNorthLatitudeRadians,
+                  double * pEstimatedGeocentricEastLongitudeRadians,
+                  double * pEstimatedGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticBatchInSinglePrecision
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    As the ellipsoid context overload of 'convertEcefToGeodeticBatch',
+//    with the Halley step and the atan2 of both angles in single
+//    precision, so that each SIMD register holds twice as many points,
+//    to the error bounds SINGLE_PRECISION_ANGLE_BOUND_RADIANS and
+//    SINGLE_PRECISION_ALTITUDE_BOUND_METERS.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    The kernels of 'convertBetweenEcefAndGeodeticForSinglePrecision.h',
+//    compiled for the widest instruction set level the CPU supports.
+//    The coordinates are read and the results written in double; the
+//    float direction of the normal is promoted to double for Equation
+//    (20), so the altitude keeps the accuracy of the double kernels
+//    while the angles carry the rounding of float, about 1e-7 radians.
+//
+//------------------------------------------------------------------------------
+//
+//  INPUTS:
+//
+//     rEllipsoidContext
+//       Reference to an ellipsoid context for which
+//       'initializeEarthEllipsoidContext' returned SUCCESSFUL_CONVERSION.
+//
+//     numberPoints
+//     pXEcefMeters
+//     pYEcefMeters
+//     pZEcefMeters
+//       As for 'convertEcefToGeodeticBatch'.
+//
+//------------------------------------------------------------------------------
+//
+//  OUTPUT:
+//
+//     pEstimatedGeodeticNorthLatitudeRadians
+//     pEstimatedGeocentricEastLongitudeRadians
+//     pEstimatedGeodeticAltitudeMeters
+//     pConversionStatus
+//       As for 'convertEcefToGeodeticBatch'.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The bounds hold for altitudes from -10 km to 50000 km.  Points
+//          with a coordinate beyond SINGLE_PRECISION_RANGE_LIMIT_METERS,
+//          where the float Halley step could overflow, are converted in
+//          double by the ellipsoid context 'convertEcefToGeodetic'.
+//
+//    [ 2 ] The bounds are checked by 'sweepAccuracyConvertEcefToGeodetic'
+//          with "float" as its last argument, and by
+//          'executeSinglePrecisionTimingConvertEcefToGeodetic'.
+//
+//    [ 3 ] This file is compiled with '-O3 -fno-math-errno
+//          -fno-trapping-math' (see 'buildTestConvertEcefToGeodetic.sh'),
+//          so the baseline batch loop is vectorized.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    if( supportedIsaLevel == AVX512_ISA_LEVEL )
+      {
+          convertEcefToGeodeticBatchInSinglePrecisionAvx512Kernel
+                 (
+                   rEllipsoidContext,
+                   numberPoints,
+                   pXEcefMeters,
+                   pYEcefMeters,
+                   pZEcefMeters,
+                   pEstimatedGeodeticNorthLatitudeRadians,
+                   pEstimatedGeocentricEastLongitudeRadians,
+                   pEstimatedGeodeticAltitudeMeters,
+                   pConversionStatus
+                 );
+      }
+    else
+    if( supportedIsaLevel == AVX2_FMA_ISA_LEVEL )
+      {
+          convertEcefToGeodeticBatchInSinglePrecisionAvx2Kernel
+                 (
+                   rEllipsoidContext,
+                   numberPoints,
+                   pXEcefMeters,
+                   pYEcefMeters,
+                   pZEcefMeters,
+                   pEstimatedGeodeticNorthLatitudeRadians,
+                   pEstimatedGeocentricEastLongitudeRadians,
+                   pEstimatedGeodeticAltitudeMeters,
+                   pConversionStatus
+                 );
+      }
+    else
+      {
+          convertEcefToGeodeticBatchForSinglePrecisionInChunks
+                 (
+                   rEllipsoidContext,
+                   numberPoints,
+                   pXEcefMeters,
+                   pYEcefMeters,
+                   pZEcefMeters,
+                   pEstimatedGeodeticNorthLatitudeRadians,
+                   pEstimatedGeocentricEastLongitudeRadians,
+                   pEstimatedGeodeticAltitudeMeters,
+                   pConversionStatus
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertGeodeticToEcefBatchInSinglePrecision
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const double * pGeodeticNorthLatitudeRadians,
+            const double * pGeocentricEastLongitudeRadians,
+            const double * pGeodeticAltitudeMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pXEcefMeters,
+                  double * pYEcefMeters,
+                  double * pZEcefMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertGeodeticToEcefBatchInSinglePrecision
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    As 'convertGeodeticToEcefBatch', for an ellipsoid context, with the
+//    sines and cosines in single precision, to the error bound
+//    SINGLE_PRECISION_FORWARD_BOUND_METERS on each coordinate.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    The kernels of 'convertBetweenEcefAndGeodeticForSinglePrecision.h',
+//    compiled for the widest instruction set level the CPU supports.  The
+//    angles are reduced by pi / 2 in double and the reduced angles
+//    rounded to float, so the sines and cosines carry errors of about
+//    1e-7 of their size, whatever the angle; N, N + h and the products
+//    are double.
+//
+//------------------------------------------------------------------------------
+//
+//  RETURNED VALUE:
+//
+//     SUCCESSFUL_CONVERSION when every point is converted, otherwise
+//     INVALID_GEODETIC_ALTITUDE, as for 'convertGeodeticToEcefBatch'.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The coordinate error is the error of the sines and cosines
+//          times N + h, so SINGLE_PRECISION_FORWARD_BOUND_METERS holds for
+//          altitudes up to 2000 km; beyond, it grows in proportion.
+//
+//    [ 2 ] Points with an angle beyond FORWARD_SINE_COSINE_ANGLE_LIMIT
+//          radians, or NAN, are converted in double by the ellipsoid
+//          context 'convertGeodeticToEcef'.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    size_t
+     numberNotConverted;
+ //-----------------------------------------------------------------------------
+    if( supportedIsaLevel == AVX512_ISA_LEVEL )
+      {
+          numberNotConverted =
+          convertGeodeticToEcefBatchInSinglePrecisionAvx512Kernel
+                 (
+                   rEllipsoidContext,
+                   numberPoints,
+                   pGeodeticNorthLatitudeRadians,
+                   pGeocentricEastLongitudeRadians,
+                   pGeodeticAltitudeMeters,
+                   pXEcefMeters,
+                   pYEcefMeters,
+                   pZEcefMeters,
+                   pConversionStatus
+                 );
+      }
+    else
+    if( supportedIsaLevel == AVX2_FMA_ISA_LEVEL )
+      {
+          numberNotConverted =
+          convertGeodeticToEcefBatchInSinglePrecisionAvx2Kernel
+                 (
+                   rEllipsoidContext,
+                   numberPoints,
+                   pGeodeticNorthLatitudeRadians,
+                   pGeocentricEastLongitudeRadians,
+                   pGeodeticAltitudeMeters,
+                   pXEcefMeters,
+                   pYEcefMeters,
+                   pZEcefMeters,
+                   pConversionStatus
+                 );
+      }
+    else
+      {
+          numberNotConverted =
+          convertGeodeticToEcefBatchForSinglePrecisionInChunks
+                 (
+                   rEllipsoidContext,
+                   numberPoints,
+                   pGeodeticNorthLatitudeRadians,
+                   pGeocentricEastLongitudeRadians,
+                   pGeodeticAltitudeMeters,
+                   pXEcefMeters,
+                   pYEcefMeters,
+                   pZEcefMeters,
+                   pConversionStatus
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    return( ( numberNotConverted == 0 ) ? SUCCESSFUL_CONVERSION :
+                                          INVALID_GEODETIC_ALTITUDE );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,132 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include "convertBetweenEcefAndGeodeticForSinglePrecision.h"
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticBatchInSinglePrecisionAvx2Kernel
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pGeodeticNorthLatitudeRadians,
+                  double * pGeocentricEastLongitudeRadians,
+                  double * pGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticBatchInSinglePrecisionAvx2Kernel
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Eight float lane AVX2 + FMA batch kernel of
+//    'convertEcefToGeodeticBatchInSinglePrecision'.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] This file is compiled with '-mavx2 -mfma'.  It must only be
+//          called when 'detectEcefToGeodeticIsaLevel' reports at least
+//          AVX2_FMA_ISA_LEVEL.
+//
+//    [ 2 ] The kernels of 'convertBetweenEcefAndGeodeticForSinglePrecision.h'
+//          are vectorized by the compiler for this instruction set; with
+//          FMA contractions the results may differ from those of the
+//          baseline kernel in the last bits.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticBatchForSinglePrecisionInChunks
+           (
+             rEllipsoidContext,
+             numberPoints,
+             pXEcefMeters,
+             pYEcefMeters,
+             pZEcefMeters,
+             pGeodeticNorthLatitudeRadians,
+             pGeocentricEastLongitudeRadians,
+             pGeodeticAltitudeMeters,
+             pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
+
+//------------------------------------------------------------------------------
+size_t
+convertGeodeticToEcefBatchInSinglePrecisionAvx2Kernel
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const double * pGeodeticNorthLatitudeRadians,
+            const double * pGeocentricEastLongitudeRadians,
+            const double * pGeodeticAltitudeMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pXEcefMeters,
+                  double * pYEcefMeters,
+                  double * pZEcefMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertGeodeticToEcefBatchInSinglePrecisionAvx2Kernel
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Eight float lane AVX2 + FMA batch kernel of
+//    'convertGeodeticToEcefBatchInSinglePrecision'.  Returns the number of
+//    points which are not converted.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] As for 'convertEcefToGeodeticBatchInSinglePrecisionAvx2Kernel'.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    return( convertGeodeticToEcefBatchForSinglePrecisionInChunks
+                   (
+                     rEllipsoidContext,
+                     numberPoints,
+                     pGeodeticNorthLatitudeRadians,
+                     pGeocentricEastLongitudeRadians,
+                     pGeodeticAltitudeMeters,
+                     pXEcefMeters,
+                     pYEcefMeters,
+                     pZEcefMeters,
+                     pConversionStatus
+                   ) );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,118 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include "conversionBetweenEcefAndGeodetic.h"
+#include "convertBetweenEcefAndGeodeticInline.h"
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertEcefToGeodeticX8664V3Clone
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double  earthEquatorialRadiusMeters,
+            const double  earthEllipsoidalFlatteningFactor,
+            const double  xEcefMeters,
+            const double  yEcefMeters,
+            const double  zEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double &rEstimatedGeodeticNorthLatitudeRadians,
+                  double &rEstimatedGeocentricEastLongitudeRadians,
+                  double &rEstimatedGeodeticAltitudeMeters
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticX8664V3Clone
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The x86-64-v3 clone of 'convertEcefToGeodetic', which
+//    'resolveConvertEcefToGeodetic' selects on hosts at that level.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] This file is compiled with '-march=x86-64-v3' (see
+//          'buildTestConvertEcefToGeodetic.sh'), under which the compiler
+//          contracts the multiplications and additions of
+//          'convertEcefToGeodeticInline' into FMA instructions.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    return(
+            convertEcefToGeodeticInline
+                   (
+                     earthEquatorialRadiusMeters,
+                     earthEllipsoidalFlatteningFactor,
+                     xEcefMeters,
+                     yEcefMeters,
+                     zEcefMeters,
+                     rEstimatedGeodeticNorthLatitudeRadians,
+                     rEstimatedGeocentricEastLongitudeRadians,
+                     rEstimatedGeodeticAltitudeMeters
+                   )
+          );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertGeodeticToEcefX8664V3Clone
+       (
+        //----------------
+        // INPUT(s):
+        //----------------
+           const double   earthEquatorialRadiusMeters,
+           const double   earthEllipsoidalEccentricitySquared,
+           const double   geodeticNorthLatitudeRadians,
+           const double   geocentricEastLongitudeRadians,
+           const double   geodeticAltitudeMeters,
+        //----------------
+        // OUTPUT(s):
+        //----------------
+                 double & rXEcefMeters,
+                 double & rYEcefMeters,
+                 double & rZEcefMeters
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertGeodeticToEcefX8664V3Clone
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The x86-64-v3 clone of 'convertGeodeticToEcef', which
+//    'resolveConvertGeodeticToEcef' selects on hosts at that level.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    return(
+            convertGeodeticToEcefInline
+                   (
+                     earthEquatorialRadiusMeters,
+                     earthEllipsoidalEccentricitySquared,
+                     geodeticNorthLatitudeRadians,
+                     geocentricEastLongitudeRadians,
+                     geodeticAltitudeMeters,
+                     rXEcefMeters,
+                     rYEcefMeters,
+                     rZEcefMeters
+                   )
+          );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
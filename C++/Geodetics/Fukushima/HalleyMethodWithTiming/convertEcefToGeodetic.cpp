@@ -4,6 +4,7 @@
 //==============================================================================
 
 #include "conversionBetweenEcefAndGeodetic.h"
+#include "convertBetweenEcefAndGeodeticInline.h"
 
 //------------------------------------------------------------------------------
 ECEF_TO_GEODETIC_CONVERSION_STATUS
@@ -24,6 +25,7 @@ convertEcefToGeodetic
                   double &rEstimatedGeocentricEastLongitudeRadians,
                   double &rEstimatedGeodeticAltitudeMeters
        )
+       __attribute__(( ifunc( "resolveConvertEcefToGeodetic" ) ));
 //==============================================================================
 //
 //  FUNCTION:
@@ -99,6 +101,9 @@ convertEcefToGeodetic
 //        UNDETERMINED_CONVERSION_STATUS
 //        INVALID_ELLIPSOIDAL_FLATTENING
 //        INVALID_EQUATORIAL_REDIUS
+//        INVALID_ECEF_COORDINATES  (a coordinate is NAN or infinite)
+//
+//     On failure the outputs are set to NAN.
 //
 //------------------------------------------------------------------------------
 //
@@ -113,6 +118,29 @@ convertEcefToGeodetic
 //    [ 3 ] The specified ellipsoidal flattening factor is (for the Earth)
 //          a value around 0.00335, (i.e. around 1/298).
 //
+//    [ 4 ] This function writes no messages and has no side effects other
+//          than its outputs, so it is reentrant.  The text describing a
+//          failed conversion is written by 'reportConvertEcefToGeodeticStatus',
+//          which a caller may call with the returned status.
+//
+//    [ 5 ] The conversion is 'convertEcefToGeodeticInline' of
+//          'convertBetweenEcefAndGeodeticInline.h'.  This out-of-line
+//          function keeps the symbol for existing callers; a caller which
+//          includes that header instead gets the conversion inlined, with
+//          the ellipsoid parameter setup hoisted out of its loop, and the
+//          results of the options it is compiled with (see Note 6).
+//
+//    [ 6 ] This function is a GNU indirect function (ifunc).  At load
+//          time 'resolveConvertEcefToGeodetic' binds it to the widest of
+//          the baseline x86-64, x86-64-v3 and x86-64-v4 clones which the
+//          host supports, so existing callers get FMA contracted
+//          arithmetic on modern hosts without being rebuilt.  The FMA
+//          clones differ from the baseline in the last bits only, within
+//          FULL_ACCURACY_TIER_ANGLE_BOUND_RADIANS and
+//          FULL_ACCURACY_TIER_ALTITUDE_BOUND_METERS, so the results depend
+//          on the host CPU; 'convertEcefToGeodeticBaselineClone' gives the
+//          same results on every host.
+//
 //------------------------------------------------------------------------------
 //
 //  AUTHOR(s):
@@ -188,459 +216,103 @@ convertEcefToGeodetic
 //           );
 //
 //==============================================================================
+
+//------------------------------------------------------------------------------
+extern "C"
+CONVERT_ECEF_TO_GEODETIC_FUNCTION
+resolveConvertEcefToGeodetic(  )
+//==============================================================================
+//
+//  FUNCTION:
+//    resolveConvertEcefToGeodetic
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The load time resolver of the indirect function
+//    'convertEcefToGeodetic':  return the widest clone of the levels of
+//    'detectEcefToGeodeticScalarCloneLevel' which the processor supports.
+//    It has C linkage so that the 'ifunc' attribute can name it.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    The resolver runs while the dynamic loader processes the relocations,
+//    before those of other functions may be bound, so it calls no
+//    function of another translation unit:  it tests the levels with the
+//    inline '__builtin_cpu_init' and '__builtin_cpu_supports' itself.
+//
+//==============================================================================
 {
  //-----------------------------------------------------------------------------
-    ECEF_TO_GEODETIC_CONVERSION_STATUS
-            returnValue = UNDETERMINED_CONVERSION_STATUS;
+    __builtin_cpu_init( );
  //-----------------------------------------------------------------------------
-    if(
-        ( earthEllipsoidalFlatteningFactor >= 0.0 )
-        &&
-        ( earthEllipsoidalFlatteningFactor <  1.0 )
-      )
+    if( __builtin_cpu_supports( "x86-64-v4" ) )
       {
-       //-----------------------------------------------------------------------
-       // The ellipsoidal flattening factor parameter value is valid.
-       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-       // Continue validating the specified ellipsoid parameters.
-       //-----------------------------------------------------------------------
-          if( earthEquatorialRadiusMeters > 0.0 )
-            {
-             //-----------------------------------------------------------------
-             // The Earth ellipsoid equatorial radius (major semiaxis length)
-             // parameter value is valid.
-             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-             // Determine functions of the ellipsoid parameters.
-             //-----------------------------------------------------------------
-                const double eps           = 1.0e-16;
-             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-                const double aEps          = earthEquatorialRadiusMeters * eps;
-                const double aEpsSquared   = aEps                        * aEps;
-             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-                const double earthEllipticitySquared =
-                                     ( 2.0 -
-                                       earthEllipsoidalFlatteningFactor ) *
-                                       earthEllipsoidalFlatteningFactor;
-                const double earthEllipticityForth   =
-                                       earthEllipticitySquared *
-                                       earthEllipticitySquared;
-                const double oneAndHalf_e4 = 1.5 *
-                                             earthEllipticityForth;
-                const double complimentaryEarthEllipticitySquared
-                                           = 1.0 - earthEllipticitySquared;
-             //-----------------------------------------------------------------
-             //
-             // NOTE:
-             //
-             //   The fact that the ellipsoidal flattening factor parameter is
-             //   valid guarantees that the squared complementary ellipsoidal
-             //   parameter value ecSquared is strictly positive.
-             //   We will check the the ecSquared value is strictly positive
-             //   here anyway.
-             //
-             //-----------------------------------------------------------------
-                if( complimentaryEarthEllipticitySquared > 0.0 )
-                  {
-                   //-----------------------------------------------------------
-                   // The squared complementary ellipsoid parameter is valid.
-                   //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-                   // Proceed with the geodetic computation.
-                   //-----------------------------------------------------------
-                      const double complimentaryEarthEllipticity
-                                               =
-                                   sqrt( complimentaryEarthEllipticitySquared );
-                      const double earthPolarRadiusMeters =
-                                             complimentaryEarthEllipticity *
-                                             earthEquatorialRadiusMeters;
-                   //-----------------------------------------------------------
-                   // Distance from polar axis squared.
-                   //-----------------------------------------------------------
-                      const double earthPolarAxisDistanceSquared =
-                                              ( xEcefMeters * xEcefMeters ) +
-                                              ( yEcefMeters * yEcefMeters );
-                   //-----------------------------------------------------------
-                   // Determine Geocentric Longitude [radians].
-                   //-----------------------------------------------------------
-                      rEstimatedGeocentricEastLongitudeRadians =
-                           ( earthPolarAxisDistanceSquared > 0.0 ) ?
-                                                atan2( yEcefMeters,
-                                                       xEcefMeters ) : 0.0;
-                   //-----------------------------------------------------------
-                   // Unsigned Geocentric z-coordinate.
-                   //-----------------------------------------------------------
-                      const
-                       double absZ = abs( zEcefMeters );
-                   //-----------------------------------------------------------
-                      if( earthPolarAxisDistanceSquared > aEpsSquared )
-                        {
-                         //-----------------------------------------------------
-                         // The specified Geocentric coordinates are
-                         // sufficiently far from the polar axis for
-                         // normal geodetic processing.
-                         //- - - - - - - - - - - - - - - - - - - - - - - - - - -
-                         // Determine distance from the polar axis.
-                         //-----------------------------------------------------
-                            const
-                             double earthPolarAxisDistanceMeters =
-                                         sqrt( earthPolarAxisDistanceSquared );
-                         //-----------------------------------------------------
-                         //
-                         // Perform normalization.
-                         //
-                         //-----------------------------------------------------
-                         // This is from Equation (2)  on Page 690 and
-                         //              Equation (17) on Page 691 of
-                         // Reference [ 1 ].
-                         // Here the factor of ec in Equation ( 2 ) is missing.
-                         //-----------------------------------------------------
-                            const
-                             double S0 = absZ / earthEquatorialRadiusMeters;
-                         //-----------------------------------------------------
-                         // This is Equation (2) on Page 690 of Reference
-                         // [ 1 ].
-                         //-----------------------------------------------------
-                            const
-                             double Pn = earthPolarAxisDistanceMeters /
-                                         earthEquatorialRadiusMeters;
-                            const
-                             double zc = complimentaryEarthEllipticity * S0;
-                         //=====================================================
-                         //
-                         // Prepare the Newton correction factors.
-                         //
-                         //=====================================================
-
-                         //-----------------------------------------------------
-                         // This is Equation (17) on Page 691 of Reference
-                         // [ 1 ].
-                         //-----------------------------------------------------
-                            const
-                             double C0        = complimentaryEarthEllipticity
-                                                *
-                                                Pn;
-                         //-----------------------------------------------------
-                            const
-                             double C0Squared = C0 * C0;
-                            const
-                             double C0Cubed   = C0 * C0Squared;
-                         //-----------------------------------------------------
-                            const
-                             double S0Squared = S0 * S0;
-                            const
-                             double S0Cubed   = S0 * S0Squared;
-                         //-----------------------------------------------------
-                         // This is Equation (14) on Page 690 of Reference
-                         // [ 1 ].
-                         //-----------------------------------------------------
-                            const
-                             double A0Squared = C0Squared + S0Squared;
-                            const
-                             double A0        = sqrt( A0Squared );
-                            const
-                             double A0Cubed   = A0 * A0Squared;
-                         //-----------------------------------------------------
-                         // This is Equation (12) on Page 690 of Reference
-                         // [ 1 ].
-                         //-----------------------------------------------------
-                            const
-                             double D0  =
-                                    (  zc                      * A0Cubed )
-                                    +
-                                    (  earthEllipticitySquared * S0Cubed );
-                         //-----------------------------------------------------
-                         // This is Equation (13) on Page 690 of Reference
-                         // [ 1 ].
-                         //-----------------------------------------------------
-                            const
-                             double F0  =
-                                    (  Pn                      * A0Cubed )
-                                    +
-                                    ( -earthEllipticitySquared * C0Cubed );
-
-                         //=====================================================
-                         //
-                         // Prepare the Halley correction factors.
-                         //
-                         //=====================================================
-
-                         //-----------------------------------------------------
-                         // This is Equation (15) on Page 690 of Reference
-                         // [ 1 ].
-                         //-----------------------------------------------------
-                            const
-                             double B0  =
-                                    oneAndHalf_e4 *
-                                    S0Squared     *
-                                    C0Squared     *
-                                    Pn            *
-                                    ( A0 - complimentaryEarthEllipticity );
-                         //-----------------------------------------------------
-                         // This is Equation (10) on Page 690 of Reference
-                         // [ 1 ].
-                         //-----------------------------------------------------
-                            const
-                             double S1  = ( D0 * F0 ) + ( -B0 * S0 );
-                         //-----------------------------------------------------
-                         // This is Equation (11) on Page 690 of Reference
-                         // [ 1 ].
-                         //-----------------------------------------------------
-                            const
-                             double C1  = ( F0 * F0 ) + ( -B0 * C0 );
-                         //-----------------------------------------------------
-                         // This is Equation (21) on Page 691 of Reference
-                         // [ 1 ].
-                         //-----------------------------------------------------
-                            const
-                             double Cc  = complimentaryEarthEllipticity * C1;
-
-                         //=====================================================
-                         //
-                         // Evaluate geodetic latitude.
-                         //
-                         //=====================================================
-
-                         //-----------------------------------------------------
-                         // This is Equation (19) on Page 691 of
-                         // Reference [ 1 ].
-                         //-----------------------------------------------------
-                            rEstimatedGeodeticNorthLatitudeRadians =
-                                                           atan2( S1, Cc );
-
-                         //=====================================================
-                         //
-                         // Evaluate geodetic altitude.
-                         // 
-                         //=====================================================
-                            const
-                             double S1Squared = S1 * S1;
-                            const
-                             double CcSquared = Cc * Cc;
-                         //- - - - - - - - - - - - - - - - - - - - - - - - - - -
-                         // The quantity a1 is ec times A1.
-                         // The quantity A1 is given by Equation (14) on
-                         // Page 690 of Reference [ 1 ].
-                         // - - - - - - - - - - - - - - - - - - - - - - - - - - 
-                            const
-                             double a1  =
-                             sqrt(
-                                   (
-                                     complimentaryEarthEllipticitySquared *
-                                     S1Squared
-                                   )
-                                   +
-                                   CcSquared
-                                 );
-                         //- - - - - - - - - - - - - - - - - - - - - - - - - - -
-                         // This is Equation (20) on Page 691 of Reference
-                         // [ 1 ].
-                         //- - - - - - - - - - - - - - - - - - - - - - - - - - -
-                            rEstimatedGeodeticAltitudeMeters
-                                = (
-                                    (  earthPolarAxisDistanceMeters * Cc ) +
-                                    (  absZ                         * S1 ) +
-                                    ( -earthEquatorialRadiusMeters  * a1 )
-                                  ) / sqrt( CcSquared + S1Squared );
-                         //-----------------------------------------------------
-                        }
-                      else
-                        {
-                         //-----------------------------------------------------
-                         // The specified Geocentric coordinates are very near
-                         // the polar axis.
-                         //- - - - - - - - - - - - - - - - - - - - - - - - - - -
-                         // Apply exceptional processing for the polar axis
-                         // vincinity.
-                         //-----------------------------------------------------
-                            const
-                            double
-                            piOverTwo         = 2.0 * atan( 1.0 );
-                         //- - - - - - - - - - - - - - - - - - - - - - - - - - -
-                            rEstimatedGeodeticNorthLatitudeRadians = piOverTwo;
-                            rEstimatedGeodeticAltitudeMeters =
-                                              absZ -
-                                              earthPolarRadiusMeters;
-                         //-----------------------------------------------------
-                        };
-                   //-----------------------------------------------------------
-                      if( zEcefMeters < 0.0 )
-                        {
-                         //-----------------------------------------------------
-                         // The specified Geocentric z coordinate is negative.
-                         //- - - - - - - - - - - - - - - - - - - - - - - - - - -
-                         // The specified Geocentric coorindates must be in the
-                         // Southern Hemisphere.
-                         //- - - - - - - - - - - - - - - - - - - - - - - - - - -
-                         // Change the sign of the computed Geodetic Latitude.
-                         //-----------------------------------------------------
-                            rEstimatedGeodeticNorthLatitudeRadians =
-                                       -rEstimatedGeodeticNorthLatitudeRadians;
-                         //-----------------------------------------------------
-                        };
-                   //-----------------------------------------------------------
-                   // Set the success status return value.
-                   //-----------------------------------------------------------
-                      returnValue = SUCCESSFUL_CONVERSION;
-                   //-----------------------------------------------------------
-                  }
-                else
-                  {
-                   //-----------------------------------------------------------
-                   // The squared complementary Earth ellipsoid parameter
-                   // value is invalid.
-                   //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-                   // Generate a purpose message.
-                   //-----------------------------------------------------------
-                      generateConvertEcefToGeodeticPurposeMessage(  );
-                   //-----------------------------------------------------------
-                   // Generate a usage message.
-                   //-----------------------------------------------------------
-                      generateConvertEcefToGeodeticUsageMessage(  );
-                   //-----------------------------------------------------------
-                   // Generate an error message.
-                   //-----------------------------------------------------------
-                      fprintf
-                      (
-                        stdout,
-                        "\n\n\n"
-                        "%s%s\n"
-                        "%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n"
-                        "%s%14.6e\n",
-                        "%s\n%s\n%s\n"
-                        "%s%s\n",
-                        "\n\n\n",
-                        "================================================",
-                        "============",
-                        "|",
-                        "|  ERROR:",
-                        "|",
-                        "|    The squared complementary Earth ellipsoid",
-                        "|    parameter value is invalid.",
-                        "|",
-                        "|    Squared complementary Earth ellipsoid",
-                        "|    parameter value is expected to be positive.",
-                        "|",
-                        "|    Squared complementary Earth ellipsoid",
-                        "|    parameter value is:-->",
-                        complimentaryEarthEllipticitySquared,
-                        "|",
-                        "|    This is an error.",
-                        "|",
-                        "================================================",
-                        "============"
-                      );
-                   //-----------------------------------------------------------
-                   // Set the error function status return value.
-                   //-----------------------------------------------------------
-                      returnValue = INVALID_ELLIPSOIDAL_FLATTENING;
-                   //-----------------------------------------------------------
-                  };
-             //-----------------------------------------------------------------
-            }
-          else
-            {
-             //-----------------------------------------------------------------
-             // The ellipsoid equatorial radius (major semiaxis length)
-             // parameter value is invalid.
-             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-             // Generate a purpose message.
-             //-----------------------------------------------------------------
-                generateConvertEcefToGeodeticPurposeMessage(  );
-             //-----------------------------------------------------------------
-             // Generate a usage message.
-             //-----------------------------------------------------------------
-                generateConvertEcefToGeodeticUsageMessage(  );
-             //-----------------------------------------------------------------
-             // Generate an error message.
-             //-----------------------------------------------------------------
-                fprintf
-                (
-                  stdout,
-                  "\n\n\n"
-                  "%s%s\n"
-                  "%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n"
-                  "%s%14.6e\n" 
-                  "%s\n%s\n%s\n"
-                  "%s%s\n" 
-                  "\n\n\n",
-                  "======================================================",
-                  "======",
-                  "|",
-                  "|  ERROR:",
-                  "|",
-                  "|    The specified Earth equatorial radius (major",
-                  "|    semiaxis length) parameter value is invalid.",
-                  "|",
-                  "|    Expected Earth equatorial radius value to be",
-                  "|    strictly positive.",
-                  "|",
-                  "|    Specified Earth equatorial radius parameter",
-                  "|    value is:-->",
-                  earthEquatorialRadiusMeters,
-                  "|",
-                  "|    This is an error.",
-                  "|",
-                  "======================================================",
-                  "======"
-                );
-             //-----------------------------------------------------------------
-             // Set the error function status return value.
-             //-----------------------------------------------------------------
-                returnValue = INVALID_EQUATORIAL_RADIUS;
-            //------------------------------------------------------------------
-            };
-       //-----------------------------------------------------------------------
-      }
-    else
+          return( convertEcefToGeodeticX8664V4Clone );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( __builtin_cpu_supports( "x86-64-v3" ) )
       {
-       //-----------------------------------------------------------------------
-       // The specified Earth ellipsoidal flattening factor parameter value
-       // is invalid.
-       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-       // Generate a purpose message.
-       //-----------------------------------------------------------------------
-          generateConvertEcefToGeodeticPurposeMessage(  );
-       //-----------------------------------------------------------------------
-       // Generate a usage message.
-       //-----------------------------------------------------------------------
-          generateConvertEcefToGeodeticUsageMessage(  );
-       //-----------------------------------------------------------------------
-       // Generate an error message.
-       //-----------------------------------------------------------------------
-          fprintf
-          (
-            stdout,
-            "\n\n\n"
-            "%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n"
-            "%s\n"
-            "%s%14.6e\n",
-            "%s\n%s\n%s\n%s\n"
-            "\n\n\n",
-            "============================================================",
-            "|",
-            "|  ERROR:",
-            "|",
-            "|    The specified Earth ellipsoidal flattening factor",
-            "|    parameter value is invalid.",
-            "|",
-            "|    Expected Earth ellipsoidal flattening factor",
-            "|    parameter value to be in the interval:  [ 0.0, 1.0 ).",
-            "|",
-            "|    Specified Earth ellipsoidal flattening factor",
-            "|    parameter value is:-->",
-            earthEllipsoidalFlatteningFactor,
-            "|",
-            "|    This is an error.",
-            "|",
-            "============================================================"
+          return( convertEcefToGeodeticX8664V3Clone );
+      };
+ //-----------------------------------------------------------------------------
+    return( convertEcefToGeodeticBaselineClone );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertEcefToGeodeticBaselineClone
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double  earthEquatorialRadiusMeters,
+            const double  earthEllipsoidalFlatteningFactor,
+            const double  xEcefMeters,
+            const double  yEcefMeters,
+            const double  zEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double &rEstimatedGeodeticNorthLatitudeRadians,
+                  double &rEstimatedGeocentricEastLongitudeRadians,
+                  double &rEstimatedGeodeticAltitudeMeters
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticBaselineClone
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The baseline x86-64 clone of 'convertEcefToGeodetic', compiled with
+//    the options of this file.  The x86-64-v3 and x86-64-v4 clones are in
+//    'convertBetweenEcefAndGeodeticX8664V3.cpp' and
+//    'convertBetweenEcefAndGeodeticX8664V4.cpp'.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    return(
+            convertEcefToGeodeticInline
+                   (
+                     earthEquatorialRadiusMeters,
+                     earthEllipsoidalFlatteningFactor,
+                     xEcefMeters,
+                     yEcefMeters,
+                     zEcefMeters,
+                     rEstimatedGeodeticNorthLatitudeRadians,
+                     rEstimatedGeocentricEastLongitudeRadians,
+                     rEstimatedGeodeticAltitudeMeters
+                   )
           );
-       //-----------------------------------------------------------------------
-       // Set the error function status return value.
-       //-----------------------------------------------------------------------
-          returnValue = INVALID_ELLIPSOIDAL_FLATTENING;
-       //-----------------------------------------------------------------------
-      }; 
- //----------------------------------------------------------------------------- 
-    return( returnValue );
  //-----------------------------------------------------------------------------
 }
 //==============================================================================
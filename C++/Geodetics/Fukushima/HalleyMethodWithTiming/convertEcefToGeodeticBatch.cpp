@@ -0,0 +1,838 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <float.h>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+// The processor is examined once, at program startup, and the widest
+// supported kernel is used for every batch.
+//------------------------------------------------------------------------------
+static
+const
+ECEF_TO_GEODETIC_ISA_LEVEL
+ supportedIsaLevel = detectEcefToGeodeticIsaLevel( );
+
+//------------------------------------------------------------------------------
+template< bool VALIDITY_BITS >
+static
+void
+convertEcefToGeodeticBatchChunk
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double   earthEquatorialRadiusMeters,
+            const double   earthEllipticitySquared,
+            const double   oneAndHalf_e4,
+            const double   complimentaryEarthEllipticitySquared,
+            const double   complimentaryEarthEllipticity,
+            const double   earthPolarRadiusMeters,
+            const double   inverseEarthEquatorialRadius,
+            const double   aEpsSquared,
+            const size_t   chunkPoints,
+            const double * __restrict__ x,
+            const double * __restrict__ y,
+            const double * __restrict__ z,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * __restrict__ latitude,
+                  double * __restrict__ longitude,
+                  double * __restrict__ altitude,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * __restrict__ status,
+                  unsigned long long
+                         * __restrict__ validBits
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticBatchChunk
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Convert one cache resident chunk of a batch for
+//    'convertEcefToGeodeticBatch'.
+//
+//    The chunk is a separate function so that its restrict qualified
+//    array arguments are visible to the vectorizer.
+//
+//    With VALIDITY_BITS set, the finite coordinates flags are stored as
+//    validity bits, bit i % 64 of word i / 64 for point i, and status is
+//    not referenced; otherwise each point gets a status.  The chunk
+//    must start on a multiple of 64 points.
+//
+//==============================================================================
+{
+ //=============================================================================
+ //
+ // Pass 1:  Branch free Halley step.
+ //
+ //=============================================================================
+    for( size_t i = 0; i < chunkPoints; i++ )
+      {
+       //-----------------------------------------------------------------------
+          const double xi   = x[ i ];
+          const double yi   = y[ i ];
+          const double zi   = z[ i ];
+       //-----------------------------------------------------------------------
+          const double earthPolarAxisDistanceSquared =
+                                           ( xi * xi ) + ( yi * yi );
+          const double earthPolarAxisDistanceMeters  =
+                                    sqrt( earthPolarAxisDistanceSquared );
+          const double absZ = fabs( zi );
+       //-----------------------------------------------------------------------
+       // Equations (2), (17), (14), (12), (13), (15), (10), (11) and
+       // (21) of Reference [ 1 ] of 'convertEcefToGeodetic'.
+       //-----------------------------------------------------------------------
+          const double S0        = absZ * inverseEarthEquatorialRadius;
+          const double Pn        = earthPolarAxisDistanceMeters *
+                                   inverseEarthEquatorialRadius;
+          const double zc        = complimentaryEarthEllipticity * S0;
+          const double C0        = complimentaryEarthEllipticity * Pn;
+          const double C0Squared = C0 * C0;
+          const double C0Cubed   = C0 * C0Squared;
+          const double S0Squared = S0 * S0;
+          const double S0Cubed   = S0 * S0Squared;
+          const double A0Squared = C0Squared + S0Squared;
+          const double A0        = sqrt( A0Squared );
+          const double A0Cubed   = A0 * A0Squared;
+          const double D0        = (  zc                      * A0Cubed ) +
+                                   (  earthEllipticitySquared * S0Cubed );
+          const double F0        = (  Pn                      * A0Cubed ) +
+                                   ( -earthEllipticitySquared * C0Cubed );
+          const double B0        = oneAndHalf_e4 *
+                                   S0Squared     *
+                                   C0Squared     *
+                                   Pn            *
+                                   ( A0 - complimentaryEarthEllipticity );
+          const double S1        = ( D0 * F0 ) + ( -B0 * S0 );
+          const double C1        = ( F0 * F0 ) + ( -B0 * C0 );
+          const double Cc        = complimentaryEarthEllipticity * C1;
+       //-----------------------------------------------------------------------
+       // Equation (20) of Reference [ 1 ] of 'convertEcefToGeodetic'.
+       //-----------------------------------------------------------------------
+          const double S1Squared = S1 * S1;
+          const double CcSquared = Cc * Cc;
+          const double a1        = sqrt(
+                                      (
+                                        complimentaryEarthEllipticitySquared *
+                                        S1Squared
+                                      )
+                                      +
+                                      CcSquared
+                                    );
+          const double h1        = (
+                                     (  earthPolarAxisDistanceMeters * Cc ) +
+                                     (  absZ                         * S1 ) +
+                                     ( -earthEquatorialRadiusMeters  * a1 )
+                                   ) / sqrt( CcSquared + S1Squared );
+       //-----------------------------------------------------------------------
+       // Polar axis vicinity values.
+       // atan2( 1, 0 ) is the latitude of the pole, pi / 2.
+       //-----------------------------------------------------------------------
+          const double hPole     = absZ - earthPolarRadiusMeters;
+       //-----------------------------------------------------------------------
+       // Select the polar axis vicinity values and the southern hemisphere
+       // sign instead of branching.  Every alternative is computed above,
+       // so the selections are plain blends.
+       //-----------------------------------------------------------------------
+          const bool nearPolarAxis =
+                       !( earthPolarAxisDistanceSquared > aEpsSquared );
+          const bool southernHemisphere = ( zi < 0.0 );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          const double S         = nearPolarAxis ? 1.0 : S1;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          latitude [ i ] = ( southernHemisphere ? -1.0 : 1.0 ) * S;
+          longitude[ i ] = nearPolarAxis ? 0.0   : Cc;
+          altitude [ i ] = nearPolarAxis ? hPole : h1;
+       //-----------------------------------------------------------------------
+      };
+ //=============================================================================
+ //
+ // Pass 2:  Angles and point status.
+ //
+ //=============================================================================
+    unsigned long long
+     wordBits = 0;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t i = 0; i < chunkPoints; i++ )
+      {
+       //-----------------------------------------------------------------------
+          const double xi = x[ i ];
+          const double yi = y[ i ];
+          const double zi = z[ i ];
+       //-----------------------------------------------------------------------
+          latitude [ i ] = atan2( latitude[ i ], longitude[ i ] );
+          longitude[ i ] = ( ( xi * xi ) + ( yi * yi ) > 0.0 ) ?
+                           atan2( yi, xi ) : 0.0;
+       //-----------------------------------------------------------------------
+       // The point status is determined here rather than in Pass 1,
+       // because mixing the double precision arithmetic with the
+       // narrower status stores prevents vectorization of Pass 1.
+       // A point which is not finite is a select, not a branch, so a
+       // chunk costs the same whatever its share of such points.
+       //-----------------------------------------------------------------------
+          const bool finiteCoordinates =
+                       ( fabs( xi ) <= DBL_MAX ) &
+                       ( fabs( yi ) <= DBL_MAX ) &
+                       ( fabs( zi ) <= DBL_MAX );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          latitude [ i ] = finiteCoordinates ? latitude [ i ] : NAN;
+          longitude[ i ] = finiteCoordinates ? longitude[ i ] : NAN;
+          altitude [ i ] = finiteCoordinates ? altitude [ i ] : NAN;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( VALIDITY_BITS )
+            {
+               wordBits |= ( unsigned long long )finiteCoordinates <<
+                           ( i % 64 );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               if( ( i % 64 == 63 ) || ( i + 1 == chunkPoints ) )
+                 {
+                    validBits[ i / 64 ] = wordBits;
+                    wordBits            = 0;
+                 };
+            }
+          else
+            {
+               status   [ i ] = finiteCoordinates ?
+                                SUCCESSFUL_CONVERSION :
+                                INVALID_ECEF_COORDINATES;
+            };
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticBatchForIsaLevel
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const ECEF_TO_GEODETIC_ISA_LEVEL
+                           isaLevel,
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pEstimatedGeodeticNorthLatitudeRadians,
+                  double * pEstimatedGeocentricEastLongitudeRadians,
+                  double * pEstimatedGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticBatchForIsaLevel
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    As the ellipsoid context overload of 'convertEcefToGeodeticBatch',
+//    with the batch kernel selected by the isaLevel argument:
+//
+//       BASELINE_ISA_LEVEL   The auto-vectorized chunk loop of this file.
+//       AVX2_FMA_ISA_LEVEL   'convertEcefToGeodeticBatchAvx2Kernel'.
+//       AVX512_ISA_LEVEL     'convertEcefToGeodeticBatchAvx512Kernel'.
+//
+//    The timing harness uses it to time each kernel on the same points.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The caller must not request a level above the one reported by
+//          'detectEcefToGeodeticIsaLevel', since the wider kernels would
+//          execute illegal instructions.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+ // Convert the batch with the kernel of the requested ISA level.
+ //-----------------------------------------------------------------------------
+    if( isaLevel == AVX512_ISA_LEVEL )
+      {
+          convertEcefToGeodeticBatchAvx512Kernel
+                 (
+                   //-------------------
+                   // INPUT(s):
+                   //-------------------
+                      rEllipsoidContext,
+                      numberPoints,
+                      pXEcefMeters,
+                      pYEcefMeters,
+                      pZEcefMeters,
+                   //-------------------
+                   // OUTPUT(s):
+                   //-------------------
+                      pEstimatedGeodeticNorthLatitudeRadians,
+                      pEstimatedGeocentricEastLongitudeRadians,
+                      pEstimatedGeodeticAltitudeMeters,
+                      pConversionStatus
+                 );
+      }
+    else
+    if( isaLevel == AVX2_FMA_ISA_LEVEL )
+      {
+          convertEcefToGeodeticBatchAvx2Kernel
+                 (
+                   //-------------------
+                   // INPUT(s):
+                   //-------------------
+                      rEllipsoidContext,
+                      numberPoints,
+                      pXEcefMeters,
+                      pYEcefMeters,
+                      pZEcefMeters,
+                   //-------------------
+                   // OUTPUT(s):
+                   //-------------------
+                      pEstimatedGeodeticNorthLatitudeRadians,
+                      pEstimatedGeocentricEastLongitudeRadians,
+                      pEstimatedGeodeticAltitudeMeters,
+                      pConversionStatus
+                 );
+      }
+    else
+      {
+       //-----------------------------------------------------------------------
+          const
+          size_t
+           CHUNK_POINTS = 256;
+       //-----------------------------------------------------------------------
+       // Loop over the chunks of the batch.
+       //-----------------------------------------------------------------------
+          for(
+               size_t chunkStart  = 0;
+                      chunkStart  < numberPoints;
+                      chunkStart += CHUNK_POINTS
+             )
+            {
+             //-----------------------------------------------------------------
+                const
+                size_t
+                 chunkPoints = ( numberPoints - chunkStart < CHUNK_POINTS ) ?
+                               ( numberPoints - chunkStart ) : CHUNK_POINTS;
+             //-----------------------------------------------------------------
+                convertEcefToGeodeticBatchChunk< false >
+                       (
+                         //-------------------
+                         // INPUT(s):
+                         //-------------------
+                            rEllipsoidContext.earthEquatorialRadiusMeters,
+                            rEllipsoidContext.earthEllipticitySquared,
+                            rEllipsoidContext.oneAndHalf_e4,
+                            rEllipsoidContext.
+                            complimentaryEarthEllipticitySquared,
+                            rEllipsoidContext.complimentaryEarthEllipticity,
+                            rEllipsoidContext.earthPolarRadiusMeters,
+                            rEllipsoidContext.inverseEarthEquatorialRadius,
+                            rEllipsoidContext.aEpsSquared,
+                            chunkPoints,
+                            pXEcefMeters + chunkStart,
+                            pYEcefMeters + chunkStart,
+                            pZEcefMeters + chunkStart,
+                         //-------------------
+                         // OUTPUT(s):
+                         //-------------------
+                            pEstimatedGeodeticNorthLatitudeRadians   +
+                                                                   chunkStart,
+                            pEstimatedGeocentricEastLongitudeRadians +
+                                                                   chunkStart,
+                            pEstimatedGeodeticAltitudeMeters         +
+                                                                   chunkStart,
+                            pConversionStatus                        +
+                                                                   chunkStart,
+                            NULL
+                       );
+             //-----------------------------------------------------------------
+            };
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertEcefToGeodeticBatch
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double   earthEquatorialRadiusMeters,
+            const double   earthEllipsoidalFlatteningFactor,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pEstimatedGeodeticNorthLatitudeRadians,
+                  double * pEstimatedGeocentricEastLongitudeRadians,
+                  double * pEstimatedGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticBatch
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Convert a batch of Earth Centered Earth Fixed (ECEF) retangular
+//    coordinates, stored as a structure of arrays, to geodetic coordinates
+//    for a specified reference ellipsoid.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//    [ 1 ] The ellipsoid parameters are validated and the functions of the
+//          ellipsoid parameters are computed once for the whole batch, by
+//          'initializeEarthEllipsoidContext'.
+//
+//    [ 2 ] Each point is converted with the same single Halley iteration
+//          used by 'convertEcefToGeodetic'.
+//
+//    [ 3 ] The batch is processed in chunks of CHUNK_POINTS points.  Within
+//          a chunk the conversion is split in two passes:
+//
+//            Pass 1:  The branch free arithmetic (Halley step, altitude,
+//                     polar axis vicinity selection and hemisphere
+//                     sign).  The loop body contains no calls and
+//                     no data dependent branches, so the compiler can
+//                     auto-vectorize it.
+//
+//            Pass 2:  The two 'atan2' evaluations, which are library calls
+//                     and would otherwise prevent vectorization of Pass 1,
+//                     and the point status.
+//
+//          Pass 1 parks the latitude numerator S1 and denominator Cc in
+//          the latitude and longitude output arrays, so no scratch memory
+//          is needed, and the chunk is still cache resident for Pass 2.
+//
+//    [ 4 ] Step [ 3 ] is the baseline kernel.  When the processor supports
+//          them, the explicit four lane AVX2 and FMA kernel or the eight
+//          lane AVX-512 kernel, which also vectorize the 'atan2'
+//          evaluations, are used instead.  'detectEcefToGeodeticIsaLevel'
+//          selects the kernel once, at program startup.
+//
+//------------------------------------------------------------------------------
+//
+//  INPUTS:
+//     earthEquatorialRadiusMeters
+//       Length of Earth equatorial radius.
+//       Also length of Earth ellipsoid semi-major axis.
+//       UNITS:  [meters]
+//
+//     earthEllipsoidalFlatteningFactor
+//       Value of Earth ellipsoidal flattening factor.
+//       UNITS:  [nondimensional]
+//
+//     numberPoints
+//       Number of points in the batch.
+//
+//     pXEcefMeters
+//     pYEcefMeters
+//     pZEcefMeters
+//       Contiguous arrays of numberPoints Earth Centered Earth Fixed (ECEF)
+//       rectangular coordinates.
+//       UNITS:  [meters]
+//
+//------------------------------------------------------------------------------
+//
+//  OUTPUT:
+//
+//     pEstimatedGeodeticNorthLatitudeRadians
+//     pEstimatedGeocentricEastLongitudeRadians
+//     pEstimatedGeodeticAltitudeMeters
+//       Contiguous arrays of numberPoints elements to contain the estimated
+//       geodetic coordinates.  The output arrays must not overlap the input
+//       arrays.
+//       UNITS:  [radians], [radians], [meters]
+//
+//     pConversionStatus
+//       Contiguous array of numberPoints elements to contain the conversion
+//       status of each point:
+//          SUCCESSFUL_CONVERSION
+//          INVALID_ECEF_COORDINATES  (a coordinate is not finite)
+//          INVALID_ELLIPSOIDAL_FLATTENING
+//          INVALID_EQUATORIAL_RADIUS
+//
+//------------------------------------------------------------------------------
+//
+//  RETURNED VALUE:
+//     An enumeration of the ellipsoid parameter validation status:
+//        SUCCESSFUL_CONVERSION
+//        INVALID_ELLIPSOIDAL_FLATTENING
+//        INVALID_EQUATORIAL_RADIUS
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] No diagnostic messages are written by this function.  When the
+//          ellipsoid parameters are invalid every point status is set to
+//          the returned value and every output coordinate is set to NAN.
+//
+//    [ 2 ] See 'convertEcefToGeodetic' for the method, authors and
+//          references of the Halley iteration.
+//
+//    [ 3 ] This file is compiled with '-O3 -fno-math-errno
+//          -fno-trapping-math' (see 'buildTestConvertEcefToGeodetic.sh');
+//          without them the Pass 1 loop is not vectorized.
+//
+//------------------------------------------------------------------------------
+//
+//  USAGE:
+//
+//    ecefToGeodeticConversionStatus =
+//    convertEcefToGeodeticBatch
+//           (
+//             //-------------------
+//             // INPUT(s):
+//             //-------------------
+//                earthEquatorialRadiusMeters,
+//                earthEllipsoidalFlatteningFactor,
+//                numberPoints,
+//                pXEcefMeters,
+//                pYEcefMeters,
+//                pZEcefMeters,
+//             //-------------------
+//             // OUTPUT(s):
+//             //-------------------
+//                pEstimatedGeodeticNorthLatitudeRadians,
+//                pEstimatedGeocentricEastLongitudeRadians,
+//                pEstimatedGeodeticAltitudeMeters,
+//                pConversionStatus
+//           );
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    EARTH_ELLIPSOID_CONTEXT
+            ellipsoidContext;
+ //-----------------------------------------------------------------------------
+    const
+    ECEF_TO_GEODETIC_CONVERSION_STATUS
+            returnValue = initializeEarthEllipsoidContext
+                                 (
+                                   earthEquatorialRadiusMeters,
+                                   earthEllipsoidalFlatteningFactor,
+                                   ellipsoidContext
+                                 );
+ //-----------------------------------------------------------------------------
+    if( returnValue != SUCCESSFUL_CONVERSION )
+      {
+       //-----------------------------------------------------------------------
+       // The ellipsoid parameters are invalid.
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+       // Mark every point of the batch as not converted.
+       //-----------------------------------------------------------------------
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+               pEstimatedGeodeticNorthLatitudeRadians  [ i ] = NAN;
+               pEstimatedGeocentricEastLongitudeRadians[ i ] = NAN;
+               pEstimatedGeodeticAltitudeMeters        [ i ] = NAN;
+               pConversionStatus                       [ i ] = returnValue;
+            };
+       //-----------------------------------------------------------------------
+          return( returnValue );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticBatch
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                ellipsoidContext,
+                numberPoints,
+                pXEcefMeters,
+                pYEcefMeters,
+                pZEcefMeters,
+             //-------------------
+             // OUTPUT(s):
+             //-------------------
+                pEstimatedGeodeticNorthLatitudeRadians,
+                pEstimatedGeocentricEastLongitudeRadians,
+                pEstimatedGeodeticAltitudeMeters,
+                pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    return( returnValue );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticBatch
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pEstimatedGeodeticNorthLatitudeRadians,
+                  double * pEstimatedGeocentricEastLongitudeRadians,
+                  double * pEstimatedGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticBatch  (ellipsoid context overload)
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Convert a batch of ECEF rectangular coordinates to geodetic
+//    coordinates for the reference ellipsoid of an ellipsoid context built
+//    by 'initializeEarthEllipsoidContext', with the widest batch kernel
+//    which the processor supports.
+//
+//    Every point status is SUCCESSFUL_CONVERSION or
+//    INVALID_ECEF_COORDINATES.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticBatchForIsaLevel
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                supportedIsaLevel,
+                rEllipsoidContext,
+                numberPoints,
+                pXEcefMeters,
+                pYEcefMeters,
+                pZEcefMeters,
+             //-------------------
+             // OUTPUT(s):
+             //-------------------
+                pEstimatedGeodeticNorthLatitudeRadians,
+                pEstimatedGeocentricEastLongitudeRadians,
+                pEstimatedGeodeticAltitudeMeters,
+                pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticBatchWithValidityBits
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pEstimatedGeodeticNorthLatitudeRadians,
+                  double * pEstimatedGeocentricEastLongitudeRadians,
+                  double * pEstimatedGeodeticAltitudeMeters,
+                  unsigned long long
+                         * pValidBits,
+                  ECEF_TO_GEODETIC_BATCH_VALIDITY
+                         & rBatchValidity
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticBatchWithValidityBits
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    As the ellipsoid context overload of 'convertEcefToGeodeticBatch',
+//    with a validity bit per point, bit i % 64 of word i / 64 of
+//    pValidBits for point i, instead of a status per point, and the
+//    summary counts of the batch in rBatchValidity.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    [ 1 ] Each kernel turns its finite coordinates lane mask into the
+//          validity bits directly, a word store per 64 points instead of
+//          a status store per point.  A lane whose coordinates are NAN or
+//          infinite goes through the same arithmetic as every other lane
+//          and is blended to NAN, so no block leaves the vector path.
+//
+//    [ 2 ] 'summarizeBatchValidityBits' counts the set bits, and looks at
+//          the inputs of the clear bits only, to count the points with
+//          coordinates which are not finite.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] pValidBits must have ( numberPoints + 63 ) / 64 words.  The
+//          bits of the last word past numberPoints are clear.
+//
+//    [ 2 ] Every clear bit is a point with a coordinate which is not
+//          finite, the INVALID_ECEF_COORDINATES status of
+//          'convertEcefToGeodeticBatch'.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    if( supportedIsaLevel == AVX512_ISA_LEVEL )
+      {
+          convertEcefToGeodeticBatchValidityBitsAvx512Kernel
+                 (
+                   //-------------------
+                   // INPUT(s):
+                   //-------------------
+                      rEllipsoidContext,
+                      numberPoints,
+                      pXEcefMeters,
+                      pYEcefMeters,
+                      pZEcefMeters,
+                   //-------------------
+                   // OUTPUT(s):
+                   //-------------------
+                      pEstimatedGeodeticNorthLatitudeRadians,
+                      pEstimatedGeocentricEastLongitudeRadians,
+                      pEstimatedGeodeticAltitudeMeters,
+                      pValidBits
+                 );
+      }
+    else
+    if( supportedIsaLevel == AVX2_FMA_ISA_LEVEL )
+      {
+          convertEcefToGeodeticBatchValidityBitsAvx2Kernel
+                 (
+                   //-------------------
+                   // INPUT(s):
+                   //-------------------
+                      rEllipsoidContext,
+                      numberPoints,
+                      pXEcefMeters,
+                      pYEcefMeters,
+                      pZEcefMeters,
+                   //-------------------
+                   // OUTPUT(s):
+                   //-------------------
+                      pEstimatedGeodeticNorthLatitudeRadians,
+                      pEstimatedGeocentricEastLongitudeRadians,
+                      pEstimatedGeodeticAltitudeMeters,
+                      pValidBits
+                 );
+      }
+    else
+      {
+       //-----------------------------------------------------------------------
+          const
+          size_t
+           CHUNK_POINTS = 256;
+       //-----------------------------------------------------------------------
+          for(
+               size_t chunkStart  = 0;
+                      chunkStart  < numberPoints;
+                      chunkStart += CHUNK_POINTS
+             )
+            {
+             //-----------------------------------------------------------------
+                const
+                size_t
+                 chunkPoints = ( numberPoints - chunkStart < CHUNK_POINTS ) ?
+                               ( numberPoints - chunkStart ) : CHUNK_POINTS;
+             //-----------------------------------------------------------------
+                convertEcefToGeodeticBatchChunk< true >
+                       (
+                         //-------------------
+                         // INPUT(s):
+                         //-------------------
+                            rEllipsoidContext.earthEquatorialRadiusMeters,
+                            rEllipsoidContext.earthEllipticitySquared,
+                            rEllipsoidContext.oneAndHalf_e4,
+                            rEllipsoidContext.
+                            complimentaryEarthEllipticitySquared,
+                            rEllipsoidContext.complimentaryEarthEllipticity,
+                            rEllipsoidContext.earthPolarRadiusMeters,
+                            rEllipsoidContext.inverseEarthEquatorialRadius,
+                            rEllipsoidContext.aEpsSquared,
+                            chunkPoints,
+                            pXEcefMeters + chunkStart,
+                            pYEcefMeters + chunkStart,
+                            pZEcefMeters + chunkStart,
+                         //-------------------
+                         // OUTPUT(s):
+                         //-------------------
+                            pEstimatedGeodeticNorthLatitudeRadians   +
+                                                                   chunkStart,
+                            pEstimatedGeocentricEastLongitudeRadians +
+                                                                   chunkStart,
+                            pEstimatedGeodeticAltitudeMeters         +
+                                                                   chunkStart,
+                            NULL,
+                            pValidBits + chunkStart / 64
+                       );
+             //-----------------------------------------------------------------
+            };
+      };
+ //-----------------------------------------------------------------------------
+    summarizeBatchValidityBits
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                numberPoints,
+                pXEcefMeters,
+                pYEcefMeters,
+                pZEcefMeters,
+                pValidBits,
+             //-------------------
+             // OUTPUT(s):
+             //-------------------
+                rBatchValidity
+           );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
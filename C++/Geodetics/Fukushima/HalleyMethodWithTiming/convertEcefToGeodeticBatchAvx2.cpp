@@ -0,0 +1,1361 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <float.h>
+#include <immintrin.h>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+static
+inline
+__m256d
+computeArcTangent2Avx2
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const __m256d  y,
+            const __m256d  x
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    computeArcTangent2Avx2
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Four lane double precision atan2( y, x ) without branches.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    [ 1 ] Reduce to the ratio a = min( |x|, |y| ) / max( |x|, |y| ) in
+//          [ 0, 1 ].  A lane with x = y = 0 uses a = 0.
+//
+//    [ 2 ] For a > 0.66 use atan( a ) = pi/4 + atan( ( a - 1 ) / ( a + 1 ) ).
+//
+//    [ 3 ] Evaluate atan of the reduced argument t with the Cephes
+//          rational approximation t + t z P( z ) / Q( z ), z = t^2, whose
+//          relative error is about 1e-16 (see Reference [ 1 ]).
+//
+//    [ 4 ] Undo the reductions with pi/2 - r when |y| > |x|, pi - r when
+//          the sign bit of x is set, and give the result the sign of y.
+//          The constants pi/2 and pi are applied as a head and a tail so
+//          the subtractions keep full precision.
+//
+//------------------------------------------------------------------------------
+//
+//  REFERENCE(s):
+//
+//     [ 1 ]  Cephes Mathematical Library, "atan.c",
+//            Stephen L. Moshier, 1984, 1995, 2000.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const __m256d signMask   = _mm256_set1_pd( -0.0 );
+    const __m256d zero       = _mm256_setzero_pd( );
+    const __m256d one        = _mm256_set1_pd( 1.0 );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const __m256d piOverTwo  = _mm256_set1_pd( 1.57079632679489661923e0 );
+    const __m256d piOverFour = _mm256_set1_pd( 7.85398163397448309616e-1 );
+    const __m256d pi         = _mm256_set1_pd( 3.14159265358979323846e0 );
+    const __m256d moreBits   = _mm256_set1_pd( 6.123233995736765886130e-17 );
+ //-----------------------------------------------------------------------------
+    const __m256d absX       = _mm256_andnot_pd( signMask, x );
+    const __m256d absY       = _mm256_andnot_pd( signMask, y );
+    const __m256d maximum    = _mm256_max_pd( absX, absY );
+    const __m256d minimum    = _mm256_min_pd( absX, absY );
+ //-----------------------------------------------------------------------------
+    const __m256d bothZero   = _mm256_cmp_pd( maximum, zero, _CMP_EQ_OQ );
+    const __m256d a          = _mm256_blendv_pd
+                                      (
+                                        _mm256_div_pd( minimum, maximum ),
+                                        zero,
+                                        bothZero
+                                      );
+ //-----------------------------------------------------------------------------
+    const __m256d reduce     = _mm256_cmp_pd
+                                      (
+                                        a,
+                                        _mm256_set1_pd( 0.66 ),
+                                        _CMP_GT_OQ
+                                      );
+    const __m256d t          = _mm256_blendv_pd
+                                      (
+                                        a,
+                                        _mm256_div_pd
+                                               (
+                                                 _mm256_sub_pd( a, one ),
+                                                 _mm256_add_pd( a, one )
+                                               ),
+                                        reduce
+                                      );
+ //-----------------------------------------------------------------------------
+    const __m256d z          = _mm256_mul_pd( t, t );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    __m256d P = _mm256_set1_pd( -8.750608600031904122785e-1 );
+    P = _mm256_fmadd_pd( P, z, _mm256_set1_pd( -1.615753718733365076637e1 ) );
+    P = _mm256_fmadd_pd( P, z, _mm256_set1_pd( -7.500855792314704667340e1 ) );
+    P = _mm256_fmadd_pd( P, z, _mm256_set1_pd( -1.228866684490136173410e2 ) );
+    P = _mm256_fmadd_pd( P, z, _mm256_set1_pd( -6.485021904942025371773e1 ) );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    __m256d Q = _mm256_add_pd( z, _mm256_set1_pd( 2.485846490142306297962e1 ) );
+    Q = _mm256_fmadd_pd( Q, z, _mm256_set1_pd( 1.650270098316988542046e2 ) );
+    Q = _mm256_fmadd_pd( Q, z, _mm256_set1_pd( 4.328810604912902668951e2 ) );
+    Q = _mm256_fmadd_pd( Q, z, _mm256_set1_pd( 4.853903996359136964868e2 ) );
+    Q = _mm256_fmadd_pd( Q, z, _mm256_set1_pd( 1.945506571482613964425e2 ) );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const __m256d tz         = _mm256_mul_pd( t, z );
+    __m256d r = _mm256_fmadd_pd( tz, _mm256_div_pd( P, Q ), t );
+ //-----------------------------------------------------------------------------
+    r = _mm256_add_pd
+               (
+                 _mm256_and_pd( reduce, piOverFour ),
+                 _mm256_add_pd
+                        (
+                          r,
+                          _mm256_and_pd
+                                 (
+                                   reduce,
+                                   _mm256_set1_pd( 0.5 * 6.123233995736765886130e-17 )
+                                 )
+                        )
+               );
+ //-----------------------------------------------------------------------------
+    const __m256d swap       = _mm256_cmp_pd( absY, absX, _CMP_GT_OQ );
+    r = _mm256_blendv_pd
+               (
+                 r,
+                 _mm256_add_pd( _mm256_sub_pd( piOverTwo, r ), moreBits ),
+                 swap
+               );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const __m256d negativeX  = _mm256_and_pd( x, signMask );
+    r = _mm256_blendv_pd
+               (
+                 r,
+                 _mm256_add_pd
+                        (
+                          _mm256_sub_pd( pi, r ),
+                          _mm256_add_pd( moreBits, moreBits )
+                        ),
+                 negativeX
+               );
+ //-----------------------------------------------------------------------------
+    return( _mm256_or_pd( r, _mm256_and_pd( y, signMask ) ) );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+template< bool LATITUDE, bool LONGITUDE, bool ALTITUDE >
+static
+inline
+void
+convertEcefToGeodeticAvx2
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double   earthEquatorialRadiusMeters,
+            const double   earthEllipticitySquared,
+            const double   oneAndHalf_e4,
+            const double   complimentaryEarthEllipticitySquared,
+            const double   complimentaryEarthEllipticity,
+            const double   earthPolarRadiusMeters,
+            const double   inverseEarthEquatorialRadius,
+            const double   aEpsSquared,
+            const __m256d  x,
+            const __m256d  y,
+            const __m256d  z,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  __m256d &rLatitude,
+                  __m256d &rLongitude,
+                  __m256d &rAltitude,
+                  int     &rFiniteLaneBits
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticAvx2
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The one iteration Fukushima Halley step of 'convertEcefToGeodetic'
+//    for four points, with the polar axis vicinity and the southern
+//    hemisphere handled by blends instead of branches.
+//
+//    Lanes with a coordinate which is not finite have NAN outputs and a
+//    clear bit in rFiniteLaneBits.
+//
+//    Only the outputs whose template flag is set are assigned, so the
+//    arithmetic of the others is dead code which the compiler drops.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const __m256d signMask  = _mm256_set1_pd( -0.0 );
+    const __m256d ec        = _mm256_set1_pd( complimentaryEarthEllipticity );
+    const __m256d e2        = _mm256_set1_pd( earthEllipticitySquared );
+    const __m256d inverseA  = _mm256_set1_pd( inverseEarthEquatorialRadius );
+ //-----------------------------------------------------------------------------
+    const __m256d pSquared  = _mm256_fmadd_pd( y, y, _mm256_mul_pd( x, x ) );
+    const __m256d p         = _mm256_sqrt_pd( pSquared );
+    const __m256d absZ      = _mm256_andnot_pd( signMask, z );
+ //-----------------------------------------------------------------------------
+ // Equations (2), (17), (14), (12), (13), (15), (10), (11) and (21) of
+ // Reference [ 1 ] of 'convertEcefToGeodetic'.
+ //-----------------------------------------------------------------------------
+    const __m256d S0        = _mm256_mul_pd( absZ, inverseA );
+    const __m256d Pn        = _mm256_mul_pd( p,    inverseA );
+    const __m256d zc        = _mm256_mul_pd( ec, S0 );
+    const __m256d C0        = _mm256_mul_pd( ec, Pn );
+    const __m256d C0Squared = _mm256_mul_pd( C0, C0 );
+    const __m256d C0Cubed   = _mm256_mul_pd( C0, C0Squared );
+    const __m256d S0Squared = _mm256_mul_pd( S0, S0 );
+    const __m256d S0Cubed   = _mm256_mul_pd( S0, S0Squared );
+    const __m256d A0Squared = _mm256_add_pd( C0Squared, S0Squared );
+    const __m256d A0        = _mm256_sqrt_pd( A0Squared );
+    const __m256d A0Cubed   = _mm256_mul_pd( A0, A0Squared );
+    const __m256d D0        = _mm256_fmadd_pd
+                                     (
+                                       zc, A0Cubed,
+                                       _mm256_mul_pd( e2, S0Cubed )
+                                     );
+    const __m256d F0        = _mm256_fnmadd_pd
+                                     (
+                                       e2, C0Cubed,
+                                       _mm256_mul_pd( Pn, A0Cubed )
+                                     );
+    const __m256d B0        = _mm256_mul_pd
+                                     (
+                                       _mm256_mul_pd
+                                              (
+                                                _mm256_mul_pd
+                                                       (
+                                                         _mm256_set1_pd
+                                                         (
+                                                           oneAndHalf_e4
+                                                         ),
+                                                         S0Squared
+                                                       ),
+                                                _mm256_mul_pd( C0Squared, Pn )
+                                              ),
+                                       _mm256_sub_pd( A0, ec )
+                                     );
+    const __m256d S1        = _mm256_fnmadd_pd
+                                     (
+                                       B0, S0, _mm256_mul_pd( D0, F0 )
+                                     );
+    const __m256d C1        = _mm256_fnmadd_pd
+                                     (
+                                       B0, C0, _mm256_mul_pd( F0, F0 )
+                                     );
+    const __m256d Cc        = _mm256_mul_pd( ec, C1 );
+ //-----------------------------------------------------------------------------
+ // Equation (20) of Reference [ 1 ] of 'convertEcefToGeodetic'.
+ //-----------------------------------------------------------------------------
+    const __m256d S1Squared = _mm256_mul_pd( S1, S1 );
+    const __m256d CcSquared = _mm256_mul_pd( Cc, Cc );
+    const __m256d a1        = _mm256_sqrt_pd
+                                     (
+                                       _mm256_fmadd_pd
+                                              (
+                                                _mm256_set1_pd
+                                                (
+                                                  complimentaryEarthEllipticitySquared
+                                                ),
+                                                S1Squared,
+                                                CcSquared
+                                              )
+                                     );
+    const __m256d h1        = _mm256_div_pd
+                                     (
+                                       _mm256_fnmadd_pd
+                                              (
+                                                _mm256_set1_pd
+                                                (
+                                                  earthEquatorialRadiusMeters
+                                                ),
+                                                a1,
+                                                _mm256_fmadd_pd
+                                                       (
+                                                         absZ, S1,
+                                                         _mm256_mul_pd( p, Cc )
+                                                       )
+                                              ),
+                                       _mm256_sqrt_pd
+                                              (
+                                                _mm256_add_pd
+                                                       (
+                                                         CcSquared, S1Squared
+                                                       )
+                                              )
+                                     );
+ //-----------------------------------------------------------------------------
+ // Blend in the polar axis vicinity values and the southern hemisphere sign.
+ //-----------------------------------------------------------------------------
+    const __m256d nearPolarAxis = _mm256_cmp_pd
+                                         (
+                                           pSquared,
+                                           _mm256_set1_pd( aEpsSquared ),
+                                           _CMP_NGT_UQ
+                                         );
+    const __m256d southernHemisphere = _mm256_cmp_pd
+                                         (
+                                           z, _mm256_setzero_pd( ), _CMP_LT_OQ
+                                         );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const __m256d S = _mm256_xor_pd
+                             (
+                               _mm256_blendv_pd
+                                      (
+                                        S1, _mm256_set1_pd( 1.0 ), nearPolarAxis
+                                      ),
+                               _mm256_and_pd( southernHemisphere, signMask )
+                             );
+    const __m256d C = _mm256_andnot_pd( nearPolarAxis, Cc );
+    const __m256d h = _mm256_blendv_pd
+                             (
+                               h1,
+                               _mm256_sub_pd
+                                      (
+                                        absZ,
+                                        _mm256_set1_pd( earthPolarRadiusMeters )
+                                      ),
+                               nearPolarAxis
+                             );
+ //-----------------------------------------------------------------------------
+ // Angles.
+ //-----------------------------------------------------------------------------
+    const __m256d offPolarAxis = _mm256_cmp_pd
+                                        (
+                                          pSquared,
+                                          _mm256_setzero_pd( ),
+                                          _CMP_GT_OQ
+                                        );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const __m256d latitude  = computeArcTangent2Avx2( S, C );
+    const __m256d longitude = _mm256_and_pd
+                                     (
+                                       offPolarAxis,
+                                       computeArcTangent2Avx2( y, x )
+                                     );
+ //-----------------------------------------------------------------------------
+ // Lanes with coordinates which are not finite get NAN outputs.
+ //-----------------------------------------------------------------------------
+    const __m256d maximumDouble = _mm256_set1_pd( DBL_MAX );
+    const __m256d finite        = _mm256_and_pd
+                                         (
+                                           _mm256_and_pd
+                                                  (
+                                                    _mm256_cmp_pd
+                                                    (
+                                                      _mm256_andnot_pd
+                                                      (
+                                                        signMask, x
+                                                      ),
+                                                      maximumDouble,
+                                                      _CMP_LE_OQ
+                                                    ),
+                                                    _mm256_cmp_pd
+                                                    (
+                                                      _mm256_andnot_pd
+                                                      (
+                                                        signMask, y
+                                                      ),
+                                                      maximumDouble,
+                                                      _CMP_LE_OQ
+                                                    )
+                                                  ),
+                                           _mm256_cmp_pd
+                                                  (
+                                                    absZ,
+                                                    maximumDouble,
+                                                    _CMP_LE_OQ
+                                                  )
+                                         );
+    const __m256d notANumber    = _mm256_set1_pd( NAN );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( LATITUDE )
+      {
+          rLatitude  = _mm256_blendv_pd( notANumber, latitude,  finite );
+      };
+    if( LONGITUDE )
+      {
+          rLongitude = _mm256_blendv_pd( notANumber, longitude, finite );
+      };
+    if( ALTITUDE )
+      {
+          rAltitude  = _mm256_blendv_pd( notANumber, h,         finite );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    rFiniteLaneBits = _mm256_movemask_pd( finite );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+template< bool LATITUDE, bool LONGITUDE, bool ALTITUDE,
+          bool VALIDITY_BITS >
+static
+void
+convertEcefToGeodeticBatchOutputsAvx2
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pGeodeticNorthLatitudeRadians,
+                  double * pGeocentricEastLongitudeRadians,
+                  double * pGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus,
+                  unsigned long long
+                         * pValidBits
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticBatchOutputsAvx2
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The block loop of 'convertEcefToGeodeticBatchAvx2Kernel' and
+//    'convertEcefToGeodeticPartialBatchAvx2Kernel'.  Only the outputs
+//    whose template flag is set are stored, and only their arrays are
+//    referenced.
+//
+//    The flags are passed on to 'convertEcefToGeodeticAvx2', so equation
+//    (20) is only evaluated for the altitude, and each arctangent only
+//    for its angle.
+//
+//    With VALIDITY_BITS set, the finite coordinates lane mask of each
+//    block is stored in pValidBits, and pConversionStatus is not
+//    referenced; otherwise each point gets a status.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const double   earthEquatorialRadiusMeters =
+                      rEllipsoidContext.earthEquatorialRadiusMeters;
+    const double   earthEllipticitySquared =
+                      rEllipsoidContext.earthEllipticitySquared;
+    const double   oneAndHalf_e4 =
+                      rEllipsoidContext.oneAndHalf_e4;
+    const double   complimentaryEarthEllipticitySquared =
+                      rEllipsoidContext.complimentaryEarthEllipticitySquared;
+    const double   complimentaryEarthEllipticity =
+                      rEllipsoidContext.complimentaryEarthEllipticity;
+    const double   earthPolarRadiusMeters =
+                      rEllipsoidContext.earthPolarRadiusMeters;
+    const double   inverseEarthEquatorialRadius =
+                      rEllipsoidContext.inverseEarthEquatorialRadius;
+    const double   aEpsSquared =
+                      rEllipsoidContext.aEpsSquared;
+ //-----------------------------------------------------------------------------
+    const size_t LANES = 4;
+ //-----------------------------------------------------------------------------
+    size_t i = 0;
+ //-----------------------------------------------------------------------------
+    while( i < numberPoints )
+      {
+       //-----------------------------------------------------------------------
+          const size_t lanes = ( numberPoints - i < LANES ) ?
+                               ( numberPoints - i ) : LANES;
+       //-----------------------------------------------------------------------
+          __m256d x;
+          __m256d y;
+          __m256d z;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( lanes == LANES )
+            {
+               x = _mm256_loadu_pd( pXEcefMeters + i );
+               y = _mm256_loadu_pd( pYEcefMeters + i );
+               z = _mm256_loadu_pd( pZEcefMeters + i );
+            }
+          else
+            {
+               double xBlock[ LANES ] = { 0.0, 0.0, 0.0, 0.0 };
+               double yBlock[ LANES ] = { 0.0, 0.0, 0.0, 0.0 };
+               double zBlock[ LANES ] = { 0.0, 0.0, 0.0, 0.0 };
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               for( size_t k = 0; k < lanes; k++ )
+                 {
+                    xBlock[ k ] = pXEcefMeters[ i + k ];
+                    yBlock[ k ] = pYEcefMeters[ i + k ];
+                    zBlock[ k ] = pZEcefMeters[ i + k ];
+                 };
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               x = _mm256_loadu_pd( xBlock );
+               y = _mm256_loadu_pd( yBlock );
+               z = _mm256_loadu_pd( zBlock );
+            };
+       //-----------------------------------------------------------------------
+          __m256d latitude;
+          __m256d longitude;
+          __m256d altitude;
+          int     finiteLaneBits;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          convertEcefToGeodeticAvx2< LATITUDE, LONGITUDE, ALTITUDE >
+                 (
+                   earthEquatorialRadiusMeters,
+                   earthEllipticitySquared,
+                   oneAndHalf_e4,
+                   complimentaryEarthEllipticitySquared,
+                   complimentaryEarthEllipticity,
+                   earthPolarRadiusMeters,
+                   inverseEarthEquatorialRadius,
+                   aEpsSquared,
+                   x,
+                   y,
+                   z,
+                   latitude,
+                   longitude,
+                   altitude,
+                   finiteLaneBits
+                 );
+       //-----------------------------------------------------------------------
+          if( lanes == LANES )
+            {
+               if( LATITUDE )
+                 {
+                    _mm256_storeu_pd( pGeodeticNorthLatitudeRadians + i,
+                                      latitude );
+                 };
+               if( LONGITUDE )
+                 {
+                    _mm256_storeu_pd( pGeocentricEastLongitudeRadians + i,
+                                      longitude );
+                 };
+               if( ALTITUDE )
+                 {
+                    _mm256_storeu_pd( pGeodeticAltitudeMeters + i,
+                                      altitude );
+                 };
+            }
+          else
+            {
+               double latitudeBlock [ LANES ];
+               double longitudeBlock[ LANES ];
+               double altitudeBlock [ LANES ];
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               _mm256_storeu_pd( latitudeBlock,  latitude  );
+               _mm256_storeu_pd( longitudeBlock, longitude );
+               _mm256_storeu_pd( altitudeBlock,  altitude  );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               for( size_t k = 0; k < lanes; k++ )
+                 {
+                    if( LATITUDE )
+                      {
+                         pGeodeticNorthLatitudeRadians  [ i + k ] =
+                                                       latitudeBlock [ k ];
+                      };
+                    if( LONGITUDE )
+                      {
+                         pGeocentricEastLongitudeRadians[ i + k ] =
+                                                       longitudeBlock[ k ];
+                      };
+                    if( ALTITUDE )
+                      {
+                         pGeodeticAltitudeMeters        [ i + k ] =
+                                                       altitudeBlock [ k ];
+                      };
+                 };
+            };
+       //-----------------------------------------------------------------------
+       // The lane bits of a block go to bits i % 64 on of word i / 64 of
+       // the validity bits; LANES divides 64, so a block never straddles
+       // two words, and the first block of a word clears it.
+       //-----------------------------------------------------------------------
+          if( VALIDITY_BITS )
+            {
+               const unsigned long long
+                laneBits = ( unsigned long long )
+                           ( finiteLaneBits & ( ( 1 << lanes ) - 1 ) );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               pValidBits[ i / 64 ] =
+                    ( ( i % 64 == 0 ) ? 0ULL : pValidBits[ i / 64 ] ) |
+                    ( laneBits << ( i % 64 ) );
+            }
+          else
+            {
+               for( size_t k = 0; k < lanes; k++ )
+                 {
+                    pConversionStatus[ i + k ] =
+                         ( ( finiteLaneBits >> k ) & 1 ) ?
+                         SUCCESSFUL_CONVERSION : INVALID_ECEF_COORDINATES;
+                 };
+            };
+       //-----------------------------------------------------------------------
+          i = i + lanes;
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticBatchAvx2Kernel
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pGeodeticNorthLatitudeRadians,
+                  double * pGeocentricEastLongitudeRadians,
+                  double * pGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticBatchAvx2Kernel
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Four lane AVX2 + FMA batch kernel of 'convertEcefToGeodeticBatch',
+//    for an ellipsoid context built by 'initializeEarthEllipsoidContext'.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] This file is compiled with '-mavx2 -mfma'.  It must only be
+//          called when 'detectEcefToGeodeticIsaLevel' reports at least
+//          AVX2_FMA_ISA_LEVEL.
+//
+//    [ 2 ] The last numberPoints % 4 points are copied to a zero padded
+//          block of four, so no lane reads or writes past the arrays.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticBatchOutputsAvx2< true, true, true, false >
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                rEllipsoidContext,
+                numberPoints,
+                pXEcefMeters,
+                pYEcefMeters,
+                pZEcefMeters,
+             //-------------------
+             // OUTPUT(s):
+             //-------------------
+                pGeodeticNorthLatitudeRadians,
+                pGeocentricEastLongitudeRadians,
+                pGeodeticAltitudeMeters,
+                pConversionStatus,
+                NULL
+           );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticBatchValidityBitsAvx2Kernel
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pGeodeticNorthLatitudeRadians,
+                  double * pGeocentricEastLongitudeRadians,
+                  double * pGeodeticAltitudeMeters,
+                  unsigned long long
+                         * pValidBits
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticBatchValidityBitsAvx2Kernel
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    As 'convertEcefToGeodeticBatchAvx2Kernel', with the finite
+//    coordinates lane mask of each block of four points stored as
+//    validity bits, bit i % 64 of word i / 64 for point i, instead of a
+//    status per point.  The bits of the last word past numberPoints are
+//    clear.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The outputs are identical to those of
+//          'convertEcefToGeodeticBatchAvx2Kernel'; a point with a
+//          coordinate which is not finite has NAN outputs and a clear bit,
+//          and costs the same as any other.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticBatchOutputsAvx2< true, true, true, true >
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                rEllipsoidContext,
+                numberPoints,
+                pXEcefMeters,
+                pYEcefMeters,
+                pZEcefMeters,
+             //-------------------
+             // OUTPUT(s):
+             //-------------------
+                pGeodeticNorthLatitudeRadians,
+                pGeocentricEastLongitudeRadians,
+                pGeodeticAltitudeMeters,
+                NULL,
+                pValidBits
+           );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticPartialBatchAvx2Kernel
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const ECEF_TO_GEODETIC_OUTPUT_SELECTION
+                           outputSelection,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pGeodeticNorthLatitudeRadians,
+                  double * pGeocentricEastLongitudeRadians,
+                  double * pGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticPartialBatchAvx2Kernel
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Four lane AVX2 + FMA kernel of the altitude only, latitude and
+//    longitude only and latitude only batch conversions.  The output
+//    arrays which outputSelection does not select are not referenced.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The selected outputs are identical to those of
+//          'convertEcefToGeodeticBatchAvx2Kernel'.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    if( outputSelection == ALTITUDE_ONLY_OUTPUT )
+      {
+          convertEcefToGeodeticBatchOutputsAvx2< false, false, true, false >
+                 (
+                   //-------------------
+                   // INPUT(s):
+                   //-------------------
+                      rEllipsoidContext,
+                      numberPoints,
+                      pXEcefMeters,
+                      pYEcefMeters,
+                      pZEcefMeters,
+                   //-------------------
+                   // OUTPUT(s):
+                   //-------------------
+                      pGeodeticNorthLatitudeRadians,
+                      pGeocentricEastLongitudeRadians,
+                      pGeodeticAltitudeMeters,
+                      pConversionStatus,
+                      NULL
+                 );
+      }
+    else
+    if( outputSelection == LATITUDE_LONGITUDE_OUTPUT )
+      {
+          convertEcefToGeodeticBatchOutputsAvx2< true, true, false, false >
+                 (
+                   //-------------------
+                   // INPUT(s):
+                   //-------------------
+                      rEllipsoidContext,
+                      numberPoints,
+                      pXEcefMeters,
+                      pYEcefMeters,
+                      pZEcefMeters,
+                   //-------------------
+                   // OUTPUT(s):
+                   //-------------------
+                      pGeodeticNorthLatitudeRadians,
+                      pGeocentricEastLongitudeRadians,
+                      pGeodeticAltitudeMeters,
+                      pConversionStatus,
+                      NULL
+                 );
+      }
+    else
+      {
+          convertEcefToGeodeticBatchOutputsAvx2< true, false, false, false >
+                 (
+                   //-------------------
+                   // INPUT(s):
+                   //-------------------
+                      rEllipsoidContext,
+                      numberPoints,
+                      pXEcefMeters,
+                      pYEcefMeters,
+                      pZEcefMeters,
+                   //-------------------
+                   // OUTPUT(s):
+                   //-------------------
+                      pGeodeticNorthLatitudeRadians,
+                      pGeocentricEastLongitudeRadians,
+                      pGeodeticAltitudeMeters,
+                      pConversionStatus,
+                      NULL
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+template< bool BLOCKED >
+static
+inline
+size_t
+offsetInterleavedPointAvx2
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const size_t   i,
+            const size_t   strideDoubles,
+            const size_t   blockPoints
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    offsetInterleavedPointAvx2
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The offset in doubles of the first coordinate of point i:  in its
+//    record of strideDoubles, or, with BLOCKED set, in its block of
+//    blockPoints points.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    return( BLOCKED ?
+            ( i / blockPoints ) * 3 * blockPoints + ( i % blockPoints ) :
+            i * strideDoubles );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+template< bool BLOCKED >
+static
+void
+convertEcefToGeodeticInterleavedOutputsAvx2
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const size_t   blockPoints,
+            const double * pInput,
+            const size_t   inputStrideBytes,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pOutput,
+            const size_t   outputStrideBytes,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticInterleavedOutputsAvx2
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The block loop of 'convertEcefToGeodeticInterleavedBatchAvx2Kernel'
+//    and, with BLOCKED set, of
+//    'convertEcefToGeodeticBlockInterleavedBatchAvx2Kernel', whose
+//    strides are not referenced.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    Each block of four points is loaded into the x, y and z registers of
+//    'convertEcefToGeodeticAvx2', and its outputs stored back, as:
+//
+//    [ 1 ] Blocked:  three loads and stores, since the four points are
+//          adjacent in each coordinate of their block.
+//
+//    [ 2 ] Packed records:  three loads of the twelve coordinates, two
+//          blends and a lane permute into three registers of coordinate
+//          pairs, and three shuffles, and the reverse for the stores.
+//
+//    [ 3 ] Strided records:  the x, y pairs of the four records are
+//          loaded as two registers, which unpack to x and y, and the z
+//          coordinates are inserted one by one; the stores reverse it.
+//
+//    The last numberPoints % 4 points are copied one by one to and from
+//    zero padded blocks of four, as in 'convertEcefToGeodeticBatchAvx2Kernel'.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const double   earthEquatorialRadiusMeters =
+                      rEllipsoidContext.earthEquatorialRadiusMeters;
+    const double   earthEllipticitySquared =
+                      rEllipsoidContext.earthEllipticitySquared;
+    const double   oneAndHalf_e4 =
+                      rEllipsoidContext.oneAndHalf_e4;
+    const double   complimentaryEarthEllipticitySquared =
+                      rEllipsoidContext.complimentaryEarthEllipticitySquared;
+    const double   complimentaryEarthEllipticity =
+                      rEllipsoidContext.complimentaryEarthEllipticity;
+    const double   earthPolarRadiusMeters =
+                      rEllipsoidContext.earthPolarRadiusMeters;
+    const double   inverseEarthEquatorialRadius =
+                      rEllipsoidContext.inverseEarthEquatorialRadius;
+    const double   aEpsSquared =
+                      rEllipsoidContext.aEpsSquared;
+ //-----------------------------------------------------------------------------
+    const size_t LANES = 4;
+ //-----------------------------------------------------------------------------
+ // The coordinates of a point are coordinateStep doubles apart.
+ //-----------------------------------------------------------------------------
+    const size_t coordinateStep      = BLOCKED ? blockPoints : 1;
+    const size_t inputStrideDoubles  = inputStrideBytes  / sizeof( double );
+    const size_t outputStrideDoubles = outputStrideBytes / sizeof( double );
+    const bool   packedInput         = !BLOCKED && ( inputStrideDoubles  == 3 );
+    const bool   packedOutput        = !BLOCKED && ( outputStrideDoubles == 3 );
+ //-----------------------------------------------------------------------------
+    size_t i = 0;
+ //-----------------------------------------------------------------------------
+    while( i < numberPoints )
+      {
+       //-----------------------------------------------------------------------
+          const size_t lanes = ( numberPoints - i < LANES ) ?
+                               ( numberPoints - i ) : LANES;
+       //-----------------------------------------------------------------------
+          __m256d x;
+          __m256d y;
+          __m256d z;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( ( lanes == LANES ) && BLOCKED )
+            {
+               const double * p = pInput +
+                                  offsetInterleavedPointAvx2< BLOCKED >
+                                         (
+                                           i, 0, blockPoints
+                                         );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               x = _mm256_loadu_pd( p                   );
+               y = _mm256_loadu_pd( p +     blockPoints );
+               z = _mm256_loadu_pd( p + 2 * blockPoints );
+            }
+          else
+          if( ( lanes == LANES ) && packedInput )
+            {
+               const double * p = pInput + 3 * i;
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+            // x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               const __m256d a    = _mm256_loadu_pd( p     );
+               const __m256d b    = _mm256_loadu_pd( p + 4 );
+               const __m256d c    = _mm256_loadu_pd( p + 8 );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+            // x0 y0 x2 y2 | z0 x1 z2 x3 | y1 z1 y3 z3
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               const __m256d xy02 = _mm256_blend_pd( a, b, 0xC );
+               const __m256d zx13 = _mm256_permute2f128_pd( a, c, 0x21 );
+               const __m256d yz13 = _mm256_blend_pd( b, c, 0xC );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               x = _mm256_shuffle_pd( xy02, zx13, 0xA );
+               y = _mm256_shuffle_pd( xy02, yz13, 0x5 );
+               z = _mm256_shuffle_pd( zx13, yz13, 0xA );
+            }
+          else
+          if( lanes == LANES )
+            {
+               const double * p0 = pInput + ( i     ) * inputStrideDoubles;
+               const double * p1 = pInput + ( i + 1 ) * inputStrideDoubles;
+               const double * p2 = pInput + ( i + 2 ) * inputStrideDoubles;
+               const double * p3 = pInput + ( i + 3 ) * inputStrideDoubles;
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               const __m256d xy02 = _mm256_insertf128_pd
+                                           (
+                                             _mm256_castpd128_pd256
+                                             (
+                                               _mm_loadu_pd( p0 )
+                                             ),
+                                             _mm_loadu_pd( p2 ),
+                                             1
+                                           );
+               const __m256d xy13 = _mm256_insertf128_pd
+                                           (
+                                             _mm256_castpd128_pd256
+                                             (
+                                               _mm_loadu_pd( p1 )
+                                             ),
+                                             _mm_loadu_pd( p3 ),
+                                             1
+                                           );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               x = _mm256_unpacklo_pd( xy02, xy13 );
+               y = _mm256_unpackhi_pd( xy02, xy13 );
+               z = _mm256_set_pd( p3[ 2 ], p2[ 2 ], p1[ 2 ], p0[ 2 ] );
+            }
+          else
+            {
+               double xBlock[ LANES ] = { 0.0, 0.0, 0.0, 0.0 };
+               double yBlock[ LANES ] = { 0.0, 0.0, 0.0, 0.0 };
+               double zBlock[ LANES ] = { 0.0, 0.0, 0.0, 0.0 };
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               for( size_t k = 0; k < lanes; k++ )
+                 {
+                    const double * p = pInput +
+                                       offsetInterleavedPointAvx2< BLOCKED >
+                                              (
+                                                i + k,
+                                                inputStrideDoubles,
+                                                blockPoints
+                                              );
+                 //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                    xBlock[ k ] = p[ 0                  ];
+                    yBlock[ k ] = p[     coordinateStep ];
+                    zBlock[ k ] = p[ 2 * coordinateStep ];
+                 };
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               x = _mm256_loadu_pd( xBlock );
+               y = _mm256_loadu_pd( yBlock );
+               z = _mm256_loadu_pd( zBlock );
+            };
+       //-----------------------------------------------------------------------
+          __m256d latitude;
+          __m256d longitude;
+          __m256d altitude;
+          int     finiteLaneBits;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          convertEcefToGeodeticAvx2< true, true, true >
+                 (
+                   earthEquatorialRadiusMeters,
+                   earthEllipticitySquared,
+                   oneAndHalf_e4,
+                   complimentaryEarthEllipticitySquared,
+                   complimentaryEarthEllipticity,
+                   earthPolarRadiusMeters,
+                   inverseEarthEquatorialRadius,
+                   aEpsSquared,
+                   x,
+                   y,
+                   z,
+                   latitude,
+                   longitude,
+                   altitude,
+                   finiteLaneBits
+                 );
+       //-----------------------------------------------------------------------
+          if( ( lanes == LANES ) && BLOCKED )
+            {
+               double * p = pOutput +
+                            offsetInterleavedPointAvx2< BLOCKED >
+                                   (
+                                     i, 0, blockPoints
+                                   );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               _mm256_storeu_pd( p,                   latitude  );
+               _mm256_storeu_pd( p +     blockPoints, longitude );
+               _mm256_storeu_pd( p + 2 * blockPoints, altitude  );
+            }
+          else
+          if( ( lanes == LANES ) && packedOutput )
+            {
+               double * p = pOutput + 3 * i;
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+            // L0 O0 L2 O2 | H0 L1 H2 L3 | O1 H1 O3 H3, for the latitude L,
+            // longitude O and altitude H.
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               const __m256d lo02 = _mm256_shuffle_pd( latitude,  longitude,
+                                                       0x0 );
+               const __m256d hl13 = _mm256_shuffle_pd( altitude,  latitude,
+                                                       0xA );
+               const __m256d oh13 = _mm256_shuffle_pd( longitude, altitude,
+                                                       0xF );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+            // L0 O0 H0 L1 | O1 H1 L2 O2 | H2 L3 O3 H3
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               _mm256_storeu_pd( p,     _mm256_permute2f128_pd( lo02, hl13,
+                                                                0x20 ) );
+               _mm256_storeu_pd( p + 4, _mm256_blend_pd( oh13, lo02, 0xC ) );
+               _mm256_storeu_pd( p + 8, _mm256_permute2f128_pd( hl13, oh13,
+                                                                0x31 ) );
+            }
+          else
+          if( lanes == LANES )
+            {
+               double * p0 = pOutput + ( i     ) * outputStrideDoubles;
+               double * p1 = pOutput + ( i + 1 ) * outputStrideDoubles;
+               double * p2 = pOutput + ( i + 2 ) * outputStrideDoubles;
+               double * p3 = pOutput + ( i + 3 ) * outputStrideDoubles;
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               const __m256d lo02 = _mm256_unpacklo_pd( latitude, longitude );
+               const __m256d lo13 = _mm256_unpackhi_pd( latitude, longitude );
+               const __m128d h01  = _mm256_castpd256_pd128( altitude );
+               const __m128d h23  = _mm256_extractf128_pd( altitude, 1 );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               _mm_storeu_pd( p0, _mm256_castpd256_pd128( lo02 ) );
+               _mm_storeu_pd( p1, _mm256_castpd256_pd128( lo13 ) );
+               _mm_storeu_pd( p2, _mm256_extractf128_pd( lo02, 1 ) );
+               _mm_storeu_pd( p3, _mm256_extractf128_pd( lo13, 1 ) );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               _mm_store_sd ( p0 + 2, h01 );
+               _mm_storeh_pd( p1 + 2, h01 );
+               _mm_store_sd ( p2 + 2, h23 );
+               _mm_storeh_pd( p3 + 2, h23 );
+            }
+          else
+            {
+               double latitudeBlock [ LANES ];
+               double longitudeBlock[ LANES ];
+               double altitudeBlock [ LANES ];
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               _mm256_storeu_pd( latitudeBlock,  latitude  );
+               _mm256_storeu_pd( longitudeBlock, longitude );
+               _mm256_storeu_pd( altitudeBlock,  altitude  );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               for( size_t k = 0; k < lanes; k++ )
+                 {
+                    double * p = pOutput +
+                                 offsetInterleavedPointAvx2< BLOCKED >
+                                        (
+                                          i + k,
+                                          outputStrideDoubles,
+                                          blockPoints
+                                        );
+                 //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                    p[ 0                  ] = latitudeBlock [ k ];
+                    p[     coordinateStep ] = longitudeBlock[ k ];
+                    p[ 2 * coordinateStep ] = altitudeBlock [ k ];
+                 };
+            };
+       //-----------------------------------------------------------------------
+          for( size_t k = 0; k < lanes; k++ )
+            {
+               pConversionStatus[ i + k ] =
+                    ( ( finiteLaneBits >> k ) & 1 ) ?
+                    SUCCESSFUL_CONVERSION : INVALID_ECEF_COORDINATES;
+            };
+       //-----------------------------------------------------------------------
+          i = i + lanes;
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticInterleavedBatchAvx2Kernel
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const double * pXyzEcefMeters,
+            const size_t   inputStrideBytes,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pLatitudeLongitudeAltitude,
+            const size_t   outputStrideBytes,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticInterleavedBatchAvx2Kernel
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Four lane AVX2 + FMA kernel of 'convertEcefToGeodeticInterleavedBatch'.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The outputs are identical to those of
+//          'convertEcefToGeodeticBatchAvx2Kernel' for the same points.
+//
+//    [ 2 ] Every block of four is loaded before it is stored, so the
+//          output records may be the input records.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticInterleavedOutputsAvx2< false >
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                rEllipsoidContext,
+                numberPoints,
+                0,
+                pXyzEcefMeters,
+                inputStrideBytes,
+             //-------------------
+             // OUTPUT(s):
+             //-------------------
+                pLatitudeLongitudeAltitude,
+                outputStrideBytes,
+                pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticBlockInterleavedBatchAvx2Kernel
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const size_t   blockPoints,
+            const double * pXyzEcefMeterBlocks,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pLatitudeLongitudeAltitudeBlocks,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticBlockInterleavedBatchAvx2Kernel
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Four lane AVX2 + FMA kernel of
+//    'convertEcefToGeodeticBlockInterleavedBatch'.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] blockPoints must be a multiple of 4, so that no block of four
+//          straddles two blocks of the layout.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticInterleavedOutputsAvx2< true >
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                rEllipsoidContext,
+                numberPoints,
+                blockPoints,
+                pXyzEcefMeterBlocks,
+                0,
+             //-------------------
+             // OUTPUT(s):
+             //-------------------
+                pLatitudeLongitudeAltitudeBlocks,
+                0,
+                pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,1234 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <float.h>
+#include <immintrin.h>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+static
+inline
+__m512d
+computeArcTangent2Avx512
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const __m512d  y,
+            const __m512d  x
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    computeArcTangent2Avx512
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Eight lane double precision atan2( y, x ) without branches.
+//
+//    The method is that of 'computeArcTangent2Avx2' in
+//    'convertEcefToGeodeticBatchAvx2.cpp', with the lane selections done
+//    by AVX-512 mask registers.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const __m512d zero       = _mm512_setzero_pd( );
+    const __m512d one        = _mm512_set1_pd( 1.0 );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const __m512d piOverTwo  = _mm512_set1_pd( 1.57079632679489661923e0 );
+    const __m512d piOverFour = _mm512_set1_pd( 7.85398163397448309616e-1 );
+    const __m512d pi         = _mm512_set1_pd( 3.14159265358979323846e0 );
+    const __m512d moreBits   = _mm512_set1_pd( 6.123233995736765886130e-17 );
+ //-----------------------------------------------------------------------------
+    const __m512d absX       = _mm512_abs_pd( x );
+    const __m512d absY       = _mm512_abs_pd( y );
+    const __m512d maximum    = _mm512_max_pd( absX, absY );
+    const __m512d minimum    = _mm512_min_pd( absX, absY );
+ //-----------------------------------------------------------------------------
+    const __mmask8 notBothZero = _mm512_cmp_pd_mask( maximum, zero, _CMP_NEQ_UQ );
+    const __m512d  a           = _mm512_maskz_div_pd( notBothZero, minimum, maximum );
+ //-----------------------------------------------------------------------------
+    const __mmask8 reduce    = _mm512_cmp_pd_mask
+                                      (
+                                        a,
+                                        _mm512_set1_pd( 0.66 ),
+                                        _CMP_GT_OQ
+                                      );
+    const __m512d  t         = _mm512_mask_div_pd
+                                      (
+                                        a,
+                                        reduce,
+                                        _mm512_sub_pd( a, one ),
+                                        _mm512_add_pd( a, one )
+                                      );
+ //-----------------------------------------------------------------------------
+    const __m512d z          = _mm512_mul_pd( t, t );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    __m512d P = _mm512_set1_pd( -8.750608600031904122785e-1 );
+    P = _mm512_fmadd_pd( P, z, _mm512_set1_pd( -1.615753718733365076637e1 ) );
+    P = _mm512_fmadd_pd( P, z, _mm512_set1_pd( -7.500855792314704667340e1 ) );
+    P = _mm512_fmadd_pd( P, z, _mm512_set1_pd( -1.228866684490136173410e2 ) );
+    P = _mm512_fmadd_pd( P, z, _mm512_set1_pd( -6.485021904942025371773e1 ) );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    __m512d Q = _mm512_add_pd( z, _mm512_set1_pd( 2.485846490142306297962e1 ) );
+    Q = _mm512_fmadd_pd( Q, z, _mm512_set1_pd( 1.650270098316988542046e2 ) );
+    Q = _mm512_fmadd_pd( Q, z, _mm512_set1_pd( 4.328810604912902668951e2 ) );
+    Q = _mm512_fmadd_pd( Q, z, _mm512_set1_pd( 4.853903996359136964868e2 ) );
+    Q = _mm512_fmadd_pd( Q, z, _mm512_set1_pd( 1.945506571482613964425e2 ) );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    __m512d r = _mm512_fmadd_pd
+                       (
+                         _mm512_mul_pd( t, z ),
+                         _mm512_div_pd( P, Q ),
+                         t
+                       );
+ //-----------------------------------------------------------------------------
+    r = _mm512_mask_add_pd
+               (
+                 r,
+                 reduce,
+                 piOverFour,
+                 _mm512_add_pd
+                        (
+                          r,
+                          _mm512_set1_pd( 0.5 * 6.123233995736765886130e-17 )
+                        )
+               );
+ //-----------------------------------------------------------------------------
+    const __mmask8 swap      = _mm512_cmp_pd_mask( absY, absX, _CMP_GT_OQ );
+    r = _mm512_mask_add_pd
+               (
+                 r,
+                 swap,
+                 _mm512_sub_pd( piOverTwo, r ),
+                 moreBits
+               );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const __mmask8 negativeX = _mm512_test_epi64_mask
+                                      (
+                                        _mm512_castpd_si512( x ),
+                                        _mm512_set1_epi64( 0x8000000000000000LL )
+                                      );
+    r = _mm512_mask_add_pd
+               (
+                 r,
+                 negativeX,
+                 _mm512_sub_pd( pi, r ),
+                 _mm512_add_pd( moreBits, moreBits )
+               );
+ //-----------------------------------------------------------------------------
+    return
+      (
+        _mm512_castsi512_pd
+               (
+                 _mm512_or_si512
+                        (
+                          _mm512_castpd_si512( r ),
+                          _mm512_and_si512
+                                 (
+                                   _mm512_castpd_si512( y ),
+                                   _mm512_set1_epi64( 0x8000000000000000LL )
+                                 )
+                        )
+               )
+      );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+template< bool LATITUDE, bool LONGITUDE, bool ALTITUDE >
+static
+inline
+void
+convertEcefToGeodeticAvx512
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double   earthEquatorialRadiusMeters,
+            const double   earthEllipticitySquared,
+            const double   oneAndHalf_e4,
+            const double   complimentaryEarthEllipticitySquared,
+            const double   complimentaryEarthEllipticity,
+            const double   earthPolarRadiusMeters,
+            const double   inverseEarthEquatorialRadius,
+            const double   aEpsSquared,
+            const __m512d  x,
+            const __m512d  y,
+            const __m512d  z,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  __m512d  &rLatitude,
+                  __m512d  &rLongitude,
+                  __m512d  &rAltitude,
+                  __mmask8 &rFiniteLanes
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticAvx512
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The one iteration Fukushima Halley step of 'convertEcefToGeodetic'
+//    for eight points, with the polar axis vicinity and the southern
+//    hemisphere handled by mask blends instead of branches.
+//
+//    Lanes with a coordinate which is not finite have NAN outputs and a
+//    clear bit in rFiniteLanes.
+//
+//    Only the outputs whose template flag is set are assigned, so the
+//    arithmetic of the others is dead code which the compiler drops.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const __m512d  ec        = _mm512_set1_pd( complimentaryEarthEllipticity );
+    const __m512d  e2        = _mm512_set1_pd( earthEllipticitySquared );
+    const __m512d  inverseA  = _mm512_set1_pd( inverseEarthEquatorialRadius );
+    const __m512d  zero      = _mm512_setzero_pd( );
+    const __m512d  maximumDouble = _mm512_set1_pd( DBL_MAX );
+ //-----------------------------------------------------------------------------
+    const __m512d pSquared  = _mm512_fmadd_pd
+                                     (
+                                       y, y, _mm512_mul_pd( x, x )
+                                     );
+    const __m512d p         = _mm512_sqrt_pd( pSquared );
+    const __m512d absZ      = _mm512_abs_pd( z );
+ //-----------------------------------------------------------------------------
+ // Equations (2), (17), (14), (12), (13), (15), (10), (11) and (21) of
+ // Reference [ 1 ] of 'convertEcefToGeodetic'.
+ //-----------------------------------------------------------------------------
+    const __m512d S0        = _mm512_mul_pd( absZ, inverseA );
+    const __m512d Pn        = _mm512_mul_pd( p,    inverseA );
+    const __m512d zc        = _mm512_mul_pd( ec, S0 );
+    const __m512d C0        = _mm512_mul_pd( ec, Pn );
+    const __m512d C0Squared = _mm512_mul_pd( C0, C0 );
+    const __m512d C0Cubed   = _mm512_mul_pd( C0, C0Squared );
+    const __m512d S0Squared = _mm512_mul_pd( S0, S0 );
+    const __m512d S0Cubed   = _mm512_mul_pd( S0, S0Squared );
+    const __m512d A0Squared = _mm512_add_pd( C0Squared, S0Squared );
+    const __m512d A0        = _mm512_sqrt_pd( A0Squared );
+    const __m512d A0Cubed   = _mm512_mul_pd( A0, A0Squared );
+    const __m512d D0        = _mm512_fmadd_pd
+                                     (
+                                       zc, A0Cubed,
+                                       _mm512_mul_pd( e2, S0Cubed )
+                                     );
+    const __m512d F0        = _mm512_fnmadd_pd
+                                     (
+                                       e2, C0Cubed,
+                                       _mm512_mul_pd( Pn, A0Cubed )
+                                     );
+    const __m512d B0        = _mm512_mul_pd
+                                     (
+                                       _mm512_mul_pd
+                                              (
+                                                _mm512_mul_pd
+                                                       (
+                                                         _mm512_set1_pd
+                                                         (
+                                                           oneAndHalf_e4
+                                                         ),
+                                                         S0Squared
+                                                       ),
+                                                _mm512_mul_pd
+                                                       (
+                                                         C0Squared, Pn
+                                                       )
+                                              ),
+                                       _mm512_sub_pd( A0, ec )
+                                     );
+    const __m512d S1        = _mm512_fnmadd_pd
+                                     (
+                                       B0, S0, _mm512_mul_pd( D0, F0 )
+                                     );
+    const __m512d C1        = _mm512_fnmadd_pd
+                                     (
+                                       B0, C0, _mm512_mul_pd( F0, F0 )
+                                     );
+    const __m512d Cc        = _mm512_mul_pd( ec, C1 );
+ //-----------------------------------------------------------------------------
+ // Equation (20) of Reference [ 1 ] of 'convertEcefToGeodetic'.
+ //-----------------------------------------------------------------------------
+    const __m512d S1Squared = _mm512_mul_pd( S1, S1 );
+    const __m512d CcSquared = _mm512_mul_pd( Cc, Cc );
+    const __m512d a1        = _mm512_sqrt_pd
+                                     (
+                                       _mm512_fmadd_pd
+                                              (
+                                                _mm512_set1_pd
+                                                (
+                                                  complimentaryEarthEllipticitySquared
+                                                ),
+                                                S1Squared,
+                                                CcSquared
+                                              )
+                                     );
+    const __m512d h1        = _mm512_div_pd
+                                     (
+                                       _mm512_fnmadd_pd
+                                              (
+                                                _mm512_set1_pd
+                                                (
+                                                  earthEquatorialRadiusMeters
+                                                ),
+                                                a1,
+                                                _mm512_fmadd_pd
+                                                       (
+                                                         absZ, S1,
+                                                         _mm512_mul_pd
+                                                         (
+                                                           p, Cc
+                                                         )
+                                                       )
+                                              ),
+                                       _mm512_sqrt_pd
+                                              (
+                                                _mm512_add_pd
+                                                       (
+                                                         CcSquared,
+                                                         S1Squared
+                                                       )
+                                              )
+                                     );
+ //-----------------------------------------------------------------------------
+ // Blend in the polar axis vicinity values and the southern hemisphere sign.
+ //-----------------------------------------------------------------------------
+    const __mmask8 nearPolarAxis =
+                     _mm512_cmp_pd_mask
+                            (
+                              pSquared,
+                              _mm512_set1_pd( aEpsSquared ),
+                              _CMP_NGT_UQ
+                            );
+    const __mmask8 southernHemisphere =
+                     _mm512_cmp_pd_mask( z, zero, _CMP_LT_OQ );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const __m512d S_  = _mm512_mask_blend_pd
+                               (
+                                 nearPolarAxis, S1, _mm512_set1_pd( 1.0 )
+                               );
+    const __m512d S   = _mm512_mask_sub_pd
+                               (
+                                 S_, southernHemisphere, zero, S_
+                               );
+    const __m512d C   = _mm512_mask_blend_pd( nearPolarAxis, Cc, zero );
+    const __m512d h   = _mm512_mask_sub_pd
+                               (
+                                 h1,
+                                 nearPolarAxis,
+                                 absZ,
+                                 _mm512_set1_pd( earthPolarRadiusMeters )
+                               );
+ //-----------------------------------------------------------------------------
+ // Angles.
+ //-----------------------------------------------------------------------------
+    const __mmask8 offPolarAxis =
+                     _mm512_cmp_pd_mask( pSquared, zero, _CMP_GT_OQ );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const __m512d latitude  = computeArcTangent2Avx512( S, C );
+    const __m512d longitude = _mm512_maskz_mov_pd
+                                     (
+                                       offPolarAxis,
+                                       computeArcTangent2Avx512( y, x )
+                                     );
+ //-----------------------------------------------------------------------------
+ // Lanes with coordinates which are not finite get NAN outputs.
+ //-----------------------------------------------------------------------------
+    const __mmask8 finite =
+             _mm512_cmp_pd_mask( _mm512_abs_pd( x ), maximumDouble,
+                                 _CMP_LE_OQ )
+             &
+             _mm512_cmp_pd_mask( _mm512_abs_pd( y ), maximumDouble,
+                                 _CMP_LE_OQ )
+             &
+             _mm512_cmp_pd_mask( absZ,               maximumDouble,
+                                 _CMP_LE_OQ );
+    const __m512d  notANumber = _mm512_set1_pd( NAN );
+ //-----------------------------------------------------------------------------
+    if( LATITUDE )
+      {
+          rLatitude  = _mm512_mask_blend_pd( finite, notANumber, latitude  );
+      };
+    if( LONGITUDE )
+      {
+          rLongitude = _mm512_mask_blend_pd( finite, notANumber, longitude );
+      };
+    if( ALTITUDE )
+      {
+          rAltitude  = _mm512_mask_blend_pd( finite, notANumber, h         );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    rFiniteLanes = finite;
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+template< bool LATITUDE, bool LONGITUDE, bool ALTITUDE,
+          bool VALIDITY_BITS >
+static
+void
+convertEcefToGeodeticBatchOutputsAvx512
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pGeodeticNorthLatitudeRadians,
+                  double * pGeocentricEastLongitudeRadians,
+                  double * pGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus,
+                  unsigned long long
+                         * pValidBits
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticBatchOutputsAvx512
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The block loop of 'convertEcefToGeodeticBatchAvx512Kernel' and
+//    'convertEcefToGeodeticPartialBatchAvx512Kernel'.  Only the outputs
+//    whose template flag is set are stored, and only their arrays are
+//    referenced.
+//
+//    The arithmetic which feeds only outputs that are not stored is dead
+//    code, which the compiler drops: equation (20) goes with the
+//    altitude, and each arctangent with its angle.
+//
+//    With VALIDITY_BITS set, the finite coordinates lane mask of each
+//    block is stored in pValidBits, and pConversionStatus is not
+//    referenced; otherwise each point gets a status.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const double   earthEquatorialRadiusMeters =
+                      rEllipsoidContext.earthEquatorialRadiusMeters;
+    const double   earthEllipticitySquared =
+                      rEllipsoidContext.earthEllipticitySquared;
+    const double   oneAndHalf_e4 =
+                      rEllipsoidContext.oneAndHalf_e4;
+    const double   complimentaryEarthEllipticitySquared =
+                      rEllipsoidContext.complimentaryEarthEllipticitySquared;
+    const double   complimentaryEarthEllipticity =
+                      rEllipsoidContext.complimentaryEarthEllipticity;
+    const double   earthPolarRadiusMeters =
+                      rEllipsoidContext.earthPolarRadiusMeters;
+    const double   inverseEarthEquatorialRadius =
+                      rEllipsoidContext.inverseEarthEquatorialRadius;
+    const double   aEpsSquared =
+                      rEllipsoidContext.aEpsSquared;
+ //-----------------------------------------------------------------------------
+    const size_t   LANES     = 8;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < numberPoints; i = i + LANES )
+      {
+       //-----------------------------------------------------------------------
+          const size_t   lanes    = ( numberPoints - i < LANES ) ?
+                                    ( numberPoints - i ) : LANES;
+          const __mmask8 laneMask = ( __mmask8 )( ( 1U << lanes ) - 1U );
+       //-----------------------------------------------------------------------
+          const __m512d x = _mm512_maskz_loadu_pd( laneMask, pXEcefMeters + i );
+          const __m512d y = _mm512_maskz_loadu_pd( laneMask, pYEcefMeters + i );
+          const __m512d z = _mm512_maskz_loadu_pd( laneMask, pZEcefMeters + i );
+       //-----------------------------------------------------------------------
+          __m512d  latitude;
+          __m512d  longitude;
+          __m512d  altitude;
+          __mmask8 finiteLanes;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          convertEcefToGeodeticAvx512< LATITUDE, LONGITUDE, ALTITUDE >
+                 (
+                   earthEquatorialRadiusMeters,
+                   earthEllipticitySquared,
+                   oneAndHalf_e4,
+                   complimentaryEarthEllipticitySquared,
+                   complimentaryEarthEllipticity,
+                   earthPolarRadiusMeters,
+                   inverseEarthEquatorialRadius,
+                   aEpsSquared,
+                   x,
+                   y,
+                   z,
+                   latitude,
+                   longitude,
+                   altitude,
+                   finiteLanes
+                 );
+       //-----------------------------------------------------------------------
+          if( LATITUDE )
+            {
+               _mm512_mask_storeu_pd( pGeodeticNorthLatitudeRadians + i,
+                                      laneMask, latitude );
+            };
+          if( LONGITUDE )
+            {
+               _mm512_mask_storeu_pd( pGeocentricEastLongitudeRadians + i,
+                                      laneMask, longitude );
+            };
+          if( ALTITUDE )
+            {
+               _mm512_mask_storeu_pd( pGeodeticAltitudeMeters + i,
+                                      laneMask, altitude );
+            };
+       //-----------------------------------------------------------------------
+       // The lane bits of a block go to bits i % 64 on of word i / 64 of
+       // the validity bits; LANES divides 64, so a block never straddles
+       // two words, and the first block of a word clears it.
+       //-----------------------------------------------------------------------
+          if( VALIDITY_BITS )
+            {
+               const unsigned long long
+                laneBits = ( unsigned long long )( finiteLanes & laneMask );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               pValidBits[ i / 64 ] =
+                    ( ( i % 64 == 0 ) ? 0ULL : pValidBits[ i / 64 ] ) |
+                    ( laneBits << ( i % 64 ) );
+            }
+          else
+            {
+               for( size_t k = 0; k < lanes; k++ )
+                 {
+                    pConversionStatus[ i + k ] =
+                         ( ( finiteLanes >> k ) & 1 ) ?
+                         SUCCESSFUL_CONVERSION : INVALID_ECEF_COORDINATES;
+                 };
+            };
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticBatchAvx512Kernel
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pGeodeticNorthLatitudeRadians,
+                  double * pGeocentricEastLongitudeRadians,
+                  double * pGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticBatchAvx512Kernel
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Eight lane AVX-512 batch kernel of 'convertEcefToGeodeticBatch',
+//    for an ellipsoid context built by 'initializeEarthEllipsoidContext'.
+//
+//    Each block of eight points is converted with the one iteration
+//    Fukushima Halley step of 'convertEcefToGeodetic', with the polar
+//    axis vicinity and the southern hemisphere handled by mask blends
+//    instead of branches.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] This file is compiled with '-mavx512f -mfma'.  It
+//          must only be called when 'detectEcefToGeodeticIsaLevel'
+//          reports AVX512_ISA_LEVEL.
+//
+//    [ 2 ] The last numberPoints % 8 points are loaded and stored with
+//          lane masks, so no lane reads or writes past the arrays.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticBatchOutputsAvx512< true, true, true, false >
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                rEllipsoidContext,
+                numberPoints,
+                pXEcefMeters,
+                pYEcefMeters,
+                pZEcefMeters,
+             //-------------------
+             // OUTPUT(s):
+             //-------------------
+                pGeodeticNorthLatitudeRadians,
+                pGeocentricEastLongitudeRadians,
+                pGeodeticAltitudeMeters,
+                pConversionStatus,
+                NULL
+           );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticBatchValidityBitsAvx512Kernel
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pGeodeticNorthLatitudeRadians,
+                  double * pGeocentricEastLongitudeRadians,
+                  double * pGeodeticAltitudeMeters,
+                  unsigned long long
+                         * pValidBits
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticBatchValidityBitsAvx512Kernel
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    As 'convertEcefToGeodeticBatchAvx512Kernel', with the finite
+//    coordinates lane mask of each block of eight points stored as
+//    validity bits, bit i % 64 of word i / 64 for point i, instead of a
+//    status per point.  The bits of the last word past numberPoints are
+//    clear.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The outputs are identical to those of
+//          'convertEcefToGeodeticBatchAvx512Kernel'; a point with a
+//          coordinate which is not finite has NAN outputs and a clear bit,
+//          and costs the same as any other.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticBatchOutputsAvx512< true, true, true, true >
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                rEllipsoidContext,
+                numberPoints,
+                pXEcefMeters,
+                pYEcefMeters,
+                pZEcefMeters,
+             //-------------------
+             // OUTPUT(s):
+             //-------------------
+                pGeodeticNorthLatitudeRadians,
+                pGeocentricEastLongitudeRadians,
+                pGeodeticAltitudeMeters,
+                NULL,
+                pValidBits
+           );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticPartialBatchAvx512Kernel
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const ECEF_TO_GEODETIC_OUTPUT_SELECTION
+                           outputSelection,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pGeodeticNorthLatitudeRadians,
+                  double * pGeocentricEastLongitudeRadians,
+                  double * pGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticPartialBatchAvx512Kernel
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Eight lane AVX-512 kernel of the altitude only, latitude and
+//    longitude only and latitude only batch conversions.  The output
+//    arrays which outputSelection does not select are not referenced.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The selected outputs are identical to those of
+//          'convertEcefToGeodeticBatchAvx512Kernel'.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    if( outputSelection == ALTITUDE_ONLY_OUTPUT )
+      {
+          convertEcefToGeodeticBatchOutputsAvx512< false, false, true, false >
+                 (
+                   //-------------------
+                   // INPUT(s):
+                   //-------------------
+                      rEllipsoidContext,
+                      numberPoints,
+                      pXEcefMeters,
+                      pYEcefMeters,
+                      pZEcefMeters,
+                   //-------------------
+                   // OUTPUT(s):
+                   //-------------------
+                      pGeodeticNorthLatitudeRadians,
+                      pGeocentricEastLongitudeRadians,
+                      pGeodeticAltitudeMeters,
+                      pConversionStatus,
+                      NULL
+                 );
+      }
+    else
+    if( outputSelection == LATITUDE_LONGITUDE_OUTPUT )
+      {
+          convertEcefToGeodeticBatchOutputsAvx512< true, true, false, false >
+                 (
+                   //-------------------
+                   // INPUT(s):
+                   //-------------------
+                      rEllipsoidContext,
+                      numberPoints,
+                      pXEcefMeters,
+                      pYEcefMeters,
+                      pZEcefMeters,
+                   //-------------------
+                   // OUTPUT(s):
+                   //-------------------
+                      pGeodeticNorthLatitudeRadians,
+                      pGeocentricEastLongitudeRadians,
+                      pGeodeticAltitudeMeters,
+                      pConversionStatus,
+                      NULL
+                 );
+      }
+    else
+      {
+          convertEcefToGeodeticBatchOutputsAvx512< true, false, false, false >
+                 (
+                   //-------------------
+                   // INPUT(s):
+                   //-------------------
+                      rEllipsoidContext,
+                      numberPoints,
+                      pXEcefMeters,
+                      pYEcefMeters,
+                      pZEcefMeters,
+                   //-------------------
+                   // OUTPUT(s):
+                   //-------------------
+                      pGeodeticNorthLatitudeRadians,
+                      pGeocentricEastLongitudeRadians,
+                      pGeodeticAltitudeMeters,
+                      pConversionStatus,
+                      NULL
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+template< bool BLOCKED >
+static
+void
+convertEcefToGeodeticInterleavedOutputsAvx512
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const size_t   blockPoints,
+            const double * pInput,
+            const size_t   inputStrideBytes,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pOutput,
+            const size_t   outputStrideBytes,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticInterleavedOutputsAvx512
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The block loop of 'convertEcefToGeodeticInterleavedBatchAvx512Kernel'
+//    and, with BLOCKED set, of
+//    'convertEcefToGeodeticBlockInterleavedBatchAvx512Kernel', whose
+//    strides are not referenced.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    Each block of eight points is loaded into the x, y and z registers
+//    of 'convertEcefToGeodeticAvx512', and its outputs stored back, as:
+//
+//    [ 1 ] Blocked:  three masked loads and stores, since the eight
+//          points are adjacent in each coordinate of their block.
+//
+//    [ 2 ] Packed records:  three loads of the twentyfour coordinates and
+//          two two-source permutes per coordinate, and the reverse for the
+//          stores.
+//
+//    [ 3 ] Strided records, and the last numberPoints % 8 packed records:
+//          one masked gather per coordinate, with the record offsets as
+//          indices, and one masked scatter per output.
+//
+//    The lane mask keeps every load and store of the last block within
+//    the points, so no block is copied.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const double   earthEquatorialRadiusMeters =
+                      rEllipsoidContext.earthEquatorialRadiusMeters;
+    const double   earthEllipticitySquared =
+                      rEllipsoidContext.earthEllipticitySquared;
+    const double   oneAndHalf_e4 =
+                      rEllipsoidContext.oneAndHalf_e4;
+    const double   complimentaryEarthEllipticitySquared =
+                      rEllipsoidContext.complimentaryEarthEllipticitySquared;
+    const double   complimentaryEarthEllipticity =
+                      rEllipsoidContext.complimentaryEarthEllipticity;
+    const double   earthPolarRadiusMeters =
+                      rEllipsoidContext.earthPolarRadiusMeters;
+    const double   inverseEarthEquatorialRadius =
+                      rEllipsoidContext.inverseEarthEquatorialRadius;
+    const double   aEpsSquared =
+                      rEllipsoidContext.aEpsSquared;
+ //-----------------------------------------------------------------------------
+    const size_t   LANES        = 8;
+ //-----------------------------------------------------------------------------
+    const bool     packedInput  = !BLOCKED &&
+                                  ( inputStrideBytes  == 3 * sizeof( double ) );
+    const bool     packedOutput = !BLOCKED &&
+                                  ( outputStrideBytes == 3 * sizeof( double ) );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const long long inputStride  = ( long long )inputStrideBytes;
+    const long long outputStride = ( long long )outputStrideBytes;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const __m512i  inputIndex   = _mm512_setr_epi64
+                                         (
+                                           0,               inputStride,
+                                           2 * inputStride, 3 * inputStride,
+                                           4 * inputStride, 5 * inputStride,
+                                           6 * inputStride, 7 * inputStride
+                                         );
+    const __m512i  outputIndex  = _mm512_setr_epi64
+                                         (
+                                           0,                outputStride,
+                                           2 * outputStride, 3 * outputStride,
+                                           4 * outputStride, 5 * outputStride,
+                                           6 * outputStride, 7 * outputStride
+                                         );
+    const __m512d  zero         = _mm512_setzero_pd( );
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < numberPoints; i = i + LANES )
+      {
+       //-----------------------------------------------------------------------
+          const size_t   lanes    = ( numberPoints - i < LANES ) ?
+                                    ( numberPoints - i ) : LANES;
+          const __mmask8 laneMask = ( __mmask8 )( ( 1U << lanes ) - 1U );
+       //-----------------------------------------------------------------------
+          __m512d x;
+          __m512d y;
+          __m512d z;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( BLOCKED )
+            {
+               const double * p = pInput +
+                                  ( i / blockPoints ) * 3 * blockPoints +
+                                  ( i % blockPoints );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               x = _mm512_maskz_loadu_pd( laneMask, p                   );
+               y = _mm512_maskz_loadu_pd( laneMask, p +     blockPoints );
+               z = _mm512_maskz_loadu_pd( laneMask, p + 2 * blockPoints );
+            }
+          else
+          if( ( lanes == LANES ) && packedInput )
+            {
+               const double * p = pInput + 3 * i;
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+            // Coordinate c of point k is element 3 k + c of a, b and c
+            // taken together; the first permute takes the elements of a
+            // and b, and the second those of c.
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               const __m512d a = _mm512_loadu_pd( p      );
+               const __m512d b = _mm512_loadu_pd( p +  8 );
+               const __m512d c = _mm512_loadu_pd( p + 16 );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               x = _mm512_permutex2var_pd
+                          (
+                            _mm512_permutex2var_pd
+                                   (
+                                     a,
+                                     _mm512_setr_epi64( 0, 3, 6,  9,
+                                                        12, 15, 0, 0 ),
+                                     b
+                                   ),
+                            _mm512_setr_epi64( 0, 1, 2, 3, 4, 5, 10, 13 ),
+                            c
+                          );
+               y = _mm512_permutex2var_pd
+                          (
+                            _mm512_permutex2var_pd
+                                   (
+                                     a,
+                                     _mm512_setr_epi64( 1, 4, 7, 10,
+                                                        13, 0, 0, 0 ),
+                                     b
+                                   ),
+                            _mm512_setr_epi64( 0, 1, 2, 3, 4, 8, 11, 14 ),
+                            c
+                          );
+               z = _mm512_permutex2var_pd
+                          (
+                            _mm512_permutex2var_pd
+                                   (
+                                     a,
+                                     _mm512_setr_epi64( 2, 5, 8, 11,
+                                                        14, 0, 0, 0 ),
+                                     b
+                                   ),
+                            _mm512_setr_epi64( 0, 1, 2, 3, 4, 9, 12, 15 ),
+                            c
+                          );
+            }
+          else
+            {
+               const char * p = ( const char * )pInput + i * inputStrideBytes;
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               x = _mm512_mask_i64gather_pd( zero, laneMask, inputIndex,
+                                             p,                        1 );
+               y = _mm512_mask_i64gather_pd( zero, laneMask, inputIndex,
+                                             p +     sizeof( double ), 1 );
+               z = _mm512_mask_i64gather_pd( zero, laneMask, inputIndex,
+                                             p + 2 * sizeof( double ), 1 );
+            };
+       //-----------------------------------------------------------------------
+          __m512d  latitude;
+          __m512d  longitude;
+          __m512d  altitude;
+          __mmask8 finiteLanes;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          convertEcefToGeodeticAvx512< true, true, true >
+                 (
+                   earthEquatorialRadiusMeters,
+                   earthEllipticitySquared,
+                   oneAndHalf_e4,
+                   complimentaryEarthEllipticitySquared,
+                   complimentaryEarthEllipticity,
+                   earthPolarRadiusMeters,
+                   inverseEarthEquatorialRadius,
+                   aEpsSquared,
+                   x,
+                   y,
+                   z,
+                   latitude,
+                   longitude,
+                   altitude,
+                   finiteLanes
+                 );
+       //-----------------------------------------------------------------------
+          if( BLOCKED )
+            {
+               double * p = pOutput +
+                            ( i / blockPoints ) * 3 * blockPoints +
+                            ( i % blockPoints );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               _mm512_mask_storeu_pd( p,                   laneMask,
+                                      latitude  );
+               _mm512_mask_storeu_pd( p +     blockPoints, laneMask,
+                                      longitude );
+               _mm512_mask_storeu_pd( p + 2 * blockPoints, laneMask,
+                                      altitude  );
+            }
+          else
+          if( ( lanes == LANES ) && packedOutput )
+            {
+               double * p = pOutput + 3 * i;
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+            // The first permute places the latitudes and longitudes, and
+            // the second the altitudes.
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               _mm512_storeu_pd
+                      (
+                        p,
+                        _mm512_permutex2var_pd
+                               (
+                                 _mm512_permutex2var_pd
+                                        (
+                                          latitude,
+                                          _mm512_setr_epi64( 0, 8, 0, 1,
+                                                             9, 0, 2, 10 ),
+                                          longitude
+                                        ),
+                                 _mm512_setr_epi64( 0, 1, 8, 3, 4, 9, 6, 7 ),
+                                 altitude
+                               )
+                      );
+               _mm512_storeu_pd
+                      (
+                        p + 8,
+                        _mm512_permutex2var_pd
+                               (
+                                 _mm512_permutex2var_pd
+                                        (
+                                          latitude,
+                                          _mm512_setr_epi64( 0, 3, 11, 0,
+                                                             4, 12, 0, 5 ),
+                                          longitude
+                                        ),
+                                 _mm512_setr_epi64( 10, 1, 2, 11,
+                                                    4, 5, 12, 7 ),
+                                 altitude
+                               )
+                      );
+               _mm512_storeu_pd
+                      (
+                        p + 16,
+                        _mm512_permutex2var_pd
+                               (
+                                 _mm512_permutex2var_pd
+                                        (
+                                          latitude,
+                                          _mm512_setr_epi64( 13, 0, 6, 14,
+                                                             0, 7, 15, 0 ),
+                                          longitude
+                                        ),
+                                 _mm512_setr_epi64( 0, 13, 2, 3,
+                                                    14, 5, 6, 15 ),
+                                 altitude
+                               )
+                      );
+            }
+          else
+            {
+               char * p = ( char * )pOutput + i * outputStrideBytes;
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               _mm512_mask_i64scatter_pd( p,                        laneMask,
+                                          outputIndex, latitude,  1 );
+               _mm512_mask_i64scatter_pd( p +     sizeof( double ), laneMask,
+                                          outputIndex, longitude, 1 );
+               _mm512_mask_i64scatter_pd( p + 2 * sizeof( double ), laneMask,
+                                          outputIndex, altitude,  1 );
+            };
+       //-----------------------------------------------------------------------
+          for( size_t k = 0; k < lanes; k++ )
+            {
+               pConversionStatus[ i + k ] =
+                    ( ( finiteLanes >> k ) & 1 ) ?
+                    SUCCESSFUL_CONVERSION : INVALID_ECEF_COORDINATES;
+            };
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticInterleavedBatchAvx512Kernel
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const double * pXyzEcefMeters,
+            const size_t   inputStrideBytes,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pLatitudeLongitudeAltitude,
+            const size_t   outputStrideBytes,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticInterleavedBatchAvx512Kernel
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Eight lane AVX-512 kernel of 'convertEcefToGeodeticInterleavedBatch'.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The outputs are identical to those of
+//          'convertEcefToGeodeticBatchAvx512Kernel' for the same points.
+//
+//    [ 2 ] Every block of eight is loaded before it is stored, so the
+//          output records may be the input records.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticInterleavedOutputsAvx512< false >
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                rEllipsoidContext,
+                numberPoints,
+                0,
+                pXyzEcefMeters,
+                inputStrideBytes,
+             //-------------------
+             // OUTPUT(s):
+             //-------------------
+                pLatitudeLongitudeAltitude,
+                outputStrideBytes,
+                pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticBlockInterleavedBatchAvx512Kernel
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const size_t   blockPoints,
+            const double * pXyzEcefMeterBlocks,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pLatitudeLongitudeAltitudeBlocks,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticBlockInterleavedBatchAvx512Kernel
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Eight lane AVX-512 kernel of
+//    'convertEcefToGeodeticBlockInterleavedBatch'.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] blockPoints must be a multiple of 8, so that no block of eight
+//          straddles two blocks of the layout.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticInterleavedOutputsAvx512< true >
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                rEllipsoidContext,
+                numberPoints,
+                blockPoints,
+                pXyzEcefMeterBlocks,
+                0,
+             //-------------------
+             // OUTPUT(s):
+             //-------------------
+                pLatitudeLongitudeAltitudeBlocks,
+                0,
+                pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
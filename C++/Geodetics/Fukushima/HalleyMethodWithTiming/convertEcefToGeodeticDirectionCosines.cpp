@@ -0,0 +1,509 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <float.h>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertEcefToGeodeticDirectionCosines
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         &rEllipsoidContext,
+            const double  xEcefMeters,
+            const double  yEcefMeters,
+            const double  zEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double &rSineOfGeodeticNorthLatitude,
+                  double &rCosineOfGeodeticNorthLatitude,
+                  double &rSineOfGeocentricEastLongitude,
+                  double &rCosineOfGeocentricEastLongitude,
+                  double &rEstimatedGeodeticAltitudeMeters
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticDirectionCosines
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Convert Earth Centered Earth Fixed (ECEF) retangular coordinates to
+//    the sine and cosine of the geodetic latitude and of the longitude,
+//    and the geodetic altitude, without computing the angles.
+//
+//    For callers which only use the angles through their sines and
+//    cosines, as in the rotation from ECEF to local East North Up axes,
+//    this replaces the two atan2 calls of 'convertEcefToGeodetic' and the
+//    sin and cos calls that follow them.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    The single Halley iteration of the ellipsoid context
+//    'convertEcefToGeodetic' gives ( S1, Cc ), a vector along
+//    ( sin( latitude ), cos( latitude ) ), of which that function returns
+//    atan2( S1, Cc ).  Here it is normalized instead:
+//
+//       r = 1 / sqrt( S1^2 + Cc^2 )
+//       sin( latitude ) = S1 r,   cos( latitude ) = Cc r
+//
+//    and r also replaces the division of Equation (20) for the altitude,
+//    which already computed that square root.  The longitude is the
+//    direction of ( x, y ):
+//
+//       sin( longitude ) = y / p,   cos( longitude ) = x / p
+//
+//    with p the distance from the polar axis, also already computed.
+//
+//    In the polar axis vicinity the latitude is +/-90 degrees, so the
+//    latitude pair is ( +/-1, 0 ); on the axis, p = 0, the longitude is
+//    0, as for 'convertEcefToGeodetic', and the longitude pair is ( 0, 1 ).
+//
+//------------------------------------------------------------------------------
+//
+//  INPUTS:
+//
+//     rEllipsoidContext
+//       Reference to an ellipsoid context for which
+//       'initializeEarthEllipsoidContext' returned SUCCESSFUL_CONVERSION.
+//
+//     xEcefMeters
+//     yEcefMeters
+//     zEcefMeters
+//       Geocentric rectangular coordinates
+//       UNITS:  [meters]
+//
+//------------------------------------------------------------------------------
+//
+//  OUTPUT:
+//
+//     rSineOfGeodeticNorthLatitude
+//     rCosineOfGeodeticNorthLatitude
+//       Sine and cosine of the geodetic latitude; the cosine is >= 0.
+//
+//     rSineOfGeocentricEastLongitude
+//     rCosineOfGeocentricEastLongitude
+//       Sine and cosine of the longitude.
+//
+//     rEstimatedGeodeticAltitudeMeters
+//       As for 'convertEcefToGeodetic'.
+//
+//------------------------------------------------------------------------------
+//
+//  RETURNED VALUE:
+//
+//     Conversion status:
+//        SUCCESSFUL_CONVERSION
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The pairs agree with the sine and cosine of the angles of the
+//          ellipsoid context 'convertEcefToGeodetic' to a few units in
+//          the last place, see
+//          'executeDirectionCosineTimingConvertEcefToGeodetic'.
+//
+//    [ 2 ] The angles remain available from 'convertEcefToGeodetic'.
+//
+//------------------------------------------------------------------------------
+//
+//  USAGE:
+//
+//    ecefToGeodeticConversionStatus =
+//    convertEcefToGeodeticDirectionCosines
+//           (
+//             //-------------------
+//             // INPUT(s):
+//             //-------------------
+//                ellipsoidContext,
+//                xEcefMeters,
+//                yEcefMeters,
+//                zEcefMeters,
+//             //-------------------
+//             // OUTPUT(s):
+//             //-------------------
+//                sineOfGeodeticNorthLatitude,
+//                cosineOfGeodeticNorthLatitude,
+//                sineOfGeocentricEastLongitude,
+//                cosineOfGeocentricEastLongitude,
+//                estimatedGeodeticAltitudeMeters
+//           );
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const double complimentaryEarthEllipticity =
+                            rEllipsoidContext.complimentaryEarthEllipticity;
+    const double earthEllipticitySquared       =
+                            rEllipsoidContext.earthEllipticitySquared;
+ //-----------------------------------------------------------------------------
+ // Distance from polar axis.
+ //-----------------------------------------------------------------------------
+    const double earthPolarAxisDistanceSquared =
+                                    ( xEcefMeters * xEcefMeters ) +
+                                    ( yEcefMeters * yEcefMeters );
+    const double earthPolarAxisDistanceMeters  =
+                                    sqrt( earthPolarAxisDistanceSquared );
+ //-----------------------------------------------------------------------------
+ // Direction of the longitude.
+ //-----------------------------------------------------------------------------
+    if( earthPolarAxisDistanceSquared > 0.0 )
+      {
+          const double inversePolarAxisDistance =
+                                    1.0 / earthPolarAxisDistanceMeters;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          rSineOfGeocentricEastLongitude   = yEcefMeters *
+                                             inversePolarAxisDistance;
+          rCosineOfGeocentricEastLongitude = xEcefMeters *
+                                             inversePolarAxisDistance;
+      }
+    else
+      {
+          rSineOfGeocentricEastLongitude   = 0.0;
+          rCosineOfGeocentricEastLongitude = 1.0;
+      };
+ //-----------------------------------------------------------------------------
+    const double absZ = fabs( zEcefMeters );
+ //-----------------------------------------------------------------------------
+    if( earthPolarAxisDistanceSquared > rEllipsoidContext.aEpsSquared )
+      {
+       //-----------------------------------------------------------------------
+       // Equations (2), (17), (14), (12), (13), (15), (10) and (11) of
+       // Reference [ 1 ] of 'convertEcefToGeodetic', as in the ellipsoid
+       // context 'convertEcefToGeodetic'.
+       //-----------------------------------------------------------------------
+          const double S0        = absZ /
+                                   rEllipsoidContext.earthEquatorialRadiusMeters;
+          const double Pn        = earthPolarAxisDistanceMeters /
+                                   rEllipsoidContext.earthEquatorialRadiusMeters;
+          const double zc        = complimentaryEarthEllipticity * S0;
+          const double C0        = complimentaryEarthEllipticity * Pn;
+          const double C0Squared = C0 * C0;
+          const double C0Cubed   = C0 * C0Squared;
+          const double S0Squared = S0 * S0;
+          const double S0Cubed   = S0 * S0Squared;
+          const double A0Squared = C0Squared + S0Squared;
+          const double A0        = sqrt( A0Squared );
+          const double A0Cubed   = A0 * A0Squared;
+          const double D0        = (  zc                      * A0Cubed ) +
+                                   (  earthEllipticitySquared * S0Cubed );
+          const double F0        = (  Pn                      * A0Cubed ) +
+                                   ( -earthEllipticitySquared * C0Cubed );
+          const double B0        = rEllipsoidContext.oneAndHalf_e4 *
+                                   S0Squared                       *
+                                   C0Squared                       *
+                                   Pn                              *
+                                   ( A0 - complimentaryEarthEllipticity );
+          const double S1        = ( D0 * F0 ) + ( -B0 * S0 );
+          const double C1        = ( F0 * F0 ) + ( -B0 * C0 );
+          const double Cc        = complimentaryEarthEllipticity * C1;
+       //-----------------------------------------------------------------------
+       // The reciprocal length of ( S1, Cc ), in place of Equation (19).
+       //-----------------------------------------------------------------------
+          const double S1Squared = S1 * S1;
+          const double CcSquared = Cc * Cc;
+          const double inverseLength = 1.0 / sqrt( CcSquared + S1Squared );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          rSineOfGeodeticNorthLatitude   = S1 * inverseLength;
+          rCosineOfGeodeticNorthLatitude = Cc * inverseLength;
+       //-----------------------------------------------------------------------
+       // Equation (20) of Reference [ 1 ] of 'convertEcefToGeodetic'.
+       //-----------------------------------------------------------------------
+          const double a1        = sqrt(
+                                      (
+                                        rEllipsoidContext.
+                                        complimentaryEarthEllipticitySquared *
+                                        S1Squared
+                                      )
+                                      +
+                                      CcSquared
+                                    );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          rEstimatedGeodeticAltitudeMeters =
+                 (
+                   (  earthPolarAxisDistanceMeters                  * Cc ) +
+                   (  absZ                                          * S1 ) +
+                   ( -rEllipsoidContext.earthEquatorialRadiusMeters * a1 )
+                 ) * inverseLength;
+       //-----------------------------------------------------------------------
+      }
+    else
+      {
+       //-----------------------------------------------------------------------
+       // Exceptional processing for the polar axis vicinity.
+       //-----------------------------------------------------------------------
+          rSineOfGeodeticNorthLatitude     = 1.0;
+          rCosineOfGeodeticNorthLatitude   = 0.0;
+          rEstimatedGeodeticAltitudeMeters =
+                                absZ - rEllipsoidContext.earthPolarRadiusMeters;
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    if( zEcefMeters < 0.0 )
+      {
+       //-----------------------------------------------------------------------
+       // Southern Hemisphere.
+       //-----------------------------------------------------------------------
+          rSineOfGeodeticNorthLatitude = -rSineOfGeodeticNorthLatitude;
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return( SUCCESSFUL_CONVERSION );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+static
+void
+convertEcefToGeodeticDirectionCosinesBatchChunk
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   chunkPoints,
+            const double * __restrict__ x,
+            const double * __restrict__ y,
+            const double * __restrict__ z,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * __restrict__ sineOfLatitude,
+                  double * __restrict__ cosineOfLatitude,
+                  double * __restrict__ sineOfLongitude,
+                  double * __restrict__ cosineOfLongitude,
+                  double * __restrict__ altitude,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * __restrict__ status
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticDirectionCosinesBatchChunk
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Convert one cache resident chunk of a batch for
+//    'convertEcefToGeodeticDirectionCosinesBatch'.  The first loop has no
+//    library call but sqrt and its branches are selects, so it is
+//    vectorized; the point status is set by a second loop.  The context
+//    is copied to a local so that its members cannot alias the outputs.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const EARTH_ELLIPSOID_CONTEXT
+     E = rEllipsoidContext;
+ //=============================================================================
+ //
+ // Pass 1:  Branch free Halley step and normalization.
+ //
+ //=============================================================================
+    for( size_t i = 0; i < chunkPoints; i++ )
+      {
+       //-----------------------------------------------------------------------
+          const double xi   = x[ i ];
+          const double yi   = y[ i ];
+          const double zi   = z[ i ];
+          const double absZ = fabs( zi );
+       //-----------------------------------------------------------------------
+          const double pSquared = ( xi * xi ) + ( yi * yi );
+          const double p        = sqrt( pSquared );
+          const bool   offAxis  = ( pSquared > E.aEpsSquared );
+          const bool   onAxis   = !( pSquared > 0.0 );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          const double inverseP = 1.0 / ( onAxis ? 1.0 : p );
+       //-----------------------------------------------------------------------
+          const double S0        = absZ * E.inverseEarthEquatorialRadius;
+          const double Pn        = p    * E.inverseEarthEquatorialRadius;
+          const double zc        = E.complimentaryEarthEllipticity * S0;
+          const double C0        = E.complimentaryEarthEllipticity * Pn;
+          const double C0Squared = C0 * C0;
+          const double S0Squared = S0 * S0;
+          const double A0Squared = C0Squared + S0Squared;
+          const double A0        = sqrt( A0Squared );
+          const double A0Cubed   = A0 * A0Squared;
+          const double D0        = (  zc * A0Cubed ) +
+                                   (  E.earthEllipticitySquared *
+                                      S0 * S0Squared );
+          const double F0        = (  Pn * A0Cubed ) +
+                                   ( -E.earthEllipticitySquared *
+                                      C0 * C0Squared );
+          const double B0        = E.oneAndHalf_e4 *
+                                   S0Squared       *
+                                   C0Squared       *
+                                   Pn              *
+                                   ( A0 - E.complimentaryEarthEllipticity );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+       // The polar axis vicinity uses the pole direction ( 1, 0 ), for
+       // which Equation (20) below gives |z| - b.
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          const double C1        = ( F0 * F0 ) + ( -B0 * C0 );
+          const double S1        = offAxis ? ( ( D0 * F0 ) + ( -B0 * S0 ) ) :
+                                             1.0;
+          const double Cc        = offAxis ? ( E.complimentaryEarthEllipticity *
+                                               C1 ) :
+                                             0.0;
+       //-----------------------------------------------------------------------
+          const double S1Squared = S1 * S1;
+          const double CcSquared = Cc * Cc;
+          const double inverseLength = 1.0 / sqrt( CcSquared + S1Squared );
+          const double a1        = sqrt(
+                                      (
+                                        E.complimentaryEarthEllipticitySquared *
+                                        S1Squared
+                                      )
+                                      +
+                                      CcSquared
+                                    );
+       //-----------------------------------------------------------------------
+          const double sineMagnitude = S1 * inverseLength;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+       // The hemisphere test matches the scalar form, so that z = -0.0 is
+       // northern.
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          sineOfLatitude   [ i ] = ( zi < 0.0 ) ? -sineMagnitude :
+                                                   sineMagnitude;
+          cosineOfLatitude [ i ] = Cc * inverseLength;
+          sineOfLongitude  [ i ] = onAxis ? 0.0 : ( yi * inverseP );
+          cosineOfLongitude[ i ] = onAxis ? 1.0 : ( xi * inverseP );
+          altitude         [ i ] = (
+                                     (  p                             * Cc ) +
+                                     (  absZ                          * S1 ) +
+                                     ( -E.earthEquatorialRadiusMeters * a1 )
+                                   ) * inverseLength;
+       //-----------------------------------------------------------------------
+      };
+ //=============================================================================
+ //
+ // Pass 2:  Point status.
+ //
+ //=============================================================================
+    for( size_t i = 0; i < chunkPoints; i++ )
+      {
+       //-----------------------------------------------------------------------
+          const bool finiteCoordinates =
+                       ( fabs( x[ i ] ) <= DBL_MAX ) &&
+                       ( fabs( y[ i ] ) <= DBL_MAX ) &&
+                       ( fabs( z[ i ] ) <= DBL_MAX );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( finiteCoordinates )
+            {
+               status           [ i ] = SUCCESSFUL_CONVERSION;
+            }
+          else
+            {
+               status           [ i ] = INVALID_ECEF_COORDINATES;
+               sineOfLatitude   [ i ] = NAN;
+               cosineOfLatitude [ i ] = NAN;
+               sineOfLongitude  [ i ] = NAN;
+               cosineOfLongitude[ i ] = NAN;
+               altitude         [ i ] = NAN;
+            };
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticDirectionCosinesBatch
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pSineOfGeodeticNorthLatitude,
+                  double * pCosineOfGeodeticNorthLatitude,
+                  double * pSineOfGeocentricEastLongitude,
+                  double * pCosineOfGeocentricEastLongitude,
+                  double * pEstimatedGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticDirectionCosinesBatch
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    As 'convertEcefToGeodeticDirectionCosines' for the points of
+//    structure of arrays inputs, with the status of each point as in
+//    'convertEcefToGeodeticBatch': INVALID_ECEF_COORDINATES and NaN
+//    outputs for a point with a non finite coordinate.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The kernel is vectorized by the compiler for the instruction
+//          set of the build.  The polar axis vicinity is handled by
+//          selects, so the results may differ from those of the scalar
+//          function in the last bits only.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const
+    size_t
+     CHUNK_POINTS = 256;
+ //-----------------------------------------------------------------------------
+    for(
+         size_t chunkStart  = 0;
+                chunkStart  < numberPoints;
+                chunkStart += CHUNK_POINTS
+       )
+      {
+       //-----------------------------------------------------------------------
+          const
+          size_t
+           chunkPoints = ( numberPoints - chunkStart < CHUNK_POINTS ) ?
+                         ( numberPoints - chunkStart ) : CHUNK_POINTS;
+       //-----------------------------------------------------------------------
+          convertEcefToGeodeticDirectionCosinesBatchChunk
+                 (
+                   rEllipsoidContext,
+                   chunkPoints,
+                   pXEcefMeters                     + chunkStart,
+                   pYEcefMeters                     + chunkStart,
+                   pZEcefMeters                     + chunkStart,
+                   pSineOfGeodeticNorthLatitude     + chunkStart,
+                   pCosineOfGeodeticNorthLatitude   + chunkStart,
+                   pSineOfGeocentricEastLongitude   + chunkStart,
+                   pCosineOfGeocentricEastLongitude + chunkStart,
+                   pEstimatedGeodeticAltitudeMeters + chunkStart,
+                   pConversionStatus                + chunkStart
+                 );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,508 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#ifndef CONVERT_ECEF_TO_GEODETIC_FOR_ACCURACY_TIER_H
+     //-------------------------------------------------------------------------
+#       define CONVERT_ECEF_TO_GEODETIC_FOR_ACCURACY_TIER_H
+
+#       include <float.h>
+#       include <math.h>
+
+#       include "conversionBetweenEcefAndGeodetic.h"
+
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    The display and survey tier kernels of the accuracy tier
+     //    overloads of 'convertEcefToGeodetic' and
+     //    'convertEcefToGeodeticBatch'.
+     //
+     //    Every function here is static, so each translation unit which
+     //    includes this file compiles its own copy for its instruction set:
+     //    'convertEcefToGeodeticWithAccuracyTier.cpp' for the baseline, and
+     //    'convertEcefToGeodeticWithAccuracyTierAvx2.cpp' and
+     //    'convertEcefToGeodeticWithAccuracyTierAvx512.cpp' for the batch
+     //    kernels of the wider instruction sets.  The kernels call no
+     //    library function and have no branches, so the batch loops are
+     //    vectorized by the compiler at each width.
+     //
+     //-------------------------------------------------------------------------
+
+     //-------------------------------------------------------------------------
+     // Coefficients c[ k ] of atan( t ) ~ t ( c[ 0 ] + c[ 1 ] t^2 + ... ) for
+     // | t | <= tan( pi / 8 ), the interpolants of atan( t ) / t at the
+     // Chebyshev nodes in t^2.  The largest errors on the interval, found by
+     // evaluation at 200001 evenly spaced points, are 6.8e-9 radians for the
+     // display tier and 7.8e-12 radians for the survey tier.
+     //-------------------------------------------------------------------------
+        static
+        const
+        double
+         DISPLAY_TIER_ARC_TANGENT_COEFFICIENTS[ 5 ] =
+           {
+              9.999999812646112E-01,
+             -3.333278577192369E-01,
+              1.997408241547598E-01,
+             -1.3848490211961015E-01,
+              7.976291805862455E-02
+           };
+     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        static
+        const
+        double
+         SURVEY_TIER_ARC_TANGENT_COEFFICIENTS[ 7 ] =
+           {
+              9.999999999783986E-01,
+             -3.333333209761088E-01,
+              1.9999883856651002E-01,
+             -1.4281588774449108E-01,
+              1.1040489244858262E-01,
+             -8.456192984759267E-02,
+              4.70734836543276E-02
+           };
+
+     //-------------------------------------------------------------------------
+     // 1 when v >= +0 and 0 when v <= -0.  A comparison converted to double is
+     // compiled to a branch in scalar code, copysign to bit operations.
+     //-------------------------------------------------------------------------
+        static
+        inline
+        double
+        computeStepForAccuracyTier
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double v
+               )
+          {
+          //--------------------------------------------------------------------
+             return( 0.5 + copysign( 0.5, v ) );
+          //--------------------------------------------------------------------
+          };
+
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    computeArcTangent2ForAccuracyTier
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    atan2( y, x ) to the accuracy of the display or survey tier, with
+     //    one division, a short polynomial and selects instead of branches.
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  METHOD:
+     //
+     //    [ 1 ] With m = min( |x|, |y| ) and M = max( |x|, |y| ), the reduced
+     //          argument is t = m / M, or t = ( m - M ) / ( m + M ) plus pi/4
+     //          when m / M > tan( pi / 8 ), so | t | <= tan( pi / 8 ).
+     //
+     //    [ 2 ] atan( t ) is the polynomial of the tier.
+     //
+     //    [ 3 ] The reductions are undone with pi/2 - r when |y| > |x|, pi - r
+     //          when x < 0 or x = -0, and the sign of y.  x = y = +0 gives 0;
+     //          DBL_MIN in the divisor keeps 0 / 0 out.
+     //
+     //    The selects are products with the 0 or 1 steps of
+     //    'computeStepForAccuracyTier', which are exact, so that the scalar
+     //    code has no data dependent branch to mispredict.
+     //
+     //-------------------------------------------------------------------------
+        template< ECEF_TO_GEODETIC_ACCURACY_TIER TIER >
+        static
+        inline
+        double
+        computeArcTangent2ForAccuracyTier
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double y,
+                    const double x
+               )
+          {
+          //--------------------------------------------------------------------
+             const double piRadians = 3.14159265358979323846E0;
+          //--------------------------------------------------------------------
+             const double absX      = fabs( x );
+             const double absY      = fabs( y );
+             const double noSwap    = computeStepForAccuracyTier( absX - absY );
+             const double maximum   = (           noSwap   * absX ) +
+                                      ( ( 1.0 - noSwap ) * absY );
+             const double minimum   = (           noSwap   * absY ) +
+                                      ( ( 1.0 - noSwap ) * absX );
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             const double reduce    = computeStepForAccuracyTier
+                                             (
+                                               minimum -
+                                               4.1421356237309503E-01 * maximum
+                                             );
+             const double numerator = minimum - ( reduce * maximum );
+             const double divisor   = maximum + ( reduce * minimum ) + DBL_MIN;
+             const double t         = numerator / divisor;
+             const double tSquared  = t * t;
+          //--------------------------------------------------------------------
+          // The Horner forms are written out; a loop over the coefficients
+          // keeps the batch loops from being vectorized.
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             double polynomial;
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             if( TIER == DISPLAY_ACCURACY_TIER )
+               {
+                   const double * c = DISPLAY_TIER_ARC_TANGENT_COEFFICIENTS;
+                //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                   polynomial = c[ 4 ];
+                   polynomial = ( polynomial * tSquared ) + c[ 3 ];
+                   polynomial = ( polynomial * tSquared ) + c[ 2 ];
+                   polynomial = ( polynomial * tSquared ) + c[ 1 ];
+                   polynomial = ( polynomial * tSquared ) + c[ 0 ];
+               }
+             else
+               {
+                   const double * c = SURVEY_TIER_ARC_TANGENT_COEFFICIENTS;
+                //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                   polynomial = c[ 6 ];
+                   polynomial = ( polynomial * tSquared ) + c[ 5 ];
+                   polynomial = ( polynomial * tSquared ) + c[ 4 ];
+                   polynomial = ( polynomial * tSquared ) + c[ 3 ];
+                   polynomial = ( polynomial * tSquared ) + c[ 2 ];
+                   polynomial = ( polynomial * tSquared ) + c[ 1 ];
+                   polynomial = ( polynomial * tSquared ) + c[ 0 ];
+               };
+          //--------------------------------------------------------------------
+             const double noReflect = computeStepForAccuracyTier( x );
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             double r = ( t * polynomial ) + ( reduce * 0.25 * piRadians );
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             r = ( ( 1.0 - noSwap    ) * 0.5 * piRadians ) +
+                 ( ( 2.0 * noSwap    - 1.0 ) * r );
+             r = ( ( 1.0 - noReflect ) *       piRadians ) +
+                 ( ( 2.0 * noReflect - 1.0 ) * r );
+          //--------------------------------------------------------------------
+             return( copysign( r, y ) );
+          //--------------------------------------------------------------------
+          };
+
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    convertEcefToGeodeticForAccuracyTier
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    The branch free conversion of one point for the display or survey
+     //    tier, shared by the scalar and batch functions so that both give
+     //    the same results.
+     //
+     //-------------------------------------------------------------------------
+        template< ECEF_TO_GEODETIC_ACCURACY_TIER TIER >
+        static
+        inline
+        void
+        convertEcefToGeodeticForAccuracyTier
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 &rEllipsoidContext,
+                    const double  xEcefMeters,
+                    const double  yEcefMeters,
+                    const double  zEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double &rGeodeticNorthLatitudeRadians,
+                          double &rGeocentricEastLongitudeRadians,
+                          double &rGeodeticAltitudeMeters
+               )
+          {
+          //--------------------------------------------------------------------
+             const EARTH_ELLIPSOID_CONTEXT & E = rEllipsoidContext;
+          //--------------------------------------------------------------------
+             const double earthPolarAxisDistanceSquared =
+                                             ( xEcefMeters * xEcefMeters ) +
+                                             ( yEcefMeters * yEcefMeters );
+             const double earthPolarAxisDistanceMeters  =
+                                     sqrt( earthPolarAxisDistanceSquared );
+             const double absZ = fabs( zEcefMeters );
+          //--------------------------------------------------------------------
+          // Equations (2), (17), (14), (12), (13), (15), (10) and (11) of
+          // Reference [ 1 ] of 'convertEcefToGeodetic'.  The display tier
+          // stops at the Newton step, B0 = 0, for which ( S1, C1 ) is
+          // parallel to ( D0, F0 ).
+          //--------------------------------------------------------------------
+             const double S0        = absZ * E.inverseEarthEquatorialRadius;
+             const double Pn        = earthPolarAxisDistanceMeters *
+                                      E.inverseEarthEquatorialRadius;
+             const double zc        = E.complimentaryEarthEllipticity * S0;
+             const double C0        = E.complimentaryEarthEllipticity * Pn;
+             const double C0Squared = C0 * C0;
+             const double S0Squared = S0 * S0;
+             const double A0Squared = C0Squared + S0Squared;
+             const double A0        = sqrt( A0Squared );
+             const double A0Cubed   = A0 * A0Squared;
+             const double D0        = (  zc * A0Cubed ) +
+                                      (  E.earthEllipticitySquared *
+                                         S0 * S0Squared );
+             const double F0        = (  Pn * A0Cubed ) +
+                                      ( -E.earthEllipticitySquared *
+                                         C0 * C0Squared );
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             double S1 = D0;
+             double C1 = F0;
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             if( TIER == SURVEY_ACCURACY_TIER )
+               {
+                   const double B0 = E.oneAndHalf_e4 *
+                                     S0Squared       *
+                                     C0Squared       *
+                                     Pn              *
+                                     ( A0 - E.complimentaryEarthEllipticity );
+                //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                   S1 = ( D0 * F0 ) + ( -B0 * S0 );
+                   C1 = ( F0 * F0 ) + ( -B0 * C0 );
+               };
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             const double Cc        = E.complimentaryEarthEllipticity * C1;
+          //--------------------------------------------------------------------
+          // Polar axis vicinity, as in 'convertEcefToGeodeticBatch'.  There
+          // the direction is replaced by the pole, ( 1, 0 ), with products
+          // by 0 or 1, for which Equation (20) gives |z| - b.
+          //--------------------------------------------------------------------
+             const double nearPolarAxis = computeStepForAccuracyTier
+                                                 (
+                                                   E.aEpsSquared -
+                                                   earthPolarAxisDistanceSquared
+                                                 );
+             const double offPolarAxis  = 1.0 - nearPolarAxis;
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             const double Sp        = ( offPolarAxis * S1 ) + nearPolarAxis;
+             const double Cp        =   offPolarAxis * Cc;
+          //--------------------------------------------------------------------
+          // Equation (20) of Reference [ 1 ] of 'convertEcefToGeodetic'.
+          //--------------------------------------------------------------------
+             const double SpSquared = Sp * Sp;
+             const double CpSquared = Cp * Cp;
+             const double a1        = sqrt(
+                                        (
+                                          E.complimentaryEarthEllipticitySquared
+                                          *
+                                          SpSquared
+                                        )
+                                        +
+                                        CpSquared
+                                      );
+             const double h1        = (
+                                        (  earthPolarAxisDistanceMeters * Cp ) +
+                                        (  absZ                         * Sp ) +
+                                        ( -E.earthEquatorialRadiusMeters
+                                                                        * a1 )
+                                      ) / sqrt( CpSquared + SpSquared );
+          //--------------------------------------------------------------------
+          // The southern hemisphere is the sign of z.
+          //--------------------------------------------------------------------
+             const double latitude  = computeArcTangent2ForAccuracyTier< TIER >
+                                             (
+                                               Sp,
+                                               Cp
+                                             );
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             rGeodeticNorthLatitudeRadians   = copysign( latitude,
+                                                         zEcefMeters );
+             rGeocentricEastLongitudeRadians =
+                                   computeArcTangent2ForAccuracyTier< TIER >
+                                          (
+                                            yEcefMeters,
+                                            xEcefMeters
+                                          );
+             rGeodeticAltitudeMeters         = h1;
+          //--------------------------------------------------------------------
+          };
+
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    convertEcefToGeodeticBatchChunkForAccuracyTier
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    Convert one cache resident chunk of a batch for the display or
+     //    survey tier.  The tier kernels call no library function, so the
+     //    first loop, which holds all of the arithmetic, is vectorized; the
+     //    point status is set by a second loop, as in
+     //    'convertEcefToGeodeticBatch'.  The context is copied to a local so
+     //    that its members cannot alias the output arrays.
+     //
+     //-------------------------------------------------------------------------
+        template< ECEF_TO_GEODETIC_ACCURACY_TIER TIER >
+        static
+        void
+        convertEcefToGeodeticBatchChunkForAccuracyTier
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const size_t   chunkPoints,
+                    const double * __restrict__ x,
+                    const double * __restrict__ y,
+                    const double * __restrict__ z,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * __restrict__ latitude,
+                          double * __restrict__ longitude,
+                          double * __restrict__ altitude,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * __restrict__ status
+               )
+          {
+          //--------------------------------------------------------------------
+             const EARTH_ELLIPSOID_CONTEXT
+              ellipsoidContext = rEllipsoidContext;
+          //--------------------------------------------------------------------
+             for( size_t i = 0; i < chunkPoints; i++ )
+               {
+                   convertEcefToGeodeticForAccuracyTier< TIER >
+                          (
+                            ellipsoidContext,
+                            x[ i ],
+                            y[ i ],
+                            z[ i ],
+                            latitude [ i ],
+                            longitude[ i ],
+                            altitude [ i ]
+                          );
+               };
+          //--------------------------------------------------------------------
+             for( size_t i = 0; i < chunkPoints; i++ )
+               {
+                //--------------------------------------------------------------
+                   const bool finiteCoordinates =
+                                ( fabs( x[ i ] ) <= DBL_MAX ) &&
+                                ( fabs( y[ i ] ) <= DBL_MAX ) &&
+                                ( fabs( z[ i ] ) <= DBL_MAX );
+                //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                   if( finiteCoordinates )
+                     {
+                        status   [ i ] = SUCCESSFUL_CONVERSION;
+                     }
+                   else
+                     {
+                        status   [ i ] = INVALID_ECEF_COORDINATES;
+                        latitude [ i ] = NAN;
+                        longitude[ i ] = NAN;
+                        altitude [ i ] = NAN;
+                     };
+                //--------------------------------------------------------------
+               };
+          //--------------------------------------------------------------------
+          };
+
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    convertEcefToGeodeticBatchForAccuracyTierInChunks
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    Convert a batch for the display or survey tier, in cache resident
+     //    chunks.  The chunk is called through a pointer so that it is not
+     //    inlined here, which would lose its restrict qualifiers and its
+     //    vectorization.
+     //
+     //-------------------------------------------------------------------------
+        static
+        void
+        convertEcefToGeodeticBatchForAccuracyTierInChunks
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const EARTH_ELLIPSOID_CONTEXT
+                                 & rEllipsoidContext,
+                    const ECEF_TO_GEODETIC_ACCURACY_TIER
+                                   accuracyTier,
+                    const size_t   numberPoints,
+                    const double * pXEcefMeters,
+                    const double * pYEcefMeters,
+                    const double * pZEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double * pGeodeticNorthLatitudeRadians,
+                          double * pGeocentricEastLongitudeRadians,
+                          double * pGeodeticAltitudeMeters,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS
+                                 * pConversionStatus
+               )
+          {
+          //--------------------------------------------------------------------
+             const
+             size_t
+              CHUNK_POINTS = 256;
+          //--------------------------------------------------------------------
+             void
+              ( *pConvertChunk )
+                     (
+                       const EARTH_ELLIPSOID_CONTEXT &,
+                       const size_t,
+                       const double *,
+                       const double *,
+                       const double *,
+                             double *,
+                             double *,
+                             double *,
+                             ECEF_TO_GEODETIC_CONVERSION_STATUS *
+                     ) = ( accuracyTier == DISPLAY_ACCURACY_TIER ) ?
+                         convertEcefToGeodeticBatchChunkForAccuracyTier
+                                                 < DISPLAY_ACCURACY_TIER > :
+                         convertEcefToGeodeticBatchChunkForAccuracyTier
+                                                 < SURVEY_ACCURACY_TIER >;
+          //--------------------------------------------------------------------
+             for(
+                  size_t chunkStart  = 0;
+                         chunkStart  < numberPoints;
+                         chunkStart += CHUNK_POINTS
+                )
+               {
+                //--------------------------------------------------------------
+                   const
+                   size_t
+                    chunkPoints = ( numberPoints - chunkStart < CHUNK_POINTS ) ?
+                                  ( numberPoints - chunkStart ) : CHUNK_POINTS;
+                //--------------------------------------------------------------
+                   pConvertChunk
+                          (
+                            rEllipsoidContext,
+                            chunkPoints,
+                            pXEcefMeters                    + chunkStart,
+                            pYEcefMeters                    + chunkStart,
+                            pZEcefMeters                    + chunkStart,
+                            pGeodeticNorthLatitudeRadians   + chunkStart,
+                            pGeocentricEastLongitudeRadians + chunkStart,
+                            pGeodeticAltitudeMeters         + chunkStart,
+                            pConversionStatus               + chunkStart
+                          );
+                //--------------------------------------------------------------
+               };
+          //--------------------------------------------------------------------
+          };
+     //-------------------------------------------------------------------------
+#endif
+//==============================================================================
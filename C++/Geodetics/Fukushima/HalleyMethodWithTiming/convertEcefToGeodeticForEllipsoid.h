@@ -0,0 +1,464 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#ifndef CONVERT_ECEF_TO_GEODETIC_FOR_ELLIPSOID_H
+     //-------------------------------------------------------------------------
+#       define CONVERT_ECEF_TO_GEODETIC_FOR_ELLIPSOID_H
+
+#       include "conversionBetweenEcefAndGeodetic.h"
+
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //
+     //    Conversions for a reference ellipsoid which is known at compile
+     //    time.  The ellipsoid is a template parameter, every function of
+     //    its parameters is a 'constexpr' constant, and the conversion
+     //    functions are inline, so the compiler folds the constants into
+     //    the arithmetic, validates the ellipsoid with 'static_assert', and
+     //    drops the branches which cannot be taken for that ellipsoid.
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  USAGE:
+     //
+     //    ecefToGeodeticConversionStatus =
+     //    convertEcefToGeodeticForEllipsoid< WGS84_ELLIPSOID >
+     //           (
+     //             //-------------------
+     //             // INPUT(s):
+     //             //-------------------
+     //                xEcefMeters,
+     //                yEcefMeters,
+     //                zEcefMeters,
+     //             //-------------------
+     //             // OUTPUT(s):
+     //             //-------------------
+     //                estimatedGeodeticNorthLatitudeRadians,
+     //                estimatedGeocentricEastLongitudeRadians,
+     //                estimatedGeodeticAltitudeMeters
+     //           );
+     //
+     //-------------------------------------------------------------------------
+
+     //-------------------------------------------------------------------------
+     //
+     //  PREDEFINED ELLIPSOIDS:
+     //
+     //    A user ellipsoid is any type with the same two static constexpr
+     //    members.
+     //
+     //-------------------------------------------------------------------------
+        struct
+        WGS84_ELLIPSOID
+          {
+            static constexpr double
+             earthEquatorialRadiusMeters      = 6378137.0E0;
+            static constexpr double
+             earthEllipsoidalFlatteningFactor = 1.0E0 / 298.257223563E0;
+          };
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        struct
+        GRS80_ELLIPSOID
+          {
+            static constexpr double
+             earthEquatorialRadiusMeters      = 6378137.0E0;
+            static constexpr double
+             earthEllipsoidalFlatteningFactor = 1.0E0 / 298.257222101E0;
+          };
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+     // The IUGG mean Earth radius.
+     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        struct
+        SPHERE_ELLIPSOID
+          {
+            static constexpr double
+             earthEquatorialRadiusMeters      = 6371008.8E0;
+            static constexpr double
+             earthEllipsoidalFlatteningFactor = 0.0E0;
+          };
+
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    computeConstexprSquareRoot
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    Square root usable in constant expressions, since 'sqrt' is not
+     //    'constexpr'.  Newton iteration from x, stopped when the iterate
+     //    stops changing or starts to alternate between two neighbors, so
+     //    the result is within one unit in the last place of 'sqrt( x )'.
+     //    For x >= 0 only.
+     //
+     //-------------------------------------------------------------------------
+        constexpr
+        double
+        computeConstexprSquareRoot
+               (
+                 const double x
+               )
+          {
+             double current  = ( x > 1.0 ) ? x : 1.0;
+             double previous = 0.0;
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             if( x == 0.0 )
+               {
+                  return( 0.0 );
+               };
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             for( int iteration = 0; iteration < 1100; iteration++ )
+               {
+                  const double next = 0.5 * ( current + x / current );
+               //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                  if( ( next == current ) || ( next == previous ) )
+                    {
+                       break;
+                    };
+               //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                  previous = current;
+                  current  = next;
+               };
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             return( current );
+          };
+
+     //-------------------------------------------------------------------------
+     //
+     //  TYPE:
+     //    ELLIPSOID_CONSTANTS< ELLIPSOID >
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    The validated parameters of a compile time ellipsoid and the
+     //    functions of them, as 'constexpr' constants.  These are the
+     //    members of EARTH_ELLIPSOID_CONTEXT, computed by the compiler
+     //    instead of by 'initializeEarthEllipsoidContext'.
+     //
+     //-------------------------------------------------------------------------
+        template< class ELLIPSOID >
+        struct
+        ELLIPSOID_CONSTANTS
+          {
+            static constexpr double
+             earthEquatorialRadiusMeters =
+                        ELLIPSOID::earthEquatorialRadiusMeters;
+            static constexpr double
+             earthEllipsoidalFlatteningFactor =
+                        ELLIPSOID::earthEllipsoidalFlatteningFactor;
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+            static_assert
+              (
+                ( earthEllipsoidalFlatteningFactor >= 0.0 )
+                &&
+                ( earthEllipsoidalFlatteningFactor <  1.0 ),
+                "Ellipsoidal flattening factor must be in [ 0.0, 1.0 )."
+              );
+            static_assert
+              (
+                earthEquatorialRadiusMeters > 0.0,
+                "Equatorial radius must be strictly positive."
+              );
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+            static constexpr double
+             earthEllipticitySquared =
+                        ( 2.0 - earthEllipsoidalFlatteningFactor ) *
+                                earthEllipsoidalFlatteningFactor;
+            static constexpr double
+             oneAndHalf_e4 =
+                        1.5 * earthEllipticitySquared * earthEllipticitySquared;
+            static constexpr double
+             complimentaryEarthEllipticitySquared =
+                        1.0 - earthEllipticitySquared;
+            static constexpr double
+             complimentaryEarthEllipticity =
+                        computeConstexprSquareRoot
+                               (
+                                 complimentaryEarthEllipticitySquared
+                               );
+            static constexpr double
+             earthPolarRadiusMeters =
+                        complimentaryEarthEllipticity *
+                        earthEquatorialRadiusMeters;
+            static constexpr double
+             inverseEarthEquatorialRadius =
+                        1.0 / earthEquatorialRadiusMeters;
+            static constexpr double
+             aEpsSquared =
+                        ( earthEquatorialRadiusMeters * 1.0e-16 ) *
+                        ( earthEquatorialRadiusMeters * 1.0e-16 );
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+            static constexpr bool
+             isSphere = ( earthEllipsoidalFlatteningFactor == 0.0 );
+          };
+
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    convertEcefToGeodeticForEllipsoid< ELLIPSOID >
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    As 'convertEcefToGeodetic', for the compile time ellipsoid
+     //    ELLIPSOID.
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  METHOD:
+     //    [ 1 ] For a flattening factor of zero the geodetic coordinates
+     //          are the spherical coordinates, which are computed directly,
+     //          and the Halley step is not compiled.
+     //
+     //    [ 2 ] Otherwise the single Halley iteration of
+     //          'convertEcefToGeodetic', with the same order of operations,
+     //          so its results match the runtime kernel (up to one unit in
+     //          the last place of ec, from 'computeConstexprSquareRoot').
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  RETURNED VALUE:
+     //
+     //     Conversion status:
+     //        SUCCESSFUL_CONVERSION
+     //
+     //     The ellipsoid is validated at compile time.
+     //
+     //-------------------------------------------------------------------------
+        template< class ELLIPSOID >
+        inline
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertEcefToGeodeticForEllipsoid
+               (
+                 //-------------------
+                 // INPUT(s):
+                 //-------------------
+                    const double  xEcefMeters,
+                    const double  yEcefMeters,
+                    const double  zEcefMeters,
+                 //-------------------
+                 // OUTPUT(s):
+                 //-------------------
+                          double &rGeodeticNorthLatitudeRadians,
+                          double &rGeocentricEastLongitudeRadians,
+                          double &rGeodeticAltitudeMeters
+               )
+          {
+          //--------------------------------------------------------------------
+             typedef ELLIPSOID_CONSTANTS< ELLIPSOID > E;
+          //--------------------------------------------------------------------
+             const double earthPolarAxisDistanceSquared =
+                                        ( xEcefMeters * xEcefMeters ) +
+                                        ( yEcefMeters * yEcefMeters );
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             rGeocentricEastLongitudeRadians =
+                     ( earthPolarAxisDistanceSquared > 0.0 ) ?
+                                     atan2( yEcefMeters, xEcefMeters ) : 0.0;
+          //--------------------------------------------------------------------
+             if constexpr( E::isSphere )
+               {
+               //---------------------------------------------------------------
+               // Spherical coordinates.
+               //---------------------------------------------------------------
+                  const double earthPolarAxisDistanceMeters =
+                                        sqrt( earthPolarAxisDistanceSquared );
+               //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                  rGeodeticNorthLatitudeRadians =
+                                atan2( zEcefMeters,
+                                       earthPolarAxisDistanceMeters );
+                  rGeodeticAltitudeMeters       =
+                                sqrt( earthPolarAxisDistanceSquared +
+                                      ( zEcefMeters * zEcefMeters ) )
+                                -
+                                E::earthEquatorialRadiusMeters;
+               //---------------------------------------------------------------
+                  return( SUCCESSFUL_CONVERSION );
+               //---------------------------------------------------------------
+               }
+             else
+               {
+               //---------------------------------------------------------------
+                  const double absZ = fabs( zEcefMeters );
+               //---------------------------------------------------------------
+                  if( earthPolarAxisDistanceSquared > E::aEpsSquared )
+                    {
+                    //----------------------------------------------------------
+                    // Equations (2), (17), (14), (12), (13), (15), (10),
+                    // (11), (21), (19) and (20) of Reference [ 1 ] of
+                    // 'convertEcefToGeodetic'.
+                    //----------------------------------------------------------
+                       const double earthPolarAxisDistanceMeters =
+                                        sqrt( earthPolarAxisDistanceSquared );
+                    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                       const double S0 =
+                              absZ / E::earthEquatorialRadiusMeters;
+                       const double Pn =
+                              earthPolarAxisDistanceMeters /
+                              E::earthEquatorialRadiusMeters;
+                       const double zc =
+                              E::complimentaryEarthEllipticity * S0;
+                       const double C0 =
+                              E::complimentaryEarthEllipticity * Pn;
+                       const double C0Squared = C0 * C0;
+                       const double C0Cubed   = C0 * C0Squared;
+                       const double S0Squared = S0 * S0;
+                       const double S0Cubed   = S0 * S0Squared;
+                       const double A0Squared = C0Squared + S0Squared;
+                       const double A0        = sqrt( A0Squared );
+                       const double A0Cubed   = A0 * A0Squared;
+                       const double D0        =
+                              (  zc                         * A0Cubed ) +
+                              (  E::earthEllipticitySquared * S0Cubed );
+                       const double F0        =
+                              (  Pn                         * A0Cubed ) +
+                              ( -E::earthEllipticitySquared * C0Cubed );
+                       const double B0        =
+                              E::oneAndHalf_e4 *
+                              S0Squared        *
+                              C0Squared        *
+                              Pn               *
+                              ( A0 - E::complimentaryEarthEllipticity );
+                       const double S1        = ( D0 * F0 ) + ( -B0 * S0 );
+                       const double C1        = ( F0 * F0 ) + ( -B0 * C0 );
+                       const double Cc        =
+                              E::complimentaryEarthEllipticity * C1;
+                    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                       rGeodeticNorthLatitudeRadians = atan2( S1, Cc );
+                    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                       const double S1Squared = S1 * S1;
+                       const double CcSquared = Cc * Cc;
+                       const double a1        =
+                              sqrt(
+                                    (
+                                      E::complimentaryEarthEllipticitySquared *
+                                      S1Squared
+                                    )
+                                    +
+                                    CcSquared
+                                  );
+                    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                       rGeodeticAltitudeMeters =
+                              (
+                                (  earthPolarAxisDistanceMeters   * Cc ) +
+                                (  absZ                           * S1 ) +
+                                ( -E::earthEquatorialRadiusMeters * a1 )
+                              ) / sqrt( CcSquared + S1Squared );
+                    //----------------------------------------------------------
+                    }
+                  else
+                    {
+                    //----------------------------------------------------------
+                    // Polar axis vicinity.
+                    //----------------------------------------------------------
+                       rGeodeticNorthLatitudeRadians = 2.0 * atan( 1.0 );
+                       rGeodeticAltitudeMeters       =
+                                        absZ - E::earthPolarRadiusMeters;
+                    //----------------------------------------------------------
+                    };
+               //---------------------------------------------------------------
+                  if( zEcefMeters < 0.0 )
+                    {
+                       rGeodeticNorthLatitudeRadians =
+                                          -rGeodeticNorthLatitudeRadians;
+                    };
+               //---------------------------------------------------------------
+                  return( SUCCESSFUL_CONVERSION );
+               //---------------------------------------------------------------
+               };
+          };
+
+     //-------------------------------------------------------------------------
+     //
+     //  FUNCTION:
+     //    convertGeodeticToEcefForEllipsoid< ELLIPSOID >
+     //
+     //-------------------------------------------------------------------------
+     //
+     //  PURPOSE:
+     //    As the ellipsoid context overload of 'convertGeodeticToEcef', for
+     //    the compile time ellipsoid ELLIPSOID.  For a sphere the prime
+     //    vertical radius of curvature is the radius, and its square root
+     //    and division are not compiled.
+     //
+     //-------------------------------------------------------------------------
+        template< class ELLIPSOID >
+        inline
+        ECEF_TO_GEODETIC_CONVERSION_STATUS
+        convertGeodeticToEcefForEllipsoid
+               (
+                //----------------
+                // INPUT(s):
+                //----------------
+                   const double   geodeticNorthLatitudeRadians,
+                   const double   geocentricEastLongitudeRadians,
+                   const double   geodeticAltitudeMeters,
+                //----------------
+                // OUTPUT(s):
+                //----------------
+                         double & rXEcefMeters,
+                         double & rYEcefMeters,
+                         double & rZEcefMeters
+               )
+          {
+          //--------------------------------------------------------------------
+             typedef ELLIPSOID_CONSTANTS< ELLIPSOID > E;
+          //--------------------------------------------------------------------
+             const double sineOfGeodeticNorthLatitude   =
+                                   sin( geodeticNorthLatitudeRadians   );
+             const double cosineOfGeodeticNorthLatitude =
+                                   cos( geodeticNorthLatitudeRadians   );
+             const double sineOfGeocentricEastLongitude   =
+                                   sin( geocentricEastLongitudeRadians );
+             const double cosineOfGeocentricEastLongitude =
+                                   cos( geocentricEastLongitudeRadians );
+          //--------------------------------------------------------------------
+             double N = E::earthEquatorialRadiusMeters;
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             if constexpr( !E::isSphere )
+               {
+                  N = E::earthEquatorialRadiusMeters /
+                      sqrt(
+                            1.0E0 +
+                            (
+                              -E::earthEllipticitySquared  *
+                               sineOfGeodeticNorthLatitude *
+                               sineOfGeodeticNorthLatitude
+                            )
+                          );
+               };
+          //--------------------------------------------------------------------
+             const double rho  = N + geodeticAltitudeMeters;
+             const double rhoz = ( E::complimentaryEarthEllipticitySquared *
+                                   N ) +
+                                 geodeticAltitudeMeters;
+          //--------------------------------------------------------------------
+             if(
+                 ( rho  > 0.0E0 ) &&
+                 ( rhoz > 0.0E0 )
+               )
+               {
+                  const double r = rho * cosineOfGeodeticNorthLatitude;
+               //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                  rXEcefMeters = r    * cosineOfGeocentricEastLongitude;
+                  rYEcefMeters = r    *   sineOfGeocentricEastLongitude;
+                  rZEcefMeters = rhoz *   sineOfGeodeticNorthLatitude;
+               }
+             else
+               {
+                  rXEcefMeters = NAN;
+                  rYEcefMeters = NAN;
+                  rZEcefMeters = NAN;
+               //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                  return( INVALID_GEODETIC_ALTITUDE );
+               };
+          //--------------------------------------------------------------------
+             return( SUCCESSFUL_CONVERSION );
+          //--------------------------------------------------------------------
+          };
+     //-------------------------------------------------------------------------
+#endif
+//==============================================================================
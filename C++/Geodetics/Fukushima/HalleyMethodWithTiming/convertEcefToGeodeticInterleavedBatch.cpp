@@ -0,0 +1,456 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+// The processor is examined once, at program startup, and the widest
+// supported kernel is used for every batch.
+//------------------------------------------------------------------------------
+static
+const
+ECEF_TO_GEODETIC_ISA_LEVEL
+ supportedIsaLevel = detectEcefToGeodeticIsaLevel( );
+
+//------------------------------------------------------------------------------
+// Points per staged chunk:  the coordinate and output arrays of a chunk
+// stay in the level one cache between the copies and the conversion.
+//------------------------------------------------------------------------------
+static
+const
+size_t
+ STAGED_CHUNK_POINTS = 256;
+
+//------------------------------------------------------------------------------
+template< bool BLOCKED >
+static
+void
+convertEcefToGeodeticStagedInterleavedBatch
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const size_t   blockPoints,
+            const double * pInput,
+            const size_t   inputStrideBytes,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pOutput,
+            const size_t   outputStrideBytes,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticStagedInterleavedBatch
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The interleaved or, with BLOCKED set, block interleaved conversion
+//    for a processor or a block shape which no kernel handles:  each
+//    chunk of STAGED_CHUNK_POINTS points is copied to coordinate arrays
+//    on the stack, converted by the ellipsoid context overload of
+//    'convertEcefToGeodeticBatch', and its outputs copied back.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The staging arrays never leave the level one cache, so the
+//          copies add no memory traffic, unlike a copy of the whole batch
+//          to coordinate arrays.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+ // The coordinates of a point are coordinateStep doubles apart.
+ //-----------------------------------------------------------------------------
+    const size_t coordinateStep      = BLOCKED ? blockPoints : 1;
+    const size_t inputStrideDoubles  = inputStrideBytes  / sizeof( double );
+    const size_t outputStrideDoubles = outputStrideBytes / sizeof( double );
+ //-----------------------------------------------------------------------------
+    double x        [ STAGED_CHUNK_POINTS ];
+    double y        [ STAGED_CHUNK_POINTS ];
+    double z        [ STAGED_CHUNK_POINTS ];
+    double latitude [ STAGED_CHUNK_POINTS ];
+    double longitude[ STAGED_CHUNK_POINTS ];
+    double altitude [ STAGED_CHUNK_POINTS ];
+ //-----------------------------------------------------------------------------
+    for(
+         size_t chunkStart  = 0;
+                chunkStart  < numberPoints;
+                chunkStart += STAGED_CHUNK_POINTS
+       )
+      {
+       //-----------------------------------------------------------------------
+          const
+          size_t
+           chunkPoints = ( numberPoints - chunkStart < STAGED_CHUNK_POINTS ) ?
+                         ( numberPoints - chunkStart ) : STAGED_CHUNK_POINTS;
+       //-----------------------------------------------------------------------
+       // The place of the first coordinate of each point advances by the
+       // record stride, or by one within a block and past the other two
+       // coordinates of the block at its end.
+       //-----------------------------------------------------------------------
+          const size_t chunkLane  = BLOCKED ? ( chunkStart % blockPoints ) : 0;
+          const size_t chunkPlace = BLOCKED ?
+                                    ( chunkStart / blockPoints ) * 3 *
+                                    blockPoints + chunkLane :
+                                    0;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          size_t lane  = chunkLane;
+          size_t place = BLOCKED ? chunkPlace :
+                                   chunkStart * inputStrideDoubles;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t k = 0; k < chunkPoints; k++ )
+            {
+               x[ k ] = pInput[ place                      ];
+               y[ k ] = pInput[ place +     coordinateStep ];
+               z[ k ] = pInput[ place + 2 * coordinateStep ];
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               if( BLOCKED )
+                 {
+                    lane  = lane  + 1;
+                    place = place + ( ( lane == blockPoints ) ?
+                                      1 + 2 * blockPoints : 1 );
+                    lane  = ( lane == blockPoints ) ? 0 : lane;
+                 }
+               else
+                 {
+                    place = place + inputStrideDoubles;
+                 };
+            };
+       //-----------------------------------------------------------------------
+          convertEcefToGeodeticBatch
+                 (
+                   //-------------------
+                   // INPUT(s):
+                   //-------------------
+                      rEllipsoidContext,
+                      chunkPoints,
+                      x,
+                      y,
+                      z,
+                   //-------------------
+                   // OUTPUT(s):
+                   //-------------------
+                      latitude,
+                      longitude,
+                      altitude,
+                      pConversionStatus + chunkStart
+                 );
+       //-----------------------------------------------------------------------
+          lane  = chunkLane;
+          place = BLOCKED ? chunkPlace : chunkStart * outputStrideDoubles;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t k = 0; k < chunkPoints; k++ )
+            {
+               pOutput[ place                      ] = latitude [ k ];
+               pOutput[ place +     coordinateStep ] = longitude[ k ];
+               pOutput[ place + 2 * coordinateStep ] = altitude [ k ];
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               if( BLOCKED )
+                 {
+                    lane  = lane  + 1;
+                    place = place + ( ( lane == blockPoints ) ?
+                                      1 + 2 * blockPoints : 1 );
+                    lane  = ( lane == blockPoints ) ? 0 : lane;
+                 }
+               else
+                 {
+                    place = place + outputStrideDoubles;
+                 };
+            };
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticInterleavedBatch
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const double * pXyzEcefMeters,
+            const size_t   inputStrideBytes,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pEstimatedLatitudeLongitudeAltitude,
+            const size_t   outputStrideBytes,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticInterleavedBatch
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    As the ellipsoid context overload of 'convertEcefToGeodeticBatch',
+//    for points stored as records of interleaved x, y and z doubles,
+//    inputStrideBytes apart, such as an array of structures whose first
+//    members are the coordinates.  The latitude, longitude and altitude
+//    of each point are written as interleaved records outputStrideBytes
+//    apart.
+//
+//------------------------------------------------------------------------------
+//
+//  INPUTS:
+//     pXyzEcefMeters
+//       The x, y and z ECEF coordinates of the first point, in meters,
+//       followed by those of the next point inputStrideBytes on.
+//
+//     inputStrideBytes
+//     outputStrideBytes
+//       The distances in bytes between the records of successive points,
+//       multiples of sizeof( double ), and at least 3 * sizeof( double ).
+//
+//------------------------------------------------------------------------------
+//
+//  OUTPUTS:
+//     pEstimatedLatitudeLongitudeAltitude
+//       The geodetic latitude and geocentric longitude in radians and the
+//       geodetic altitude in meters of the first point, followed by those
+//       of the next point outputStrideBytes on.  It may be pXyzEcefMeters,
+//       with equal strides, to convert the records in place.
+//
+//     pConversionStatus
+//       The status of each point, as 'convertEcefToGeodeticBatch'.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The SIMD kernels deinterleave the records in registers, with
+//          shuffles for packed records and gathers or paired loads for
+//          strided ones, so the records are read and written once, and
+//          the outputs are those of 'convertEcefToGeodeticBatch'.
+//
+//    [ 2 ] A baseline processor converts staged chunks instead, with
+//          'convertEcefToGeodeticStagedInterleavedBatch'.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    if( supportedIsaLevel == AVX512_ISA_LEVEL )
+      {
+          convertEcefToGeodeticInterleavedBatchAvx512Kernel
+                 (
+                   //-------------------
+                   // INPUT(s):
+                   //-------------------
+                      rEllipsoidContext,
+                      numberPoints,
+                      pXyzEcefMeters,
+                      inputStrideBytes,
+                   //-------------------
+                   // OUTPUT(s):
+                   //-------------------
+                      pEstimatedLatitudeLongitudeAltitude,
+                      outputStrideBytes,
+                      pConversionStatus
+                 );
+      }
+    else
+    if( supportedIsaLevel == AVX2_FMA_ISA_LEVEL )
+      {
+          convertEcefToGeodeticInterleavedBatchAvx2Kernel
+                 (
+                   //-------------------
+                   // INPUT(s):
+                   //-------------------
+                      rEllipsoidContext,
+                      numberPoints,
+                      pXyzEcefMeters,
+                      inputStrideBytes,
+                   //-------------------
+                   // OUTPUT(s):
+                   //-------------------
+                      pEstimatedLatitudeLongitudeAltitude,
+                      outputStrideBytes,
+                      pConversionStatus
+                 );
+      }
+    else
+      {
+          convertEcefToGeodeticStagedInterleavedBatch< false >
+                 (
+                   //-------------------
+                   // INPUT(s):
+                   //-------------------
+                      rEllipsoidContext,
+                      numberPoints,
+                      0,
+                      pXyzEcefMeters,
+                      inputStrideBytes,
+                   //-------------------
+                   // OUTPUT(s):
+                   //-------------------
+                      pEstimatedLatitudeLongitudeAltitude,
+                      outputStrideBytes,
+                      pConversionStatus
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticBlockInterleavedBatch
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const size_t   blockPoints,
+            const double * pXyzEcefMeterBlocks,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pEstimatedLatitudeLongitudeAltitudeBlocks,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticBlockInterleavedBatch
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    As the ellipsoid context overload of 'convertEcefToGeodeticBatch',
+//    for points stored as an array of blocks of structures of arrays:
+//    blockPoints x, then blockPoints y, then blockPoints z coordinates.
+//    The latitudes, longitudes and altitudes are written as blocks of
+//    the same shape.
+//
+//------------------------------------------------------------------------------
+//
+//  INPUTS:
+//     blockPoints
+//       The points per block, at least one.
+//
+//     pXyzEcefMeterBlocks
+//       The blocks of ECEF coordinates, in meters.  Only the first
+//       numberPoints % blockPoints places of each coordinate of a partial
+//       last block are referenced.
+//
+//------------------------------------------------------------------------------
+//
+//  OUTPUTS:
+//     pEstimatedLatitudeLongitudeAltitudeBlocks
+//       The blocks of geodetic latitudes and geocentric longitudes in
+//       radians and geodetic altitudes in meters.  It may be
+//       pXyzEcefMeterBlocks, to convert the blocks in place.
+//
+//     pConversionStatus
+//       The status of each point, as 'convertEcefToGeodeticBatch'.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] A kernel is used when blockPoints is a multiple of its lanes,
+//          eight for AVX-512 and four for AVX2; a block of lanes is then
+//          three plain loads, with no deinterleave at all.
+//
+//    [ 2 ] Any other block shape, or a baseline processor, converts staged
+//          chunks instead, with 'convertEcefToGeodeticStagedInterleavedBatch'.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    if(
+        ( supportedIsaLevel == AVX512_ISA_LEVEL ) &&
+        ( blockPoints % 8   == 0                )
+      )
+      {
+          convertEcefToGeodeticBlockInterleavedBatchAvx512Kernel
+                 (
+                   //-------------------
+                   // INPUT(s):
+                   //-------------------
+                      rEllipsoidContext,
+                      numberPoints,
+                      blockPoints,
+                      pXyzEcefMeterBlocks,
+                   //-------------------
+                   // OUTPUT(s):
+                   //-------------------
+                      pEstimatedLatitudeLongitudeAltitudeBlocks,
+                      pConversionStatus
+                 );
+      }
+    else
+    if(
+        ( supportedIsaLevel != BASELINE_ISA_LEVEL ) &&
+        ( blockPoints % 4   == 0                  )
+      )
+      {
+          convertEcefToGeodeticBlockInterleavedBatchAvx2Kernel
+                 (
+                   //-------------------
+                   // INPUT(s):
+                   //-------------------
+                      rEllipsoidContext,
+                      numberPoints,
+                      blockPoints,
+                      pXyzEcefMeterBlocks,
+                   //-------------------
+                   // OUTPUT(s):
+                   //-------------------
+                      pEstimatedLatitudeLongitudeAltitudeBlocks,
+                      pConversionStatus
+                 );
+      }
+    else
+      {
+          convertEcefToGeodeticStagedInterleavedBatch< true >
+                 (
+                   //-------------------
+                   // INPUT(s):
+                   //-------------------
+                      rEllipsoidContext,
+                      numberPoints,
+                      blockPoints,
+                      pXyzEcefMeterBlocks,
+                      0,
+                   //-------------------
+                   // OUTPUT(s):
+                   //-------------------
+                      pEstimatedLatitudeLongitudeAltitudeBlocks,
+                      0,
+                      pConversionStatus
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
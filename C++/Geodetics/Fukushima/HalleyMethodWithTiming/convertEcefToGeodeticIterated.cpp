@@ -0,0 +1,829 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <float.h>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+static
+inline
+void
+convertEcefToGeodeticFukushimaNewton
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         &rEllipsoidContext,
+            const int     maximumNumberIterations,
+            const double  earthPolarAxisDistanceMeters,
+            const double  absZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double &rEstimatedGeodeticNorthLatitudeRadians,
+                  double &rEstimatedGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERGENCE_REPORT
+                         &rConvergenceReport
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticFukushimaNewton
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The latitude and altitude of FUKUSHIMA_NEWTON_ENGINE, for a point
+//    at distance p from the polar axis and height | z | above the
+//    equatorial plane.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    In units of a, with z' = ec | z | and c = e^2, the tangent t of half
+//    the reduced colatitude, t = tan( ( pi / 2 - beta ) / 2 ), is a root
+//    in [ 0, 1 ] of the quartic of Reference [ 1 ]
+//
+//       f( t ) = p t^4 + u t^3 + v t - p,  u = 2 ( z' - c ),
+//                                          v = 2 ( z' + c ),
+//
+//    found by Newton iterations, and
+//
+//       tan( phi ) = ( 1 - t^2 ) / ( 2 ec t ).
+//
+//    The starting value is that of Reference [ 1 ], the root of the
+//    quartic for a sphere, c = 0,
+//
+//       t0 = p / ( z' + sqrt( z'^2 + p^2 ) ).
+//
+//    f( 0 ) = -p and f( 1 ) = 4 z', and f is concave below and convex
+//    above the inflection point tM = ( c - z' ) / p.  When z' < c and
+//    the root is not in the convex part, min( tM, 1 ), the Newton
+//    iterations converge without leaving [ 0, 1 ] only from below, from
+//    t0 if f( t0 ) < 0 there and else from 0.  When the root is in the
+//    convex part, they start from max( t0, tM ).
+//
+//    The latitude change of each Newton step dt is
+//
+//       2 ec ( 1 + t^2 ) | dt | / ( ( 1 - t^2 )^2 + 4 ec^2 t^2 ).
+//
+//------------------------------------------------------------------------------
+//
+//  REFERENCE(s):
+//
+//     [ 1 ]  "Fast transform from geocentric to geodetic coordinates",
+//            Fukushima, T.,
+//            Journal of Geodesy,
+//            73 (1999)
+//            603-610.
+//
+//     [ 2 ]  "Transformation from Cartesian to geodetic coordinates
+//             accelerated by Halley's method",
+//            Fukushima, T.,
+//            Journal of Geodesy,
+//            79 (2006)
+//            689-693.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] ITERATED_HALLEY_ENGINE starts from the direction ( ec p, | z | )
+//          of Reference [ 2 ], which is exact on the ellipsoid, so it
+//          needs fewer iterations near the surface.  Started from that
+//          direction the Newton iterations of a point near the center,
+//          where f is not monotone in [ 0, 1 ], can converge to a root
+//          beyond 1, of the wrong sign of latitude.
+//
+//    [ 2 ] On the polar axis, the Earth's center included, t0 = 0, the
+//          pole, and f( 0 ) = 0, so the iterations stay at the pole.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const double a      = rEllipsoidContext.earthEquatorialRadiusMeters;
+    const double aInv   = rEllipsoidContext.inverseEarthEquatorialRadius;
+    const double e2     = rEllipsoidContext.earthEllipticitySquared;
+    const double ec     = rEllipsoidContext.complimentaryEarthEllipticity;
+ //-----------------------------------------------------------------------------
+    const double p      = earthPolarAxisDistanceMeters * aInv;
+    const double zPrime = ec * absZEcefMeters * aInv;
+    const double u      = 2.0 * ( zPrime - e2 );
+    const double v      = 2.0 * ( zPrime + e2 );
+ //-----------------------------------------------------------------------------
+    double t = ( p > 0.0 ) ?
+               p / ( zPrime + sqrt( ( zPrime * zPrime ) + ( p * p ) ) ) : 0.0;
+ //-----------------------------------------------------------------------------
+ // Near the center, the start on the side of the root where the Newton
+ // iterations converge monotonically.
+ //-----------------------------------------------------------------------------
+    if( ( u < 0.0 ) && ( p > 0.0 ) )
+      {
+          const double tM = fmin( -u / ( 2.0 * p ), 1.0 );
+          const double fM = ( ( ( ( p * tM ) + u ) * tM * tM ) + v ) * tM - p;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( fM >= 0.0 )
+            {
+               const double f0 = ( ( ( ( p * t ) + u ) * t * t ) + v ) * t - p;
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               if( !( ( t < tM ) && ( f0 < 0.0 ) ) )
+                 {
+                    t = 0.0;
+                 };
+            }
+          else
+            {
+               t = fmax( t, tM );
+            };
+      };
+ //-----------------------------------------------------------------------------
+    double latitudeCorrection = NAN;
+    bool   isConverged        = false;
+    int    n                  = 0;
+ //-----------------------------------------------------------------------------
+    while( ( n < maximumNumberIterations ) && !isConverged )
+      {
+       //-----------------------------------------------------------------------
+          const double tSquared = t * t;
+          const double f        = ( p * tSquared * tSquared ) +
+                                  ( u * tSquared * t ) + ( v * t ) - p;
+          const double df       = ( 4.0 * p * tSquared * t ) +
+                                  ( 3.0 * u * tSquared ) + v;
+          const double dt       = -f / df;
+       //-----------------------------------------------------------------------
+          t += dt;
+          n++;
+       //-----------------------------------------------------------------------
+          const double tNewSquared = t * t;
+          const double oneMinusT2  = 1.0 - tNewSquared;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          latitudeCorrection = 2.0 * ec * ( 1.0 + tNewSquared ) * fabs( dt ) /
+                               ( ( oneMinusT2 * oneMinusT2 ) +
+                                 ( 4.0 * ec * ec * tNewSquared ) );
+          isConverged        = ( latitudeCorrection <=
+                                 ITERATED_ENGINE_CONVERGENCE_RADIANS );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    const double tSquared = t * t;
+    const double onePlusT2 = 1.0 + tSquared;
+ //-----------------------------------------------------------------------------
+    rEstimatedGeodeticNorthLatitudeRadians =
+                                   atan2( 1.0 - tSquared, 2.0 * ec * t );
+    rEstimatedGeodeticAltitudeMeters       =
+          ( ( 2.0 * earthPolarAxisDistanceMeters * ec * t ) +
+            ( absZEcefMeters * ( 1.0 - tSquared ) ) -
+            ( a * ec * onePlusT2 ) ) /
+          sqrt( ( onePlusT2 * onePlusT2 ) - ( 4.0 * e2 * tSquared ) );
+ //-----------------------------------------------------------------------------
+    rConvergenceReport.numberIterations              = n;
+    rConvergenceReport.lastLatitudeCorrectionRadians = latitudeCorrection;
+    rConvergenceReport.isConverged                   = isConverged;
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+static
+inline
+void
+convertEcefToGeodeticIteratedHalley
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         &rEllipsoidContext,
+            const int     maximumNumberIterations,
+            const double  earthPolarAxisDistanceMeters,
+            const double  absZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double &rEstimatedGeodeticNorthLatitudeRadians,
+                  double &rEstimatedGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERGENCE_REPORT
+                         &rConvergenceReport
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticIteratedHalley
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The latitude and altitude of ITERATED_HALLEY_ENGINE, for a point at
+//    distance p from the polar axis and height | z | above the
+//    equatorial plane.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    The Halley iterations of equations ( 6 ) to ( 9 ) of Reference [ 1 ]
+//    for the unnormalized sine S and cosine C of the reduced latitude,
+//    in units of a, with zc = ec | z | and c = e^2,
+//
+//       S' = ( zc A^3 + c S^3 ) A^3 - B S
+//       C' = ( p  A^3 - c C^3 ) A^3 - B C
+//       B  = 1.5 c S C ( ( p S - zc C ) A - c S C )
+//
+//    where A^2 = S^2 + C^2, starting from S = | z |, C = ec p.  S and C
+//    are normalized before each iteration, so A = 1 and the values stay
+//    in range however many iterations are made.  The latitude is that of
+//    the direction ( ec C, S ), and the latitude change of an iteration
+//    is the angle between the directions before and after it.
+//
+//    The first iteration is that of the appendix of Reference [ 1 ];
+//    the ellipsoid context 'convertEcefToGeodetic' makes the same step
+//    rearranged so that it needs no normalization, and so differs from
+//    one iteration here in the last bits.
+//
+//    Within the evolute, near the equatorial plane, p < e^2 makes C'
+//    negative, and the direction would leave the first quadrant, to a
+//    latitude beyond pi/2 with | lat | = pi on the plane itself.  The
+//    foot point of a point of the first quadrant is in the first
+//    quadrant, so S' and C' are taken in absolute value, the mirror
+//    image of the step in the polar axis or the equatorial plane, and
+//    the latitude stays within [ 0, pi/2 ].
+//
+//------------------------------------------------------------------------------
+//
+//  REFERENCE(s):
+//
+//     [ 1 ]  "Transformation from Cartesian to geodetic coordinates
+//             accelerated by Halley's method",
+//            Fukushima, T.,
+//            Journal of Geodesy,
+//            79 (2006)
+//            689-693.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] A point within about 1.0e-16 a of the polar axis is taken on
+//          it, as by the ellipsoid context 'convertEcefToGeodetic', with
+//          no iteration, and reported converged.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const double a      = rEllipsoidContext.earthEquatorialRadiusMeters;
+    const double aInv   = rEllipsoidContext.inverseEarthEquatorialRadius;
+    const double e2     = rEllipsoidContext.earthEllipticitySquared;
+    const double ec     = rEllipsoidContext.complimentaryEarthEllipticity;
+    const double ec2    =
+                   rEllipsoidContext.complimentaryEarthEllipticitySquared;
+ //-----------------------------------------------------------------------------
+    if( !( ( earthPolarAxisDistanceMeters * earthPolarAxisDistanceMeters ) >
+           rEllipsoidContext.aEpsSquared ) )
+      {
+          rEstimatedGeodeticNorthLatitudeRadians = 2.0 * atan( 1.0 );
+          rEstimatedGeodeticAltitudeMeters       =
+                    absZEcefMeters - rEllipsoidContext.earthPolarRadiusMeters;
+       //-----------------------------------------------------------------------
+          rConvergenceReport.numberIterations              = 0;
+          rConvergenceReport.lastLatitudeCorrectionRadians = 0.0;
+          rConvergenceReport.isConverged                   = true;
+       //-----------------------------------------------------------------------
+          return;
+      };
+ //-----------------------------------------------------------------------------
+    const double p  = earthPolarAxisDistanceMeters * aInv;
+    const double zc = ec * absZEcefMeters * aInv;
+ //-----------------------------------------------------------------------------
+    double S = absZEcefMeters * aInv;
+    double C = ec * p;
+ //-----------------------------------------------------------------------------
+    double latitudeCorrection = NAN;
+    bool   isConverged        = false;
+    int    n                  = 0;
+ //-----------------------------------------------------------------------------
+    while( ( n < maximumNumberIterations ) && !isConverged )
+      {
+       //-----------------------------------------------------------------------
+          const double inverseA = 1.0 / sqrt( ( S * S ) + ( C * C ) );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          S *= inverseA;
+          C *= inverseA;
+       //-----------------------------------------------------------------------
+          const double cSC   = e2 * S * C;
+          const double B     = 1.5 * cSC *
+                               ( ( p * S ) - ( zc * C ) - cSC );
+          const double SNext = fabs( zc + ( e2 * S * S * S ) - ( B * S ) );
+          const double CNext = fabs( p  - ( e2 * C * C * C ) - ( B * C ) );
+       //-----------------------------------------------------------------------
+       // The angle between ( ec C, S ), of length sqrt( 1 - e^2 C^2 ), and
+       // ( ec C', S' ).
+       //-----------------------------------------------------------------------
+          latitudeCorrection =
+                 ec * fabs( ( SNext * C ) - ( CNext * S ) ) /
+                 sqrt( ( 1.0 - ( e2 * C * C ) ) *
+                       ( ( ec2 * CNext * CNext ) + ( SNext * SNext ) ) );
+          isConverged        = ( latitudeCorrection <=
+                                 ITERATED_ENGINE_CONVERGENCE_RADIANS );
+       //-----------------------------------------------------------------------
+          S = SNext;
+          C = CNext;
+          n++;
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    const double Cc = ec * C;
+ //-----------------------------------------------------------------------------
+    rEstimatedGeodeticNorthLatitudeRadians = atan2( S, Cc );
+    rEstimatedGeodeticAltitudeMeters       =
+          ( ( earthPolarAxisDistanceMeters * Cc ) + ( absZEcefMeters * S ) -
+            ( a * sqrt( ( ec2 * S * S ) + ( Cc * Cc ) ) ) ) /
+          sqrt( ( Cc * Cc ) + ( S * S ) );
+ //-----------------------------------------------------------------------------
+    rConvergenceReport.numberIterations              = n;
+    rConvergenceReport.lastLatitudeCorrectionRadians = latitudeCorrection;
+    rConvergenceReport.isConverged                   = isConverged;
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+template< ECEF_TO_GEODETIC_ENGINE ENGINE >
+static
+inline
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertEcefToGeodeticIteratedForEngine
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         &rEllipsoidContext,
+            const int     maximumNumberIterations,
+            const double  xEcefMeters,
+            const double  yEcefMeters,
+            const double  zEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double &rEstimatedGeodeticNorthLatitudeRadians,
+                  double &rEstimatedGeocentricEastLongitudeRadians,
+                  double &rEstimatedGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERGENCE_REPORT
+                         &rConvergenceReport
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticIteratedForEngine
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The conversion of one point with the iterative engine ENGINE,
+//    FUKUSHIMA_NEWTON_ENGINE or ITERATED_HALLEY_ENGINE.  The engines work
+//    in the northern hemisphere, with | z |; the longitude and the sign
+//    of the latitude are those of the ellipsoid context
+//    'convertEcefToGeodetic'.  A coordinate which is not finite is
+//    INVALID_ECEF_COORDINATES, with no iteration.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    if( !( isfinite( xEcefMeters ) &&
+           isfinite( yEcefMeters ) &&
+           isfinite( zEcefMeters ) ) )
+      {
+          rEstimatedGeodeticNorthLatitudeRadians   = NAN;
+          rEstimatedGeocentricEastLongitudeRadians = NAN;
+          rEstimatedGeodeticAltitudeMeters         = NAN;
+       //-----------------------------------------------------------------------
+          rConvergenceReport.numberIterations              = 0;
+          rConvergenceReport.lastLatitudeCorrectionRadians = NAN;
+          rConvergenceReport.isConverged                   = false;
+       //-----------------------------------------------------------------------
+          return( INVALID_ECEF_COORDINATES );
+      };
+ //-----------------------------------------------------------------------------
+    const double earthPolarAxisDistanceSquared =
+                                    ( xEcefMeters * xEcefMeters ) +
+                                    ( yEcefMeters * yEcefMeters );
+    const double earthPolarAxisDistance =
+                                    sqrt( earthPolarAxisDistanceSquared );
+    const double absZ = fabs( zEcefMeters );
+ //-----------------------------------------------------------------------------
+    double latitude;
+ //-----------------------------------------------------------------------------
+    if( ENGINE == FUKUSHIMA_NEWTON_ENGINE )
+      {
+          convertEcefToGeodeticFukushimaNewton
+                 (
+                   rEllipsoidContext,
+                   maximumNumberIterations,
+                   earthPolarAxisDistance,
+                   absZ,
+                   latitude,
+                   rEstimatedGeodeticAltitudeMeters,
+                   rConvergenceReport
+                 );
+      }
+    else
+      {
+          convertEcefToGeodeticIteratedHalley
+                 (
+                   rEllipsoidContext,
+                   maximumNumberIterations,
+                   earthPolarAxisDistance,
+                   absZ,
+                   latitude,
+                   rEstimatedGeodeticAltitudeMeters,
+                   rConvergenceReport
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    rEstimatedGeocentricEastLongitudeRadians =
+                 ( earthPolarAxisDistanceSquared > 0.0 ) ?
+                                      atan2( yEcefMeters, xEcefMeters ) : 0.0;
+ //-----------------------------------------------------------------------------
+    rEstimatedGeodeticNorthLatitudeRadians =
+                 ( zEcefMeters < 0.0 ) ? -latitude : latitude;
+ //-----------------------------------------------------------------------------
+    return( SUCCESSFUL_CONVERSION );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+template< ECEF_TO_GEODETIC_ENGINE ENGINE >
+static
+void
+convertEcefToGeodeticIteratedBatchForEngine
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const int      maximumNumberIterations,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pEstimatedGeodeticNorthLatitudeRadians,
+                  double * pEstimatedGeocentricEastLongitudeRadians,
+                  double * pEstimatedGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus,
+                  ECEF_TO_GEODETIC_CONVERGENCE_REPORT
+                         * pConvergenceReports
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticIteratedBatchForEngine
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The batch loop of the iterative engine ENGINE, with the engine
+//    inlined.  The context is copied to a local, as by
+//    'convertEcefToGeodeticBatchForEngine', and the reports of a NULL
+//    pConvergenceReports go to a local which is overwritten every point.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const EARTH_ELLIPSOID_CONTEXT context = rEllipsoidContext;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    ECEF_TO_GEODETIC_CONVERGENCE_REPORT
+     discardedReport;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < numberPoints; i++ )
+      {
+          pConversionStatus[ i ] =
+                 convertEcefToGeodeticIteratedForEngine< ENGINE >
+                        (
+                          context,
+                          maximumNumberIterations,
+                          pXEcefMeters[ i ],
+                          pYEcefMeters[ i ],
+                          pZEcefMeters[ i ],
+                          pEstimatedGeodeticNorthLatitudeRadians  [ i ],
+                          pEstimatedGeocentricEastLongitudeRadians[ i ],
+                          pEstimatedGeodeticAltitudeMeters        [ i ],
+                          ( pConvergenceReports == NULL ) ?
+                                 discardedReport : pConvergenceReports[ i ]
+                        );
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertEcefToGeodeticIterated
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         &rEllipsoidContext,
+            const ECEF_TO_GEODETIC_ENGINE
+                          conversionEngine,
+            const int     maximumNumberIterations,
+            const double  xEcefMeters,
+            const double  yEcefMeters,
+            const double  zEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double &rEstimatedGeodeticNorthLatitudeRadians,
+                  double &rEstimatedGeocentricEastLongitudeRadians,
+                  double &rEstimatedGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERGENCE_REPORT
+                         &rConvergenceReport
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticIterated
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Convert Earth Centered Earth Fixed (ECEF) retangular coordinates to
+//    geodetic coordinates with an iterative conversion engine, with a
+//    bound on the number of iterations and a report of the convergence,
+//    so that the time per point can be measured against the accuracy.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//       FUKUSHIMA_NEWTON_ENGINE  'convertEcefToGeodeticFukushimaNewton'.
+//       ITERATED_HALLEY_ENGINE   'convertEcefToGeodeticIteratedHalley'.
+//       Any other engine         The engine overload of
+//                                'convertEcefToGeodetic'.
+//
+//------------------------------------------------------------------------------
+//
+//  INPUTS:
+//
+//     rEllipsoidContext
+//       Reference to an ellipsoid context for which
+//       'initializeEarthEllipsoidContext' returned SUCCESSFUL_CONVERSION.
+//
+//     conversionEngine
+//       One of the ECEF_TO_GEODETIC_ENGINE values.
+//
+//     maximumNumberIterations
+//       The largest number of iterations per point.  A value less than
+//       one is taken as one.
+//
+//     xEcefMeters
+//     yEcefMeters
+//     zEcefMeters
+//       Geocentric rectangular coordinates
+//       UNITS:  [meters]
+//
+//------------------------------------------------------------------------------
+//
+//  OUTPUT:
+//
+//     rEstimatedGeodeticNorthLatitudeRadians
+//     rEstimatedGeocentricEastLongitudeRadians
+//     rEstimatedGeodeticAltitudeMeters
+//       As for 'convertEcefToGeodetic'.
+//
+//     rConvergenceReport
+//       The number of iterations made, the latitude change of the last
+//       one, and whether it was within ITERATED_ENGINE_CONVERGENCE_RADIANS.
+//       No iterations, a change which is not a number, and no
+//       convergence for an engine which does not iterate.
+//
+//------------------------------------------------------------------------------
+//
+//  RETURNED VALUE:
+//
+//     Conversion status:
+//        SUCCESSFUL_CONVERSION
+//        INVALID_ECEF_COORDINATES  A coordinate which is not finite, or
+//                                  as for the engine overload for an
+//                                  engine which does not iterate.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] A point which has not converged within maximumNumberIterations
+//          is still a SUCCESSFUL_CONVERSION, with the result of the last
+//          iteration; the report tells the caller how far it was from
+//          convergence.
+//
+//    [ 2 ] The time per point, the mean number of iterations and the
+//          errors of both engines near the Earth's center, about the
+//          Earth and at lunar distances are measured by
+//          'executeIterationTimingConvertEcefToGeodetic'.
+//
+//    [ 3 ] This file is compiled with '-O3 -fno-math-errno
+//          -fno-trapping-math' (see 'buildTestConvertEcefToGeodetic.sh').
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const int numberIterations = ( maximumNumberIterations < 1 ) ?
+                                   1 : maximumNumberIterations;
+ //-----------------------------------------------------------------------------
+    switch( conversionEngine )
+      {
+       //-----------------------------------------------------------------------
+          case FUKUSHIMA_NEWTON_ENGINE:
+            {
+                return( convertEcefToGeodeticIteratedForEngine<
+                                               FUKUSHIMA_NEWTON_ENGINE >
+                               (
+                                 rEllipsoidContext,
+                                 numberIterations,
+                                 xEcefMeters,
+                                 yEcefMeters,
+                                 zEcefMeters,
+                                 rEstimatedGeodeticNorthLatitudeRadians,
+                                 rEstimatedGeocentricEastLongitudeRadians,
+                                 rEstimatedGeodeticAltitudeMeters,
+                                 rConvergenceReport
+                               ) );
+            };
+       //-----------------------------------------------------------------------
+          case ITERATED_HALLEY_ENGINE:
+            {
+                return( convertEcefToGeodeticIteratedForEngine<
+                                               ITERATED_HALLEY_ENGINE >
+                               (
+                                 rEllipsoidContext,
+                                 numberIterations,
+                                 xEcefMeters,
+                                 yEcefMeters,
+                                 zEcefMeters,
+                                 rEstimatedGeodeticNorthLatitudeRadians,
+                                 rEstimatedGeocentricEastLongitudeRadians,
+                                 rEstimatedGeodeticAltitudeMeters,
+                                 rConvergenceReport
+                               ) );
+            };
+       //-----------------------------------------------------------------------
+          default:
+            {
+                rConvergenceReport.numberIterations              = 0;
+                rConvergenceReport.lastLatitudeCorrectionRadians = NAN;
+                rConvergenceReport.isConverged                   = false;
+             //-----------------------------------------------------------------
+                return( convertEcefToGeodetic
+                               (
+                                 rEllipsoidContext,
+                                 conversionEngine,
+                                 xEcefMeters,
+                                 yEcefMeters,
+                                 zEcefMeters,
+                                 rEstimatedGeodeticNorthLatitudeRadians,
+                                 rEstimatedGeocentricEastLongitudeRadians,
+                                 rEstimatedGeodeticAltitudeMeters
+                               ) );
+            };
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticIteratedBatch
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const ECEF_TO_GEODETIC_ENGINE
+                           conversionEngine,
+            const int      maximumNumberIterations,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pEstimatedGeodeticNorthLatitudeRadians,
+                  double * pEstimatedGeocentricEastLongitudeRadians,
+                  double * pEstimatedGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus,
+                  ECEF_TO_GEODETIC_CONVERGENCE_REPORT
+                         * pConvergenceReports
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticIteratedBatch
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    As 'convertEcefToGeodeticIterated', for numberPoints points, with a
+//    scalar loop which has the engine inlined.  The iterations of each
+//    point stop at its own convergence, so the loop is not vectorized.
+//    pConvergenceReports may be NULL.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const int numberIterations = ( maximumNumberIterations < 1 ) ?
+                                   1 : maximumNumberIterations;
+ //-----------------------------------------------------------------------------
+    switch( conversionEngine )
+      {
+       //-----------------------------------------------------------------------
+          case FUKUSHIMA_NEWTON_ENGINE:
+            convertEcefToGeodeticIteratedBatchForEngine<
+                                               FUKUSHIMA_NEWTON_ENGINE >
+                   (
+                     rEllipsoidContext,
+                     numberIterations,
+                     numberPoints,
+                     pXEcefMeters,
+                     pYEcefMeters,
+                     pZEcefMeters,
+                     pEstimatedGeodeticNorthLatitudeRadians,
+                     pEstimatedGeocentricEastLongitudeRadians,
+                     pEstimatedGeodeticAltitudeMeters,
+                     pConversionStatus,
+                     pConvergenceReports
+                   );
+            break;
+       //-----------------------------------------------------------------------
+          case ITERATED_HALLEY_ENGINE:
+            convertEcefToGeodeticIteratedBatchForEngine<
+                                               ITERATED_HALLEY_ENGINE >
+                   (
+                     rEllipsoidContext,
+                     numberIterations,
+                     numberPoints,
+                     pXEcefMeters,
+                     pYEcefMeters,
+                     pZEcefMeters,
+                     pEstimatedGeodeticNorthLatitudeRadians,
+                     pEstimatedGeocentricEastLongitudeRadians,
+                     pEstimatedGeodeticAltitudeMeters,
+                     pConversionStatus,
+                     pConvergenceReports
+                   );
+            break;
+       //-----------------------------------------------------------------------
+          default:
+            convertEcefToGeodeticBatch
+                   (
+                     rEllipsoidContext,
+                     conversionEngine,
+                     numberPoints,
+                     pXEcefMeters,
+                     pYEcefMeters,
+                     pZEcefMeters,
+                     pEstimatedGeodeticNorthLatitudeRadians,
+                     pEstimatedGeocentricEastLongitudeRadians,
+                     pEstimatedGeodeticAltitudeMeters,
+                     pConversionStatus
+                   );
+         //---------------------------------------------------------------------
+            if( pConvergenceReports != NULL )
+              {
+                  for( size_t i = 0; i < numberPoints; i++ )
+                    {
+                        pConvergenceReports[ i ].numberIterations = 0;
+                        pConvergenceReports[ i ]
+                               .lastLatitudeCorrectionRadians     = NAN;
+                        pConvergenceReports[ i ].isConverged      = false;
+                    };
+              };
+            break;
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
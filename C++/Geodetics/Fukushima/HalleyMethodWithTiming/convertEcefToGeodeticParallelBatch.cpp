@@ -0,0 +1,591 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+
+//------------------------------------------------------------------------------
+// The range of chunk indices [ firstChunk, endChunk ) not yet converted by a
+// worker.  The owner takes chunks from the front, a thief takes the back
+// half.  Each queue is on its own cache line.
+//------------------------------------------------------------------------------
+struct
+alignas( 64 )
+ECEF_TO_GEODETIC_WORK_QUEUE
+  {
+    mutex  queueLock;
+    size_t firstChunk;
+    size_t endChunk;
+  };
+
+//------------------------------------------------------------------------------
+struct
+ECEF_TO_GEODETIC_THREAD_POOL
+  {
+ //-----------------------------------------------------------------------------
+ // Worker 0 is the calling thread; workers 1 .. numberThreads - 1 are the
+ // pool threads.
+ //-----------------------------------------------------------------------------
+    size_t                                    numberThreads;
+    vector< thread >                          workerThreads;
+    unique_ptr< ECEF_TO_GEODETIC_WORK_QUEUE[ ] >
+                                              pWorkQueues;
+ //-----------------------------------------------------------------------------
+ // Job hand-off.
+ //-----------------------------------------------------------------------------
+    mutex                                     jobLock;
+    condition_variable                        jobStarted;
+    condition_variable                        jobFinished;
+    unsigned long long                        jobGeneration;
+    size_t                                    numberWorkersFinished;
+    bool                                      isShuttingDown;
+ //-----------------------------------------------------------------------------
+ // The current job.
+ //-----------------------------------------------------------------------------
+    const EARTH_ELLIPSOID_CONTEXT           * pEllipsoidContext;
+    size_t                                    chunkSizePoints;
+    size_t                                    numberPoints;
+    const double                            * pXEcefMeters;
+    const double                            * pYEcefMeters;
+    const double                            * pZEcefMeters;
+    double                                  * pGeodeticNorthLatitudeRadians;
+    double                                  * pGeocentricEastLongitudeRadians;
+    double                                  * pGeodeticAltitudeMeters;
+    ECEF_TO_GEODETIC_CONVERSION_STATUS      * pConversionStatus;
+  };
+
+//------------------------------------------------------------------------------
+static
+bool
+takeEcefToGeodeticChunk
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            ECEF_TO_GEODETIC_THREAD_POOL
+                   & rThreadPool,
+            const size_t workerIndex,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+            size_t & rChunkIndex
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    takeEcefToGeodeticChunk
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Take the next chunk for a worker: the front chunk of its own queue or,
+//    when that is empty, the front chunk of the back half of the first
+//    other queue with work, the rest of which becomes the worker's queue.
+//    Returns false when no queue has work.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    ECEF_TO_GEODETIC_WORK_QUEUE
+         & rOwnQueue = rThreadPool.pWorkQueues[ workerIndex ];
+ //-----------------------------------------------------------------------------
+ // Own queue.
+ //-----------------------------------------------------------------------------
+    {
+       lock_guard< mutex > ownLock( rOwnQueue.queueLock );
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+       if( rOwnQueue.firstChunk < rOwnQueue.endChunk )
+         {
+            rChunkIndex = rOwnQueue.firstChunk;
+            rOwnQueue.firstChunk++;
+         //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+            return( true );
+         };
+    };
+ //-----------------------------------------------------------------------------
+ // Steal the back half of another queue.
+ //-----------------------------------------------------------------------------
+    for( size_t k = 1; k < rThreadPool.numberThreads; k++ )
+      {
+       //-----------------------------------------------------------------------
+          ECEF_TO_GEODETIC_WORK_QUEUE
+               & rVictimQueue =
+                 rThreadPool.pWorkQueues[ ( workerIndex + k ) %
+                                          rThreadPool.numberThreads ];
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          size_t stolenFirstChunk = 0;
+          size_t stolenEndChunk   = 0;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          {
+             lock_guard< mutex > victimLock( rVictimQueue.queueLock );
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             const size_t remainingChunks = rVictimQueue.endChunk -
+                                            rVictimQueue.firstChunk;
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             if( rVictimQueue.firstChunk < rVictimQueue.endChunk )
+               {
+                  stolenEndChunk          = rVictimQueue.endChunk;
+                  stolenFirstChunk        = stolenEndChunk -
+                                            ( remainingChunks + 1 ) / 2;
+                  rVictimQueue.endChunk   = stolenFirstChunk;
+               };
+          };
+       //-----------------------------------------------------------------------
+          if( stolenFirstChunk < stolenEndChunk )
+            {
+               lock_guard< mutex > ownLock( rOwnQueue.queueLock );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               rOwnQueue.firstChunk = stolenFirstChunk + 1;
+               rOwnQueue.endChunk   = stolenEndChunk;
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               rChunkIndex = stolenFirstChunk;
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               return( true );
+            };
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return( false );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+static
+void
+convertEcefToGeodeticWorkerChunks
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            ECEF_TO_GEODETIC_THREAD_POOL
+                   & rThreadPool,
+            const size_t workerIndex
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticWorkerChunks
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Convert chunks of the current job with the vectorized batch kernel
+//    until no queue has work.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    size_t chunkIndex = 0;
+ //-----------------------------------------------------------------------------
+    while( takeEcefToGeodeticChunk( rThreadPool, workerIndex, chunkIndex ) )
+      {
+       //-----------------------------------------------------------------------
+          const size_t chunkStart  = chunkIndex * rThreadPool.chunkSizePoints;
+          const size_t chunkPoints =
+                     min( rThreadPool.chunkSizePoints,
+                          rThreadPool.numberPoints - chunkStart );
+       //-----------------------------------------------------------------------
+          convertEcefToGeodeticBatch
+                 (
+                   *rThreadPool.pEllipsoidContext,
+                   chunkPoints,
+                   rThreadPool.pXEcefMeters                    + chunkStart,
+                   rThreadPool.pYEcefMeters                    + chunkStart,
+                   rThreadPool.pZEcefMeters                    + chunkStart,
+                   rThreadPool.pGeodeticNorthLatitudeRadians   + chunkStart,
+                   rThreadPool.pGeocentricEastLongitudeRadians + chunkStart,
+                   rThreadPool.pGeodeticAltitudeMeters         + chunkStart,
+                   rThreadPool.pConversionStatus               + chunkStart
+                 );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+static
+void
+runEcefToGeodeticPoolThread
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            ECEF_TO_GEODETIC_THREAD_POOL
+                  * pThreadPool,
+            const size_t workerIndex
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    runEcefToGeodeticPoolThread
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The body of a pool thread: wait for a job, convert its chunks, report
+//    completion, until the pool is destroyed.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    unsigned long long lastJobGeneration = 0;
+ //-----------------------------------------------------------------------------
+    for( ; ; )
+      {
+       //-----------------------------------------------------------------------
+          {
+             unique_lock< mutex > jobLock( pThreadPool->jobLock );
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             pThreadPool->jobStarted.wait
+                    (
+                      jobLock,
+                      [ & ]
+                        {
+                           return( pThreadPool->isShuttingDown ||
+                                   ( pThreadPool->jobGeneration !=
+                                     lastJobGeneration ) );
+                        }
+                    );
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             if( pThreadPool->isShuttingDown )
+               {
+                  return;
+               };
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             lastJobGeneration = pThreadPool->jobGeneration;
+          };
+       //-----------------------------------------------------------------------
+          convertEcefToGeodeticWorkerChunks( *pThreadPool, workerIndex );
+       //-----------------------------------------------------------------------
+          {
+             lock_guard< mutex > jobLock( pThreadPool->jobLock );
+          //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             pThreadPool->numberWorkersFinished++;
+          };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          pThreadPool->jobFinished.notify_one( );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_THREAD_POOL *
+createEcefToGeodeticThreadPool
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const size_t numberThreads
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    createEcefToGeodeticThreadPool
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Create a work-stealing pool of numberThreads workers for
+//    'convertEcefToGeodeticParallelBatch'.  The calling thread of each
+//    batch is one of the workers, so numberThreads - 1 threads are started.
+//
+//------------------------------------------------------------------------------
+//
+//  INPUTS:
+//
+//     numberThreads
+//       The number of workers.  Zero selects the number of hardware
+//       threads reported by the system (at least one).
+//
+//------------------------------------------------------------------------------
+//
+//  RETURNED VALUE:
+//
+//     Pointer to the pool, to be released by
+//     'destroyEcefToGeodeticThreadPool'.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    ECEF_TO_GEODETIC_THREAD_POOL
+         * pThreadPool = new ECEF_TO_GEODETIC_THREAD_POOL;
+ //-----------------------------------------------------------------------------
+    pThreadPool->numberThreads =
+         ( numberThreads > 0 ) ?
+                 numberThreads :
+                 max( ( size_t )1,
+                      ( size_t )thread::hardware_concurrency( ) );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    pThreadPool->pWorkQueues.reset
+           (
+             new ECEF_TO_GEODETIC_WORK_QUEUE[ pThreadPool->numberThreads ]
+           );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    pThreadPool->jobGeneration         = 0;
+    pThreadPool->numberWorkersFinished = 0;
+    pThreadPool->isShuttingDown        = false;
+ //-----------------------------------------------------------------------------
+    for( size_t w = 1; w < pThreadPool->numberThreads; w++ )
+      {
+          pThreadPool->workerThreads.emplace_back
+                 (
+                   runEcefToGeodeticPoolThread,
+                   pThreadPool,
+                   w
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    return( pThreadPool );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+destroyEcefToGeodeticThreadPool
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            ECEF_TO_GEODETIC_THREAD_POOL
+                  * pThreadPool
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    destroyEcefToGeodeticThreadPool
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Stop and join the pool threads and release the pool.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    if( pThreadPool == NULL )
+      {
+          return;
+      };
+ //-----------------------------------------------------------------------------
+    {
+       lock_guard< mutex > jobLock( pThreadPool->jobLock );
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+       pThreadPool->isShuttingDown = true;
+    };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    pThreadPool->jobStarted.notify_all( );
+ //-----------------------------------------------------------------------------
+    for( thread & rWorkerThread : pThreadPool->workerThreads )
+      {
+          rWorkerThread.join( );
+      };
+ //-----------------------------------------------------------------------------
+    delete pThreadPool;
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticParallelBatch
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            ECEF_TO_GEODETIC_THREAD_POOL
+                         & rThreadPool,
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   chunkSizePoints,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pGeodeticNorthLatitudeRadians,
+                  double * pGeocentricEastLongitudeRadians,
+                  double * pGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticParallelBatch
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Convert a batch of ECEF points to geodetic coordinates on the workers
+//    of a thread pool.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    [ 1 ] The batch is split into chunks of chunkSizePoints points, and
+//          the chunk indices into one contiguous range per worker.
+//
+//    [ 2 ] Each worker converts the chunks of its range in order with the
+//          context overload of 'convertEcefToGeodeticBatch', so with the
+//          widest supported vector kernel.  A worker whose range is empty
+//          steals the back half of the range of another worker, so the
+//          load stays balanced when the workers run at different speeds.
+//
+//    [ 3 ] Every point is converted by the same kernel as in a single
+//          threaded batch, so the results do not depend on the number of
+//          threads or on the chunk size.
+//
+//------------------------------------------------------------------------------
+//
+//  INPUTS:
+//
+//     rThreadPool
+//       A pool from 'createEcefToGeodeticThreadPool'.
+//
+//     rEllipsoidContext
+//       As for 'convertEcefToGeodeticBatch'.
+//
+//     chunkSizePoints
+//       The number of points per chunk.  Zero selects
+//       DEFAULT_ECEF_TO_GEODETIC_CHUNK_POINTS.
+//
+//     numberPoints
+//     pXEcefMeters
+//     pYEcefMeters
+//     pZEcefMeters
+//       As for 'convertEcefToGeodeticBatch'.
+//
+//------------------------------------------------------------------------------
+//
+//  OUTPUT:
+//
+//     As for 'convertEcefToGeodeticBatch'.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] A pool converts one batch at a time; concurrent batches need
+//          separate pools.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const
+    size_t
+     effectiveChunkSizePoints =
+                 ( chunkSizePoints > 0 ) ?
+                         chunkSizePoints :
+                         DEFAULT_ECEF_TO_GEODETIC_CHUNK_POINTS;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    size_t
+     numberChunks = ( numberPoints + effectiveChunkSizePoints - 1 ) /
+                    effectiveChunkSizePoints;
+ //-----------------------------------------------------------------------------
+ // A single worker or a single chunk needs no hand-off.
+ //-----------------------------------------------------------------------------
+    if(
+        ( rThreadPool.numberThreads == 1 )
+        ||
+        ( numberChunks <= 1 )
+      )
+      {
+          convertEcefToGeodeticBatch
+                 (
+                   rEllipsoidContext,
+                   numberPoints,
+                   pXEcefMeters,
+                   pYEcefMeters,
+                   pZEcefMeters,
+                   pGeodeticNorthLatitudeRadians,
+                   pGeocentricEastLongitudeRadians,
+                   pGeodeticAltitudeMeters,
+                   pConversionStatus
+                 );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          return;
+      };
+ //-----------------------------------------------------------------------------
+ // Describe the job and deal the chunk ranges.
+ //-----------------------------------------------------------------------------
+    {
+       lock_guard< mutex > jobLock( rThreadPool.jobLock );
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+       rThreadPool.pEllipsoidContext               = &rEllipsoidContext;
+       rThreadPool.chunkSizePoints                 = effectiveChunkSizePoints;
+       rThreadPool.numberPoints                    = numberPoints;
+       rThreadPool.pXEcefMeters                    = pXEcefMeters;
+       rThreadPool.pYEcefMeters                    = pYEcefMeters;
+       rThreadPool.pZEcefMeters                    = pZEcefMeters;
+       rThreadPool.pGeodeticNorthLatitudeRadians   =
+                                         pGeodeticNorthLatitudeRadians;
+       rThreadPool.pGeocentricEastLongitudeRadians =
+                                         pGeocentricEastLongitudeRadians;
+       rThreadPool.pGeodeticAltitudeMeters         = pGeodeticAltitudeMeters;
+       rThreadPool.pConversionStatus               = pConversionStatus;
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+       for( size_t w = 0; w < rThreadPool.numberThreads; w++ )
+         {
+            lock_guard< mutex >
+                 queueLock( rThreadPool.pWorkQueues[ w ].queueLock );
+         //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+            rThreadPool.pWorkQueues[ w ].firstChunk =
+                      (   w       * numberChunks ) / rThreadPool.numberThreads;
+            rThreadPool.pWorkQueues[ w ].endChunk   =
+                      ( ( w + 1 ) * numberChunks ) / rThreadPool.numberThreads;
+         };
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+       rThreadPool.numberWorkersFinished = 0;
+       rThreadPool.jobGeneration++;
+    };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    rThreadPool.jobStarted.notify_all( );
+ //-----------------------------------------------------------------------------
+ // The calling thread is worker 0.
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticWorkerChunks( rThreadPool, 0 );
+ //-----------------------------------------------------------------------------
+ // Wait for the pool threads.
+ //-----------------------------------------------------------------------------
+    {
+       unique_lock< mutex > jobLock( rThreadPool.jobLock );
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+       rThreadPool.jobFinished.wait
+              (
+                jobLock,
+                [ & ]
+                  {
+                     return( rThreadPool.numberWorkersFinished ==
+                             rThreadPool.numberThreads - 1 );
+                  }
+              );
+    };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
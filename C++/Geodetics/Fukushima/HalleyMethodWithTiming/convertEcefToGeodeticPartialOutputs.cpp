@@ -0,0 +1,887 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <float.h>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+// The processor is examined once, at program startup, and the widest
+// supported kernel is used for every batch.
+//------------------------------------------------------------------------------
+static
+const
+ECEF_TO_GEODETIC_ISA_LEVEL
+ supportedIsaLevel = detectEcefToGeodeticIsaLevel( );
+
+//------------------------------------------------------------------------------
+static
+const
+size_t
+ CHUNK_POINTS = 256;
+
+//------------------------------------------------------------------------------
+static
+inline
+void
+computeHalleyDirection
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         &rEllipsoidContext,
+            const double  earthPolarAxisDistanceMeters,
+            const double  absZ,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double &rS1,
+                  double &rCc
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    computeHalleyDirection
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The single Halley step of the ellipsoid context overload of
+//    'convertEcefToGeodetic', away from the polar axis.  rS1 and rCc are
+//    proportional to the sine and cosine of the geodetic latitude.
+//
+//    The arithmetic is that of 'convertEcefToGeodetic', so the partial
+//    conversions of this file give its results to the last bit.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const double complimentaryEarthEllipticity =
+                            rEllipsoidContext.complimentaryEarthEllipticity;
+    const double earthEllipticitySquared       =
+                            rEllipsoidContext.earthEllipticitySquared;
+ //-----------------------------------------------------------------------------
+ // Equations (2), (17), (14), (12), (13), (15), (10), (11) and (21)
+ // of Reference [ 1 ] of 'convertEcefToGeodetic'.
+ //-----------------------------------------------------------------------------
+    const double S0        = absZ /
+                             rEllipsoidContext.earthEquatorialRadiusMeters;
+    const double Pn        = earthPolarAxisDistanceMeters /
+                             rEllipsoidContext.earthEquatorialRadiusMeters;
+    const double zc        = complimentaryEarthEllipticity * S0;
+    const double C0        = complimentaryEarthEllipticity * Pn;
+    const double C0Squared = C0 * C0;
+    const double C0Cubed   = C0 * C0Squared;
+    const double S0Squared = S0 * S0;
+    const double S0Cubed   = S0 * S0Squared;
+    const double A0Squared = C0Squared + S0Squared;
+    const double A0        = sqrt( A0Squared );
+    const double A0Cubed   = A0 * A0Squared;
+    const double D0        = (  zc                      * A0Cubed ) +
+                             (  earthEllipticitySquared * S0Cubed );
+    const double F0        = (  Pn                      * A0Cubed ) +
+                             ( -earthEllipticitySquared * C0Cubed );
+    const double B0        = rEllipsoidContext.oneAndHalf_e4 *
+                             S0Squared                       *
+                             C0Squared                       *
+                             Pn                              *
+                             ( A0 - complimentaryEarthEllipticity );
+    const double C1        = ( F0 * F0 ) + ( -B0 * C0 );
+ //-----------------------------------------------------------------------------
+    rS1 = ( D0 * F0 ) + ( -B0 * S0 );
+    rCc = complimentaryEarthEllipticity * C1;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertEcefToGeodeticAltitude
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         &rEllipsoidContext,
+            const double  xEcefMeters,
+            const double  yEcefMeters,
+            const double  zEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double &rEstimatedGeodeticAltitudeMeters
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticAltitude
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The geodetic altitude of the ellipsoid context overload of
+//    'convertEcefToGeodetic', without the latitude and longitude.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    The Halley step and equation (20) of 'convertEcefToGeodetic'.  Both
+//    arctangents are skipped.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const double earthPolarAxisDistanceSquared =
+                                    ( xEcefMeters * xEcefMeters ) +
+                                    ( yEcefMeters * yEcefMeters );
+    const double absZ = fabs( zEcefMeters );
+ //-----------------------------------------------------------------------------
+    if( earthPolarAxisDistanceSquared > rEllipsoidContext.aEpsSquared )
+      {
+       //-----------------------------------------------------------------------
+          const double earthPolarAxisDistanceMeters =
+                                    sqrt( earthPolarAxisDistanceSquared );
+       //-----------------------------------------------------------------------
+          double S1;
+          double Cc;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          computeHalleyDirection
+                 (
+                   rEllipsoidContext,
+                   earthPolarAxisDistanceMeters,
+                   absZ,
+                   S1,
+                   Cc
+                 );
+       //-----------------------------------------------------------------------
+       // Equation (20) of Reference [ 1 ] of 'convertEcefToGeodetic'.
+       //-----------------------------------------------------------------------
+          const double S1Squared = S1 * S1;
+          const double CcSquared = Cc * Cc;
+          const double a1        = sqrt(
+                                      (
+                                        rEllipsoidContext.
+                                        complimentaryEarthEllipticitySquared *
+                                        S1Squared
+                                      )
+                                      +
+                                      CcSquared
+                                    );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          rEstimatedGeodeticAltitudeMeters =
+                 (
+                   (  earthPolarAxisDistanceMeters                  * Cc ) +
+                   (  absZ                                          * S1 ) +
+                   ( -rEllipsoidContext.earthEquatorialRadiusMeters * a1 )
+                 ) / sqrt( CcSquared + S1Squared );
+       //-----------------------------------------------------------------------
+      }
+    else
+      {
+       //-----------------------------------------------------------------------
+       // Exceptional processing for the polar axis vicinity.
+       //-----------------------------------------------------------------------
+          rEstimatedGeodeticAltitudeMeters =
+                                absZ - rEllipsoidContext.earthPolarRadiusMeters;
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return( SUCCESSFUL_CONVERSION );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertEcefToGeodeticLatitude
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         &rEllipsoidContext,
+            const double  xEcefMeters,
+            const double  yEcefMeters,
+            const double  zEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double &rEstimatedGeodeticNorthLatitudeRadians
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticLatitude
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The geodetic latitude of the ellipsoid context overload of
+//    'convertEcefToGeodetic', without the longitude and altitude.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    The Halley step and equation (19) of 'convertEcefToGeodetic'.  The
+//    longitude arctangent and equation (20), with its two square roots
+//    and its division, are skipped.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const double earthPolarAxisDistanceSquared =
+                                    ( xEcefMeters * xEcefMeters ) +
+                                    ( yEcefMeters * yEcefMeters );
+ //-----------------------------------------------------------------------------
+    if( earthPolarAxisDistanceSquared > rEllipsoidContext.aEpsSquared )
+      {
+       //-----------------------------------------------------------------------
+          double S1;
+          double Cc;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          computeHalleyDirection
+                 (
+                   rEllipsoidContext,
+                   sqrt( earthPolarAxisDistanceSquared ),
+                   fabs( zEcefMeters ),
+                   S1,
+                   Cc
+                 );
+       //-----------------------------------------------------------------------
+       // Equation (19) of Reference [ 1 ] of 'convertEcefToGeodetic'.
+       //-----------------------------------------------------------------------
+          rEstimatedGeodeticNorthLatitudeRadians = atan2( S1, Cc );
+       //-----------------------------------------------------------------------
+      }
+    else
+      {
+       //-----------------------------------------------------------------------
+       // Exceptional processing for the polar axis vicinity.
+       //-----------------------------------------------------------------------
+          rEstimatedGeodeticNorthLatitudeRadians = 2.0 * atan( 1.0 );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    if( zEcefMeters < 0.0 )
+      {
+       //-----------------------------------------------------------------------
+       // Southern Hemisphere.
+       //-----------------------------------------------------------------------
+          rEstimatedGeodeticNorthLatitudeRadians =
+                                     -rEstimatedGeodeticNorthLatitudeRadians;
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return( SUCCESSFUL_CONVERSION );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertEcefToGeodeticLatitudeLongitude
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         &rEllipsoidContext,
+            const double  xEcefMeters,
+            const double  yEcefMeters,
+            const double  zEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double &rEstimatedGeodeticNorthLatitudeRadians,
+                  double &rEstimatedGeocentricEastLongitudeRadians
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticLatitudeLongitude
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The geodetic latitude and the longitude of the ellipsoid context
+//    overload of 'convertEcefToGeodetic', without the altitude.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    As 'convertEcefToGeodeticLatitude', with the longitude arctangent.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const double earthPolarAxisDistanceSquared =
+                                    ( xEcefMeters * xEcefMeters ) +
+                                    ( yEcefMeters * yEcefMeters );
+ //-----------------------------------------------------------------------------
+ // Determine Geocentric Longitude [radians].
+ //-----------------------------------------------------------------------------
+    rEstimatedGeocentricEastLongitudeRadians =
+                 ( earthPolarAxisDistanceSquared > 0.0 ) ?
+                                      atan2( yEcefMeters, xEcefMeters ) : 0.0;
+ //-----------------------------------------------------------------------------
+    return(
+            convertEcefToGeodeticLatitude
+                   (
+                     //-------------------
+                     // INPUT(s):
+                     //-------------------
+                        rEllipsoidContext,
+                        xEcefMeters,
+                        yEcefMeters,
+                        zEcefMeters,
+                     //-------------------
+                     // OUTPUT(s):
+                     //-------------------
+                        rEstimatedGeodeticNorthLatitudeRadians
+                   )
+          );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+template< bool LATITUDE, bool LONGITUDE, bool ALTITUDE >
+static
+void
+convertEcefToGeodeticPartialBatchChunk
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   chunkPoints,
+            const double * __restrict__ x,
+            const double * __restrict__ y,
+            const double * __restrict__ z,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * __restrict__ latitude,
+                  double * __restrict__ longitude,
+                  double * __restrict__ altitude,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * __restrict__ status
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticPartialBatchChunk
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The baseline kernel of the partial batch conversions, converting one
+//    cache resident chunk as the chunk loop of 'convertEcefToGeodeticBatch'
+//    does, for the outputs whose template flag is set.
+//
+//    The unnormalized sine and cosine of the latitude go to local blocks
+//    rather than to the output arrays, since the longitude array is not
+//    there when only the latitude is selected.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const double earthEquatorialRadiusMeters =
+                    rEllipsoidContext.earthEquatorialRadiusMeters;
+    const double earthEllipticitySquared =
+                    rEllipsoidContext.earthEllipticitySquared;
+    const double oneAndHalf_e4 =
+                    rEllipsoidContext.oneAndHalf_e4;
+    const double complimentaryEarthEllipticitySquared =
+                    rEllipsoidContext.complimentaryEarthEllipticitySquared;
+    const double complimentaryEarthEllipticity =
+                    rEllipsoidContext.complimentaryEarthEllipticity;
+    const double earthPolarRadiusMeters =
+                    rEllipsoidContext.earthPolarRadiusMeters;
+    const double inverseEarthEquatorialRadius =
+                    rEllipsoidContext.inverseEarthEquatorialRadius;
+    const double aEpsSquared =
+                    rEllipsoidContext.aEpsSquared;
+ //-----------------------------------------------------------------------------
+    double sineBlock  [ CHUNK_POINTS ];
+    double cosineBlock[ CHUNK_POINTS ];
+ //=============================================================================
+ //
+ // Pass 1:  Branch free Halley step.
+ //
+ //=============================================================================
+    for( size_t i = 0; i < chunkPoints; i++ )
+      {
+       //-----------------------------------------------------------------------
+          const double xi   = x[ i ];
+          const double yi   = y[ i ];
+          const double zi   = z[ i ];
+       //-----------------------------------------------------------------------
+          const double earthPolarAxisDistanceSquared =
+                                           ( xi * xi ) + ( yi * yi );
+          const double earthPolarAxisDistanceMeters  =
+                                    sqrt( earthPolarAxisDistanceSquared );
+          const double absZ = fabs( zi );
+       //-----------------------------------------------------------------------
+       // Equations (2), (17), (14), (12), (13), (15), (10), (11) and
+       // (21) of Reference [ 1 ] of 'convertEcefToGeodetic'.
+       //-----------------------------------------------------------------------
+          const double S0        = absZ * inverseEarthEquatorialRadius;
+          const double Pn        = earthPolarAxisDistanceMeters *
+                                   inverseEarthEquatorialRadius;
+          const double zc        = complimentaryEarthEllipticity * S0;
+          const double C0        = complimentaryEarthEllipticity * Pn;
+          const double C0Squared = C0 * C0;
+          const double C0Cubed   = C0 * C0Squared;
+          const double S0Squared = S0 * S0;
+          const double S0Cubed   = S0 * S0Squared;
+          const double A0Squared = C0Squared + S0Squared;
+          const double A0        = sqrt( A0Squared );
+          const double A0Cubed   = A0 * A0Squared;
+          const double D0        = (  zc                      * A0Cubed ) +
+                                   (  earthEllipticitySquared * S0Cubed );
+          const double F0        = (  Pn                      * A0Cubed ) +
+                                   ( -earthEllipticitySquared * C0Cubed );
+          const double B0        = oneAndHalf_e4 *
+                                   S0Squared     *
+                                   C0Squared     *
+                                   Pn            *
+                                   ( A0 - complimentaryEarthEllipticity );
+          const double S1        = ( D0 * F0 ) + ( -B0 * S0 );
+          const double C1        = ( F0 * F0 ) + ( -B0 * C0 );
+          const double Cc        = complimentaryEarthEllipticity * C1;
+       //-----------------------------------------------------------------------
+          const bool nearPolarAxis =
+                       !( earthPolarAxisDistanceSquared > aEpsSquared );
+       //-----------------------------------------------------------------------
+          if( LATITUDE )
+            {
+               const double S = nearPolarAxis ? 1.0 : S1;
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               sineBlock  [ i ] = ( ( zi < 0.0 ) ? -1.0 : 1.0 ) * S;
+               cosineBlock[ i ] = nearPolarAxis ? 0.0 : Cc;
+            };
+       //-----------------------------------------------------------------------
+       // Equation (20) of Reference [ 1 ] of 'convertEcefToGeodetic'.
+       //-----------------------------------------------------------------------
+          if( ALTITUDE )
+            {
+               const double S1Squared = S1 * S1;
+               const double CcSquared = Cc * Cc;
+               const double a1        =
+                        sqrt(
+                              (
+                                complimentaryEarthEllipticitySquared *
+                                S1Squared
+                              )
+                              +
+                              CcSquared
+                            );
+               const double h1        = (
+                                          (  earthPolarAxisDistanceMeters * Cc )
+                                          +
+                                          (  absZ                         * S1 )
+                                          +
+                                          ( -earthEquatorialRadiusMeters  * a1 )
+                                        ) / sqrt( CcSquared + S1Squared );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               altitude[ i ] = nearPolarAxis ?
+                               ( absZ - earthPolarRadiusMeters ) : h1;
+            };
+       //-----------------------------------------------------------------------
+      };
+ //=============================================================================
+ //
+ // Pass 2:  Angles and point status.
+ //
+ //=============================================================================
+    for( size_t i = 0; i < chunkPoints; i++ )
+      {
+       //-----------------------------------------------------------------------
+          const double xi = x[ i ];
+          const double yi = y[ i ];
+          const double zi = z[ i ];
+       //-----------------------------------------------------------------------
+          if( LATITUDE )
+            {
+               latitude [ i ] = atan2( sineBlock[ i ], cosineBlock[ i ] );
+            };
+          if( LONGITUDE )
+            {
+               longitude[ i ] = ( ( xi * xi ) + ( yi * yi ) > 0.0 ) ?
+                                atan2( yi, xi ) : 0.0;
+            };
+       //-----------------------------------------------------------------------
+          const bool finiteCoordinates =
+                       ( fabs( xi ) <= DBL_MAX ) &&
+                       ( fabs( yi ) <= DBL_MAX ) &&
+                       ( fabs( zi ) <= DBL_MAX );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( finiteCoordinates )
+            {
+               status   [ i ] = SUCCESSFUL_CONVERSION;
+            }
+          else
+            {
+               status   [ i ] = INVALID_ECEF_COORDINATES;
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               if( LATITUDE )
+                 {
+                    latitude [ i ] = NAN;
+                 };
+               if( LONGITUDE )
+                 {
+                    longitude[ i ] = NAN;
+                 };
+               if( ALTITUDE )
+                 {
+                    altitude [ i ] = NAN;
+                 };
+            };
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+static
+void
+convertEcefToGeodeticPartialBatch
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const ECEF_TO_GEODETIC_OUTPUT_SELECTION
+                           outputSelection,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pGeodeticNorthLatitudeRadians,
+                  double * pGeocentricEastLongitudeRadians,
+                  double * pGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticPartialBatch
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Convert a batch for the outputs of outputSelection with the widest
+//    kernel the processor supports.  The output arrays which are not
+//    selected are not referenced.
+//
+//    The baseline chunk is called through a pointer so that it is not
+//    inlined here, which would lose its restrict qualifiers and its
+//    vectorization.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    if( supportedIsaLevel == AVX512_ISA_LEVEL )
+      {
+          convertEcefToGeodeticPartialBatchAvx512Kernel
+                 (
+                   //-------------------
+                   // INPUT(s):
+                   //-------------------
+                      rEllipsoidContext,
+                      outputSelection,
+                      numberPoints,
+                      pXEcefMeters,
+                      pYEcefMeters,
+                      pZEcefMeters,
+                   //-------------------
+                   // OUTPUT(s):
+                   //-------------------
+                      pGeodeticNorthLatitudeRadians,
+                      pGeocentricEastLongitudeRadians,
+                      pGeodeticAltitudeMeters,
+                      pConversionStatus
+                 );
+      }
+    else
+    if( supportedIsaLevel == AVX2_FMA_ISA_LEVEL )
+      {
+          convertEcefToGeodeticPartialBatchAvx2Kernel
+                 (
+                   //-------------------
+                   // INPUT(s):
+                   //-------------------
+                      rEllipsoidContext,
+                      outputSelection,
+                      numberPoints,
+                      pXEcefMeters,
+                      pYEcefMeters,
+                      pZEcefMeters,
+                   //-------------------
+                   // OUTPUT(s):
+                   //-------------------
+                      pGeodeticNorthLatitudeRadians,
+                      pGeocentricEastLongitudeRadians,
+                      pGeodeticAltitudeMeters,
+                      pConversionStatus
+                 );
+      }
+    else
+      {
+       //-----------------------------------------------------------------------
+          void
+           ( *pConvertChunk )
+                  (
+                    const EARTH_ELLIPSOID_CONTEXT &,
+                    const size_t,
+                    const double *,
+                    const double *,
+                    const double *,
+                          double *,
+                          double *,
+                          double *,
+                          ECEF_TO_GEODETIC_CONVERSION_STATUS *
+                  ) =
+                  ( outputSelection == ALTITUDE_ONLY_OUTPUT ) ?
+                  convertEcefToGeodeticPartialBatchChunk
+                                           < false, false, true > :
+                  ( outputSelection == LATITUDE_LONGITUDE_OUTPUT ) ?
+                  convertEcefToGeodeticPartialBatchChunk
+                                           < true,  true,  false > :
+                  convertEcefToGeodeticPartialBatchChunk
+                                           < true,  false, false >;
+       //-----------------------------------------------------------------------
+       // Loop over the chunks of the batch.  The output arrays which are
+       // not selected may be null, so only the selected ones are offset.
+       //-----------------------------------------------------------------------
+          for(
+               size_t chunkStart  = 0;
+                      chunkStart  < numberPoints;
+                      chunkStart += CHUNK_POINTS
+             )
+            {
+             //-----------------------------------------------------------------
+                const
+                size_t
+                 chunkPoints = ( numberPoints - chunkStart < CHUNK_POINTS ) ?
+                               ( numberPoints - chunkStart ) : CHUNK_POINTS;
+             //-----------------------------------------------------------------
+                pConvertChunk
+                       (
+                         rEllipsoidContext,
+                         chunkPoints,
+                         pXEcefMeters + chunkStart,
+                         pYEcefMeters + chunkStart,
+                         pZEcefMeters + chunkStart,
+                         ( outputSelection != ALTITUDE_ONLY_OUTPUT ) ?
+                         pGeodeticNorthLatitudeRadians + chunkStart : NULL,
+                         ( outputSelection == LATITUDE_LONGITUDE_OUTPUT ) ?
+                         pGeocentricEastLongitudeRadians + chunkStart : NULL,
+                         ( outputSelection == ALTITUDE_ONLY_OUTPUT ) ?
+                         pGeodeticAltitudeMeters + chunkStart : NULL,
+                         pConversionStatus + chunkStart
+                       );
+             //-----------------------------------------------------------------
+            };
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticAltitudeBatch
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pEstimatedGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticAltitudeBatch
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The geodetic altitudes of the ellipsoid context overload of
+//    'convertEcefToGeodeticBatch', without the latitudes and longitudes.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticPartialBatch
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                rEllipsoidContext,
+                ALTITUDE_ONLY_OUTPUT,
+                numberPoints,
+                pXEcefMeters,
+                pYEcefMeters,
+                pZEcefMeters,
+             //-------------------
+             // OUTPUT(s):
+             //-------------------
+                NULL,
+                NULL,
+                pEstimatedGeodeticAltitudeMeters,
+                pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticLatitudeLongitudeBatch
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pEstimatedGeodeticNorthLatitudeRadians,
+                  double * pEstimatedGeocentricEastLongitudeRadians,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticLatitudeLongitudeBatch
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The geodetic latitudes and the longitudes of the ellipsoid context
+//    overload of 'convertEcefToGeodeticBatch', without the altitudes.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticPartialBatch
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                rEllipsoidContext,
+                LATITUDE_LONGITUDE_OUTPUT,
+                numberPoints,
+                pXEcefMeters,
+                pYEcefMeters,
+                pZEcefMeters,
+             //-------------------
+             // OUTPUT(s):
+             //-------------------
+                pEstimatedGeodeticNorthLatitudeRadians,
+                pEstimatedGeocentricEastLongitudeRadians,
+                NULL,
+                pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticLatitudeBatch
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pEstimatedGeodeticNorthLatitudeRadians,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticLatitudeBatch
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The geodetic latitudes of the ellipsoid context overload of
+//    'convertEcefToGeodeticBatch', without the longitudes and altitudes.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticPartialBatch
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                rEllipsoidContext,
+                LATITUDE_ONLY_OUTPUT,
+                numberPoints,
+                pXEcefMeters,
+                pYEcefMeters,
+                pZEcefMeters,
+             //-------------------
+             // OUTPUT(s):
+             //-------------------
+                pEstimatedGeodeticNorthLatitudeRadians,
+                NULL,
+                NULL,
+                pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
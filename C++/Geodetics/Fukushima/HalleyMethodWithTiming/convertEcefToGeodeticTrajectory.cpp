@@ -0,0 +1,551 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+// asin( s ) for | s | <= TRAJECTORY_ANCHOR_ANGLE_LIMIT_RADIANS, where the
+// first omitted term, 5 s^7 / 112, is below 1e-15 s.
+//------------------------------------------------------------------------------
+static
+inline
+double
+computeSmallAngleArcSine
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double s
+       )
+{
+ //-----------------------------------------------------------------------------
+    const double sSquared = s * s;
+ //-----------------------------------------------------------------------------
+    return( s + ( s * sSquared ) * ( ( 1.0 / 6.0 ) +
+                                     ( 3.0 / 40.0 ) * sSquared ) );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// The stateless conversion of one point, which then becomes the anchor of
+// the warm points after it.  A point which fails leaves the state cold, so
+// the next point is an anchor again.
+//------------------------------------------------------------------------------
+static
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertEcefToGeodeticTrajectoryAnchor
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         &rEllipsoidContext,
+            const double  xEcefMeters,
+            const double  yEcefMeters,
+            const double  zEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  ECEF_TO_GEODETIC_TRAJECTORY_STATE
+                         &rTrajectoryState,
+                  double &rGeodeticNorthLatitudeRadians,
+                  double &rGeocentricEastLongitudeRadians,
+                  double &rGeodeticAltitudeMeters
+       )
+{
+ //-----------------------------------------------------------------------------
+    const ECEF_TO_GEODETIC_CONVERSION_STATUS
+     returnValue = convertEcefToGeodetic
+                          (
+                            rEllipsoidContext,
+                            xEcefMeters,
+                            yEcefMeters,
+                            zEcefMeters,
+                            rGeodeticNorthLatitudeRadians,
+                            rGeocentricEastLongitudeRadians,
+                            rGeodeticAltitudeMeters
+                          );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    rTrajectoryState.numberFullSolutionPoints++;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( returnValue != SUCCESSFUL_CONVERSION )
+      {
+         rTrajectoryState.isWarm            = 0;
+         rTrajectoryState.pointsSinceAnchor = 0;
+      //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+         return( returnValue );
+      };
+ //-----------------------------------------------------------------------------
+    const double absoluteLatitude = fabs( rGeodeticNorthLatitudeRadians );
+    const double p                = sqrt( ( xEcefMeters * xEcefMeters ) +
+                                          ( yEcefMeters * yEcefMeters ) );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    double sine;
+    double cosine;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    sincos( absoluteLatitude, &sine, &cosine );
+ //-----------------------------------------------------------------------------
+ // The correction from the direction of the raw start, ( |z|, ec^2 p ), to
+ // the solution.
+ //-----------------------------------------------------------------------------
+    const double rawSine   = fabs( zEcefMeters );
+    const double rawCosine = rEllipsoidContext.
+                             complimentaryEarthEllipticitySquared * p;
+    const double rawScale  = 1.0 / sqrt( ( rawSine   * rawSine   ) +
+                                         ( rawCosine * rawCosine ) );
+ //-----------------------------------------------------------------------------
+    rTrajectoryState.isWarm                         = 1;
+    rTrajectoryState.pointsSinceAnchor              = 0;
+    rTrajectoryState.anchorXEcefMeters              = xEcefMeters;
+    rTrajectoryState.anchorYEcefMeters              = yEcefMeters;
+    rTrajectoryState.anchorPolarAxisDistanceMeters  = p;
+    rTrajectoryState.anchorLongitudeRadians         =
+                                          rGeocentricEastLongitudeRadians;
+    rTrajectoryState.anchorAbsoluteLatitudeRadians  = absoluteLatitude;
+    rTrajectoryState.anchorSineAbsoluteLatitude     = sine;
+    rTrajectoryState.anchorCosineLatitude           = cosine;
+    rTrajectoryState.anchorSineCorrection           =
+                     ( ( sine   * rawCosine ) - ( cosine * rawSine   ) ) *
+                     rawScale;
+    rTrajectoryState.anchorCosineCorrection         =
+                     ( ( cosine * rawCosine ) + ( sine   * rawSine   ) ) *
+                     rawScale;
+ //-----------------------------------------------------------------------------
+    return( returnValue );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+initializeEcefToGeodeticTrajectoryState
+       (
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+            ECEF_TO_GEODETIC_TRAJECTORY_STATE
+                   &rTrajectoryState
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    initializeEcefToGeodeticTrajectoryState
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Start a new trajectory:  the next point converted with the state is
+//    solved without a warm start, and the point counts are zeroed.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    rTrajectoryState.isWarm                         = 0;
+    rTrajectoryState.pointsSinceAnchor              = 0;
+    rTrajectoryState.anchorXEcefMeters              = NAN;
+    rTrajectoryState.anchorYEcefMeters              = NAN;
+    rTrajectoryState.anchorPolarAxisDistanceMeters  = NAN;
+    rTrajectoryState.anchorLongitudeRadians         = NAN;
+    rTrajectoryState.anchorAbsoluteLatitudeRadians  = NAN;
+    rTrajectoryState.anchorSineAbsoluteLatitude     = NAN;
+    rTrajectoryState.anchorCosineLatitude           = NAN;
+    rTrajectoryState.anchorSineCorrection           = NAN;
+    rTrajectoryState.anchorCosineCorrection         = NAN;
+    rTrajectoryState.numberNewtonPoints             = 0;
+    rTrajectoryState.numberHalleyPoints             = 0;
+    rTrajectoryState.numberFullSolutionPoints       = 0;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertEcefToGeodeticTrajectory
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                           &rEllipsoidContext,
+            const size_t    numberPoints,
+            const double  * pXEcefMeters,
+            const double  * pYEcefMeters,
+            const double  * pZEcefMeters,
+         //-------------------
+         // INPUT and OUTPUT:
+         //-------------------
+                  ECEF_TO_GEODETIC_TRAJECTORY_STATE
+                           &rTrajectoryState,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double  * pGeodeticNorthLatitudeRadians,
+                  double  * pGeocentricEastLongitudeRadians,
+                  double  * pGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                          * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticTrajectory
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Convert a time ordered run of Earth Centered Earth Fixed (ECEF)
+//    points, such as a flight track or an orbit, to geodetic coordinates,
+//    starting each point's iteration from the solution of a recent point
+//    on the track instead of from the Fukushima initial values.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    The stateless conversion starts from the direction of ( |z|, ec^2 p )
+//    and its Halley step corrects that to the geodetic latitude.  The
+//    correction is a smooth function of the latitude and altitude, so a
+//    point near the anchor, the last point solved by the stateless
+//    conversion, starts from its own raw direction rotated by the anchor's
+//    correction.
+//
+//    With P = p / a, Zc = ec |z| / a, and that start as ( S, C ), where
+//    tan( lat0 ) = S / ( ec C ), Equations (10) to (15) of Reference [ 1 ]
+//    of 'convertEcefToGeodetic' give
+//
+//       A = sqrt( S^2 + C^2 )
+//       D = Zc A^3 + e^2 S^3
+//       F = P  A^3 - e^2 C^3
+//       B = 1.5 e^2 S C^2 ( ( P S - Zc C ) A - e^2 S C )
+//
+//    and the corrected ( S1, C1 ) = ( D F - B S, F^2 - B C ), where
+//    tan| lat | = S1 / ( ec C1 ).
+//
+//    [ 1 ] Take the Newton step, B = 0, and its correction d of the start.
+//
+//    [ 2 ] If | sin( d ) | <= TRAJECTORY_NEWTON_STEP_LIMIT_RADIANS,
+//          keep the Newton step, whose error is about 0.005 d^2.  Else
+//          if | sin( d ) | <= TRAJECTORY_HALLEY_STEP_LIMIT_RADIANS, redo
+//          the step with B, whose error is about 3 d^3.  With both
+//          limits the largest error measured on the tracks of the timing
+//          report is 0.1 micro arc seconds.  Else the point takes the
+//          stateless conversion and becomes the anchor.
+//
+//    [ 3 ] | lat | is the anchor's latitude plus the asin, by a short
+//          series, of the sine of the difference, and
+//          h = p cos( lat ) + |z| sin| lat | - a sqrt( 1 - e^2 sin^2 lat ).
+//          A point more than TRAJECTORY_ANCHOR_ANGLE_LIMIT_RADIANS of
+//          latitude from the anchor takes the stateless conversion and
+//          becomes the anchor.
+//
+//    [ 4 ] The longitude is the anchor's longitude plus the asin of the
+//          cross product of the horizontal directions, or atan2 when it
+//          differs by more than TRAJECTORY_ANCHOR_ANGLE_LIMIT_RADIANS.
+//
+//    A warm point depends on the anchor only, not on the point before it,
+//    so successive points overlap in the processor instead of waiting on
+//    each other's square roots, and no error accumulates along the track.
+//
+//------------------------------------------------------------------------------
+//
+//  INPUTS:
+//
+//     rEllipsoidContext
+//       Reference to an ellipsoid context for which
+//       'initializeEarthEllipsoidContext' returned SUCCESSFUL_CONVERSION.
+//
+//     numberPoints
+//       Number of points in the run.
+//
+//     pXEcefMeters
+//     pYEcefMeters
+//     pZEcefMeters
+//       Contiguous arrays of numberPoints ECEF coordinates, in time order.
+//       UNITS:  [meters]
+//
+//------------------------------------------------------------------------------
+//
+//  INPUT and OUTPUT:
+//
+//     rTrajectoryState
+//       The anchor and the point counts, initialized by
+//       'initializeEcefToGeodeticTrajectoryState' at the start of a
+//       trajectory.  A stream may be converted in runs of any length with
+//       the same state.
+//
+//------------------------------------------------------------------------------
+//
+//  OUTPUT:
+//
+//     pGeodeticNorthLatitudeRadians
+//     pGeocentricEastLongitudeRadians
+//     pGeodeticAltitudeMeters
+//       Contiguous arrays of numberPoints elements to contain the
+//       geodetic coordinates.
+//       UNITS:  [radians], [radians], [meters]
+//
+//     pConversionStatus
+//       Contiguous array of numberPoints elements to contain the conversion
+//       status of each point, that of 'convertEcefToGeodetic' for an anchor
+//       and SUCCESSFUL_CONVERSION for a warm point.
+//
+//------------------------------------------------------------------------------
+//
+//  RETURNED VALUE:
+//
+//     The status of the first point of the run which failed, or
+//     SUCCESSFUL_CONVERSION:
+//        SUCCESSFUL_CONVERSION
+//        INVALID_ECEF_COORDINATES  (a coordinate is NAN or infinite)
+//        INVALID_ELLIPSOIDAL_FLATTENING
+//        INVALID_EQUATORIAL_RADIUS
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The first point of a trajectory, points within 1.0e-16 a of the
+//          polar axis, non finite points, and the point after every
+//          TRAJECTORY_ANCHOR_INTERVAL warm points also take the stateless
+//          conversion and become the anchor.
+//
+//    [ 2 ] The counts of the trajectory state report how many points
+//          took each of the three paths.
+//
+//    [ 3 ] A point which fails is not an anchor: its coordinates are NAN,
+//          and the next point takes the stateless conversion and becomes
+//          the anchor.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const EARTH_ELLIPSOID_CONTEXT & E = rEllipsoidContext;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const double piRadians    = 4.0 * atan( 1.0 );
+    const double e2           = E.earthEllipticitySquared;
+    const double ec           = E.complimentaryEarthEllipticity;
+    const double ec2          = E.complimentaryEarthEllipticitySquared;
+    const double inverseEc    = 1.0 / ec;
+    const double oneAndHalfE2 = 1.5 * e2;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    ECEF_TO_GEODETIC_CONVERSION_STATUS
+     returnValue = SUCCESSFUL_CONVERSION;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < numberPoints; i++ )
+      {
+       //-----------------------------------------------------------------------
+          const double x    = pXEcefMeters[ i ];
+          const double y    = pYEcefMeters[ i ];
+          const double absZ = fabs( pZEcefMeters[ i ] );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          const double pSquared = ( x * x ) + ( y * y );
+       //-----------------------------------------------------------------------
+       // The comparisons are written so that a NAN takes the full solution.
+       //-----------------------------------------------------------------------
+          bool isAnchor =
+               !rTrajectoryState.isWarm
+               ||
+               ( rTrajectoryState.pointsSinceAnchor >=
+                 TRAJECTORY_ANCHOR_INTERVAL )
+               ||
+               !( pSquared > E.aEpsSquared )
+               ||
+               !( pSquared + ( absZ * absZ ) < 1.0E300 );
+       //=======================================================================
+       //
+       // [ 1 ] Newton step from the raw start rotated by the correction.
+       //
+       //=======================================================================
+          double p        = 0.0;
+          double sine     = 0.0;
+          double cosine   = 0.0;
+          bool   isHalley = false;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( !isAnchor )
+            {
+             //-----------------------------------------------------------------
+                p = sqrt( pSquared );
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                const double P  = p    * E.inverseEarthEquatorialRadius;
+                const double Z  = absZ * E.inverseEarthEquatorialRadius;
+                const double Zc = ec   * Z;
+             //-----------------------------------------------------------------
+             // The start ( sin lat0, cos lat0 ), scaled by rawLength.
+             //-----------------------------------------------------------------
+                const double rawSine     = Z;
+                const double rawCosine   = ec2 * P;
+                const double rawLength   = sqrt( ( rawSine   * rawSine   ) +
+                                                 ( rawCosine * rawCosine ) );
+                const double startSine   =
+                             ( rawSine   * rTrajectoryState.
+                                           anchorCosineCorrection ) +
+                             ( rawCosine * rTrajectoryState.
+                                           anchorSineCorrection );
+                const double startCosine =
+                             ( rawCosine * rTrajectoryState.
+                                           anchorCosineCorrection ) -
+                             ( rawSine   * rTrajectoryState.
+                                           anchorSineCorrection );
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                const double S        = startSine;
+                const double C        = startCosine * inverseEc;
+                const double SSquared = S * S;
+                const double CSquared = C * C;
+                const double A        = sqrt( SSquared + CSquared );
+                const double ACubed   = A * ( SSquared + CSquared );
+                const double D        = ( Zc * ACubed ) + ( e2 * S * SSquared );
+                const double F        = ( P  * ACubed ) - ( e2 * C * CSquared );
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                double S1    = D;
+                double Cc    = ec * F;
+                double scale = 1.0 / sqrt( ( S1 * S1 ) + ( Cc * Cc ) );
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                sine   = S1 * scale;
+                cosine = Cc * scale;
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                const double correction =
+                             fabs( ( sine   * startCosine ) -
+                                   ( cosine * startSine   ) ) / rawLength;
+             //=================================================================
+             //
+             // [ 2 ] Keep the Newton step, take the Halley step, or anchor.
+             //
+             //=================================================================
+                if( !( correction <= TRAJECTORY_HALLEY_STEP_LIMIT_RADIANS ) )
+                  {
+                     isAnchor = true;
+                  }
+                else
+                if( correction > TRAJECTORY_NEWTON_STEP_LIMIT_RADIANS )
+                  {
+                     const double B = oneAndHalfE2 * S * CSquared *
+                                      (
+                                        ( ( P * S ) - ( Zc * C ) ) * A -
+                                        ( e2 * S * C )
+                                      );
+                  //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                     S1       = ( D * F ) - ( B * S );
+                     Cc       = ec * ( ( F * F ) - ( B * C ) );
+                     scale    = 1.0 / sqrt( ( S1 * S1 ) + ( Cc * Cc ) );
+                     sine     = S1 * scale;
+                     cosine   = Cc * scale;
+                     isHalley = true;
+                  };
+             //-----------------------------------------------------------------
+            };
+       //=======================================================================
+       //
+       // [ 3 ] Latitude and altitude from the anchor.
+       //
+       //=======================================================================
+          const double sineLatitudeChange =
+                       ( sine   * rTrajectoryState.anchorCosineLatitude ) -
+                       ( cosine * rTrajectoryState.anchorSineAbsoluteLatitude );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if(
+              isAnchor
+              ||
+              !( fabs( sineLatitudeChange ) <=
+                 TRAJECTORY_ANCHOR_ANGLE_LIMIT_RADIANS )
+            )
+            {
+               pConversionStatus[ i ] =
+               convertEcefToGeodeticTrajectoryAnchor
+                      (
+                        E,
+                        x,
+                        y,
+                        pZEcefMeters[ i ],
+                        rTrajectoryState,
+                        pGeodeticNorthLatitudeRadians  [ i ],
+                        pGeocentricEastLongitudeRadians[ i ],
+                        pGeodeticAltitudeMeters        [ i ]
+                      );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               if(
+                   ( pConversionStatus[ i ] != SUCCESSFUL_CONVERSION )
+                   &&
+                   ( returnValue            == SUCCESSFUL_CONVERSION )
+                 )
+                 {
+                    returnValue = pConversionStatus[ i ];
+                 };
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               continue;
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          const double absoluteLatitude =
+                       rTrajectoryState.anchorAbsoluteLatitudeRadians +
+                       computeSmallAngleArcSine( sineLatitudeChange );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          pGeodeticNorthLatitudeRadians[ i ] =
+                       ( pZEcefMeters[ i ] < 0.0 ) ? -absoluteLatitude :
+                                                      absoluteLatitude;
+          pGeodeticAltitudeMeters      [ i ] =
+                       ( p * cosine ) + ( absZ * sine ) -
+                       E.earthEquatorialRadiusMeters *
+                       sqrt( 1.0 - ( e2 * sine * sine ) );
+       //=======================================================================
+       //
+       // [ 4 ] Longitude from the anchor.
+       //
+       //=======================================================================
+          const double anchorX = rTrajectoryState.anchorXEcefMeters;
+          const double anchorY = rTrajectoryState.anchorYEcefMeters;
+          const double pScale  = 1.0 / ( rTrajectoryState.
+                                         anchorPolarAxisDistanceMeters * p );
+          const double sineLongitudeChange   =
+                       ( ( anchorX * y ) - ( anchorY * x ) ) * pScale;
+          const double cosineLongitudeChange =
+                       ( ( anchorX * x ) + ( anchorY * y ) ) * pScale;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          double longitude;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if(
+              ( cosineLongitudeChange > 0.0 )
+              &&
+              ( fabs( sineLongitudeChange ) <=
+                TRAJECTORY_ANCHOR_ANGLE_LIMIT_RADIANS )
+            )
+            {
+               longitude = rTrajectoryState.anchorLongitudeRadians +
+                           computeSmallAngleArcSine( sineLongitudeChange );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               if( longitude >  piRadians )
+                 {
+                    longitude -= 2.0 * piRadians;
+                 }
+               else
+               if( longitude < -piRadians )
+                 {
+                    longitude += 2.0 * piRadians;
+                 };
+            }
+          else
+            {
+               longitude = atan2( y, x );
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          pGeocentricEastLongitudeRadians[ i ] = longitude;
+          pConversionStatus              [ i ] = SUCCESSFUL_CONVERSION;
+       //-----------------------------------------------------------------------
+          rTrajectoryState.pointsSinceAnchor++;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( isHalley )
+            {
+               rTrajectoryState.numberHalleyPoints++;
+            }
+          else
+            {
+               rTrajectoryState.numberNewtonPoints++;
+            };
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return( returnValue );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,286 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include "convertEcefToGeodeticForAccuracyTier.h"
+
+//------------------------------------------------------------------------------
+// The instruction set level of this CPU, detected once; the widest
+// supported kernel is used for every accuracy tier batch.
+//------------------------------------------------------------------------------
+static
+const
+ECEF_TO_GEODETIC_ISA_LEVEL
+ supportedIsaLevel = detectEcefToGeodeticIsaLevel( );
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         &rEllipsoidContext,
+            const ECEF_TO_GEODETIC_ACCURACY_TIER
+                          accuracyTier,
+            const double  xEcefMeters,
+            const double  yEcefMeters,
+            const double  zEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double &rEstimatedGeodeticNorthLatitudeRadians,
+                  double &rEstimatedGeocentricEastLongitudeRadians,
+                  double &rEstimatedGeodeticAltitudeMeters
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodetic  (accuracy tier overload)
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Convert Earth Centered Earth Fixed (ECEF) retangular coordinates to
+//    geodetic coordinates with the cheapest evaluation which meets the
+//    error bounds of the requested accuracy tier.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    Every tier starts from the Fukushima initial values of
+//    'convertEcefToGeodetic':
+//
+//       DISPLAY_ACCURACY_TIER  The Newton step, B = 0, and the display
+//                              polynomial atan2 for both angles.
+//
+//       SURVEY_ACCURACY_TIER   The Halley step and the survey polynomial
+//                              atan2 for both angles.
+//
+//       FULL_ACCURACY_TIER     The Halley step and the library atan2, by
+//                              the ellipsoid context 'convertEcefToGeodetic'.
+//
+//    The two library atan2 calls take most of the time of the full tier;
+//    the polynomial atan2 takes one division, and the Newton step saves
+//    the B term.
+//
+//    The error bounds of the tiers, the constants
+//    ..._ACCURACY_TIER_ANGLE_BOUND_RADIANS and
+//    ..._ACCURACY_TIER_ALTITUDE_BOUND_METERS, are the sum of the largest
+//    error of the iteration and the largest error of the atan2, rounded
+//    up, for altitudes from -10 km to 50000 km.  The angle bounds of
+//    1.5e-7 and 1.5e-10 radians are about 1 meter and 1 millimeter
+//    along the Earth's surface.
+//
+//------------------------------------------------------------------------------
+//
+//  INPUTS:
+//
+//     rEllipsoidContext
+//       Reference to an ellipsoid context for which
+//       'initializeEarthEllipsoidContext' returned SUCCESSFUL_CONVERSION.
+//
+//     accuracyTier
+//       DISPLAY_ACCURACY_TIER, SURVEY_ACCURACY_TIER or FULL_ACCURACY_TIER.
+//
+//     xEcefMeters
+//     yEcefMeters
+//     zEcefMeters
+//       Geocentric rectangular coordinates
+//       UNITS:  [meters]
+//
+//------------------------------------------------------------------------------
+//
+//  OUTPUT:
+//
+//     rEstimatedGeodeticNorthLatitudeRadians
+//     rEstimatedGeocentricEastLongitudeRadians
+//     rEstimatedGeodeticAltitudeMeters
+//       As for 'convertEcefToGeodetic'.
+//
+//------------------------------------------------------------------------------
+//
+//  RETURNED VALUE:
+//
+//     Conversion status:
+//        SUCCESSFUL_CONVERSION
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The bounds are checked by 'sweepAccuracyConvertEcefToGeodetic'
+//          with the tier as its last argument, and the longitude bounds
+//          by 'executeAccuracyTierTimingConvertEcefToGeodetic'.
+//
+//    [ 2 ] This file is compiled with '-O3 -fno-math-errno
+//          -fno-trapping-math' (see 'buildTestConvertEcefToGeodetic.sh'),
+//          so the batch loop of the display and survey tiers is
+//          vectorized.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    if( accuracyTier == DISPLAY_ACCURACY_TIER )
+      {
+          convertEcefToGeodeticForAccuracyTier< DISPLAY_ACCURACY_TIER >
+                 (
+                   rEllipsoidContext,
+                   xEcefMeters,
+                   yEcefMeters,
+                   zEcefMeters,
+                   rEstimatedGeodeticNorthLatitudeRadians,
+                   rEstimatedGeocentricEastLongitudeRadians,
+                   rEstimatedGeodeticAltitudeMeters
+                 );
+      }
+    else
+    if( accuracyTier == SURVEY_ACCURACY_TIER )
+      {
+          convertEcefToGeodeticForAccuracyTier< SURVEY_ACCURACY_TIER >
+                 (
+                   rEllipsoidContext,
+                   xEcefMeters,
+                   yEcefMeters,
+                   zEcefMeters,
+                   rEstimatedGeodeticNorthLatitudeRadians,
+                   rEstimatedGeocentricEastLongitudeRadians,
+                   rEstimatedGeodeticAltitudeMeters
+                 );
+      }
+    else
+      {
+          return( convertEcefToGeodetic
+                         (
+                           rEllipsoidContext,
+                           xEcefMeters,
+                           yEcefMeters,
+                           zEcefMeters,
+                           rEstimatedGeodeticNorthLatitudeRadians,
+                           rEstimatedGeocentricEastLongitudeRadians,
+                           rEstimatedGeodeticAltitudeMeters
+                         ) );
+      };
+ //-----------------------------------------------------------------------------
+    return( SUCCESSFUL_CONVERSION );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticBatch
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const ECEF_TO_GEODETIC_ACCURACY_TIER
+                           accuracyTier,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pEstimatedGeodeticNorthLatitudeRadians,
+                  double * pEstimatedGeocentricEastLongitudeRadians,
+                  double * pEstimatedGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticBatch  (accuracy tier overload)
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    As the ellipsoid context overload of 'convertEcefToGeodeticBatch',
+//    to the accuracy of the requested tier.  FULL_ACCURACY_TIER is the
+//    ellipsoid context batch itself.  The display and survey tiers use
+//    the kernels of 'convertEcefToGeodeticForAccuracyTier.h', compiled
+//    for the widest instruction set level the CPU supports.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    if( accuracyTier == FULL_ACCURACY_TIER )
+      {
+          convertEcefToGeodeticBatch
+                 (
+                   rEllipsoidContext,
+                   numberPoints,
+                   pXEcefMeters,
+                   pYEcefMeters,
+                   pZEcefMeters,
+                   pEstimatedGeodeticNorthLatitudeRadians,
+                   pEstimatedGeocentricEastLongitudeRadians,
+                   pEstimatedGeodeticAltitudeMeters,
+                   pConversionStatus
+                 );
+          return;
+      };
+ //-----------------------------------------------------------------------------
+    if( supportedIsaLevel == AVX512_ISA_LEVEL )
+      {
+          convertEcefToGeodeticBatchForAccuracyTierAvx512Kernel
+                 (
+                   rEllipsoidContext,
+                   accuracyTier,
+                   numberPoints,
+                   pXEcefMeters,
+                   pYEcefMeters,
+                   pZEcefMeters,
+                   pEstimatedGeodeticNorthLatitudeRadians,
+                   pEstimatedGeocentricEastLongitudeRadians,
+                   pEstimatedGeodeticAltitudeMeters,
+                   pConversionStatus
+                 );
+      }
+    else
+    if( supportedIsaLevel == AVX2_FMA_ISA_LEVEL )
+      {
+          convertEcefToGeodeticBatchForAccuracyTierAvx2Kernel
+                 (
+                   rEllipsoidContext,
+                   accuracyTier,
+                   numberPoints,
+                   pXEcefMeters,
+                   pYEcefMeters,
+                   pZEcefMeters,
+                   pEstimatedGeodeticNorthLatitudeRadians,
+                   pEstimatedGeocentricEastLongitudeRadians,
+                   pEstimatedGeodeticAltitudeMeters,
+                   pConversionStatus
+                 );
+      }
+    else
+      {
+          convertEcefToGeodeticBatchForAccuracyTierInChunks
+                 (
+                   rEllipsoidContext,
+                   accuracyTier,
+                   numberPoints,
+                   pXEcefMeters,
+                   pYEcefMeters,
+                   pZEcefMeters,
+                   pEstimatedGeodeticNorthLatitudeRadians,
+                   pEstimatedGeocentricEastLongitudeRadians,
+                   pEstimatedGeodeticAltitudeMeters,
+                   pConversionStatus
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,75 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include "convertEcefToGeodeticForAccuracyTier.h"
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticBatchForAccuracyTierAvx512Kernel
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const ECEF_TO_GEODETIC_ACCURACY_TIER
+                           accuracyTier,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pGeodeticNorthLatitudeRadians,
+                  double * pGeocentricEastLongitudeRadians,
+                  double * pGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticBatchForAccuracyTierAvx512Kernel
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Eight lane AVX-512 batch kernel of the accuracy tier overload of
+//    'convertEcefToGeodeticBatch', for the display and survey tiers.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] This file is compiled with '-mavx512f -mfma'.  It must only be
+//          called when 'detectEcefToGeodeticIsaLevel' reports at least
+//          AVX512_ISA_LEVEL.
+//
+//    [ 2 ] The kernels of 'convertEcefToGeodeticForAccuracyTier.h' are
+//          vectorized by the compiler for this instruction set; with FMA
+//          contractions the results may differ from those of the scalar
+//          accuracy tier 'convertEcefToGeodetic' in the last bits.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticBatchForAccuracyTierInChunks
+           (
+             rEllipsoidContext,
+             accuracyTier,
+             numberPoints,
+             pXEcefMeters,
+             pYEcefMeters,
+             pZEcefMeters,
+             pGeodeticNorthLatitudeRadians,
+             pGeocentricEastLongitudeRadians,
+             pGeodeticAltitudeMeters,
+             pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,236 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         &rEllipsoidContext,
+            const double  xEcefMeters,
+            const double  yEcefMeters,
+            const double  zEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double &rEstimatedGeodeticNorthLatitudeRadians,
+                  double &rEstimatedGeocentricEastLongitudeRadians,
+                  double &rEstimatedGeodeticAltitudeMeters
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodetic  (ellipsoid context overload)
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Convert Earth Centered Earth Fixed (ECEF) retangular coordinates to
+//    geodetic coordinates for the reference ellipsoid of an ellipsoid
+//    context built by 'initializeEarthEllipsoidContext'.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    The single Halley iteration of 'convertEcefToGeodetic', with every
+//    function of the ellipsoid parameters read from the context.  The
+//    arithmetic is otherwise identical, so for finite coordinates this
+//    function gives the results of 'convertEcefToGeodeticBaselineClone'
+//    to the last bit; the entry point 'convertEcefToGeodetic' of an FMA
+//    capable host differs from both in the last bits.
+//
+//------------------------------------------------------------------------------
+//
+//  INPUTS:
+//
+//     rEllipsoidContext
+//       Reference to an ellipsoid context for which
+//       'initializeEarthEllipsoidContext' returned SUCCESSFUL_CONVERSION.
+//
+//     xEcefMeters
+//     yEcefMeters
+//     zEcefMeters
+//       Geocentric rectangular coordinates
+//       UNITS:  [meters]
+//
+//------------------------------------------------------------------------------
+//
+//  OUTPUT:
+//
+//     rEstimatedGeodeticNorthLatitudeRadians
+//     rEstimatedGeocentricEastLongitudeRadians
+//     rEstimatedGeodeticAltitudeMeters
+//       As for 'convertEcefToGeodetic'.
+//
+//------------------------------------------------------------------------------
+//
+//  RETURNED VALUE:
+//
+//     Conversion status:
+//        SUCCESSFUL_CONVERSION
+//        INVALID_ECEF_COORDINATES  (a coordinate is not finite; the
+//                                   outputs are NaN, as for
+//                                   'convertEcefToGeodeticBatch')
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The ellipsoid parameters were validated when the context was
+//          built, so the only error branch is the test of the coordinates,
+//          and no messages are written.
+//
+//    [ 2 ] See 'convertEcefToGeodetic' for the authors and references.
+//
+//------------------------------------------------------------------------------
+//
+//  USAGE:
+//
+//    ecefToGeodeticConversionStatus =
+//    convertEcefToGeodetic
+//           (
+//             //-------------------
+//             // INPUT(s):
+//             //-------------------
+//                ellipsoidContext,
+//                xEcefMeters,
+//                yEcefMeters,
+//                zEcefMeters,
+//             //-------------------
+//             // OUTPUT(s):
+//             //-------------------
+//                estimatedGeodeticNorthLatitudeRadians,
+//                estimatedGeocentricEastLongitudeRadians,
+//                estimatedGeodeticAltitudeMeters
+//           );
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    if( !( isfinite( xEcefMeters ) &&
+           isfinite( yEcefMeters ) &&
+           isfinite( zEcefMeters ) ) )
+      {
+          rEstimatedGeodeticNorthLatitudeRadians   = NAN;
+          rEstimatedGeocentricEastLongitudeRadians = NAN;
+          rEstimatedGeodeticAltitudeMeters         = NAN;
+       //-----------------------------------------------------------------------
+          return( INVALID_ECEF_COORDINATES );
+      };
+ //-----------------------------------------------------------------------------
+    const double complimentaryEarthEllipticity =
+                            rEllipsoidContext.complimentaryEarthEllipticity;
+    const double earthEllipticitySquared       =
+                            rEllipsoidContext.earthEllipticitySquared;
+ //-----------------------------------------------------------------------------
+ // Distance from polar axis squared.
+ //-----------------------------------------------------------------------------
+    const double earthPolarAxisDistanceSquared =
+                                    ( xEcefMeters * xEcefMeters ) +
+                                    ( yEcefMeters * yEcefMeters );
+ //-----------------------------------------------------------------------------
+ // Determine Geocentric Longitude [radians].
+ //-----------------------------------------------------------------------------
+    rEstimatedGeocentricEastLongitudeRadians =
+                 ( earthPolarAxisDistanceSquared > 0.0 ) ?
+                                      atan2( yEcefMeters, xEcefMeters ) : 0.0;
+ //-----------------------------------------------------------------------------
+    const double absZ = fabs( zEcefMeters );
+ //-----------------------------------------------------------------------------
+    if( earthPolarAxisDistanceSquared > rEllipsoidContext.aEpsSquared )
+      {
+       //-----------------------------------------------------------------------
+       // Normal geodetic processing.
+       //-----------------------------------------------------------------------
+          const double earthPolarAxisDistanceMeters =
+                                    sqrt( earthPolarAxisDistanceSquared );
+       //-----------------------------------------------------------------------
+       // Equations (2), (17), (14), (12), (13), (15), (10), (11) and (21)
+       // of Reference [ 1 ] of 'convertEcefToGeodetic'.
+       //-----------------------------------------------------------------------
+          const double S0        = absZ /
+                                   rEllipsoidContext.earthEquatorialRadiusMeters;
+          const double Pn        = earthPolarAxisDistanceMeters /
+                                   rEllipsoidContext.earthEquatorialRadiusMeters;
+          const double zc        = complimentaryEarthEllipticity * S0;
+          const double C0        = complimentaryEarthEllipticity * Pn;
+          const double C0Squared = C0 * C0;
+          const double C0Cubed   = C0 * C0Squared;
+          const double S0Squared = S0 * S0;
+          const double S0Cubed   = S0 * S0Squared;
+          const double A0Squared = C0Squared + S0Squared;
+          const double A0        = sqrt( A0Squared );
+          const double A0Cubed   = A0 * A0Squared;
+          const double D0        = (  zc                      * A0Cubed ) +
+                                   (  earthEllipticitySquared * S0Cubed );
+          const double F0        = (  Pn                      * A0Cubed ) +
+                                   ( -earthEllipticitySquared * C0Cubed );
+          const double B0        = rEllipsoidContext.oneAndHalf_e4 *
+                                   S0Squared                       *
+                                   C0Squared                       *
+                                   Pn                              *
+                                   ( A0 - complimentaryEarthEllipticity );
+          const double S1        = ( D0 * F0 ) + ( -B0 * S0 );
+          const double C1        = ( F0 * F0 ) + ( -B0 * C0 );
+          const double Cc        = complimentaryEarthEllipticity * C1;
+       //-----------------------------------------------------------------------
+       // Equation (19) of Reference [ 1 ] of 'convertEcefToGeodetic'.
+       //-----------------------------------------------------------------------
+          rEstimatedGeodeticNorthLatitudeRadians = atan2( S1, Cc );
+       //-----------------------------------------------------------------------
+       // Equation (20) of Reference [ 1 ] of 'convertEcefToGeodetic'.
+       //-----------------------------------------------------------------------
+          const double S1Squared = S1 * S1;
+          const double CcSquared = Cc * Cc;
+          const double a1        = sqrt(
+                                      (
+                                        rEllipsoidContext.
+                                        complimentaryEarthEllipticitySquared *
+                                        S1Squared
+                                      )
+                                      +
+                                      CcSquared
+                                    );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          rEstimatedGeodeticAltitudeMeters =
+                 (
+                   (  earthPolarAxisDistanceMeters                  * Cc ) +
+                   (  absZ                                          * S1 ) +
+                   ( -rEllipsoidContext.earthEquatorialRadiusMeters * a1 )
+                 ) / sqrt( CcSquared + S1Squared );
+       //-----------------------------------------------------------------------
+      }
+    else
+      {
+       //-----------------------------------------------------------------------
+       // Exceptional processing for the polar axis vicinity.
+       //-----------------------------------------------------------------------
+          rEstimatedGeodeticNorthLatitudeRadians = 2.0 * atan( 1.0 );
+          rEstimatedGeodeticAltitudeMeters       =
+                                absZ - rEllipsoidContext.earthPolarRadiusMeters;
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    if( zEcefMeters < 0.0 )
+      {
+       //-----------------------------------------------------------------------
+       // Southern Hemisphere.
+       //-----------------------------------------------------------------------
+          rEstimatedGeodeticNorthLatitudeRadians =
+                                     -rEstimatedGeodeticNorthLatitudeRadians;
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return( SUCCESSFUL_CONVERSION );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,1216 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <float.h>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+static
+inline
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertEcefToGeodeticOlson
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         &rEllipsoidContext,
+            const double  xEcefMeters,
+            const double  yEcefMeters,
+            const double  zEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double &rEstimatedGeodeticNorthLatitudeRadians,
+                  double &rEstimatedGeodeticAltitudeMeters
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticOlson
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The latitude and altitude of OLSON_ENGINE.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    The series in e^2 of Reference [ 1 ] gives the sine of the latitude,
+//    or its cosine within 33 degrees of a pole, and one Newton step along
+//    the normal corrects the latitude and gives the altitude.  This is
+//    the algorithm of 'convertEcefToGeodeticOlsen.py'.
+//
+//------------------------------------------------------------------------------
+//
+//  REFERENCE(s):
+//
+//     [ 1 ]  "Converting Earth-Centered, Earth-Fixed Coordinates to
+//             Geodetic Coordinates",
+//            Olson, D. K.,
+//            IEEE Transactions on Aerospace and Electronic Systems,
+//            32 (1996)
+//            473-476.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const double a  = rEllipsoidContext.earthEquatorialRadiusMeters;
+    const double e2 = rEllipsoidContext.earthEllipticitySquared;
+ //-----------------------------------------------------------------------------
+ // The constants a1 to a6 of Reference [ 1 ].
+ //-----------------------------------------------------------------------------
+    const double a1 = a * e2;
+    const double a2 = a1 * a1;
+    const double a3 = 0.5 * a1 * e2;
+    const double a4 = 2.5 * a2;
+    const double a5 = a1 + a3;
+    const double a6 = rEllipsoidContext.complimentaryEarthEllipticitySquared;
+ //-----------------------------------------------------------------------------
+    const double absZ     = fabs( zEcefMeters );
+    const double wSquared = ( xEcefMeters * xEcefMeters ) +
+                            ( yEcefMeters * yEcefMeters );
+ //-----------------------------------------------------------------------------
+    if( !( wSquared > rEllipsoidContext.aEpsSquared ) )
+      {
+          rEstimatedGeodeticNorthLatitudeRadians = 2.0 * atan( 1.0 );
+          rEstimatedGeodeticAltitudeMeters       =
+                                absZ - rEllipsoidContext.earthPolarRadiusMeters;
+          return( SUCCESSFUL_CONVERSION );
+      };
+ //-----------------------------------------------------------------------------
+    const double w        = sqrt( wSquared );
+    const double rSquared = wSquared + ( zEcefMeters * zEcefMeters );
+    const double r        = sqrt( rSquared );
+    const double s2       = ( zEcefMeters * zEcefMeters ) / rSquared;
+    const double c2       = wSquared / rSquared;
+    const double u        = a2 / r;
+    const double v        = a3 - ( a4 / r );
+ //-----------------------------------------------------------------------------
+    double latitude;
+    double s;
+    double c;
+    double ss;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( c2 > 0.3 )
+      {
+          s        = ( absZ / r ) *
+                     ( 1.0 + ( c2 * ( a1 + u + ( s2 * v ) ) / r ) );
+          latitude = asin( s );
+          ss       = s * s;
+          c        = sqrt( 1.0 - ss );
+      }
+    else
+      {
+          c        = ( w / r ) *
+                     ( 1.0 - ( s2 * ( a5 - u - ( c2 * v ) ) / r ) );
+          latitude = acos( c );
+          ss       = 1.0 - ( c * c );
+          s        = sqrt( ss );
+      };
+ //-----------------------------------------------------------------------------
+ // The Newton step along the normal.
+ //-----------------------------------------------------------------------------
+    const double g  = 1.0 - ( e2 * ss );
+    const double rg = a / sqrt( g );
+    const double rf = a6 * rg;
+    const double du = w    - ( rg * c );
+    const double dv = absZ - ( rf * s );
+    const double f  = ( c * du ) + ( s * dv );
+    const double m  = ( c * dv ) - ( s * du );
+    const double p  = m / ( ( rf / g ) + f );
+ //-----------------------------------------------------------------------------
+    rEstimatedGeodeticNorthLatitudeRadians = latitude + p;
+    rEstimatedGeodeticAltitudeMeters       = f + ( 0.5 * m * p );
+ //-----------------------------------------------------------------------------
+    return( SUCCESSFUL_CONVERSION );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+template< int NUMBER_ITERATIONS >
+static
+inline
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertEcefToGeodeticBowring
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         &rEllipsoidContext,
+            const double  xEcefMeters,
+            const double  yEcefMeters,
+            const double  zEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double &rEstimatedGeodeticNorthLatitudeRadians,
+                  double &rEstimatedGeodeticAltitudeMeters
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticBowring
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The latitude and altitude of BOWRING_ONE_ENGINE, for one iteration,
+//    and of BOWRING_TWO_ENGINE, for two.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    Starting from the reduced latitude u with tan( u ) = a z / ( b p ),
+//    each iteration of Reference [ 1 ] evaluates
+//
+//       tan( phi ) = ( z + e'^2 b sin^3( u ) ) / ( p - e^2 a cos^3( u ) )
+//
+//    and the next iteration takes tan( u ) = ( b / a ) tan( phi ).  The
+//    sines and cosines are carried as normalized pairs, so only the final
+//    latitude needs an arctangent.  The altitude is the well conditioned
+//    form of Reference [ 2 ],
+//
+//       h = p cos( phi ) + z sin( phi ) - a sqrt( 1 - e^2 sin^2( phi ) ).
+//
+//------------------------------------------------------------------------------
+//
+//  REFERENCE(s):
+//
+//     [ 1 ]  "Transformation from spatial to geographical coordinates",
+//            Bowring, B. R.,
+//            Survey Review,
+//            23 (1976)
+//            323-327.
+//
+//     [ 2 ]  "The accuracy of geodetic latitude and height equations",
+//            Bowring, B. R.,
+//            Survey Review,
+//            28 (1985)
+//            202-206.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const double a  = rEllipsoidContext.earthEquatorialRadiusMeters;
+    const double b  = rEllipsoidContext.earthPolarRadiusMeters;
+    const double e2 = rEllipsoidContext.earthEllipticitySquared;
+    const double ec = rEllipsoidContext.complimentaryEarthEllipticity;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const double eb = ( e2 /
+                        rEllipsoidContext.complimentaryEarthEllipticitySquared )
+                      * b;
+    const double ea = e2 * a;
+ //-----------------------------------------------------------------------------
+    const double absZ     = fabs( zEcefMeters );
+    const double pSquared = ( xEcefMeters * xEcefMeters ) +
+                            ( yEcefMeters * yEcefMeters );
+ //-----------------------------------------------------------------------------
+    if( !( pSquared > rEllipsoidContext.aEpsSquared ) )
+      {
+          rEstimatedGeodeticNorthLatitudeRadians = 2.0 * atan( 1.0 );
+          rEstimatedGeodeticAltitudeMeters       = absZ - b;
+          return( SUCCESSFUL_CONVERSION );
+      };
+ //-----------------------------------------------------------------------------
+    const double p = sqrt( pSquared );
+ //-----------------------------------------------------------------------------
+ // The reduced latitude, tan( u ) = z / ( ec p ).
+ //-----------------------------------------------------------------------------
+    double sineU      = absZ;
+    double cosineU    = ec * p;
+    double inverseU   = 1.0 / sqrt( ( sineU * sineU ) + ( cosineU * cosineU ) );
+    double numerator;
+    double denominator;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    sineU   *= inverseU;
+    cosineU *= inverseU;
+ //-----------------------------------------------------------------------------
+    for( int iteration = 0; ; iteration++ )
+      {
+       //-----------------------------------------------------------------------
+          numerator   = absZ + ( eb * sineU   * sineU   * sineU   );
+          denominator = p    - ( ea * cosineU * cosineU * cosineU );
+       //-----------------------------------------------------------------------
+          if( iteration + 1 == NUMBER_ITERATIONS )
+            {
+                break;
+            };
+       //-----------------------------------------------------------------------
+          sineU    = ec * numerator;
+          cosineU  = denominator;
+          inverseU = 1.0 / sqrt( ( sineU * sineU ) + ( cosineU * cosineU ) );
+          sineU   *= inverseU;
+          cosineU *= inverseU;
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    const double inverseLength = 1.0 / sqrt( ( numerator   * numerator   ) +
+                                             ( denominator * denominator ) );
+    const double sineLatitude   = numerator   * inverseLength;
+    const double cosineLatitude = denominator * inverseLength;
+ //-----------------------------------------------------------------------------
+    rEstimatedGeodeticNorthLatitudeRadians = atan2( numerator, denominator );
+    rEstimatedGeodeticAltitudeMeters       =
+           ( p * cosineLatitude ) + ( absZ * sineLatitude ) -
+           ( a * sqrt( 1.0 - ( e2 * sineLatitude * sineLatitude ) ) );
+ //-----------------------------------------------------------------------------
+    return( SUCCESSFUL_CONVERSION );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+static
+inline
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertEcefToGeodeticVermeille
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         &rEllipsoidContext,
+            const double  xEcefMeters,
+            const double  yEcefMeters,
+            const double  zEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double &rEstimatedGeodeticNorthLatitudeRadians,
+                  double &rEstimatedGeodeticAltitudeMeters
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticVermeille
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The latitude and altitude of VERMEILLE_ENGINE.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    The closed form of Reference [ 1 ], which solves the quartic of the
+//    foot point with one cube root and four square roots:
+//
+//       p = ( x^2 + y^2 ) / a^2           q = ( 1 - e^2 ) z^2 / a^2
+//       r = ( p + q - e^4 ) / 6           s = e^4 p q / ( 4 r^3 )
+//       t = cbrt( 1 + s + sqrt( s ( 2 + s ) ) )
+//       u = r ( 1 + t + 1 / t )           v = sqrt( u^2 + e^4 q )
+//       w = e^2 ( u + v - q ) / ( 2 v )   k = sqrt( u + v + w^2 ) - w
+//       D = k sqrt( x^2 + y^2 ) / ( k + e^2 )
+//
+//       phi = 2 atan( z / ( D + sqrt( D^2 + z^2 ) ) )
+//       h   = ( k + e^2 - 1 ) / k sqrt( D^2 + z^2 )
+//
+//    The point must be outside the region of 'isInsideEngineEvolute',
+//    where r is positive.
+//
+//------------------------------------------------------------------------------
+//
+//  REFERENCE(s):
+//
+//     [ 1 ]  "Direct transformation from geocentric coordinates to
+//             geodetic coordinates",
+//            Vermeille, H.,
+//            Journal of Geodesy,
+//            76 (2002)
+//            451-454.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const double inverseA = rEllipsoidContext.inverseEarthEquatorialRadius;
+    const double e2       = rEllipsoidContext.earthEllipticitySquared;
+    const double e4       = e2 * e2;
+ //-----------------------------------------------------------------------------
+    const double xScaled        = xEcefMeters * inverseA;
+    const double yScaled        = yEcefMeters * inverseA;
+    const double zScaled        = zEcefMeters * inverseA;
+    const double pSquaredScaled = ( xScaled * xScaled ) +
+                                  ( yScaled * yScaled );
+ //-----------------------------------------------------------------------------
+    const double p = pSquaredScaled;
+    const double q = rEllipsoidContext.complimentaryEarthEllipticitySquared *
+                     zScaled * zScaled;
+    const double r = ( p + q - e4 ) / 6.0;
+ //-----------------------------------------------------------------------------
+    const double s = ( e4 * p * q ) / ( 4.0 * r * r * r );
+    const double t = cbrt( 1.0 + s + sqrt( s * ( 2.0 + s ) ) );
+    const double u = r * ( 1.0 + t + ( 1.0 / t ) );
+    const double v = sqrt( ( u * u ) + ( e4 * q ) );
+    const double w = e2 * ( u + v - q ) / ( 2.0 * v );
+    const double k = sqrt( u + v + ( w * w ) ) - w;
+    const double D = k * sqrt( pSquaredScaled ) / ( k + e2 );
+ //-----------------------------------------------------------------------------
+    const double distance = sqrt( ( D * D ) + ( zScaled * zScaled ) );
+ //-----------------------------------------------------------------------------
+    rEstimatedGeodeticNorthLatitudeRadians =
+                   2.0 * atan( fabs( zScaled ) / ( D + distance ) );
+    rEstimatedGeodeticAltitudeMeters       =
+                   ( ( k + e2 - 1.0 ) / k ) * distance *
+                   rEllipsoidContext.earthEquatorialRadiusMeters;
+ //-----------------------------------------------------------------------------
+    return( SUCCESSFUL_CONVERSION );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+static
+inline
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertEcefToGeodeticHeikkinen
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         &rEllipsoidContext,
+            const double  xEcefMeters,
+            const double  yEcefMeters,
+            const double  zEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double &rEstimatedGeodeticNorthLatitudeRadians,
+                  double &rEstimatedGeodeticAltitudeMeters
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticHeikkinen
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The latitude and altitude of HEIKKINEN_ENGINE.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    The closed form of Reference [ 1 ], as given in Reference [ 2 ]:
+//
+//       F  = 54 b^2 z^2
+//       G  = p^2 + ( 1 - e^2 ) z^2 - e^2 ( a^2 - b^2 )
+//       c  = e^4 F p^2 / G^3
+//       s  = cbrt( 1 + c + sqrt( c^2 + 2 c ) )
+//       P  = F / ( 3 ( s + 1 / s + 1 )^2 G^2 )
+//       Q  = sqrt( 1 + 2 e^4 P )
+//       r0 = -P e^2 p / ( 1 + Q )
+//            + sqrt( a^2 ( 1 + 1 / Q ) / 2
+//                    - P ( 1 - e^2 ) z^2 / ( Q ( 1 + Q ) ) - P p^2 / 2 )
+//       U  = sqrt( ( p - e^2 r0 )^2 + z^2 )
+//       V  = sqrt( ( p - e^2 r0 )^2 + ( 1 - e^2 ) z^2 )
+//       z0 = b^2 z / ( a V )
+//
+//       phi = atan2( z + e'^2 z0, p )
+//       h   = U ( 1 - b^2 / ( a V ) )
+//
+//    The lengths are scaled by 1 / a, so that the powers of G stay far
+//    from overflow.  The point must be outside the region of
+//    'isInsideEngineEvolute', where G is positive.  The radicand of r0,
+//    which rounding can make slightly negative near the poles, is
+//    clamped at zero.
+//
+//------------------------------------------------------------------------------
+//
+//  REFERENCE(s):
+//
+//     [ 1 ]  "Geschlossene Formeln zur Berechnung raeumlicher geodaetischer
+//             Koordinaten aus rechtwinkligen Koordinaten",
+//            Heikkinen, M.,
+//            Zeitschrift fuer Vermessungswesen,
+//            107 (1982)
+//            207-211.
+//
+//     [ 2 ]  "Conversion of Earth-centered Earth-fixed coordinates to
+//             geodetic coordinates",
+//            Zhu, J.,
+//            IEEE Transactions on Aerospace and Electronic Systems,
+//            30 (1994)
+//            957-961.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const double inverseA = rEllipsoidContext.inverseEarthEquatorialRadius;
+    const double e2       = rEllipsoidContext.earthEllipticitySquared;
+    const double e4       = e2 * e2;
+    const double ec2      =
+                       rEllipsoidContext.complimentaryEarthEllipticitySquared;
+ //-----------------------------------------------------------------------------
+ // Lengths in units of a, so a = 1 and b^2 = 1 - e^2.
+ //-----------------------------------------------------------------------------
+    const double xScaled  = xEcefMeters * inverseA;
+    const double yScaled  = yEcefMeters * inverseA;
+    const double z        = fabs( zEcefMeters ) * inverseA;
+    const double zSquared = z * z;
+    const double pSquared = ( xScaled * xScaled ) + ( yScaled * yScaled );
+    const double p        = sqrt( pSquared );
+ //-----------------------------------------------------------------------------
+    const double F = 54.0 * ec2 * zSquared;
+    const double G = pSquared + ( ec2 * zSquared ) - e4;
+ //-----------------------------------------------------------------------------
+    const double c      = e4 * F * pSquared / ( G * G * G );
+    const double s      = cbrt( 1.0 + c + sqrt( ( c * c ) + ( 2.0 * c ) ) );
+    const double sTerm  = s + ( 1.0 / s ) + 1.0;
+    const double P      = F / ( 3.0 * sTerm * sTerm * G * G );
+    const double Q      = sqrt( 1.0 + ( 2.0 * e4 * P ) );
+    const double radicand = ( 0.5 * ( 1.0 + ( 1.0 / Q ) ) )
+                          - ( P * ec2 * zSquared / ( Q * ( 1.0 + Q ) ) )
+                          - ( 0.5 * P * pSquared );
+    const double r0     = ( -P * e2 * p / ( 1.0 + Q ) )
+                        + sqrt( ( radicand > 0.0 ) ? radicand : 0.0 );
+    const double pFoot  = p - ( e2 * r0 );
+    const double U      = sqrt( ( pFoot * pFoot ) + zSquared );
+    const double V      = sqrt( ( pFoot * pFoot ) + ( ec2 * zSquared ) );
+    const double z0     = ec2 * z / V;
+ //-----------------------------------------------------------------------------
+    rEstimatedGeodeticNorthLatitudeRadians =
+                   atan2( z + ( ( e2 / ec2 ) * z0 ), p );
+    rEstimatedGeodeticAltitudeMeters       =
+                   U * ( 1.0 - ( ec2 / V ) ) *
+                   rEllipsoidContext.earthEquatorialRadiusMeters;
+ //-----------------------------------------------------------------------------
+    return( SUCCESSFUL_CONVERSION );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+static
+inline
+bool
+isInsideEngineEvolute
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         &rEllipsoidContext,
+            const double  xEcefMeters,
+            const double  yEcefMeters,
+            const double  zEcefMeters
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    isInsideEngineEvolute
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Whether a point is in the ellipse
+//
+//       ( x^2 + y^2 ) + ( 1 - e^2 ) z^2 <= ( a e^2 )^2,
+//
+//    reaching about 43 km from the center, around the evolute of the
+//    meridian ellipse.  A point there may have several normals to the
+//    ellipsoid: the cube roots of the closed forms are not defined, the
+//    series of Olson leaves the domain of its arcsine and Bowring may
+//    converge to a foot point across the axis.  The test also holds for
+//    NaN coordinates.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const double ae2 = rEllipsoidContext.earthEquatorialRadiusMeters *
+                       rEllipsoidContext.earthEllipticitySquared;
+ //-----------------------------------------------------------------------------
+    return( !( ( ( xEcefMeters * xEcefMeters ) +
+                 ( yEcefMeters * yEcefMeters ) +
+                 ( rEllipsoidContext.complimentaryEarthEllipticitySquared *
+                   zEcefMeters * zEcefMeters ) ) > ( ae2 * ae2 ) ) );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+template< ECEF_TO_GEODETIC_ENGINE ENGINE >
+static
+inline
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertEcefToGeodeticForEngine
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         &rEllipsoidContext,
+            const double  xEcefMeters,
+            const double  yEcefMeters,
+            const double  zEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double &rEstimatedGeodeticNorthLatitudeRadians,
+                  double &rEstimatedGeocentricEastLongitudeRadians,
+                  double &rEstimatedGeodeticAltitudeMeters
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticForEngine
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The conversion of one point with the engine ENGINE, other than
+//    FUKUSHIMA_HALLEY_ENGINE.  The engines work in the northern
+//    hemisphere, with | z |; the longitude and the sign of the latitude
+//    are those of the ellipsoid context 'convertEcefToGeodetic'.  A
+//    coordinate which is not finite is INVALID_ECEF_COORDINATES, as for
+//    the iterative engines.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    ECEF_TO_GEODETIC_CONVERSION_STATUS
+     conversionStatus;
+    double
+     latitude;
+ //-----------------------------------------------------------------------------
+    if( !( isfinite( xEcefMeters ) &&
+           isfinite( yEcefMeters ) &&
+           isfinite( zEcefMeters ) ) )
+      {
+          rEstimatedGeodeticNorthLatitudeRadians   = NAN;
+          rEstimatedGeocentricEastLongitudeRadians = NAN;
+          rEstimatedGeodeticAltitudeMeters         = NAN;
+       //-----------------------------------------------------------------------
+          return( INVALID_ECEF_COORDINATES );
+      };
+ //-----------------------------------------------------------------------------
+    if( isInsideEngineEvolute( rEllipsoidContext,
+                               xEcefMeters,
+                               yEcefMeters,
+                               zEcefMeters ) )
+      {
+          conversionStatus                 = INVALID_ECEF_COORDINATES;
+          latitude                         = NAN;
+          rEstimatedGeodeticAltitudeMeters = NAN;
+      }
+    else
+    if( ENGINE == OLSON_ENGINE )
+      {
+          conversionStatus = convertEcefToGeodeticOlson
+                                    (
+                                      rEllipsoidContext,
+                                      xEcefMeters,
+                                      yEcefMeters,
+                                      zEcefMeters,
+                                      latitude,
+                                      rEstimatedGeodeticAltitudeMeters
+                                    );
+      }
+    else
+    if( ENGINE == BOWRING_ONE_ENGINE )
+      {
+          conversionStatus = convertEcefToGeodeticBowring< 1 >
+                                    (
+                                      rEllipsoidContext,
+                                      xEcefMeters,
+                                      yEcefMeters,
+                                      zEcefMeters,
+                                      latitude,
+                                      rEstimatedGeodeticAltitudeMeters
+                                    );
+      }
+    else
+    if( ENGINE == BOWRING_TWO_ENGINE )
+      {
+          conversionStatus = convertEcefToGeodeticBowring< 2 >
+                                    (
+                                      rEllipsoidContext,
+                                      xEcefMeters,
+                                      yEcefMeters,
+                                      zEcefMeters,
+                                      latitude,
+                                      rEstimatedGeodeticAltitudeMeters
+                                    );
+      }
+    else
+    if( ENGINE == VERMEILLE_ENGINE )
+      {
+          conversionStatus = convertEcefToGeodeticVermeille
+                                    (
+                                      rEllipsoidContext,
+                                      xEcefMeters,
+                                      yEcefMeters,
+                                      zEcefMeters,
+                                      latitude,
+                                      rEstimatedGeodeticAltitudeMeters
+                                    );
+      }
+    else
+      {
+          conversionStatus = convertEcefToGeodeticHeikkinen
+                                    (
+                                      rEllipsoidContext,
+                                      xEcefMeters,
+                                      yEcefMeters,
+                                      zEcefMeters,
+                                      latitude,
+                                      rEstimatedGeodeticAltitudeMeters
+                                    );
+      };
+ //-----------------------------------------------------------------------------
+    const double earthPolarAxisDistanceSquared =
+                                    ( xEcefMeters * xEcefMeters ) +
+                                    ( yEcefMeters * yEcefMeters );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    rEstimatedGeocentricEastLongitudeRadians =
+                 ( earthPolarAxisDistanceSquared > 0.0 ) ?
+                                      atan2( yEcefMeters, xEcefMeters ) : 0.0;
+ //-----------------------------------------------------------------------------
+    rEstimatedGeodeticNorthLatitudeRadians =
+                 ( zEcefMeters < 0.0 ) ? -latitude : latitude;
+ //-----------------------------------------------------------------------------
+    return( conversionStatus );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+template< ECEF_TO_GEODETIC_ENGINE ENGINE >
+static
+void
+convertEcefToGeodeticBatchForEngine
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pEstimatedGeodeticNorthLatitudeRadians,
+                  double * pEstimatedGeocentricEastLongitudeRadians,
+                  double * pEstimatedGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticBatchForEngine
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The batch loop of the engine ENGINE, other than
+//    FUKUSHIMA_HALLEY_ENGINE, with the engine inlined.  The context is
+//    copied to a local, so that the stores to the outputs, which could
+//    alias it, do not force its members to be reloaded for every point.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const EARTH_ELLIPSOID_CONTEXT context = rEllipsoidContext;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < numberPoints; i++ )
+      {
+          pConversionStatus[ i ] =
+                 convertEcefToGeodeticForEngine< ENGINE >
+                        (
+                          context,
+                          pXEcefMeters[ i ],
+                          pYEcefMeters[ i ],
+                          pZEcefMeters[ i ],
+                          pEstimatedGeodeticNorthLatitudeRadians  [ i ],
+                          pEstimatedGeocentricEastLongitudeRadians[ i ],
+                          pEstimatedGeodeticAltitudeMeters        [ i ]
+                        );
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         &rEllipsoidContext,
+            const ECEF_TO_GEODETIC_ENGINE
+                          conversionEngine,
+            const double  xEcefMeters,
+            const double  yEcefMeters,
+            const double  zEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double &rEstimatedGeodeticNorthLatitudeRadians,
+                  double &rEstimatedGeocentricEastLongitudeRadians,
+                  double &rEstimatedGeodeticAltitudeMeters
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodetic  (engine overload)
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Convert Earth Centered Earth Fixed (ECEF) retangular coordinates to
+//    geodetic coordinates with the requested conversion engine, so that
+//    the engines can be compared, in time and in error, on the same
+//    points and through the same interface.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//       FUKUSHIMA_HALLEY_ENGINE  The ellipsoid context 'convertEcefToGeodetic'.
+//       OLSON_ENGINE             'convertEcefToGeodeticOlson'.
+//       BOWRING_ONE_ENGINE       'convertEcefToGeodeticBowring', once.
+//       BOWRING_TWO_ENGINE       'convertEcefToGeodeticBowring', twice.
+//       VERMEILLE_ENGINE         'convertEcefToGeodeticVermeille'.
+//       HEIKKINEN_ENGINE         'convertEcefToGeodeticHeikkinen'.
+//       FUKUSHIMA_NEWTON_ENGINE  'convertEcefToGeodeticIterated', with
+//       ITERATED_HALLEY_ENGINE   ITERATED_ENGINE_DEFAULT_MAXIMUM_ITERATIONS
+//                                and the report discarded.
+//
+//------------------------------------------------------------------------------
+//
+//  INPUTS:
+//
+//     rEllipsoidContext
+//       Reference to an ellipsoid context for which
+//       'initializeEarthEllipsoidContext' returned SUCCESSFUL_CONVERSION.
+//
+//     conversionEngine
+//       One of the ECEF_TO_GEODETIC_ENGINE values.
+//
+//     xEcefMeters
+//     yEcefMeters
+//     zEcefMeters
+//       Geocentric rectangular coordinates
+//       UNITS:  [meters]
+//
+//------------------------------------------------------------------------------
+//
+//  OUTPUT:
+//
+//     rEstimatedGeodeticNorthLatitudeRadians
+//     rEstimatedGeocentricEastLongitudeRadians
+//     rEstimatedGeodeticAltitudeMeters
+//       As for 'convertEcefToGeodetic'.
+//
+//------------------------------------------------------------------------------
+//
+//  RETURNED VALUE:
+//
+//     Conversion status:
+//        SUCCESSFUL_CONVERSION
+//        INVALID_ECEF_COORDINATES  A closed form engine or an engine of
+//                                  one or two fixed steps, other than
+//                                  FUKUSHIMA_HALLEY_ENGINE, for a point
+//                                  within about 43 km of the center, see
+//                                  'isInsideEngineEvolute'.  The latitude
+//                                  and altitude are NaN.  Every engine,
+//                                  for a coordinate which is not finite,
+//                                  with NaN outputs.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The errors of every engine, by region of latitude and
+//          altitude, are measured by
+//          'executeEngineTimingConvertEcefToGeodetic', and by
+//          'sweepAccuracyConvertEcefToGeodetic' with the engine keyword
+//          as its last argument.
+//
+//    [ 2 ] This file is compiled with '-O3 -fno-math-errno
+//          -fno-trapping-math' (see 'buildTestConvertEcefToGeodetic.sh').
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    switch( conversionEngine )
+      {
+       //-----------------------------------------------------------------------
+          case OLSON_ENGINE:
+            {
+                return( convertEcefToGeodeticForEngine< OLSON_ENGINE >
+                               (
+                                 rEllipsoidContext,
+                                 xEcefMeters,
+                                 yEcefMeters,
+                                 zEcefMeters,
+                                 rEstimatedGeodeticNorthLatitudeRadians,
+                                 rEstimatedGeocentricEastLongitudeRadians,
+                                 rEstimatedGeodeticAltitudeMeters
+                               ) );
+            };
+       //-----------------------------------------------------------------------
+          case BOWRING_ONE_ENGINE:
+            {
+                return( convertEcefToGeodeticForEngine< BOWRING_ONE_ENGINE >
+                               (
+                                 rEllipsoidContext,
+                                 xEcefMeters,
+                                 yEcefMeters,
+                                 zEcefMeters,
+                                 rEstimatedGeodeticNorthLatitudeRadians,
+                                 rEstimatedGeocentricEastLongitudeRadians,
+                                 rEstimatedGeodeticAltitudeMeters
+                               ) );
+            };
+       //-----------------------------------------------------------------------
+          case BOWRING_TWO_ENGINE:
+            {
+                return( convertEcefToGeodeticForEngine< BOWRING_TWO_ENGINE >
+                               (
+                                 rEllipsoidContext,
+                                 xEcefMeters,
+                                 yEcefMeters,
+                                 zEcefMeters,
+                                 rEstimatedGeodeticNorthLatitudeRadians,
+                                 rEstimatedGeocentricEastLongitudeRadians,
+                                 rEstimatedGeodeticAltitudeMeters
+                               ) );
+            };
+       //-----------------------------------------------------------------------
+          case VERMEILLE_ENGINE:
+            {
+                return( convertEcefToGeodeticForEngine< VERMEILLE_ENGINE >
+                               (
+                                 rEllipsoidContext,
+                                 xEcefMeters,
+                                 yEcefMeters,
+                                 zEcefMeters,
+                                 rEstimatedGeodeticNorthLatitudeRadians,
+                                 rEstimatedGeocentricEastLongitudeRadians,
+                                 rEstimatedGeodeticAltitudeMeters
+                               ) );
+            };
+       //-----------------------------------------------------------------------
+          case HEIKKINEN_ENGINE:
+            {
+                return( convertEcefToGeodeticForEngine< HEIKKINEN_ENGINE >
+                               (
+                                 rEllipsoidContext,
+                                 xEcefMeters,
+                                 yEcefMeters,
+                                 zEcefMeters,
+                                 rEstimatedGeodeticNorthLatitudeRadians,
+                                 rEstimatedGeocentricEastLongitudeRadians,
+                                 rEstimatedGeodeticAltitudeMeters
+                               ) );
+            };
+       //-----------------------------------------------------------------------
+          case FUKUSHIMA_NEWTON_ENGINE:
+          case ITERATED_HALLEY_ENGINE:
+            {
+                ECEF_TO_GEODETIC_CONVERGENCE_REPORT
+                 convergenceReport;
+             //-----------------------------------------------------------------
+                return( convertEcefToGeodeticIterated
+                               (
+                                 rEllipsoidContext,
+                                 conversionEngine,
+                                 ITERATED_ENGINE_DEFAULT_MAXIMUM_ITERATIONS,
+                                 xEcefMeters,
+                                 yEcefMeters,
+                                 zEcefMeters,
+                                 rEstimatedGeodeticNorthLatitudeRadians,
+                                 rEstimatedGeocentricEastLongitudeRadians,
+                                 rEstimatedGeodeticAltitudeMeters,
+                                 convergenceReport
+                               ) );
+            };
+       //-----------------------------------------------------------------------
+          default:
+            {
+                return( convertEcefToGeodetic
+                               (
+                                 rEllipsoidContext,
+                                 xEcefMeters,
+                                 yEcefMeters,
+                                 zEcefMeters,
+                                 rEstimatedGeodeticNorthLatitudeRadians,
+                                 rEstimatedGeocentricEastLongitudeRadians,
+                                 rEstimatedGeodeticAltitudeMeters
+                               ) );
+            };
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+convertEcefToGeodeticBatch
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const ECEF_TO_GEODETIC_ENGINE
+                           conversionEngine,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pEstimatedGeodeticNorthLatitudeRadians,
+                  double * pEstimatedGeocentricEastLongitudeRadians,
+                  double * pEstimatedGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertEcefToGeodeticBatch  (engine overload)
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    As the ellipsoid context overload of 'convertEcefToGeodeticBatch',
+//    with the requested conversion engine.  FUKUSHIMA_HALLEY_ENGINE is
+//    the ellipsoid context batch itself, with its SIMD kernels; the
+//    other engines run a scalar loop with the engine inlined, since
+//    their library arcsine, arccosine and cube root calls keep the loops
+//    from being vectorized.  The iterative engines are
+//    'convertEcefToGeodeticIteratedBatch', with
+//    ITERATED_ENGINE_DEFAULT_MAXIMUM_ITERATIONS and no reports.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    void
+     ( *pConvertBatch )( const EARTH_ELLIPSOID_CONTEXT &,
+                         const size_t,
+                         const double *,
+                         const double *,
+                         const double *,
+                         double *,
+                         double *,
+                         double *,
+                         ECEF_TO_GEODETIC_CONVERSION_STATUS * ) = NULL;
+ //-----------------------------------------------------------------------------
+    switch( conversionEngine )
+      {
+          case OLSON_ENGINE:
+            pConvertBatch =
+                 convertEcefToGeodeticBatchForEngine< OLSON_ENGINE >;
+            break;
+          case BOWRING_ONE_ENGINE:
+            pConvertBatch =
+                 convertEcefToGeodeticBatchForEngine< BOWRING_ONE_ENGINE >;
+            break;
+          case BOWRING_TWO_ENGINE:
+            pConvertBatch =
+                 convertEcefToGeodeticBatchForEngine< BOWRING_TWO_ENGINE >;
+            break;
+          case VERMEILLE_ENGINE:
+            pConvertBatch =
+                 convertEcefToGeodeticBatchForEngine< VERMEILLE_ENGINE >;
+            break;
+          case HEIKKINEN_ENGINE:
+            pConvertBatch =
+                 convertEcefToGeodeticBatchForEngine< HEIKKINEN_ENGINE >;
+            break;
+          case FUKUSHIMA_NEWTON_ENGINE:
+          case ITERATED_HALLEY_ENGINE:
+            convertEcefToGeodeticIteratedBatch
+                   (
+                     rEllipsoidContext,
+                     conversionEngine,
+                     ITERATED_ENGINE_DEFAULT_MAXIMUM_ITERATIONS,
+                     numberPoints,
+                     pXEcefMeters,
+                     pYEcefMeters,
+                     pZEcefMeters,
+                     pEstimatedGeodeticNorthLatitudeRadians,
+                     pEstimatedGeocentricEastLongitudeRadians,
+                     pEstimatedGeodeticAltitudeMeters,
+                     pConversionStatus,
+                     NULL
+                   );
+            return;
+          default:
+            break;
+      };
+ //-----------------------------------------------------------------------------
+    if( pConvertBatch == NULL )
+      {
+          convertEcefToGeodeticBatch
+                 (
+                   rEllipsoidContext,
+                   numberPoints,
+                   pXEcefMeters,
+                   pYEcefMeters,
+                   pZEcefMeters,
+                   pEstimatedGeodeticNorthLatitudeRadians,
+                   pEstimatedGeocentricEastLongitudeRadians,
+                   pEstimatedGeodeticAltitudeMeters,
+                   pConversionStatus
+                 );
+      }
+    else
+      {
+          pConvertBatch
+                 (
+                   rEllipsoidContext,
+                   numberPoints,
+                   pXEcefMeters,
+                   pYEcefMeters,
+                   pZEcefMeters,
+                   pEstimatedGeodeticNorthLatitudeRadians,
+                   pEstimatedGeocentricEastLongitudeRadians,
+                   pEstimatedGeodeticAltitudeMeters,
+                   pConversionStatus
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// The engine batches with the signature of an ECEF_TO_GEODETIC_BATCH_FUNCTION.
+//------------------------------------------------------------------------------
+template< ECEF_TO_GEODETIC_ENGINE ENGINE >
+static
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertEcefToGeodeticBatchWithEngine
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double   earthEquatorialRadiusMeters,
+            const double   earthEllipsoidalFlatteningFactor,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pGeodeticNorthLatitudeRadians,
+                  double * pGeocentricEastLongitudeRadians,
+                  double * pGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+{
+ //-----------------------------------------------------------------------------
+    EARTH_ELLIPSOID_CONTEXT
+            ellipsoidContext;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    ECEF_TO_GEODETIC_CONVERSION_STATUS
+            returnValue = initializeEarthEllipsoidContext
+                                 (
+                                   earthEquatorialRadiusMeters,
+                                   earthEllipsoidalFlatteningFactor,
+                                   ellipsoidContext
+                                 );
+ //-----------------------------------------------------------------------------
+    if( returnValue == SUCCESSFUL_CONVERSION )
+      {
+          convertEcefToGeodeticBatch
+                 (
+                   ellipsoidContext,
+                   ENGINE,
+                   numberPoints,
+                   pXEcefMeters,
+                   pYEcefMeters,
+                   pZEcefMeters,
+                   pGeodeticNorthLatitudeRadians,
+                   pGeocentricEastLongitudeRadians,
+                   pGeodeticAltitudeMeters,
+                   pConversionStatus
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    return( returnValue );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_BATCH_FUNCTION
+getEcefToGeodeticEngineBatchFunction
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const ECEF_TO_GEODETIC_ENGINE
+                           conversionEngine
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    getEcefToGeodeticEngineBatchFunction
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The engine overload of 'convertEcefToGeodeticBatch' for
+//    conversionEngine, with the ellipsoid given by its equatorial radius
+//    and flattening, as the accuracy sweep calls it.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    switch( conversionEngine )
+      {
+          case OLSON_ENGINE:
+            return( convertEcefToGeodeticBatchWithEngine< OLSON_ENGINE > );
+          case BOWRING_ONE_ENGINE:
+            return( convertEcefToGeodeticBatchWithEngine<
+                                                  BOWRING_ONE_ENGINE > );
+          case BOWRING_TWO_ENGINE:
+            return( convertEcefToGeodeticBatchWithEngine<
+                                                  BOWRING_TWO_ENGINE > );
+          case VERMEILLE_ENGINE:
+            return( convertEcefToGeodeticBatchWithEngine< VERMEILLE_ENGINE > );
+          case HEIKKINEN_ENGINE:
+            return( convertEcefToGeodeticBatchWithEngine< HEIKKINEN_ENGINE > );
+          case FUKUSHIMA_NEWTON_ENGINE:
+            return( convertEcefToGeodeticBatchWithEngine<
+                                                  FUKUSHIMA_NEWTON_ENGINE > );
+          case ITERATED_HALLEY_ENGINE:
+            return( convertEcefToGeodeticBatchWithEngine<
+                                                  ITERATED_HALLEY_ENGINE > );
+          default:
+            return( convertEcefToGeodeticBatchWithEngine<
+                                                  FUKUSHIMA_HALLEY_ENGINE > );
+      };
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,289 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+
+//------------------------------------------------------------------------------
+static
+size_t
+convertGeodeticGridRowToEcef
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double   primeVerticalRadius,
+            const double   polarPrimeVerticalRadius,
+            const double   sineLatitude,
+            const double   cosineLatitude,
+            const size_t   numberColumns,
+            const double * __restrict__ sineLongitude,
+            const double * __restrict__ cosineLongitude,
+            const double * __restrict__ altitude,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * __restrict__ x,
+                  double * __restrict__ y,
+                  double * __restrict__ z,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * __restrict__ status
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertGeodeticGridRowToEcef
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Convert one row of a grid for 'convertGeodeticGridToEcef', given the
+//    row quantities N, ( 1 - e^2 ) N, sin( lat ) and cos( lat ), and return
+//    the number of cells which are not converted.
+//
+//    The first loop has no call and no branch, so the compiler vectorizes
+//    it as the outer product of the row quantities and the column tables.
+//    A cell which fails the rho > 0 and rhoz > 0 check gets NAN added to
+//    its coordinates rather than selected, since a select between the
+//    products and NAN would need loads which the compiler cannot
+//    speculate.  The statuses are set by a second, scalar, loop.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    for( size_t j = 0; j < numberColumns; j++ )
+      {
+       //-----------------------------------------------------------------------
+          const double rho   = primeVerticalRadius      + altitude[ j ];
+          const double rhoz  = polarPrimeVerticalRadius + altitude[ j ];
+          const double r     = rho * cosineLatitude;
+          const double nan   = ( ( rho > 0.0 ) & ( rhoz > 0.0 ) ) ? 0.0 : NAN;
+       //-----------------------------------------------------------------------
+          x[ j ] = ( r    * cosineLongitude[ j ] ) + nan;
+          y[ j ] = ( r    *   sineLongitude[ j ] ) + nan;
+          z[ j ] = ( rhoz *    sineLatitude      ) + nan;
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    size_t numberInvalidCells = 0;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t j = 0; j < numberColumns; j++ )
+      {
+          const bool valid = ( primeVerticalRadius      + altitude[ j ] > 0.0 )
+                             &
+                             ( polarPrimeVerticalRadius + altitude[ j ] > 0.0 );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          status[ j ] = valid ? SUCCESSFUL_CONVERSION :
+                                INVALID_GEODETIC_ALTITUDE;
+          numberInvalidCells += !valid;
+      };
+ //-----------------------------------------------------------------------------
+    return( numberInvalidCells );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertGeodeticGridToEcef
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double   earthEquatorialRadiusMeters,
+            const double   earthEllipsoidalEccentricitySquared,
+            const size_t   numberRows,
+            const size_t   numberColumns,
+            const double   firstGeodeticNorthLatitudeRadians,
+            const double   geodeticNorthLatitudeStepRadians,
+            const double   firstGeocentricEastLongitudeRadians,
+            const double   geocentricEastLongitudeStepRadians,
+            const double * pGeodeticAltitudeMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pXEcefMeters,
+                  double * pYEcefMeters,
+                  double * pZEcefMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertGeodeticGridToEcef
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Convert a regular latitude and longitude grid with a geodetic
+//    altitude per cell, such as a digital elevation model (DEM) tile, to
+//    Earth Centered Earth Fixed (ECEF) rectangular coordinates, with the
+//    results of 'convertGeodeticToEcef' cell by cell.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    The conversion is separable:
+//
+//       x = ( N( lat ) + h ) cos( lat ) cos( lon )
+//       y = ( N( lat ) + h ) cos( lat ) sin( lon )
+//       z = ( ( 1 - e^2 ) N( lat ) + h ) sin( lat )
+//
+//    [ 1 ] Tabulate cos( lon ) and sin( lon ) once per column.
+//
+//    [ 2 ] For each row, compute sin( lat ), cos( lat ) and N( lat ) once,
+//          then form the row as the outer product of these row quantities
+//          and the column tables, adding each cell's altitude along the
+//          ellipsoid normal.
+//
+//    A grid of R rows and C columns needs R + C sine and cosine pairs and
+//    R square roots, instead of R C of each.
+//
+//------------------------------------------------------------------------------
+//
+//  INPUTS:
+//
+//     earthEquatorialRadiusMeters
+//     earthEllipsoidalEccentricitySquared
+//       As for 'convertGeodeticToEcef'.
+//
+//     numberRows
+//     numberColumns
+//       Number of latitude rows and longitude columns of the grid.
+//
+//     firstGeodeticNorthLatitudeRadians
+//     geodeticNorthLatitudeStepRadians
+//       Latitude of row 0 and the latitude increment from one row to the
+//       next, which is negative for a north up raster.  Row i is at
+//       first + i * step.
+//       UNITS:  [radians]
+//
+//     firstGeocentricEastLongitudeRadians
+//     geocentricEastLongitudeStepRadians
+//       Longitude of column 0 and the longitude increment from one column
+//       to the next.  Column j is at first + j * step.
+//       UNITS:  [radians]
+//
+//     pGeodeticAltitudeMeters
+//       Contiguous row major array of numberRows x numberColumns geodetic
+//       altitudes; the altitude of row i, column j is element
+//       i * numberColumns + j.
+//       UNITS:  [meters]
+//
+//------------------------------------------------------------------------------
+//
+//  OUTPUT:
+//
+//     pXEcefMeters
+//     pYEcefMeters
+//     pZEcefMeters
+//       Contiguous row major arrays of numberRows x numberColumns elements
+//       to contain the ECEF coordinates of the cells, NAN for a cell which
+//       is not converted.  They must not overlap pGeodeticAltitudeMeters.
+//       UNITS:  [meters]
+//
+//     pConversionStatus
+//       Contiguous row major array of numberRows x numberColumns elements
+//       to contain the status of each cell, SUCCESSFUL_CONVERSION or
+//       INVALID_GEODETIC_ALTITUDE.
+//
+//------------------------------------------------------------------------------
+//
+//  RETURNED VALUE:
+//
+//     SUCCESSFUL_CONVERSION if every cell is converted, otherwise
+//     INVALID_GEODETIC_ALTITUDE.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The row and column angles are computed as first + index * step,
+//          not by accumulation, so a 10000 x 10000 tile has no drift.
+//
+//    [ 2 ] This file is compiled with '-O3 -fno-math-errno
+//          -fno-trapping-math' (see 'buildTestConvertEcefToGeodetic.sh');
+//          without them the row loop is not vectorized.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const double ec2 = 1.0 - earthEllipsoidalEccentricitySquared;
+ //-----------------------------------------------------------------------------
+ //
+ // [ 1 ] Column tables.
+ //
+ //-----------------------------------------------------------------------------
+    vector< double > sineLongitude  ( numberColumns );
+    vector< double > cosineLongitude( numberColumns );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t j = 0; j < numberColumns; j++ )
+      {
+          sincos(
+                  firstGeocentricEastLongitudeRadians +
+                  ( double )j * geocentricEastLongitudeStepRadians,
+                  &sineLongitude  [ j ],
+                  &cosineLongitude[ j ]
+                );
+      };
+ //-----------------------------------------------------------------------------
+ //
+ // [ 2 ] Rows.
+ //
+ //-----------------------------------------------------------------------------
+    size_t numberInvalidCells = 0;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t i = 0; i < numberRows; i++ )
+      {
+       //-----------------------------------------------------------------------
+          double sineLatitude;
+          double cosineLatitude;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          sincos(
+                  firstGeodeticNorthLatitudeRadians +
+                  ( double )i * geodeticNorthLatitudeStepRadians,
+                  &sineLatitude,
+                  &cosineLatitude
+                );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          const double N = earthEquatorialRadiusMeters /
+                           sqrt(
+                                 1.0 -
+                                 earthEllipsoidalEccentricitySquared *
+                                 sineLatitude * sineLatitude
+                               );
+       //-----------------------------------------------------------------------
+          const size_t rowStart = i * numberColumns;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          numberInvalidCells +=
+          convertGeodeticGridRowToEcef
+                 (
+                   N,
+                   ec2 * N,
+                   sineLatitude,
+                   cosineLatitude,
+                   numberColumns,
+                   sineLongitude  .data( ),
+                   cosineLongitude.data( ),
+                   pGeodeticAltitudeMeters + rowStart,
+                   pXEcefMeters            + rowStart,
+                   pYEcefMeters            + rowStart,
+                   pZEcefMeters            + rowStart,
+                   pConversionStatus       + rowStart
+                 );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return( ( numberInvalidCells == 0 ) ? SUCCESSFUL_CONVERSION :
+                                          INVALID_GEODETIC_ALTITUDE );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -4,9 +4,10 @@
 //==============================================================================
 
 #include "conversionBetweenEcefAndGeodetic.h"
+#include "convertBetweenEcefAndGeodeticInline.h"
 
 //------------------------------------------------------------------------------
-void
+ECEF_TO_GEODETIC_CONVERSION_STATUS
 convertGeodeticToEcef
        (
         //----------------
@@ -24,6 +25,7 @@ convertGeodeticToEcef
                  double & rYEcefMeters,
                  double & rZEcefMeters
        )
+       __attribute__(( ifunc( "resolveConvertGeodeticToEcef" ) ));
 //==============================================================================
 //
 //  FUNCTION:
@@ -86,7 +88,30 @@ convertGeodeticToEcef
 //
 //  RETURNED VALUE:
 //
-//    None.
+//     Conversion status:
+//        SUCCESSFUL_CONVERSION
+//        INVALID_GEODETIC_ALTITUDE
+//          The length quantities rho and rhoz are not both positive, and
+//          the outputs are set to NAN.
+//
+//     No message is written; see 'reportConvertGeodeticToEcefStatus'.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The conversion is 'convertGeodeticToEcefInline' of
+//          'convertBetweenEcefAndGeodeticInline.h'.  This out-of-line
+//          function keeps the symbol for existing callers; a caller which
+//          includes that header instead gets the conversion inlined, with
+//          the results of the options it is compiled with.
+//
+//    [ 2 ] This function is a GNU indirect function (ifunc), bound at
+//          load time to the widest of the baseline x86-64, x86-64-v3 and
+//          x86-64-v4 clones which the host supports, as
+//          'convertEcefToGeodetic' is, so the results depend on the host
+//          CPU in the last bits; 'convertGeodeticToEcefBaselineClone'
+//          gives the same results on every host.
 //
 //------------------------------------------------------------------------------
 //
@@ -111,6 +136,7 @@ convertGeodeticToEcef
 //
 //  USAGE:
 //
+//    geodeticToEcefConversionStatus =
 //    convertGeodeticToEcef
 //           (
 //            //----------------
@@ -130,138 +156,89 @@ convertGeodeticToEcef
 //           );
 //
 //==============================================================================
+
+//------------------------------------------------------------------------------
+extern "C"
+CONVERT_GEODETIC_TO_ECEF_FUNCTION
+resolveConvertGeodeticToEcef(  )
+//==============================================================================
+//
+//  FUNCTION:
+//    resolveConvertGeodeticToEcef
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The load time resolver of the indirect function
+//    'convertGeodeticToEcef', as 'resolveConvertEcefToGeodetic'.
+//
+//==============================================================================
 {
  //-----------------------------------------------------------------------------
-    const
-    double
-        sineOfGeodeticNorthLatitude   = sin( geodeticNorthLatitudeRadians   );
-    const
-    double
-      cosineOfGeodeticNorthLatitude   = cos( geodeticNorthLatitudeRadians   );
+    __builtin_cpu_init( );
+ //-----------------------------------------------------------------------------
+    if( __builtin_cpu_supports( "x86-64-v4" ) )
+      {
+          return( convertGeodeticToEcefX8664V4Clone );
+      };
  //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-    const
-    double
-        sineOfGeocentricEastLongitude = sin( geocentricEastLongitudeRadians );
-    const
-    double
-      cosineOfGeocentricEastLongitude = cos( geocentricEastLongitudeRadians );
+    if( __builtin_cpu_supports( "x86-64-v3" ) )
+      {
+          return( convertGeodeticToEcefX8664V3Clone );
+      };
  //-----------------------------------------------------------------------------
- //
- // NOTE(s):
- //
- //   [ 1 ]  The value of the prime vertical radius of curvature, N, is
- //          derived in Equation (48) of Section 1.1.6
- //          "Geometry of the ellipse" pages 12 through 15 of
- //          Reference [2].
- //
+    return( convertGeodeticToEcefBaselineClone );
  //-----------------------------------------------------------------------------
-    const
-    double
-      N    = earthEquatorialRadiusMeters /
-             sqrt(
-                   1.0E0 +
+}
+//==============================================================================
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertGeodeticToEcefBaselineClone
+       (
+        //----------------
+        // INPUT(s):
+        //----------------
+           const double   earthEquatorialRadiusMeters,
+           const double   earthEllipsoidalEccentricitySquared,
+           const double   geodeticNorthLatitudeRadians,
+           const double   geocentricEastLongitudeRadians,
+           const double   geodeticAltitudeMeters,
+        //----------------
+        // OUTPUT(s):
+        //----------------
+                 double & rXEcefMeters,
+                 double & rYEcefMeters,
+                 double & rZEcefMeters
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertGeodeticToEcefBaselineClone
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The baseline x86-64 clone of 'convertGeodeticToEcef'.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    return(
+            convertGeodeticToEcefInline
                    (
-                     -earthEllipsoidalEccentricitySquared *
-                      sineOfGeodeticNorthLatitude         *
-                      sineOfGeodeticNorthLatitude
+                     earthEquatorialRadiusMeters,
+                     earthEllipsoidalEccentricitySquared,
+                     geodeticNorthLatitudeRadians,
+                     geocentricEastLongitudeRadians,
+                     geodeticAltitudeMeters,
+                     rXEcefMeters,
+                     rYEcefMeters,
+                     rZEcefMeters
                    )
-                 );
- //-----------------------------------------------------------------------------
-    const
-    double
-      rho  = N + geodeticAltitudeMeters;
-    const
-    double
-      rhoz = ( ( 1.0E0 - earthEllipsoidalEccentricitySquared ) * N ) +
-             geodeticAltitudeMeters;
- //-----------------------------------------------------------------------------
- // Check the length quantities.
- //-----------------------------------------------------------------------------
-    if(
-        ( rho  > 0.0E0 ) &&
-        ( rhoz > 0.0E0 )
-      )
-      {
-       //-----------------------------------------------------------------------
-       // The length quantities are all positive.
-       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-       // Continue the computation of ECEF retangular coordinates.
-       //
-       // NOTE(s):
-       //
-       //   [ 1 ]  The Earth Centered Earth Fixed (ECEF) coordinates
-       //          { x, y, z } are computed via Equation (277) on page 94
-       //          Section 2.1
-       //          "Cartesian coords x,y,z given geodetic coords"
-       //          of Reference [2].
-       //
-       //   [ 2 ]  The Earth Centered Earth Fixed (ECEF) coordinates
-       //          { x, y, z } are derived on pages 92, 93 and 94 of
-       //          Chapter 2
-       //          "Transformations Between Cartesian Coordinates x,y,z
-       //           and Geodetic Coordinates"
-       //          of Reference [2].
-       //
-       //-----------------------------------------------------------------------
-          const
-          double
-          r            = rho  * cosineOfGeodeticNorthLatitude;
-       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-          rXEcefMeters = r    * cosineOfGeocentricEastLongitude;
-          rYEcefMeters = r    *   sineOfGeocentricEastLongitude;
-          rZEcefMeters = rhoz *   sineOfGeodeticNorthLatitude;
-       //-----------------------------------------------------------------------
-      }
-    else
-      {
-       //-----------------------------------------------------------------------
-       // The length quantities are not all positive.
-       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-       // Generate a purpose message.
-       //-----------------------------------------------------------------------
-          generateConvertGeodeticToEcefPurposeMessage(  );
-       //-----------------------------------------------------------------------
-       // Generate a usage message.
-       //-----------------------------------------------------------------------
-          generateConvertGeodeticToEcefUsageMessage(  );
-       //-----------------------------------------------------------------------
-       // Generate an error message.
-       //-----------------------------------------------------------------------
-          fprintf
-          (
-            stdout,
-            "\n\n\n"
-            "%s\n%s\n%s\n%s\n%s\n%s\n%s\n"
-            "%s%14.6e\n"
-            "%s%14.6e\n"
-            "%s\n%s\n%s\n%s\n"
-            "\n\n\n",
-            "============================================================",
-            "|",
-            "|  ERROR:",
-            "|",
-            "|    The computeed length quantities rho and rhoz are",
-            "|    not both positive.",
-            "|",
-            "|    Computed value for rho  is:-->",
-            rho,
-            "|    Computed value for rhoz is:-->",
-            rhoz,
-            "|",
-            "|    This is an error.",
-            "|",
-            "============================================================"
           );
-       //-----------------------------------------------------------------------
-       // Assign invalid values to the output arguments.
-       //-----------------------------------------------------------------------
-          rXEcefMeters = NAN;
-          rYEcefMeters = NAN;
-          rZEcefMeters = NAN;
-       //-----------------------------------------------------------------------
-      }; 
- //-----------------------------------------------------------------------------
-    return;
  //-----------------------------------------------------------------------------
 }
 
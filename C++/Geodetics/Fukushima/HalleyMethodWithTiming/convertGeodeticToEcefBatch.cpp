@@ -0,0 +1,581 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <float.h>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+// The processor is examined once, at program startup, and the widest
+// supported kernel is used for every batch.
+//------------------------------------------------------------------------------
+static
+const
+ECEF_TO_GEODETIC_ISA_LEVEL
+ supportedIsaLevel = detectEcefToGeodeticIsaLevel( );
+
+//------------------------------------------------------------------------------
+template< bool VALIDITY_BITS >
+static
+size_t
+convertGeodeticToEcefBatchChunk
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double   earthEquatorialRadiusMeters,
+            const double   earthEllipsoidalEccentricitySquared,
+            const size_t   chunkPoints,
+            const double * __restrict__ latitude,
+            const double * __restrict__ longitude,
+            const double * __restrict__ altitude,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * __restrict__ x,
+                  double * __restrict__ y,
+                  double * __restrict__ z,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * __restrict__ status,
+                  unsigned long long
+                         * __restrict__ validBits
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertGeodeticToEcefBatchChunk
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Convert one cache resident chunk of at most CHUNK_POINTS points for
+//    'convertGeodeticToEcefBatch', and return the number of points which
+//    are not converted.
+//
+//    With VALIDITY_BITS set, Pass 3 stores validity bits, bit i % 64 of
+//    word i / 64 for point i, and status is not referenced; otherwise
+//    each point gets a status.  The chunk must start on a multiple of 64
+//    points.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const size_t CHUNK_POINTS = 256;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    double       sineLatitude   [ CHUNK_POINTS ];
+    double       cosineLatitude [ CHUNK_POINTS ];
+    double       sineLongitude  [ CHUNK_POINTS ];
+    double       cosineLongitude[ CHUNK_POINTS ];
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const double ec2 = 1.0 - earthEllipsoidalEccentricitySquared;
+ //=============================================================================
+ //
+ // Pass 1:  Sines and cosines, one 'sincos' call per angle.
+ //
+ //=============================================================================
+    for( size_t i = 0; i < chunkPoints; i++ )
+      {
+          sincos( latitude [ i ], &sineLatitude [ i ], &cosineLatitude [ i ] );
+          sincos( longitude[ i ], &sineLongitude[ i ], &cosineLongitude[ i ] );
+      };
+ //=============================================================================
+ //
+ // Pass 2:  Branch free arithmetic.  The rho and rhoz check is a select,
+ //          and its result is parked in sineLongitude once that is used.
+ //
+ //=============================================================================
+    for( size_t i = 0; i < chunkPoints; i++ )
+      {
+       //-----------------------------------------------------------------------
+          const double N    = earthEquatorialRadiusMeters /
+                              sqrt(
+                                    1.0 -
+                                    earthEllipsoidalEccentricitySquared *
+                                    sineLatitude[ i ] * sineLatitude[ i ]
+                                  );
+          const double rho  = N + altitude[ i ];
+          const double rhoz = ( ec2 * N ) + altitude[ i ];
+          const double r    = rho * cosineLatitude[ i ];
+       //-----------------------------------------------------------------------
+       // With validity bits, a point with an input which is not finite is
+       // not converted either, so a set bit always has finite outputs.
+       //-----------------------------------------------------------------------
+          const bool   finiteInputs =
+                             ( fabs( latitude [ i ] ) <= DBL_MAX ) &
+                             ( fabs( longitude[ i ] ) <= DBL_MAX ) &
+                             ( fabs( altitude [ i ] ) <= DBL_MAX );
+          const bool   valid = ( rho > 0.0 ) & ( rhoz > 0.0 ) &
+                               ( finiteInputs | !VALIDITY_BITS );
+       //-----------------------------------------------------------------------
+          x[ i ]             = valid ? r    * cosineLongitude[ i ] : NAN;
+          y[ i ]             = valid ? r    *   sineLongitude[ i ] : NAN;
+          z[ i ]             = valid ? rhoz *    sineLatitude[ i ] : NAN;
+          sineLongitude[ i ] = valid ? 1.0 : 0.0;
+       //-----------------------------------------------------------------------
+      };
+ //=============================================================================
+ //
+ // Pass 3:  Point status, kept out of Pass 2 so that it vectorizes.
+ //
+ //=============================================================================
+    size_t numberInvalidPoints = 0;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( VALIDITY_BITS )
+      {
+          for( size_t word = 0; 64 * word < chunkPoints; word++ )
+            {
+               const size_t wordPoints =
+                              ( chunkPoints - 64 * word < 64 ) ?
+                              ( chunkPoints - 64 * word ) : 64;
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               unsigned long long wordBits = 0;
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               for( size_t k = 0; k < wordPoints; k++ )
+                 {
+                    wordBits |= ( unsigned long long )
+                                ( sineLongitude[ 64 * word + k ] != 0.0 ) << k;
+                 };
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               validBits[ word ]    = wordBits;
+               numberInvalidPoints += wordPoints -
+                                      __builtin_popcountll( wordBits );
+            };
+      }
+    else
+      {
+          for( size_t i = 0; i < chunkPoints; i++ )
+            {
+               status[ i ] = ( sineLongitude[ i ] != 0.0 ) ?
+                             SUCCESSFUL_CONVERSION : INVALID_GEODETIC_ALTITUDE;
+               numberInvalidPoints += ( sineLongitude[ i ] == 0.0 );
+            };
+      };
+ //-----------------------------------------------------------------------------
+    return( numberInvalidPoints );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+size_t
+convertGeodeticToEcefBatchForIsaLevel
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const ECEF_TO_GEODETIC_ISA_LEVEL
+                           isaLevel,
+            const double   earthEquatorialRadiusMeters,
+            const double   earthEllipsoidalEccentricitySquared,
+            const size_t   numberPoints,
+            const double * pGeodeticNorthLatitudeRadians,
+            const double * pGeocentricEastLongitudeRadians,
+            const double * pGeodeticAltitudeMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pXEcefMeters,
+                  double * pYEcefMeters,
+                  double * pZEcefMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertGeodeticToEcefBatchForIsaLevel
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    As 'convertGeodeticToEcefBatch', with the batch kernel selected by
+//    the isaLevel argument, and returning the number of points which are
+//    not converted:
+//
+//       BASELINE_ISA_LEVEL   The chunk loop of this file.
+//       AVX2_FMA_ISA_LEVEL   'convertGeodeticToEcefBatchAvx2Kernel'.
+//       AVX512_ISA_LEVEL     'convertGeodeticToEcefBatchAvx512Kernel'.
+//
+//    The timing harness uses it to time each kernel on the same points.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The caller must not request a level above the one reported by
+//          'detectEcefToGeodeticIsaLevel', since the wider kernels would
+//          execute illegal instructions.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    if( isaLevel == AVX512_ISA_LEVEL )
+      {
+          return(
+                  convertGeodeticToEcefBatchAvx512Kernel
+                         (
+                           earthEquatorialRadiusMeters,
+                           earthEllipsoidalEccentricitySquared,
+                           numberPoints,
+                           pGeodeticNorthLatitudeRadians,
+                           pGeocentricEastLongitudeRadians,
+                           pGeodeticAltitudeMeters,
+                           pXEcefMeters,
+                           pYEcefMeters,
+                           pZEcefMeters,
+                           pConversionStatus
+                         )
+                );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( isaLevel == AVX2_FMA_ISA_LEVEL )
+      {
+          return(
+                  convertGeodeticToEcefBatchAvx2Kernel
+                         (
+                           earthEquatorialRadiusMeters,
+                           earthEllipsoidalEccentricitySquared,
+                           numberPoints,
+                           pGeodeticNorthLatitudeRadians,
+                           pGeocentricEastLongitudeRadians,
+                           pGeodeticAltitudeMeters,
+                           pXEcefMeters,
+                           pYEcefMeters,
+                           pZEcefMeters,
+                           pConversionStatus
+                         )
+                );
+      };
+ //-----------------------------------------------------------------------------
+    const size_t CHUNK_POINTS        = 256;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    size_t       numberInvalidPoints = 0;
+ //-----------------------------------------------------------------------------
+    for(
+         size_t chunkStart  = 0;
+                chunkStart  < numberPoints;
+                chunkStart += CHUNK_POINTS
+       )
+      {
+          const
+          size_t
+           chunkPoints = ( numberPoints - chunkStart < CHUNK_POINTS ) ?
+                         ( numberPoints - chunkStart ) : CHUNK_POINTS;
+       //-----------------------------------------------------------------------
+          numberInvalidPoints +=
+          convertGeodeticToEcefBatchChunk< false >
+                 (
+                   earthEquatorialRadiusMeters,
+                   earthEllipsoidalEccentricitySquared,
+                   chunkPoints,
+                   pGeodeticNorthLatitudeRadians   + chunkStart,
+                   pGeocentricEastLongitudeRadians + chunkStart,
+                   pGeodeticAltitudeMeters         + chunkStart,
+                   pXEcefMeters                    + chunkStart,
+                   pYEcefMeters                    + chunkStart,
+                   pZEcefMeters                    + chunkStart,
+                   pConversionStatus               + chunkStart,
+                   NULL
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    return( numberInvalidPoints );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertGeodeticToEcefBatch
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double   earthEquatorialRadiusMeters,
+            const double   earthEllipsoidalEccentricitySquared,
+            const size_t   numberPoints,
+            const double * pGeodeticNorthLatitudeRadians,
+            const double * pGeocentricEastLongitudeRadians,
+            const double * pGeodeticAltitudeMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pXEcefMeters,
+                  double * pYEcefMeters,
+                  double * pZEcefMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertGeodeticToEcefBatch
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Convert a batch of geodetic coordinates, stored as a structure of
+//    arrays, to Earth Centered Earth Fixed (ECEF) rectangular coordinates,
+//    with the results of 'convertGeodeticToEcef' point by point.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    [ 1 ] The sine and cosine of each angle come from one fused
+//          evaluation:  'sincos' in the baseline kernel, a four or eight
+//          lane polynomial sincos in the AVX2 and AVX-512 kernels.
+//
+//    [ 2 ] The SIMD kernels compute the prime vertical radius of
+//          curvature with a reciprocal square root estimate refined by
+//          Newton steps instead of a square root and a divide.
+//
+//    [ 3 ] The rho > 0 and rhoz > 0 check is a per lane mask; no message
+//          is written.
+//
+//    [ 4 ] 'detectEcefToGeodeticIsaLevel' selects the widest kernel once,
+//          at program startup.
+//
+//------------------------------------------------------------------------------
+//
+//  INPUTS:
+//
+//     earthEquatorialRadiusMeters
+//     earthEllipsoidalEccentricitySquared
+//       As for 'convertGeodeticToEcef'.
+//
+//     numberPoints
+//       Number of points in the batch.
+//
+//     pGeodeticNorthLatitudeRadians
+//     pGeocentricEastLongitudeRadians
+//     pGeodeticAltitudeMeters
+//       Contiguous arrays of numberPoints geodetic coordinates.
+//       UNITS:  [radians], [radians], [meters]
+//
+//------------------------------------------------------------------------------
+//
+//  OUTPUT:
+//
+//     pXEcefMeters
+//     pYEcefMeters
+//     pZEcefMeters
+//       Contiguous arrays of numberPoints elements to contain the ECEF
+//       coordinates, NAN for a point which is not converted.  The output
+//       arrays must not overlap the input arrays.
+//       UNITS:  [meters]
+//
+//     pConversionStatus
+//       Contiguous array of numberPoints elements to contain the status
+//       of each point, SUCCESSFUL_CONVERSION or INVALID_GEODETIC_ALTITUDE.
+//
+//------------------------------------------------------------------------------
+//
+//  RETURNED VALUE:
+//
+//     SUCCESSFUL_CONVERSION if every point is converted, otherwise
+//     INVALID_GEODETIC_ALTITUDE.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The SIMD results differ from those of 'convertGeodeticToEcef'
+//          by a few units in the last place, a few nanometers at the
+//          surface of the Earth; 'executeForwardTimingConvertGeodeticToEcef'
+//          reports the largest difference.
+//
+//    [ 2 ] This file is compiled with '-O3 -fno-math-errno
+//          -fno-trapping-math' (see 'buildTestConvertEcefToGeodetic.sh');
+//          without them Pass 2 of the baseline kernel is not vectorized.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const
+    size_t
+     numberInvalidPoints = convertGeodeticToEcefBatchForIsaLevel
+                                  (
+                                    //-------------------
+                                    // INPUT(s):
+                                    //-------------------
+                                       supportedIsaLevel,
+                                       earthEquatorialRadiusMeters,
+                                       earthEllipsoidalEccentricitySquared,
+                                       numberPoints,
+                                       pGeodeticNorthLatitudeRadians,
+                                       pGeocentricEastLongitudeRadians,
+                                       pGeodeticAltitudeMeters,
+                                    //-------------------
+                                    // OUTPUT(s):
+                                    //-------------------
+                                       pXEcefMeters,
+                                       pYEcefMeters,
+                                       pZEcefMeters,
+                                       pConversionStatus
+                                  );
+ //-----------------------------------------------------------------------------
+    return( ( numberInvalidPoints == 0 ) ? SUCCESSFUL_CONVERSION :
+                                           INVALID_GEODETIC_ALTITUDE );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
+
+//------------------------------------------------------------------------------
+void
+convertGeodeticToEcefBatchWithValidityBits
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double   earthEquatorialRadiusMeters,
+            const double   earthEllipsoidalEccentricitySquared,
+            const size_t   numberPoints,
+            const double * pGeodeticNorthLatitudeRadians,
+            const double * pGeocentricEastLongitudeRadians,
+            const double * pGeodeticAltitudeMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pXEcefMeters,
+                  double * pYEcefMeters,
+                  double * pZEcefMeters,
+                  unsigned long long
+                         * pValidBits,
+                  ECEF_TO_GEODETIC_BATCH_VALIDITY
+                         & rBatchValidity
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertGeodeticToEcefBatchWithValidityBits
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    As 'convertGeodeticToEcefBatch', with a validity bit per point, bit
+//    i % 64 of word i / 64 of pValidBits for point i, instead of a status
+//    per point, and the summary counts of the batch in rBatchValidity.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    [ 1 ] Each kernel turns its valid lane mask into the validity bits
+//          directly.  A NAN or infinite angle stays in its SIMD lane and
+//          fails the rho > 0 and rhoz > 0 check there; only a finite
+//          angle beyond FORWARD_SINE_COSINE_ANGLE_LIMIT is converted with
+//          the scalar 'convertGeodeticToEcef'.
+//
+//    [ 2 ] 'summarizeBatchValidityBits' counts the set bits, and looks at
+//          the inputs of the clear bits only, to count the points with
+//          coordinates which are not finite.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] pValidBits must have ( numberPoints + 63 ) / 64 words.  The
+//          bits of the last word past numberPoints are clear.
+//
+//    [ 2 ] A clear bit is a point with the INVALID_GEODETIC_ALTITUDE
+//          status of 'convertGeodeticToEcefBatch', or with an input
+//          coordinate which is not finite, and has NAN outputs.  Unlike
+//          the status, which only checks rho and rhoz, a set bit always
+//          has finite outputs:  a NAN longitude, for one, passes the
+//          length check of 'convertGeodeticToEcef'.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    if( supportedIsaLevel == AVX512_ISA_LEVEL )
+      {
+          convertGeodeticToEcefBatchValidityBitsAvx512Kernel
+                 (
+                   earthEquatorialRadiusMeters,
+                   earthEllipsoidalEccentricitySquared,
+                   numberPoints,
+                   pGeodeticNorthLatitudeRadians,
+                   pGeocentricEastLongitudeRadians,
+                   pGeodeticAltitudeMeters,
+                   pXEcefMeters,
+                   pYEcefMeters,
+                   pZEcefMeters,
+                   pValidBits
+                 );
+      }
+    else
+    if( supportedIsaLevel == AVX2_FMA_ISA_LEVEL )
+      {
+          convertGeodeticToEcefBatchValidityBitsAvx2Kernel
+                 (
+                   earthEquatorialRadiusMeters,
+                   earthEllipsoidalEccentricitySquared,
+                   numberPoints,
+                   pGeodeticNorthLatitudeRadians,
+                   pGeocentricEastLongitudeRadians,
+                   pGeodeticAltitudeMeters,
+                   pXEcefMeters,
+                   pYEcefMeters,
+                   pZEcefMeters,
+                   pValidBits
+                 );
+      }
+    else
+      {
+       //-----------------------------------------------------------------------
+          const size_t CHUNK_POINTS = 256;
+       //-----------------------------------------------------------------------
+          for(
+               size_t chunkStart  = 0;
+                      chunkStart  < numberPoints;
+                      chunkStart += CHUNK_POINTS
+             )
+            {
+               const
+               size_t
+                chunkPoints = ( numberPoints - chunkStart < CHUNK_POINTS ) ?
+                              ( numberPoints - chunkStart ) : CHUNK_POINTS;
+            //------------------------------------------------------------------
+               convertGeodeticToEcefBatchChunk< true >
+                      (
+                        earthEquatorialRadiusMeters,
+                        earthEllipsoidalEccentricitySquared,
+                        chunkPoints,
+                        pGeodeticNorthLatitudeRadians   + chunkStart,
+                        pGeocentricEastLongitudeRadians + chunkStart,
+                        pGeodeticAltitudeMeters         + chunkStart,
+                        pXEcefMeters                    + chunkStart,
+                        pYEcefMeters                    + chunkStart,
+                        pZEcefMeters                    + chunkStart,
+                        NULL,
+                        pValidBits                      + chunkStart / 64
+                      );
+            };
+      };
+ //-----------------------------------------------------------------------------
+    summarizeBatchValidityBits
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                numberPoints,
+                pGeodeticNorthLatitudeRadians,
+                pGeocentricEastLongitudeRadians,
+                pGeodeticAltitudeMeters,
+                pValidBits,
+             //-------------------
+             // OUTPUT(s):
+             //-------------------
+                rBatchValidity
+           );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
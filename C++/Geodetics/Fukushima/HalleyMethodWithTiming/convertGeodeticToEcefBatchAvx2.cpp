@@ -0,0 +1,661 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <float.h>
+#include <immintrin.h>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+static
+inline
+void
+computeSineCosineAvx2
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const __m256d  angle,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  __m256d &rSine,
+                  __m256d &rCosine
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    computeSineCosineAvx2
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Four lane double precision sin( angle ) and cos( angle ) together,
+//    from one argument reduction, without branches.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    [ 1 ] k = nearest integer to |angle| / ( pi / 2 ), found by adding
+//          and subtracting 1.5 * 2^52, which also leaves k in the low
+//          mantissa bits of the sum.
+//
+//    [ 2 ] z = |angle| - k pi / 2 in [ -pi / 4, pi / 4 ], with pi / 2
+//          split into three parts (Cody and Waite) whose products with k
+//          are exact for k < 2^26.
+//
+//    [ 3 ] sin( z ) and cos( z ) by the Cephes minimax polynomials,
+//          relative error about 1e-16 (see Reference [ 1 ]).
+//
+//    [ 4 ] The quadrant k mod 4 swaps them when odd and supplies their
+//          signs, which are xor-ed in as sign bits; sin also takes the
+//          sign of angle.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] Only valid for |angle| <= FORWARD_SINE_COSINE_ANGLE_LIMIT;
+//          the caller converts the other finite lanes with the scalar
+//          function.  A NAN or infinite angle gives a NAN sine and
+//          cosine.
+//
+//------------------------------------------------------------------------------
+//
+//  REFERENCE(s):
+//
+//     [ 1 ]  Cephes Mathematical Library, "sin.c",
+//            Stephen L. Moshier, 1985, 1995, 2000.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const __m256d signMask        = _mm256_set1_pd( -0.0 );
+    const __m256d roundingShifter = _mm256_set1_pd( 0x1.8p52 );
+ //-----------------------------------------------------------------------------
+    const __m256d absAngle = _mm256_andnot_pd( signMask, angle );
+    const __m256d shifted  = _mm256_fmadd_pd
+                                    (
+                                      absAngle,
+                                    _mm256_set1_pd( 6.36619772367581343076e-1 ),
+                                      roundingShifter
+                                    );
+    const __m256d k        = _mm256_sub_pd( shifted, roundingShifter );
+ //-----------------------------------------------------------------------------
+    __m256d z = _mm256_fnmadd_pd
+                       (
+                         k, _mm256_set1_pd( 2.0 * 7.85398125648498535156e-1 ),
+                         absAngle
+                       );
+    z = _mm256_fnmadd_pd
+               (
+                 k, _mm256_set1_pd( 2.0 * 3.77489470793079817668e-8 ), z
+               );
+    z = _mm256_fnmadd_pd
+               (
+                 k, _mm256_set1_pd( 2.0 * 2.69515142907905952645e-15 ), z
+               );
+ //-----------------------------------------------------------------------------
+    const __m256d zz = _mm256_mul_pd( z, z );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    __m256d s = _mm256_set1_pd( 1.58962301576546568060e-10 );
+    s = _mm256_fmadd_pd( s, zz, _mm256_set1_pd( -2.50507477628578072866e-8 ) );
+    s = _mm256_fmadd_pd( s, zz, _mm256_set1_pd(  2.75573136213857245213e-6 ) );
+    s = _mm256_fmadd_pd( s, zz, _mm256_set1_pd( -1.98412698295895385996e-4 ) );
+    s = _mm256_fmadd_pd( s, zz, _mm256_set1_pd(  8.33333333332211858878e-3 ) );
+    s = _mm256_fmadd_pd( s, zz, _mm256_set1_pd( -1.66666666666666307295e-1 ) );
+    s = _mm256_fmadd_pd( _mm256_mul_pd( z, zz ), s, z );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    __m256d c = _mm256_set1_pd( -1.13585365213876817300e-11 );
+    c = _mm256_fmadd_pd( c, zz, _mm256_set1_pd(  2.08757008419747316778e-9 ) );
+    c = _mm256_fmadd_pd( c, zz, _mm256_set1_pd( -2.75573141792967388112e-7 ) );
+    c = _mm256_fmadd_pd( c, zz, _mm256_set1_pd(  2.48015872888517045348e-5 ) );
+    c = _mm256_fmadd_pd( c, zz, _mm256_set1_pd( -1.38888888888730564116e-3 ) );
+    c = _mm256_fmadd_pd( c, zz, _mm256_set1_pd(  4.16666666666665929218e-2 ) );
+    c = _mm256_fmadd_pd
+               (
+                 _mm256_mul_pd( zz, zz ), c,
+                 _mm256_fnmadd_pd( _mm256_set1_pd( 0.5 ), zz,
+                                   _mm256_set1_pd( 1.0 ) )
+               );
+ //-----------------------------------------------------------------------------
+ // Quadrant q = k mod 4:  sin = (  s,  c, -s, -c )[ q ],
+ //                        cos = (  c, -s, -c,  s )[ q ].
+ //-----------------------------------------------------------------------------
+    const __m256i quadrant    = _mm256_castpd_si256( shifted );
+    const __m256d swap        = _mm256_castsi256_pd
+                                       (
+                                         _mm256_cmpeq_epi64
+                                         (
+                                           _mm256_and_si256
+                                           (
+                                             quadrant, _mm256_set1_epi64x( 1 )
+                                           ),
+                                           _mm256_set1_epi64x( 1 )
+                                         )
+                                       );
+    const __m256d sineSign    = _mm256_castsi256_pd
+                                       (
+                                         _mm256_slli_epi64
+                                         (
+                                           _mm256_srli_epi64( quadrant, 1 ),
+                                           63
+                                         )
+                                       );
+    const __m256d cosineSign  = _mm256_castsi256_pd
+                                       (
+                                         _mm256_slli_epi64
+                                         (
+                                           _mm256_srli_epi64
+                                           (
+                                             _mm256_add_epi64
+                                             (
+                                               quadrant,
+                                               _mm256_set1_epi64x( 1 )
+                                             ),
+                                             1
+                                           ),
+                                           63
+                                         )
+                                       );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    rSine   = _mm256_xor_pd
+                     (
+                       _mm256_blendv_pd( s, c, swap ),
+                       _mm256_xor_pd( sineSign,
+                                      _mm256_and_pd( angle, signMask ) )
+                     );
+    rCosine = _mm256_xor_pd( _mm256_blendv_pd( c, s, swap ), cosineSign );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+template< bool VALIDITY_BITS >
+static
+size_t
+convertGeodeticToEcefBatchBlocksAvx2
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double   earthEquatorialRadiusMeters,
+            const double   earthEllipsoidalEccentricitySquared,
+            const size_t   numberPoints,
+            const double * pGeodeticNorthLatitudeRadians,
+            const double * pGeocentricEastLongitudeRadians,
+            const double * pGeodeticAltitudeMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pXEcefMeters,
+                  double * pYEcefMeters,
+                  double * pZEcefMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus,
+                  unsigned long long
+                         * pValidBits
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertGeodeticToEcefBatchBlocksAvx2
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The four lane AVX2 + FMA block loop of
+//    'convertGeodeticToEcefBatchAvx2Kernel' and
+//    'convertGeodeticToEcefBatchValidityBitsAvx2Kernel'.  Returns the
+//    number of points which are not converted.
+//
+//    With VALIDITY_BITS set, the valid lane mask of each block, which
+//    then also requires finite inputs, is stored in pValidBits, bit
+//    i % 64 of word i / 64 for point i, and pConversionStatus is not
+//    referenced; otherwise each point gets a status.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    [ 1 ] The sines and cosines of latitude and longitude come from
+//          'computeSineCosineAvx2', one argument reduction per angle.
+//
+//    [ 2 ] N = a / sqrt( 1 - e^2 sin^2 ) is a times the reciprocal square
+//          root of w = 1 - e^2 sin^2: the single precision estimate,
+//          good to 12 bits, then three Newton steps
+//          r = r ( 1.5 - 0.5 w r^2 ), which triple that, instead of a
+//          square root and a divide.
+//
+//    [ 3 ] The rho > 0 and rhoz > 0 check of 'convertGeodeticToEcef' is
+//          a lane mask:  failing lanes get NAN outputs and the
+//          INVALID_GEODETIC_ALTITUDE status.
+//
+//    [ 4 ] Lanes with a finite angle outside the range of [ 1 ] are
+//          converted again with the scalar 'convertGeodeticToEcef', so
+//          every point gets its result and status.  A NAN or infinite
+//          angle stays in its lane:  its sine and cosine are NAN, so the
+//          check of [ 3 ] fails as it does in the scalar function, and a
+//          block with a missing record costs no more than any other.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] This file is compiled with '-mavx2 -mfma'.  It must only be
+//          called when 'detectEcefToGeodeticIsaLevel' reports at least
+//          AVX2_FMA_ISA_LEVEL.
+//
+//    [ 2 ] The last numberPoints % 4 points are copied to a zero padded
+//          block of four, so no lane reads or writes past the arrays.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const size_t  LANES       = 4;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const __m256d signMask    = _mm256_set1_pd( -0.0 );
+    const __m256d angleLimit  = _mm256_set1_pd
+                                       ( FORWARD_SINE_COSINE_ANGLE_LIMIT );
+    const __m256d a           = _mm256_set1_pd( earthEquatorialRadiusMeters );
+    const __m256d e2          = _mm256_set1_pd
+                                       ( earthEllipsoidalEccentricitySquared );
+    const __m256d ec2         = _mm256_set1_pd
+                                       (
+                                         1.0 -
+                                         earthEllipsoidalEccentricitySquared
+                                       );
+    const __m256d notANumber  = _mm256_set1_pd( NAN );
+ //-----------------------------------------------------------------------------
+    size_t numberInvalidPoints = 0;
+    size_t i                   = 0;
+ //-----------------------------------------------------------------------------
+    while( i < numberPoints )
+      {
+       //-----------------------------------------------------------------------
+          const size_t lanes = ( numberPoints - i < LANES ) ?
+                               ( numberPoints - i ) : LANES;
+       //-----------------------------------------------------------------------
+          __m256d latitude;
+          __m256d longitude;
+          __m256d altitude;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( lanes == LANES )
+            {
+               latitude  =
+               _mm256_loadu_pd( pGeodeticNorthLatitudeRadians   + i );
+               longitude =
+               _mm256_loadu_pd( pGeocentricEastLongitudeRadians + i );
+               altitude  =
+               _mm256_loadu_pd( pGeodeticAltitudeMeters         + i );
+            }
+          else
+            {
+               double latitudeBlock [ LANES ] = { 0.0, 0.0, 0.0, 0.0 };
+               double longitudeBlock[ LANES ] = { 0.0, 0.0, 0.0, 0.0 };
+               double altitudeBlock [ LANES ] = { 0.0, 0.0, 0.0, 0.0 };
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               for( size_t k = 0; k < lanes; k++ )
+                 {
+                    latitudeBlock [ k ] =
+                    pGeodeticNorthLatitudeRadians  [ i + k ];
+                    longitudeBlock[ k ] =
+                    pGeocentricEastLongitudeRadians[ i + k ];
+                    altitudeBlock [ k ] =
+                    pGeodeticAltitudeMeters        [ i + k ];
+                 };
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               latitude  = _mm256_loadu_pd( latitudeBlock  );
+               longitude = _mm256_loadu_pd( longitudeBlock );
+               altitude  = _mm256_loadu_pd( altitudeBlock  );
+            };
+       //-----------------------------------------------------------------------
+       // Fused sines and cosines.
+       //-----------------------------------------------------------------------
+          __m256d sineLatitude;
+          __m256d cosineLatitude;
+          __m256d sineLongitude;
+          __m256d cosineLongitude;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          computeSineCosineAvx2( latitude,  sineLatitude,  cosineLatitude  );
+          computeSineCosineAvx2( longitude, sineLongitude, cosineLongitude );
+       //-----------------------------------------------------------------------
+       // N = a / sqrt( w ) by the reciprocal square root of w.
+       //-----------------------------------------------------------------------
+          const __m256d w      = _mm256_fnmadd_pd
+                                        (
+                                          _mm256_mul_pd( e2, sineLatitude ),
+                                          sineLatitude,
+                                          _mm256_set1_pd( 1.0 )
+                                        );
+          const __m256d halfW  = _mm256_mul_pd( _mm256_set1_pd( 0.5 ), w );
+          __m256d       r      = _mm256_cvtps_pd
+                                        (
+                                          _mm_rsqrt_ps( _mm256_cvtpd_ps( w ) )
+                                        );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( int step = 0; step < 3; step++ )
+            {
+               r = _mm256_mul_pd
+                          (
+                            r,
+                            _mm256_fnmadd_pd
+                                   (
+                                     _mm256_mul_pd( halfW, r ), r,
+                                     _mm256_set1_pd( 1.5 )
+                                   )
+                          );
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          const __m256d N      = _mm256_mul_pd( a, r );
+          const __m256d rho    = _mm256_add_pd( N, altitude );
+          const __m256d rhoz   = _mm256_fmadd_pd( ec2, N, altitude );
+       //-----------------------------------------------------------------------
+       // Lane masks:  valid lengths, and finite angles beyond the
+       // reduction range.
+       //-----------------------------------------------------------------------
+          const __m256d lengthsValid =
+                                 _mm256_and_pd
+                                        (
+                                          _mm256_cmp_pd
+                                          (
+                                            rho, _mm256_setzero_pd( ),
+                                            _CMP_GT_OQ
+                                          ),
+                                          _mm256_cmp_pd
+                                          (
+                                            rhoz, _mm256_setzero_pd( ),
+                                            _CMP_GT_OQ
+                                          )
+                                        );
+          const __m256d maximumDouble = _mm256_set1_pd( DBL_MAX );
+          const __m256d absAltitude   = _mm256_andnot_pd( signMask, altitude );
+          const __m256d absLatitude   = _mm256_andnot_pd( signMask, latitude );
+          const __m256d absLongitude  = _mm256_andnot_pd( signMask, longitude );
+          const __m256d outOfRange    =
+                   _mm256_or_pd
+                   (
+                     _mm256_and_pd
+                     (
+                       _mm256_cmp_pd( absLatitude, angleLimit, _CMP_GT_OQ ),
+                       _mm256_cmp_pd( absLatitude, maximumDouble, _CMP_LE_OQ )
+                     ),
+                     _mm256_and_pd
+                     (
+                       _mm256_cmp_pd( absLongitude, angleLimit, _CMP_GT_OQ ),
+                       _mm256_cmp_pd( absLongitude, maximumDouble, _CMP_LE_OQ )
+                     )
+                   );
+       //-----------------------------------------------------------------------
+       // With validity bits, a lane with an input which is not finite is
+       // not converted either, so a set bit always has finite outputs; the
+       // status of 'convertGeodeticToEcef' only checks the lengths.
+       //-----------------------------------------------------------------------
+          const __m256d finiteInputs  =
+                   _mm256_and_pd
+                   (
+                     _mm256_and_pd
+                     (
+                       _mm256_cmp_pd( absLatitude, maximumDouble, _CMP_LE_OQ ),
+                       _mm256_cmp_pd( absLongitude, maximumDouble, _CMP_LE_OQ )
+                     ),
+                     _mm256_cmp_pd( absAltitude, maximumDouble, _CMP_LE_OQ )
+                   );
+          const __m256d valid         = VALIDITY_BITS ?
+                                        _mm256_and_pd( lengthsValid,
+                                                       finiteInputs ) :
+                                        lengthsValid;
+       //-----------------------------------------------------------------------
+          const __m256d r0     = _mm256_mul_pd( rho, cosineLatitude );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          const __m256d x      = _mm256_blendv_pd
+                                        (
+                                          notANumber,
+                                          _mm256_mul_pd( r0, cosineLongitude ),
+                                          valid
+                                        );
+          const __m256d y      = _mm256_blendv_pd
+                                        (
+                                          notANumber,
+                                          _mm256_mul_pd( r0, sineLongitude ),
+                                          valid
+                                        );
+          const __m256d z      = _mm256_blendv_pd
+                                        (
+                                          notANumber,
+                                          _mm256_mul_pd( rhoz, sineLatitude ),
+                                          valid
+                                        );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          const int validLaneBits        = _mm256_movemask_pd( valid );
+          const int outOfRangeLaneBits   = _mm256_movemask_pd( outOfRange );
+          const int finiteInputsLaneBits = _mm256_movemask_pd( finiteInputs );
+       //-----------------------------------------------------------------------
+          if( lanes == LANES )
+            {
+               _mm256_storeu_pd( pXEcefMeters + i, x );
+               _mm256_storeu_pd( pYEcefMeters + i, y );
+               _mm256_storeu_pd( pZEcefMeters + i, z );
+            }
+          else
+            {
+               double xBlock[ LANES ];
+               double yBlock[ LANES ];
+               double zBlock[ LANES ];
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               _mm256_storeu_pd( xBlock, x );
+               _mm256_storeu_pd( yBlock, y );
+               _mm256_storeu_pd( zBlock, z );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               for( size_t k = 0; k < lanes; k++ )
+                 {
+                    pXEcefMeters[ i + k ] = xBlock[ k ];
+                    pYEcefMeters[ i + k ] = yBlock[ k ];
+                    pZEcefMeters[ i + k ] = zBlock[ k ];
+                 };
+            };
+       //-----------------------------------------------------------------------
+          if( VALIDITY_BITS )
+            {
+               unsigned long long
+                laneBits = ( unsigned long long )
+                           ( validLaneBits & ~outOfRangeLaneBits &
+                             ( ( 1 << lanes ) - 1 ) );
+               int
+                scalarLaneBits = outOfRangeLaneBits & finiteInputsLaneBits;
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               while( scalarLaneBits != 0 )
+                 {
+                    const int k = __builtin_ctz( scalarLaneBits );
+                 //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                    scalarLaneBits &= scalarLaneBits - 1;
+                 //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                    if(
+                        convertGeodeticToEcef
+                               (
+                                 earthEquatorialRadiusMeters,
+                                 earthEllipsoidalEccentricitySquared,
+                                 pGeodeticNorthLatitudeRadians  [ i + k ],
+                                 pGeocentricEastLongitudeRadians[ i + k ],
+                                 pGeodeticAltitudeMeters        [ i + k ],
+                                 pXEcefMeters[ i + k ],
+                                 pYEcefMeters[ i + k ],
+                                 pZEcefMeters[ i + k ]
+                               )
+                        ==
+                        SUCCESSFUL_CONVERSION
+                      )
+                      {
+                         laneBits |= 1ULL << k;
+                      };
+                 };
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               pValidBits[ i / 64 ] =
+                    ( ( i % 64 == 0 ) ? 0ULL : pValidBits[ i / 64 ] ) |
+                    ( laneBits << ( i % 64 ) );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               numberInvalidPoints += lanes - __builtin_popcountll( laneBits );
+            }
+          else
+            {
+               for( size_t k = 0; k < lanes; k++ )
+                 {
+                    if( ( ( outOfRangeLaneBits >> k ) & 1 ) == 0 )
+                      {
+                         pConversionStatus[ i + k ] =
+                              ( ( validLaneBits >> k ) & 1 ) ?
+                              SUCCESSFUL_CONVERSION :
+                              INVALID_GEODETIC_ALTITUDE;
+                      }
+                    else
+                      {
+                         pConversionStatus[ i + k ] =
+                         convertGeodeticToEcef
+                                (
+                                  earthEquatorialRadiusMeters,
+                                  earthEllipsoidalEccentricitySquared,
+                                  pGeodeticNorthLatitudeRadians  [ i + k ],
+                                  pGeocentricEastLongitudeRadians[ i + k ],
+                                  pGeodeticAltitudeMeters        [ i + k ],
+                                  pXEcefMeters[ i + k ],
+                                  pYEcefMeters[ i + k ],
+                                  pZEcefMeters[ i + k ]
+                                );
+                      };
+                 //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                    numberInvalidPoints +=
+                       ( pConversionStatus[ i + k ] != SUCCESSFUL_CONVERSION );
+                 };
+            };
+       //-----------------------------------------------------------------------
+          i = i + lanes;
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return( numberInvalidPoints );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
+
+//------------------------------------------------------------------------------
+size_t
+convertGeodeticToEcefBatchAvx2Kernel
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double   earthEquatorialRadiusMeters,
+            const double   earthEllipsoidalEccentricitySquared,
+            const size_t   numberPoints,
+            const double * pGeodeticNorthLatitudeRadians,
+            const double * pGeocentricEastLongitudeRadians,
+            const double * pGeodeticAltitudeMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pXEcefMeters,
+                  double * pYEcefMeters,
+                  double * pZEcefMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertGeodeticToEcefBatchAvx2Kernel
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Four lane AVX2 + FMA batch kernel of 'convertGeodeticToEcefBatch'.
+//    Returns the number of points which are not converted.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    return(
+            convertGeodeticToEcefBatchBlocksAvx2< false >
+                   (
+                     earthEquatorialRadiusMeters,
+                     earthEllipsoidalEccentricitySquared,
+                     numberPoints,
+                     pGeodeticNorthLatitudeRadians,
+                     pGeocentricEastLongitudeRadians,
+                     pGeodeticAltitudeMeters,
+                     pXEcefMeters,
+                     pYEcefMeters,
+                     pZEcefMeters,
+                     pConversionStatus,
+                     NULL
+                   )
+          );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
+
+//------------------------------------------------------------------------------
+size_t
+convertGeodeticToEcefBatchValidityBitsAvx2Kernel
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double   earthEquatorialRadiusMeters,
+            const double   earthEllipsoidalEccentricitySquared,
+            const size_t   numberPoints,
+            const double * pGeodeticNorthLatitudeRadians,
+            const double * pGeocentricEastLongitudeRadians,
+            const double * pGeodeticAltitudeMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pXEcefMeters,
+                  double * pYEcefMeters,
+                  double * pZEcefMeters,
+                  unsigned long long
+                         * pValidBits
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertGeodeticToEcefBatchValidityBitsAvx2Kernel
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Four lane AVX2 + FMA batch kernel of
+//    'convertGeodeticToEcefBatchWithValidityBits':  as
+//    'convertGeodeticToEcefBatchAvx2Kernel', with a validity bit per
+//    point, bit i % 64 of word i / 64 for point i, instead of a status.
+//    The bits of the last word past numberPoints are clear.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    return(
+            convertGeodeticToEcefBatchBlocksAvx2< true >
+                   (
+                     earthEquatorialRadiusMeters,
+                     earthEllipsoidalEccentricitySquared,
+                     numberPoints,
+                     pGeodeticNorthLatitudeRadians,
+                     pGeocentricEastLongitudeRadians,
+                     pGeodeticAltitudeMeters,
+                     pXEcefMeters,
+                     pYEcefMeters,
+                     pZEcefMeters,
+                     NULL,
+                     pValidBits
+                   )
+          );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
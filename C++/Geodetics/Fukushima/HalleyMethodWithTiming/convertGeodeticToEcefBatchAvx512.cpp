@@ -0,0 +1,560 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <float.h>
+#include <immintrin.h>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+static
+inline
+void
+computeSineCosineAvx512
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const __m512d  angle,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  __m512d &rSine,
+                  __m512d &rCosine
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    computeSineCosineAvx512
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Eight lane double precision sin( angle ) and cos( angle ) together,
+//    by the method of 'computeSineCosineAvx2' (see
+//    'convertGeodeticToEcefBatchAvx2.cpp'), with mask blends.  Only
+//    AVX-512F instructions are used, so the sign bits are xor-ed as
+//    integers.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const __m512d roundingShifter = _mm512_set1_pd( 0x1.8p52 );
+    const __m512i one             = _mm512_set1_epi64( 1 );
+ //-----------------------------------------------------------------------------
+    const __m512d absAngle = _mm512_abs_pd( angle );
+    const __m512d shifted  = _mm512_fmadd_pd
+                                    (
+                                      absAngle,
+                                    _mm512_set1_pd( 6.36619772367581343076e-1 ),
+                                      roundingShifter
+                                    );
+    const __m512d k        = _mm512_sub_pd( shifted, roundingShifter );
+ //-----------------------------------------------------------------------------
+    __m512d z = _mm512_fnmadd_pd
+                       (
+                         k, _mm512_set1_pd( 2.0 * 7.85398125648498535156e-1 ),
+                         absAngle
+                       );
+    z = _mm512_fnmadd_pd
+               (
+                 k, _mm512_set1_pd( 2.0 * 3.77489470793079817668e-8 ), z
+               );
+    z = _mm512_fnmadd_pd
+               (
+                 k, _mm512_set1_pd( 2.0 * 2.69515142907905952645e-15 ), z
+               );
+ //-----------------------------------------------------------------------------
+    const __m512d zz = _mm512_mul_pd( z, z );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    __m512d s = _mm512_set1_pd( 1.58962301576546568060e-10 );
+    s = _mm512_fmadd_pd( s, zz, _mm512_set1_pd( -2.50507477628578072866e-8 ) );
+    s = _mm512_fmadd_pd( s, zz, _mm512_set1_pd(  2.75573136213857245213e-6 ) );
+    s = _mm512_fmadd_pd( s, zz, _mm512_set1_pd( -1.98412698295895385996e-4 ) );
+    s = _mm512_fmadd_pd( s, zz, _mm512_set1_pd(  8.33333333332211858878e-3 ) );
+    s = _mm512_fmadd_pd( s, zz, _mm512_set1_pd( -1.66666666666666307295e-1 ) );
+    s = _mm512_fmadd_pd( _mm512_mul_pd( z, zz ), s, z );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    __m512d c = _mm512_set1_pd( -1.13585365213876817300e-11 );
+    c = _mm512_fmadd_pd( c, zz, _mm512_set1_pd(  2.08757008419747316778e-9 ) );
+    c = _mm512_fmadd_pd( c, zz, _mm512_set1_pd( -2.75573141792967388112e-7 ) );
+    c = _mm512_fmadd_pd( c, zz, _mm512_set1_pd(  2.48015872888517045348e-5 ) );
+    c = _mm512_fmadd_pd( c, zz, _mm512_set1_pd( -1.38888888888730564116e-3 ) );
+    c = _mm512_fmadd_pd( c, zz, _mm512_set1_pd(  4.16666666666665929218e-2 ) );
+    c = _mm512_fmadd_pd
+               (
+                 _mm512_mul_pd( zz, zz ), c,
+                 _mm512_fnmadd_pd( _mm512_set1_pd( 0.5 ), zz,
+                                   _mm512_set1_pd( 1.0 ) )
+               );
+ //-----------------------------------------------------------------------------
+ // Quadrant q = k mod 4:  sin = (  s,  c, -s, -c )[ q ],
+ //                        cos = (  c, -s, -c,  s )[ q ].
+ //-----------------------------------------------------------------------------
+    const __m512i  quadrant   = _mm512_castpd_si512( shifted );
+    const __mmask8 swap       = _mm512_test_epi64_mask( quadrant, one );
+    const __m512i  sineSign   = _mm512_xor_si512
+                                       (
+                                         _mm512_slli_epi64
+                                         (
+                                           _mm512_srli_epi64( quadrant, 1 ),
+                                           63
+                                         ),
+                                         _mm512_and_si512
+                                         (
+                                           _mm512_castpd_si512( angle ),
+                                           _mm512_set1_epi64
+                                           (
+                                             ( long long )0x8000000000000000ULL
+                                           )
+                                         )
+                                       );
+    const __m512i  cosineSign = _mm512_slli_epi64
+                                       (
+                                         _mm512_srli_epi64
+                                         (
+                                           _mm512_add_epi64( quadrant, one ),
+                                           1
+                                         ),
+                                         63
+                                       );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    rSine   = _mm512_castsi512_pd
+                     (
+                       _mm512_xor_si512
+                       (
+                         _mm512_castpd_si512
+                         (
+                           _mm512_mask_blend_pd( swap, s, c )
+                         ),
+                         sineSign
+                       )
+                     );
+    rCosine = _mm512_castsi512_pd
+                     (
+                       _mm512_xor_si512
+                       (
+                         _mm512_castpd_si512
+                         (
+                           _mm512_mask_blend_pd( swap, c, s )
+                         ),
+                         cosineSign
+                       )
+                     );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+template< bool VALIDITY_BITS >
+static
+size_t
+convertGeodeticToEcefBatchBlocksAvx512
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double   earthEquatorialRadiusMeters,
+            const double   earthEllipsoidalEccentricitySquared,
+            const size_t   numberPoints,
+            const double * pGeodeticNorthLatitudeRadians,
+            const double * pGeocentricEastLongitudeRadians,
+            const double * pGeodeticAltitudeMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pXEcefMeters,
+                  double * pYEcefMeters,
+                  double * pZEcefMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus,
+                  unsigned long long
+                         * pValidBits
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertGeodeticToEcefBatchBlocksAvx512
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The eight lane AVX-512 block loop of
+//    'convertGeodeticToEcefBatchAvx512Kernel' and
+//    'convertGeodeticToEcefBatchValidityBitsAvx512Kernel', with the
+//    method and the VALIDITY_BITS flag of
+//    'convertGeodeticToEcefBatchBlocksAvx2', except
+//    that the reciprocal square root estimate is the 14 bit
+//    'rsqrt14' of double precision, so two Newton steps suffice.
+//    Returns the number of points which are not converted.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] This file is compiled with '-mavx512f -mfma'.  It
+//          must only be called when 'detectEcefToGeodeticIsaLevel'
+//          reports AVX512_ISA_LEVEL.
+//
+//    [ 2 ] The last numberPoints % 8 points are loaded and stored with
+//          lane masks, so no lane reads or writes past the arrays.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const size_t  LANES       = 8;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const __m512d angleLimit  = _mm512_set1_pd
+                                       ( FORWARD_SINE_COSINE_ANGLE_LIMIT );
+    const __m512d a           = _mm512_set1_pd( earthEquatorialRadiusMeters );
+    const __m512d e2          = _mm512_set1_pd
+                                       ( earthEllipsoidalEccentricitySquared );
+    const __m512d ec2         = _mm512_set1_pd
+                                       (
+                                         1.0 -
+                                         earthEllipsoidalEccentricitySquared
+                                       );
+    const __m512d zero        = _mm512_setzero_pd( );
+    const __m512d notANumber  = _mm512_set1_pd( NAN );
+ //-----------------------------------------------------------------------------
+    size_t numberInvalidPoints = 0;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < numberPoints; i = i + LANES )
+      {
+       //-----------------------------------------------------------------------
+          const size_t   lanes    = ( numberPoints - i < LANES ) ?
+                                    ( numberPoints - i ) : LANES;
+          const __mmask8 laneMask = ( __mmask8 )( ( 1U << lanes ) - 1U );
+       //-----------------------------------------------------------------------
+          const __m512d latitude  = _mm512_maskz_loadu_pd
+                                           (
+                                             laneMask,
+                                             pGeodeticNorthLatitudeRadians + i
+                                           );
+          const __m512d longitude = _mm512_maskz_loadu_pd
+                                           (
+                                             laneMask,
+                                             pGeocentricEastLongitudeRadians + i
+                                           );
+          const __m512d altitude  = _mm512_maskz_loadu_pd
+                                           (
+                                             laneMask,
+                                             pGeodeticAltitudeMeters + i
+                                           );
+       //-----------------------------------------------------------------------
+       // Fused sines and cosines.
+       //-----------------------------------------------------------------------
+          __m512d sineLatitude;
+          __m512d cosineLatitude;
+          __m512d sineLongitude;
+          __m512d cosineLongitude;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          computeSineCosineAvx512( latitude,  sineLatitude,  cosineLatitude  );
+          computeSineCosineAvx512( longitude, sineLongitude, cosineLongitude );
+       //-----------------------------------------------------------------------
+       // N = a / sqrt( w ) by the reciprocal square root of w.
+       //-----------------------------------------------------------------------
+          const __m512d w      = _mm512_fnmadd_pd
+                                        (
+                                          _mm512_mul_pd( e2, sineLatitude ),
+                                          sineLatitude,
+                                          _mm512_set1_pd( 1.0 )
+                                        );
+          const __m512d halfW  = _mm512_mul_pd( _mm512_set1_pd( 0.5 ), w );
+          __m512d       r      = _mm512_rsqrt14_pd( w );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( int step = 0; step < 2; step++ )
+            {
+               r = _mm512_mul_pd
+                          (
+                            r,
+                            _mm512_fnmadd_pd
+                                   (
+                                     _mm512_mul_pd( halfW, r ), r,
+                                     _mm512_set1_pd( 1.5 )
+                                   )
+                          );
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          const __m512d N      = _mm512_mul_pd( a, r );
+          const __m512d rho    = _mm512_add_pd( N, altitude );
+          const __m512d rhoz   = _mm512_fmadd_pd( ec2, N, altitude );
+       //-----------------------------------------------------------------------
+       // Lane masks:  valid lengths, and finite angles beyond the
+       // reduction range.
+       //-----------------------------------------------------------------------
+          const __mmask8 lengthsValid =
+                   _mm512_cmp_pd_mask( rho,  zero, _CMP_GT_OQ )
+                   &
+                   _mm512_cmp_pd_mask( rhoz, zero, _CMP_GT_OQ );
+          const __m512d  maximumDouble = _mm512_set1_pd( DBL_MAX );
+          const __m512d  absLatitude   = _mm512_abs_pd( latitude );
+          const __m512d  absLongitude  = _mm512_abs_pd( longitude );
+          const __m512d  absAltitude   = _mm512_abs_pd( altitude );
+          const __mmask8 outOfRange    =
+                   (
+                     _mm512_cmp_pd_mask( absLatitude, angleLimit,
+                                         _CMP_GT_OQ )
+                     &
+                     _mm512_cmp_pd_mask( absLatitude, maximumDouble,
+                                         _CMP_LE_OQ )
+                   )
+                   |
+                   (
+                     _mm512_cmp_pd_mask( absLongitude, angleLimit,
+                                         _CMP_GT_OQ )
+                     &
+                     _mm512_cmp_pd_mask( absLongitude, maximumDouble,
+                                         _CMP_LE_OQ )
+                   );
+       //-----------------------------------------------------------------------
+       // With validity bits, a lane with an input which is not finite is
+       // not converted either, as in 'convertGeodeticToEcefBatchBlocksAvx2'.
+       //-----------------------------------------------------------------------
+          const __mmask8 finiteInputs  =
+                   _mm512_cmp_pd_mask( absLatitude,  maximumDouble,
+                                       _CMP_LE_OQ )
+                   &
+                   _mm512_cmp_pd_mask( absLongitude, maximumDouble,
+                                       _CMP_LE_OQ )
+                   &
+                   _mm512_cmp_pd_mask( absAltitude,  maximumDouble,
+                                       _CMP_LE_OQ );
+          const __mmask8 valid         = VALIDITY_BITS ?
+                                         ( __mmask8 )( lengthsValid &
+                                                       finiteInputs ) :
+                                         lengthsValid;
+       //-----------------------------------------------------------------------
+          const __m512d r0     = _mm512_mul_pd( rho, cosineLatitude );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          _mm512_mask_storeu_pd
+                 (
+                   pXEcefMeters + i,
+                   laneMask,
+                   _mm512_mask_blend_pd
+                          (
+                            valid, notANumber,
+                            _mm512_mul_pd( r0, cosineLongitude )
+                          )
+                 );
+          _mm512_mask_storeu_pd
+                 (
+                   pYEcefMeters + i,
+                   laneMask,
+                   _mm512_mask_blend_pd
+                          (
+                            valid, notANumber,
+                            _mm512_mul_pd( r0, sineLongitude )
+                          )
+                 );
+          _mm512_mask_storeu_pd
+                 (
+                   pZEcefMeters + i,
+                   laneMask,
+                   _mm512_mask_blend_pd
+                          (
+                            valid, notANumber,
+                            _mm512_mul_pd( rhoz, sineLatitude )
+                          )
+                 );
+       //-----------------------------------------------------------------------
+          if( VALIDITY_BITS )
+            {
+               unsigned long long
+                laneBits = ( unsigned long long )
+                           ( valid & ~outOfRange & laneMask );
+               unsigned int
+                scalarLaneBits = outOfRange & finiteInputs;
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               while( scalarLaneBits != 0 )
+                 {
+                    const int k = __builtin_ctz( scalarLaneBits );
+                 //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                    scalarLaneBits &= scalarLaneBits - 1;
+                 //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                    if(
+                        convertGeodeticToEcef
+                               (
+                                 earthEquatorialRadiusMeters,
+                                 earthEllipsoidalEccentricitySquared,
+                                 pGeodeticNorthLatitudeRadians  [ i + k ],
+                                 pGeocentricEastLongitudeRadians[ i + k ],
+                                 pGeodeticAltitudeMeters        [ i + k ],
+                                 pXEcefMeters[ i + k ],
+                                 pYEcefMeters[ i + k ],
+                                 pZEcefMeters[ i + k ]
+                               )
+                        ==
+                        SUCCESSFUL_CONVERSION
+                      )
+                      {
+                         laneBits |= 1ULL << k;
+                      };
+                 };
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               pValidBits[ i / 64 ] =
+                    ( ( i % 64 == 0 ) ? 0ULL : pValidBits[ i / 64 ] ) |
+                    ( laneBits << ( i % 64 ) );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               numberInvalidPoints += lanes - __builtin_popcountll( laneBits );
+            }
+          else
+            {
+               for( size_t k = 0; k < lanes; k++ )
+                 {
+                    if( ( ( outOfRange >> k ) & 1 ) == 0 )
+                      {
+                         pConversionStatus[ i + k ] =
+                              ( ( valid >> k ) & 1 ) ?
+                              SUCCESSFUL_CONVERSION :
+                              INVALID_GEODETIC_ALTITUDE;
+                      }
+                    else
+                      {
+                         pConversionStatus[ i + k ] =
+                         convertGeodeticToEcef
+                                (
+                                  earthEquatorialRadiusMeters,
+                                  earthEllipsoidalEccentricitySquared,
+                                  pGeodeticNorthLatitudeRadians  [ i + k ],
+                                  pGeocentricEastLongitudeRadians[ i + k ],
+                                  pGeodeticAltitudeMeters        [ i + k ],
+                                  pXEcefMeters[ i + k ],
+                                  pYEcefMeters[ i + k ],
+                                  pZEcefMeters[ i + k ]
+                                );
+                      };
+                 //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                    numberInvalidPoints +=
+                       ( pConversionStatus[ i + k ] != SUCCESSFUL_CONVERSION );
+                 };
+            };
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return( numberInvalidPoints );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
+
+//------------------------------------------------------------------------------
+size_t
+convertGeodeticToEcefBatchAvx512Kernel
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double   earthEquatorialRadiusMeters,
+            const double   earthEllipsoidalEccentricitySquared,
+            const size_t   numberPoints,
+            const double * pGeodeticNorthLatitudeRadians,
+            const double * pGeocentricEastLongitudeRadians,
+            const double * pGeodeticAltitudeMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pXEcefMeters,
+                  double * pYEcefMeters,
+                  double * pZEcefMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertGeodeticToEcefBatchAvx512Kernel
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Eight lane AVX-512 batch kernel of 'convertGeodeticToEcefBatch'.
+//    Returns the number of points which are not converted.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    return(
+            convertGeodeticToEcefBatchBlocksAvx512< false >
+                   (
+                     earthEquatorialRadiusMeters,
+                     earthEllipsoidalEccentricitySquared,
+                     numberPoints,
+                     pGeodeticNorthLatitudeRadians,
+                     pGeocentricEastLongitudeRadians,
+                     pGeodeticAltitudeMeters,
+                     pXEcefMeters,
+                     pYEcefMeters,
+                     pZEcefMeters,
+                     pConversionStatus,
+                     NULL
+                   )
+          );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
+
+//------------------------------------------------------------------------------
+size_t
+convertGeodeticToEcefBatchValidityBitsAvx512Kernel
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double   earthEquatorialRadiusMeters,
+            const double   earthEllipsoidalEccentricitySquared,
+            const size_t   numberPoints,
+            const double * pGeodeticNorthLatitudeRadians,
+            const double * pGeocentricEastLongitudeRadians,
+            const double * pGeodeticAltitudeMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pXEcefMeters,
+                  double * pYEcefMeters,
+                  double * pZEcefMeters,
+                  unsigned long long
+                         * pValidBits
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertGeodeticToEcefBatchValidityBitsAvx512Kernel
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Eight lane AVX-512 batch kernel of
+//    'convertGeodeticToEcefBatchWithValidityBits':  as
+//    'convertGeodeticToEcefBatchAvx512Kernel', with a validity bit per
+//    point, bit i % 64 of word i / 64 for point i, instead of a status.
+//    The bits of the last word past numberPoints are clear.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    return(
+            convertGeodeticToEcefBatchBlocksAvx512< true >
+                   (
+                     earthEquatorialRadiusMeters,
+                     earthEllipsoidalEccentricitySquared,
+                     numberPoints,
+                     pGeodeticNorthLatitudeRadians,
+                     pGeocentricEastLongitudeRadians,
+                     pGeodeticAltitudeMeters,
+                     pXEcefMeters,
+                     pYEcefMeters,
+                     pZEcefMeters,
+                     NULL,
+                     pValidBits
+                   )
+          );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,152 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertGeodeticToEcef
+       (
+        //----------------
+        // INPUT(s):
+        //----------------
+           const EARTH_ELLIPSOID_CONTEXT
+                        & rEllipsoidContext,
+           const double   geodeticNorthLatitudeRadians,
+           const double   geocentricEastLongitudeRadians,
+           const double   geodeticAltitudeMeters,
+        //----------------
+        // OUTPUT(s):
+        //----------------
+                 double & rXEcefMeters,
+                 double & rYEcefMeters,
+                 double & rZEcefMeters
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertGeodeticToEcef  (ellipsoid context overload)
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Convert:
+//      Geodetic   Latitude,
+//      Geocentric Longitude
+//      Geodetic   Altitude
+//    to Earth Centered Earth Fixed (ECEF) rectangular coordinates, for the
+//    reference ellipsoid of an ellipsoid context built by
+//    'initializeEarthEllipsoidContext'.
+//
+//------------------------------------------------------------------------------
+//
+//  INPUTS:
+//
+//     rEllipsoidContext
+//       Reference to an ellipsoid context for which
+//       'initializeEarthEllipsoidContext' returned SUCCESSFUL_CONVERSION.
+//
+//     geodeticNorthLatitudeRadians
+//     geocentricEastLongitudeRadians
+//     geodeticAltitudeMeters
+//       As for 'convertGeodeticToEcef'.
+//
+//------------------------------------------------------------------------------
+//
+//  OUTPUT:
+//
+//     rXEcefMeters
+//     rYEcefMeters
+//     rZEcefMeters
+//       As for 'convertGeodeticToEcef'.  All three are set to NAN when
+//       the length quantities rho and rhoz are not both positive.
+//
+//------------------------------------------------------------------------------
+//
+//  RETURNED VALUE:
+//
+//     As for 'convertGeodeticToEcef'.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The eccentricity squared and 1 - e^2 are read from the context.
+//
+//    [ 2 ] See 'convertGeodeticToEcef' for the references.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const
+    double
+        sineOfGeodeticNorthLatitude   = sin( geodeticNorthLatitudeRadians   );
+    const
+    double
+      cosineOfGeodeticNorthLatitude   = cos( geodeticNorthLatitudeRadians   );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    double
+        sineOfGeocentricEastLongitude = sin( geocentricEastLongitudeRadians );
+    const
+    double
+      cosineOfGeocentricEastLongitude = cos( geocentricEastLongitudeRadians );
+ //-----------------------------------------------------------------------------
+ // Prime vertical radius of curvature, Equation (48) of Reference [2] of
+ // 'convertGeodeticToEcef'.
+ //-----------------------------------------------------------------------------
+    const
+    double
+      N    = rEllipsoidContext.earthEquatorialRadiusMeters /
+             sqrt(
+                   1.0E0 +
+                   (
+                     -rEllipsoidContext.earthEllipticitySquared *
+                      sineOfGeodeticNorthLatitude               *
+                      sineOfGeodeticNorthLatitude
+                   )
+                 );
+ //-----------------------------------------------------------------------------
+    const
+    double
+      rho  = N + geodeticAltitudeMeters;
+    const
+    double
+      rhoz = ( rEllipsoidContext.complimentaryEarthEllipticitySquared * N ) +
+             geodeticAltitudeMeters;
+ //-----------------------------------------------------------------------------
+    if(
+        ( rho  > 0.0E0 ) &&
+        ( rhoz > 0.0E0 )
+      )
+      {
+       //-----------------------------------------------------------------------
+       // Equation (277) of Reference [2] of 'convertGeodeticToEcef'.
+       //-----------------------------------------------------------------------
+          const
+          double
+          r            = rho  * cosineOfGeodeticNorthLatitude;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          rXEcefMeters = r    * cosineOfGeocentricEastLongitude;
+          rYEcefMeters = r    *   sineOfGeocentricEastLongitude;
+          rZEcefMeters = rhoz *   sineOfGeodeticNorthLatitude;
+       //-----------------------------------------------------------------------
+      }
+    else
+      {
+       //-----------------------------------------------------------------------
+          rXEcefMeters = NAN;
+          rYEcefMeters = NAN;
+          rZEcefMeters = NAN;
+       //-----------------------------------------------------------------------
+          return( INVALID_GEODETIC_ALTITUDE );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return( SUCCESSFUL_CONVERSION );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
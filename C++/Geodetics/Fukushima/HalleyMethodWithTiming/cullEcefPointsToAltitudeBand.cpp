@@ -0,0 +1,647 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <float.h>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+// Points are classified in blocks of 64, one word of the in band bit mask.
+//------------------------------------------------------------------------------
+static
+const
+size_t
+ BLOCK_POINTS = 64;
+
+//------------------------------------------------------------------------------
+// Relative widening of the ellipsoid bounds, so that neither rounding nor
+// the altitude error of the single Halley step can make a bound decide a
+// point which the exact altitude would decide otherwise.  It is about
+// 3 mm at the Earth's surface, against the 1.0E-7 m altitude error bound.
+//------------------------------------------------------------------------------
+static
+const
+double
+ ALTITUDE_BAND_BOUND_MARGIN = 1.0E-9;
+
+//------------------------------------------------------------------------------
+// The processor is examined once, at program startup, and the widest
+// supported bounding ellipsoid kernel is used for every block.
+//------------------------------------------------------------------------------
+static
+const
+ECEF_TO_GEODETIC_ISA_LEVEL
+ supportedIsaLevel = detectEcefToGeodeticIsaLevel( );
+
+//------------------------------------------------------------------------------
+static
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+initializeAltitudeBandBounds
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         &rEllipsoidContext,
+            const double  minimumGeodeticAltitudeMeters,
+            const double  maximumGeodeticAltitudeMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  ALTITUDE_BAND_BOUNDS
+                         &rBounds
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    initializeAltitudeBandBounds
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Validate an altitude band and compute the inverse squared semi-axes
+//    of the ellipsoids which bound the surfaces of constant geodetic
+//    altitude at its edges.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    The points of geodetic altitude at most H, for an ellipsoid of
+//    semi-axes a and b, are those within distance H of the ellipsoid,
+//    whose support function is that of the ellipsoid plus H.  By the
+//    triangle inequality on the support functions, that body contains
+//    the ellipsoid of semi-axes ( a + H, b + H ) and is contained in the
+//    ellipsoid of semi-axes ( a + H a / b, b + H ).  For negative H the
+//    two exchange their roles.
+//
+//    The two bounding ellipsoids share their polar semi-axis, and differ
+//    by | H | ( a / b - 1 ), 0.34 percent of | H |, at the equator.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const double a = rEllipsoidContext.earthEquatorialRadiusMeters;
+    const double b = rEllipsoidContext.earthPolarRadiusMeters;
+ //-----------------------------------------------------------------------------
+ // Only a NAN edge or an empty band is invalid.
+ //-----------------------------------------------------------------------------
+    if( !( maximumGeodeticAltitudeMeters >= minimumGeodeticAltitudeMeters ) )
+      {
+          return( INVALID_GEODETIC_ALTITUDE );
+      };
+ //-----------------------------------------------------------------------------
+ // At or below the minimum radius of curvature, b^2 / a, the geodetic
+ // altitude is no longer the distance to the ellipsoid, and an edge there
+ // has no bounding ellipsoids.  Such a minimum, -INFINITY included, is an
+ // open lower edge:  its coefficients are infinite, so that its tests
+ // never reject a point.  Such a maximum has NAN coefficients, so that
+ // its tests decide nothing and every point not rejected by the minimum
+ // gets the exact altitude.  A point with x = y = 0 or z = 0 makes an
+ // infinite coefficient NAN as well, and is refined too.
+ //-----------------------------------------------------------------------------
+    const double minimumBoundedAltitudeMeters = -( b * b ) / a;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const double altitudes[ 2 ] = { minimumGeodeticAltitudeMeters,
+                                    maximumGeodeticAltitudeMeters };
+    const double unboundedInverseSquared[ 2 ] = { INFINITY, NAN };
+    double       innerInverseASquared[ 2 ];
+    double       outerInverseASquared[ 2 ];
+    double       inverseBSquared     [ 2 ];
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int edge = 0; edge < 2; edge++ )
+      {
+       //-----------------------------------------------------------------------
+          const double H  = altitudes[ edge ];
+       //-----------------------------------------------------------------------
+          if( H <= minimumBoundedAltitudeMeters )
+            {
+               innerInverseASquared[ edge ] = unboundedInverseSquared[ edge ];
+               outerInverseASquared[ edge ] = unboundedInverseSquared[ edge ];
+               inverseBSquared     [ edge ] = unboundedInverseSquared[ edge ];
+            //------------------------------------------------------------------
+               continue;
+            //------------------------------------------------------------------
+            };
+       //-----------------------------------------------------------------------
+          const double A1 = a + H;
+          const double A2 = a + H * ( a / b );
+          const double B  = b + H;
+       //-----------------------------------------------------------------------
+          const double innerA = ( A1 < A2 ) ? A1 : A2;
+          const double outerA = ( A1 < A2 ) ? A2 : A1;
+       //-----------------------------------------------------------------------
+          innerInverseASquared[ edge ] = 1.0 / ( innerA * innerA );
+          outerInverseASquared[ edge ] = 1.0 / ( outerA * outerA );
+          inverseBSquared     [ edge ] = 1.0 / ( B      * B      );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    rBounds.minimumAltitudeMeters       = minimumGeodeticAltitudeMeters;
+    rBounds.maximumAltitudeMeters       = maximumGeodeticAltitudeMeters;
+    rBounds.minimumInnerInverseASquared = innerInverseASquared[ 0 ];
+    rBounds.minimumOuterInverseASquared = outerInverseASquared[ 0 ];
+    rBounds.minimumInverseBSquared      = inverseBSquared     [ 0 ];
+    rBounds.maximumInnerInverseASquared = innerInverseASquared[ 1 ];
+    rBounds.maximumOuterInverseASquared = outerInverseASquared[ 1 ];
+    rBounds.maximumInverseBSquared      = inverseBSquared     [ 1 ];
+    rBounds.lowerTestBound              = 1.0 - ALTITUDE_BAND_BOUND_MARGIN;
+    rBounds.upperTestBound              = 1.0 + ALTITUDE_BAND_BOUND_MARGIN;
+ //-----------------------------------------------------------------------------
+    return( SUCCESSFUL_CONVERSION );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+static
+void
+classifyAltitudeBandBlock
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const ALTITUDE_BAND_BOUNDS
+                         & rBounds,
+            const size_t   blockPoints,
+            const double * x,
+            const double * y,
+            const double * z,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  unsigned long long
+                         & rInBandBits,
+                  unsigned long long
+                         & rUndecidedBits
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    classifyAltitudeBandBlock
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The baseline, auto-vectorized bounding ellipsoid tests of a block
+//    of at most 64 points, as 'classifyAltitudeBandBlockAvx2Kernel'.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const double lowerBound = rBounds.lowerTestBound;
+    const double upperBound = rBounds.upperTestBound;
+ //-----------------------------------------------------------------------------
+    const double minimumInnerInverseASquared =
+                   rBounds.minimumInnerInverseASquared;
+    const double minimumOuterInverseASquared =
+                   rBounds.minimumOuterInverseASquared;
+    const double minimumInverseBSquared =
+                   rBounds.minimumInverseBSquared;
+    const double maximumInnerInverseASquared =
+                   rBounds.maximumInnerInverseASquared;
+    const double maximumOuterInverseASquared =
+                   rBounds.maximumOuterInverseASquared;
+    const double maximumInverseBSquared =
+                   rBounds.maximumInverseBSquared;
+ //-----------------------------------------------------------------------------
+ // The flags are doubles, as the coordinates are, since integer stores
+ // prevent vectorization of the pass.
+ //-----------------------------------------------------------------------------
+    double inBand   [ BLOCK_POINTS ];
+    double undecided[ BLOCK_POINTS ];
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < blockPoints; i++ )
+      {
+       //-----------------------------------------------------------------------
+          const double pSquared = ( x[ i ] * x[ i ] ) + ( y[ i ] * y[ i ] );
+          const double zSquared = z[ i ] * z[ i ];
+       //-----------------------------------------------------------------------
+          const double minimumInner = ( pSquared * minimumInnerInverseASquared )
+                                    + ( zSquared * minimumInverseBSquared );
+          const double minimumOuter = ( pSquared * minimumOuterInverseASquared )
+                                    + ( zSquared * minimumInverseBSquared );
+          const double maximumInner = ( pSquared * maximumInnerInverseASquared )
+                                    + ( zSquared * maximumInverseBSquared );
+          const double maximumOuter = ( pSquared * maximumOuterInverseASquared )
+                                    + ( zSquared * maximumInverseBSquared );
+       //-----------------------------------------------------------------------
+          const bool accept = ( minimumOuter > upperBound ) &
+                              ( maximumInner < lowerBound );
+          const bool reject = ( minimumInner < lowerBound ) |
+                              ( maximumOuter > upperBound );
+       //-----------------------------------------------------------------------
+          inBand   [ i ] = accept              ? 1.0 : 0.0;
+          undecided[ i ] = ( accept | reject ) ? 0.0 : 1.0;
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    unsigned long long inBandBits    = 0;
+    unsigned long long undecidedBits = 0;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t i = 0; i < blockPoints; i++ )
+      {
+          inBandBits    |= ( unsigned long long )( inBand   [ i ] ) << i;
+          undecidedBits |= ( unsigned long long )( undecided[ i ] ) << i;
+      };
+ //-----------------------------------------------------------------------------
+    rInBandBits    = inBandBits;
+    rUndecidedBits = undecidedBits;
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+static
+unsigned long long
+cullAltitudeBandBlock
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const ALTITUDE_BAND_BOUNDS
+                         & rBounds,
+            const size_t   blockPoints,
+            const double * x,
+            const double * y,
+            const double * z,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  size_t & rNumberRefinedPoints
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    cullAltitudeBandBlock
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Return the in band bits of a block of at most 64 points, bit k for
+//    point k, and add the number of points which needed the exact
+//    altitude to rNumberRefinedPoints.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    [ 1 ] A branch free pass, with the widest supported kernel,
+//          evaluates the four bounding ellipsoids of
+//          'initializeAltitudeBandBounds' at each point.  A point outside
+//          the outer ellipsoid of the minimum altitude and inside the
+//          inner ellipsoid of the maximum altitude is in the band; a
+//          point inside the inner ellipsoid of the minimum altitude or
+//          outside the outer ellipsoid of the maximum altitude is not.
+//
+//    [ 2 ] Every other point, which lies within a thin shell around an
+//          edge of the band or has a coordinate which is not finite,
+//          gets the altitude of 'convertEcefToGeodeticAltitude'.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    unsigned long long inBandBits;
+    unsigned long long undecidedBits;
+ //=============================================================================
+ //
+ // Pass 1:  Bounding ellipsoid tests.
+ //
+ //=============================================================================
+    if( supportedIsaLevel == AVX512_ISA_LEVEL )
+      {
+          classifyAltitudeBandBlockAvx512Kernel
+                 (
+                   rBounds,
+                   blockPoints,
+                   x,
+                   y,
+                   z,
+                   inBandBits,
+                   undecidedBits
+                 );
+      }
+    else if( supportedIsaLevel == AVX2_FMA_ISA_LEVEL )
+      {
+          classifyAltitudeBandBlockAvx2Kernel
+                 (
+                   rBounds,
+                   blockPoints,
+                   x,
+                   y,
+                   z,
+                   inBandBits,
+                   undecidedBits
+                 );
+      }
+    else
+      {
+          classifyAltitudeBandBlock
+                 (
+                   rBounds,
+                   blockPoints,
+                   x,
+                   y,
+                   z,
+                   inBandBits,
+                   undecidedBits
+                 );
+      };
+ //=============================================================================
+ //
+ // Pass 2:  Exact altitude of the undecided points.
+ //
+ //=============================================================================
+    while( undecidedBits != 0 )
+      {
+       //-----------------------------------------------------------------------
+          const int k = __builtin_ctzll( undecidedBits );
+       //-----------------------------------------------------------------------
+          const bool finiteCoordinates =
+                       ( fabs( x[ k ] ) <= DBL_MAX ) &&
+                       ( fabs( y[ k ] ) <= DBL_MAX ) &&
+                       ( fabs( z[ k ] ) <= DBL_MAX );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( finiteCoordinates )
+            {
+             //-----------------------------------------------------------------
+                double altitudeMeters;
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                ( void )
+                convertEcefToGeodeticAltitude
+                       (
+                         rEllipsoidContext,
+                         x[ k ],
+                         y[ k ],
+                         z[ k ],
+                         altitudeMeters
+                       );
+             //-----------------------------------------------------------------
+                if(
+                    ( altitudeMeters >= rBounds.minimumAltitudeMeters ) &&
+                    ( altitudeMeters <= rBounds.maximumAltitudeMeters )
+                  )
+                  {
+                     inBandBits |= 1ULL << k;
+                  };
+             //-----------------------------------------------------------------
+            };
+       //-----------------------------------------------------------------------
+          undecidedBits &= undecidedBits - 1;
+          rNumberRefinedPoints++;
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return( inBandBits );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+cullEcefPointsToAltitudeBand
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const double   minimumGeodeticAltitudeMeters,
+            const double   maximumGeodeticAltitudeMeters,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  unsigned long long
+                         * pInBandBits,
+                  size_t & rNumberInBandPoints,
+                  size_t & rNumberRefinedPoints
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    cullEcefPointsToAltitudeBand
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Find the points of a batch whose geodetic altitude lies in the band
+//    [ minimumGeodeticAltitudeMeters, maximumGeodeticAltitudeMeters ],
+//    for an ellipsoid context built by 'initializeEarthEllipsoidContext'.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    Most points are accepted or rejected by four bounding ellipsoid
+//    tests, two multiply adds each, without a square root or an
+//    arctangent.  Only the points within a shell of thickness
+//    | H | ( a / b - 1 ) around an edge H of the band get the single
+//    Halley step of 'convertEcefToGeodeticAltitude'.  A point is in the
+//    band exactly when the altitude of 'convertEcefToGeodetic' is.
+//
+//------------------------------------------------------------------------------
+//
+//  OUTPUT:
+//
+//     pInBandBits
+//       Array of ( numberPoints + 63 ) / 64 words.  Bit i % 64 of word
+//       i / 64 is set when point i is in the band.  The unused bits of
+//       the last word are clear.
+//
+//     rNumberInBandPoints
+//       The number of points in the band.
+//
+//     rNumberRefinedPoints
+//       The number of points which needed the exact altitude.
+//
+//------------------------------------------------------------------------------
+//
+//  RETURNED VALUE:
+//
+//     Validation status:
+//        SUCCESSFUL_CONVERSION
+//        INVALID_GEODETIC_ALTITUDE  An altitude is NAN, or the maximum
+//                                   altitude is below the minimum.  No
+//                                   output is written.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] An infinite maximum altitude tests for points above the
+//          minimum altitude.  A minimum altitude of -INFINITY, or any at
+//          or below -b^2 / a, leaves the band open below, and tests for
+//          points below the maximum altitude.
+//
+//    [ 2 ] Points with a coordinate which is not finite are not in the
+//          band.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    ALTITUDE_BAND_BOUNDS
+     bounds;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    ECEF_TO_GEODETIC_CONVERSION_STATUS
+     boundsStatus = initializeAltitudeBandBounds
+                           (
+                             rEllipsoidContext,
+                             minimumGeodeticAltitudeMeters,
+                             maximumGeodeticAltitudeMeters,
+                             bounds
+                           );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( boundsStatus != SUCCESSFUL_CONVERSION )
+      {
+          return( boundsStatus );
+      };
+ //-----------------------------------------------------------------------------
+    rNumberInBandPoints  = 0;
+    rNumberRefinedPoints = 0;
+ //-----------------------------------------------------------------------------
+    for(
+         size_t blockStart  = 0;
+                blockStart  < numberPoints;
+                blockStart += BLOCK_POINTS
+       )
+      {
+       //-----------------------------------------------------------------------
+          const
+          size_t
+           blockPoints = ( numberPoints - blockStart < BLOCK_POINTS ) ?
+                         ( numberPoints - blockStart ) : BLOCK_POINTS;
+       //-----------------------------------------------------------------------
+          const
+          unsigned long long
+           inBandBits = cullAltitudeBandBlock
+                               (
+                                 rEllipsoidContext,
+                                 bounds,
+                                 blockPoints,
+                                 pXEcefMeters + blockStart,
+                                 pYEcefMeters + blockStart,
+                                 pZEcefMeters + blockStart,
+                                 rNumberRefinedPoints
+                               );
+       //-----------------------------------------------------------------------
+          pInBandBits[ blockStart / BLOCK_POINTS ] = inBandBits;
+          rNumberInBandPoints += __builtin_popcountll( inBandBits );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return( SUCCESSFUL_CONVERSION );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+cullEcefPointsToAltitudeBandIndices
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const EARTH_ELLIPSOID_CONTEXT
+                         & rEllipsoidContext,
+            const double   minimumGeodeticAltitudeMeters,
+            const double   maximumGeodeticAltitudeMeters,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  size_t * pInBandIndices,
+                  size_t & rNumberInBandPoints,
+                  size_t & rNumberRefinedPoints
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    cullEcefPointsToAltitudeBandIndices
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    As 'cullEcefPointsToAltitudeBand', returning the indices of the
+//    points in the band, in increasing order, in the first
+//    rNumberInBandPoints elements of pInBandIndices, which must have room
+//    for numberPoints indices.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    ALTITUDE_BAND_BOUNDS
+     bounds;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    ECEF_TO_GEODETIC_CONVERSION_STATUS
+     boundsStatus = initializeAltitudeBandBounds
+                           (
+                             rEllipsoidContext,
+                             minimumGeodeticAltitudeMeters,
+                             maximumGeodeticAltitudeMeters,
+                             bounds
+                           );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( boundsStatus != SUCCESSFUL_CONVERSION )
+      {
+          return( boundsStatus );
+      };
+ //-----------------------------------------------------------------------------
+    rNumberInBandPoints  = 0;
+    rNumberRefinedPoints = 0;
+ //-----------------------------------------------------------------------------
+    for(
+         size_t blockStart  = 0;
+                blockStart  < numberPoints;
+                blockStart += BLOCK_POINTS
+       )
+      {
+       //-----------------------------------------------------------------------
+          const
+          size_t
+           blockPoints = ( numberPoints - blockStart < BLOCK_POINTS ) ?
+                         ( numberPoints - blockStart ) : BLOCK_POINTS;
+       //-----------------------------------------------------------------------
+          unsigned long long
+           inBandBits = cullAltitudeBandBlock
+                               (
+                                 rEllipsoidContext,
+                                 bounds,
+                                 blockPoints,
+                                 pXEcefMeters + blockStart,
+                                 pYEcefMeters + blockStart,
+                                 pZEcefMeters + blockStart,
+                                 rNumberRefinedPoints
+                               );
+       //-----------------------------------------------------------------------
+       // Compact the set bits into indices.
+       //-----------------------------------------------------------------------
+          while( inBandBits != 0 )
+            {
+               pInBandIndices[ rNumberInBandPoints ] =
+                                 blockStart + __builtin_ctzll( inBandBits );
+               rNumberInBandPoints++;
+               inBandBits &= inBandBits - 1;
+            };
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return( SUCCESSFUL_CONVERSION );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
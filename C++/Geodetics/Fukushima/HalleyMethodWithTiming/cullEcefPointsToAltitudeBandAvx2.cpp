@@ -0,0 +1,208 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <immintrin.h>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+static
+inline
+void
+classifyAltitudeBandLanesAvx2
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const __m256d  coefficients[ 8 ],
+            const __m256d  x,
+            const __m256d  y,
+            const __m256d  z,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  int    & rInBandLanes,
+                  int    & rUndecidedLanes
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    classifyAltitudeBandLanesAvx2
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The bounding ellipsoid tests of four points, as four bit lane masks.
+//    A lane which is not a number compares false everywhere, and so is
+//    undecided.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const __m256d pSquared = _mm256_fmadd_pd( x, x, _mm256_mul_pd( y, y ) );
+    const __m256d zSquared = _mm256_mul_pd( z, z );
+ //-----------------------------------------------------------------------------
+    const __m256d minimumZ = _mm256_mul_pd( zSquared, coefficients[ 2 ] );
+    const __m256d maximumZ = _mm256_mul_pd( zSquared, coefficients[ 5 ] );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const __m256d minimumInner = _mm256_fmadd_pd( pSquared,
+                                                  coefficients[ 0 ],
+                                                  minimumZ );
+    const __m256d minimumOuter = _mm256_fmadd_pd( pSquared,
+                                                  coefficients[ 1 ],
+                                                  minimumZ );
+    const __m256d maximumInner = _mm256_fmadd_pd( pSquared,
+                                                  coefficients[ 3 ],
+                                                  maximumZ );
+    const __m256d maximumOuter = _mm256_fmadd_pd( pSquared,
+                                                  coefficients[ 4 ],
+                                                  maximumZ );
+ //-----------------------------------------------------------------------------
+    const __m256d accept =
+            _mm256_and_pd
+                   (
+                     _mm256_cmp_pd( minimumOuter, coefficients[ 7 ],
+                                    _CMP_GT_OQ ),
+                     _mm256_cmp_pd( maximumInner, coefficients[ 6 ],
+                                    _CMP_LT_OQ )
+                   );
+    const __m256d reject =
+            _mm256_or_pd
+                   (
+                     _mm256_cmp_pd( minimumInner, coefficients[ 6 ],
+                                    _CMP_LT_OQ ),
+                     _mm256_cmp_pd( maximumOuter, coefficients[ 7 ],
+                                    _CMP_GT_OQ )
+                   );
+ //-----------------------------------------------------------------------------
+    rInBandLanes    = _mm256_movemask_pd( accept );
+    rUndecidedLanes = _mm256_movemask_pd( _mm256_or_pd( accept, reject ) )
+                      ^ 0xF;
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+classifyAltitudeBandBlockAvx2Kernel
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const ALTITUDE_BAND_BOUNDS
+                         & rBounds,
+            const size_t   blockPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  unsigned long long
+                         & rInBandBits,
+                  unsigned long long
+                         & rUndecidedBits
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    classifyAltitudeBandBlockAvx2Kernel
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Four lane AVX2 + FMA bounding ellipsoid tests of a block of at most
+//    64 points of 'cullEcefPointsToAltitudeBand'.  The lane masks of the
+//    compares are the bits of the block directly.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] This file is compiled with '-mavx2 -mfma'.  It must only be
+//          called when 'detectEcefToGeodeticIsaLevel' reports at least
+//          AVX2_FMA_ISA_LEVEL.
+//
+//    [ 2 ] The last blockPoints % 4 points are read with a masked load,
+//          so no lane reads past the arrays.  A masked off lane is the
+//          origin, which is below every valid band, so its bits are
+//          clear.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const __m256d coefficients[ 8 ] =
+      {
+        _mm256_set1_pd( rBounds.minimumInnerInverseASquared ),
+        _mm256_set1_pd( rBounds.minimumOuterInverseASquared ),
+        _mm256_set1_pd( rBounds.minimumInverseBSquared      ),
+        _mm256_set1_pd( rBounds.maximumInnerInverseASquared ),
+        _mm256_set1_pd( rBounds.maximumOuterInverseASquared ),
+        _mm256_set1_pd( rBounds.maximumInverseBSquared      ),
+        _mm256_set1_pd( rBounds.lowerTestBound              ),
+        _mm256_set1_pd( rBounds.upperTestBound              )
+      };
+ //-----------------------------------------------------------------------------
+    unsigned long long inBandBits    = 0;
+    unsigned long long undecidedBits = 0;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    int    inBandLanes;
+    int    undecidedLanes;
+    size_t i = 0;
+ //-----------------------------------------------------------------------------
+    for( ; ( i + 4 ) <= blockPoints; i += 4 )
+      {
+       //-----------------------------------------------------------------------
+          classifyAltitudeBandLanesAvx2
+                 (
+                   coefficients,
+                   _mm256_loadu_pd( pXEcefMeters + i ),
+                   _mm256_loadu_pd( pYEcefMeters + i ),
+                   _mm256_loadu_pd( pZEcefMeters + i ),
+                   inBandLanes,
+                   undecidedLanes
+                 );
+       //-----------------------------------------------------------------------
+          inBandBits    |= ( unsigned long long )( inBandLanes    ) << i;
+          undecidedBits |= ( unsigned long long )( undecidedLanes ) << i;
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    if( i < blockPoints )
+      {
+       //-----------------------------------------------------------------------
+          const __m256i laneMask =
+                  _mm256_cmpgt_epi64
+                         (
+                           _mm256_set1_epi64x( ( long long )
+                                               ( blockPoints - i ) ),
+                           _mm256_set_epi64x( 3, 2, 1, 0 )
+                         );
+       //-----------------------------------------------------------------------
+          classifyAltitudeBandLanesAvx2
+                 (
+                   coefficients,
+                   _mm256_maskload_pd( pXEcefMeters + i, laneMask ),
+                   _mm256_maskload_pd( pYEcefMeters + i, laneMask ),
+                   _mm256_maskload_pd( pZEcefMeters + i, laneMask ),
+                   inBandLanes,
+                   undecidedLanes
+                 );
+       //-----------------------------------------------------------------------
+          inBandBits    |= ( unsigned long long )( inBandLanes    ) << i;
+          undecidedBits |= ( unsigned long long )( undecidedLanes ) << i;
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    rInBandBits    = inBandBits;
+    rUndecidedBits = undecidedBits;
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
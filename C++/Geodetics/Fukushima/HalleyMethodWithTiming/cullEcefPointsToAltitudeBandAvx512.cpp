@@ -0,0 +1,144 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <immintrin.h>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+void
+classifyAltitudeBandBlockAvx512Kernel
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const ALTITUDE_BAND_BOUNDS
+                         & rBounds,
+            const size_t   blockPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  unsigned long long
+                         & rInBandBits,
+                  unsigned long long
+                         & rUndecidedBits
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    classifyAltitudeBandBlockAvx512Kernel
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Eight lane AVX-512 bounding ellipsoid tests of a block of at most
+//    64 points of 'cullEcefPointsToAltitudeBand'.  The compare masks are
+//    the bits of the block directly.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] This file is compiled with '-mavx512f -mfma'.  It must only be
+//          called when 'detectEcefToGeodeticIsaLevel' reports
+//          AVX512_ISA_LEVEL.
+//
+//    [ 2 ] Every group of eight points is read with a masked load, so no
+//          lane reads past the arrays, and the compares are masked, so a
+//          masked off lane has clear bits.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const __m512d minimumInnerInverseASquared =
+                    _mm512_set1_pd( rBounds.minimumInnerInverseASquared );
+    const __m512d minimumOuterInverseASquared =
+                    _mm512_set1_pd( rBounds.minimumOuterInverseASquared );
+    const __m512d minimumInverseBSquared =
+                    _mm512_set1_pd( rBounds.minimumInverseBSquared );
+    const __m512d maximumInnerInverseASquared =
+                    _mm512_set1_pd( rBounds.maximumInnerInverseASquared );
+    const __m512d maximumOuterInverseASquared =
+                    _mm512_set1_pd( rBounds.maximumOuterInverseASquared );
+    const __m512d maximumInverseBSquared =
+                    _mm512_set1_pd( rBounds.maximumInverseBSquared );
+    const __m512d lowerBound = _mm512_set1_pd( rBounds.lowerTestBound );
+    const __m512d upperBound = _mm512_set1_pd( rBounds.upperTestBound );
+ //-----------------------------------------------------------------------------
+    unsigned long long inBandBits    = 0;
+    unsigned long long undecidedBits = 0;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < blockPoints; i += 8 )
+      {
+       //-----------------------------------------------------------------------
+          const __mmask8 laneMask = ( blockPoints - i >= 8 ) ?
+                                    ( __mmask8 )( 0xFF ) :
+                                    ( __mmask8 )
+                                    ( ( 1U << ( blockPoints - i ) ) - 1U );
+       //-----------------------------------------------------------------------
+          const __m512d x = _mm512_maskz_loadu_pd( laneMask,
+                                                   pXEcefMeters + i );
+          const __m512d y = _mm512_maskz_loadu_pd( laneMask,
+                                                   pYEcefMeters + i );
+          const __m512d z = _mm512_maskz_loadu_pd( laneMask,
+                                                   pZEcefMeters + i );
+       //-----------------------------------------------------------------------
+          const __m512d pSquared = _mm512_fmadd_pd( x, x,
+                                                    _mm512_mul_pd( y, y ) );
+          const __m512d zSquared = _mm512_mul_pd( z, z );
+       //-----------------------------------------------------------------------
+          const __m512d minimumZ = _mm512_mul_pd( zSquared,
+                                                  minimumInverseBSquared );
+          const __m512d maximumZ = _mm512_mul_pd( zSquared,
+                                                  maximumInverseBSquared );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          const __m512d minimumInner =
+                          _mm512_fmadd_pd( pSquared,
+                                           minimumInnerInverseASquared,
+                                           minimumZ );
+          const __m512d minimumOuter =
+                          _mm512_fmadd_pd( pSquared,
+                                           minimumOuterInverseASquared,
+                                           minimumZ );
+          const __m512d maximumInner =
+                          _mm512_fmadd_pd( pSquared,
+                                           maximumInnerInverseASquared,
+                                           maximumZ );
+          const __m512d maximumOuter =
+                          _mm512_fmadd_pd( pSquared,
+                                           maximumOuterInverseASquared,
+                                           maximumZ );
+       //-----------------------------------------------------------------------
+       // A lane which is not a number compares false everywhere, and so
+       // is undecided.
+       //-----------------------------------------------------------------------
+          const __mmask8 accept =
+                  _mm512_mask_cmp_pd_mask( laneMask, minimumOuter,
+                                           upperBound, _CMP_GT_OQ ) &
+                  _mm512_mask_cmp_pd_mask( laneMask, maximumInner,
+                                           lowerBound, _CMP_LT_OQ );
+          const __mmask8 reject =
+                  _mm512_mask_cmp_pd_mask( laneMask, minimumInner,
+                                           lowerBound, _CMP_LT_OQ ) |
+                  _mm512_mask_cmp_pd_mask( laneMask, maximumOuter,
+                                           upperBound, _CMP_GT_OQ );
+       //-----------------------------------------------------------------------
+          inBandBits    |= ( unsigned long long )( accept ) << i;
+          undecidedBits |= ( unsigned long long )
+                           ( laneMask & ~( accept | reject ) ) << i;
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    rInBandBits    = inBandBits;
+    rUndecidedBits = undecidedBits;
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,169 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <cpuid.h>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_ISA_LEVEL
+detectEcefToGeodeticIsaLevel(  )
+//==============================================================================
+//
+//  FUNCTION:
+//    detectEcefToGeodeticIsaLevel
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Determine the widest batch conversion kernel instruction set
+//    architecture (ISA) level which the processor and the operating
+//    system both support.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    [ 1 ] CPUID leaf 1 reports FMA, AVX and OSXSAVE (ECX bits 12, 28, 27).
+//
+//    [ 2 ] CPUID leaf 7 sub-leaf 0 reports AVX2 and AVX512F (EBX bits 5
+//          and 16).
+//
+//    [ 3 ] XGETBV of XCR0 reports whether the operating system saves the
+//          YMM state (bits 1, 2) and the opmask and ZMM state (bits 5, 6,
+//          7) on context switches.  Without it the instructions fault even
+//          when the processor implements them.
+//
+//------------------------------------------------------------------------------
+//
+//  RETURNED VALUE:
+//     The widest supported level:
+//        AVX512_ISA_LEVEL
+//        AVX2_FMA_ISA_LEVEL
+//        BASELINE_ISA_LEVEL
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    ECEF_TO_GEODETIC_ISA_LEVEL
+            returnValue = BASELINE_ISA_LEVEL;
+ //-----------------------------------------------------------------------------
+    unsigned int eax = 0;
+    unsigned int ebx = 0;
+    unsigned int ecx = 0;
+    unsigned int edx = 0;
+ //-----------------------------------------------------------------------------
+    if( __get_cpuid( 1, &eax, &ebx, &ecx, &edx ) == 0 )
+      {
+          return( returnValue );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const bool fmaSupported     = ( ecx & ( 1U << 12 ) ) != 0;
+    const bool osxsaveSupported = ( ecx & ( 1U << 27 ) ) != 0;
+    const bool avxSupported     = ( ecx & ( 1U << 28 ) ) != 0;
+ //-----------------------------------------------------------------------------
+    if( !( osxsaveSupported && avxSupported && fmaSupported ) )
+      {
+          return( returnValue );
+      };
+ //-----------------------------------------------------------------------------
+    unsigned int xcr0Low  = 0;
+    unsigned int xcr0High = 0;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    __asm__ __volatile__
+      (
+        "xgetbv"
+        : "=a" ( xcr0Low ), "=d" ( xcr0High )
+        : "c"  ( 0 )
+      );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const bool ymmStateEnabled  = ( xcr0Low & 0x06 ) == 0x06;
+    const bool zmmStateEnabled  = ( xcr0Low & 0xE6 ) == 0xE6;
+ //-----------------------------------------------------------------------------
+    if(
+        ( __get_cpuid_count( 7, 0, &eax, &ebx, &ecx, &edx ) == 0 )
+        ||
+        !ymmStateEnabled
+      )
+      {
+          return( returnValue );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const bool avx2Supported    = ( ebx & ( 1U <<  5 ) ) != 0;
+    const bool avx512fSupported = ( ebx & ( 1U << 16 ) ) != 0;
+ //-----------------------------------------------------------------------------
+    if( avx2Supported )
+      {
+          returnValue = AVX2_FMA_ISA_LEVEL;
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( avx2Supported && avx512fSupported && zmmStateEnabled )
+      {
+          returnValue = AVX512_ISA_LEVEL;
+      };
+ //-----------------------------------------------------------------------------
+    return( returnValue );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_ISA_LEVEL
+detectEcefToGeodeticScalarCloneLevel(  )
+//==============================================================================
+//
+//  FUNCTION:
+//    detectEcefToGeodeticScalarCloneLevel
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Determine the widest clone of the scalar conversions which the
+//    processor and the operating system both support.  The clones are
+//    compiled for the x86-64 micro-architecture levels, so the levels
+//    are tested as a whole rather than by the AVX2, FMA and AVX512F bits
+//    of 'detectEcefToGeodeticIsaLevel':
+//
+//       AVX512_ISA_LEVEL     x86-64-v4  (AVX-512 F, BW, CD, DQ and VL)
+//       AVX2_FMA_ISA_LEVEL   x86-64-v3  (AVX2, FMA, BMI1, BMI2, F16C,
+//                                        LZCNT and MOVBE)
+//       BASELINE_ISA_LEVEL   x86-64
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    [ 1 ] '__builtin_cpu_supports' of the x86-64 level names, which also
+//          checks with XGETBV that the operating system saves the YMM and
+//          ZMM state.
+//
+//    [ 2 ] The load time resolvers of 'convertEcefToGeodetic' and
+//          'convertGeodeticToEcef' make the same tests inline, since they
+//          run before the other functions may be bound.  This function
+//          may also be called before the constructors of the program run,
+//          so it initializes the CPU model data of
+//          '__builtin_cpu_supports' itself.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    __builtin_cpu_init( );
+ //-----------------------------------------------------------------------------
+    if( __builtin_cpu_supports( "x86-64-v4" ) )
+      {
+          return( AVX512_ISA_LEVEL );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( __builtin_cpu_supports( "x86-64-v3" ) )
+      {
+          return( AVX2_FMA_ISA_LEVEL );
+      };
+ //-----------------------------------------------------------------------------
+    return( BASELINE_ISA_LEVEL );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,622 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+#include "convertEcefToGeodeticForEllipsoid.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+   using namespace std::chrono;
+
+//------------------------------------------------------------------------------
+// Error histograms: bin 0 holds the errors below 10^-6, the next bins 1/20
+// of a decade each up to 10^9, and the last bin larger errors and failed
+// conversions.
+//------------------------------------------------------------------------------
+static const int    ERROR_HISTOGRAM_BINS_PER_DECADE = 20;
+static const int    ERROR_HISTOGRAM_MINIMUM_EXPONENT = -6;
+static const int    ERROR_HISTOGRAM_MAXIMUM_EXPONENT =  9;
+static const int    ERROR_HISTOGRAM_BINS =
+                         ERROR_HISTOGRAM_BINS_PER_DECADE *
+                         ( ERROR_HISTOGRAM_MAXIMUM_EXPONENT -
+                           ERROR_HISTOGRAM_MINIMUM_EXPONENT ) + 2;
+
+//------------------------------------------------------------------------------
+struct
+ACCURACY_SWEEP_REGION_ACCUMULATOR
+  {
+    size_t numberPoints;
+    size_t numberFailedConversions;
+    double maximumLatitudeErrorMicroArcSecs;
+    double maximumAltitudeErrorNanoMeters;
+    size_t latitudeErrorHistogram[ ERROR_HISTOGRAM_BINS ];
+    size_t altitudeErrorHistogram[ ERROR_HISTOGRAM_BINS ];
+  };
+
+//------------------------------------------------------------------------------
+// The accumulators of one sweep thread, on cache lines of their own.
+//------------------------------------------------------------------------------
+struct
+alignas( 64 )
+ACCURACY_SWEEP_THREAD_ACCUMULATOR
+  {
+    ACCURACY_SWEEP_REGION_ACCUMULATOR
+         regions[ NUMBER_ACCURACY_SWEEP_LATITUDE_BANDS ]
+                [ NUMBER_ACCURACY_SWEEP_ALTITUDE_BANDS ];
+  };
+
+//------------------------------------------------------------------------------
+static
+int
+findErrorHistogramBin
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double absoluteError
+       )
+{
+ //-----------------------------------------------------------------------------
+ // NAN and infinite errors, of failed conversions, go to the last bin.
+ //-----------------------------------------------------------------------------
+    if( !( absoluteError < INFINITY ) )
+      {
+          return( ERROR_HISTOGRAM_BINS - 1 );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( absoluteError < 1.0E-6 )
+      {
+          return( 0 );
+      };
+ //-----------------------------------------------------------------------------
+    const double binPosition = ERROR_HISTOGRAM_BINS_PER_DECADE *
+                               ( log10( absoluteError ) -
+                                 ERROR_HISTOGRAM_MINIMUM_EXPONENT );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    return( min( ERROR_HISTOGRAM_BINS - 1, 1 + ( int )binPosition ) );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+static
+double
+findErrorHistogramPercentile
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const size_t * pHistogram,
+            const size_t   numberPoints,
+            const double   maximumError,
+            const double   fraction
+       )
+//==============================================================================
+//
+//  PURPOSE:
+//
+//    The upper edge of the bin holding the smallest error not exceeded by
+//    the fraction of the points, or the maximum error if smaller: an upper
+//    bound of that percentile.  INFINITY if it is in the overflow bin.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    if( numberPoints == 0 )
+      {
+          return( NAN );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const size_t rank = max( ( size_t )1,
+                             ( size_t )ceil( fraction * numberPoints ) );
+    size_t       count = 0;
+ //-----------------------------------------------------------------------------
+    for( int bin = 0; bin < ERROR_HISTOGRAM_BINS - 1; bin++ )
+      {
+          count += pHistogram[ bin ];
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( count >= rank )
+            {
+                return( min( maximumError,
+                             pow( 10.0,
+                                  ERROR_HISTOGRAM_MINIMUM_EXPONENT +
+                                  bin /
+                                  ( double )ERROR_HISTOGRAM_BINS_PER_DECADE )
+                           ) );
+            };
+      };
+ //-----------------------------------------------------------------------------
+    return( INFINITY );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+static
+int
+findLatitudeBand
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double latitudeDegrees
+       )
+{
+ //-----------------------------------------------------------------------------
+    int band = 0;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    while( band + 1 < NUMBER_ACCURACY_SWEEP_LATITUDE_BANDS
+           &&
+           fabs( latitudeDegrees ) >=
+                        ACCURACY_SWEEP_LATITUDE_BAND_DEGREES[ band + 1 ] )
+      {
+          band++;
+      };
+ //-----------------------------------------------------------------------------
+    return( band );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+static
+int
+findAltitudeBand
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double altitudeMeters
+       )
+{
+ //-----------------------------------------------------------------------------
+    int band = 0;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    while( band + 1 < NUMBER_ACCURACY_SWEEP_ALTITUDE_BANDS
+           &&
+           altitudeMeters >= ACCURACY_SWEEP_ALTITUDE_BAND_METERS[ band + 1 ] )
+      {
+          band++;
+      };
+ //-----------------------------------------------------------------------------
+    return( band );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+static
+void
+sweepAccuracyLatitudeRows
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const ACCURACY_SWEEP_SPECIFICATION
+                             * pSweepSpecification,
+            ECEF_TO_GEODETIC_BATCH_FUNCTION
+                               pConvertBatch,
+            const int          firstLatitudeIndex,
+            const int          endLatitudeIndex,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+            ACCURACY_SWEEP_THREAD_ACCUMULATOR
+                             * pAccumulator,
+            double           * pHeatMapLatitudeErrorMicroArcSecs,
+            double           * pHeatMapAltitudeErrorNanoMeters
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    sweepAccuracyLatitudeRows
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Convert the points of the latitude rows [ firstLatitudeIndex,
+//    endLatitudeIndex ), one row per batch call, and accumulate their
+//    errors into the accumulator of the calling thread and into the heat
+//    map rows, which no other thread writes.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    typedef ELLIPSOID_CONSTANTS< GRS80_ELLIPSOID > GRS80;
+ //-----------------------------------------------------------------------------
+    const ACCURACY_SWEEP_SPECIFICATION & rSpecification = *pSweepSpecification;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const double radiansPerDegree         = 4.0 * atan( 1.0 ) / 180.0;
+    const double microArcSecondsPerRadian = 3600.0E6 / radiansPerDegree;
+    const double nanoMetersPerMeter       = 1.0E9;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const int    numberLongitudes = rSpecification.numberLongitudes;
+    const int    numberAltitudes  = rSpecification.numberAltitudes;
+    const size_t rowPoints        = ( size_t )numberLongitudes *
+                                    numberAltitudes;
+ //-----------------------------------------------------------------------------
+    vector< double > trueAltitudeMeters( numberAltitudes );
+    vector< int    > altitudeBand      ( numberAltitudes );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int k = 0; k < numberAltitudes; k++ )
+      {
+          trueAltitudeMeters[ k ] =
+                     computeAccuracySweepAltitudeMeters( rSpecification, k );
+          altitudeBand      [ k ] =
+                     findAltitudeBand( trueAltitudeMeters[ k ] );
+      };
+ //-----------------------------------------------------------------------------
+    vector< double > xEcefMeters     ( rowPoints );
+    vector< double > yEcefMeters     ( rowPoints );
+    vector< double > zEcefMeters     ( rowPoints );
+    vector< double > latitudeRadians ( rowPoints );
+    vector< double > longitudeRadians( rowPoints );
+    vector< double > altitudeMeters  ( rowPoints );
+    vector< ECEF_TO_GEODETIC_CONVERSION_STATUS >
+                     conversionStatus( rowPoints );
+ //-----------------------------------------------------------------------------
+    for( int i = firstLatitudeIndex; i < endLatitudeIndex; i++ )
+      {
+       //-----------------------------------------------------------------------
+          const double trueLatitudeDegrees =
+                     computeAccuracySweepLatitudeDegrees( rSpecification, i );
+          const double trueLatitudeRadians =
+                     radiansPerDegree * trueLatitudeDegrees;
+          const int    latitudeBand        =
+                     findLatitudeBand( trueLatitudeDegrees );
+       //-----------------------------------------------------------------------
+       // Exact ECEF coordinates of the row, longitude major.
+       //-----------------------------------------------------------------------
+          for( int j = 0; j < numberLongitudes; j++ )
+            {
+                const double longitudeRadians =
+                     radiansPerDegree *
+                     computeAccuracySweepLongitudeDegrees( rSpecification, j );
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                for( int k = 0; k < numberAltitudes; k++ )
+                  {
+                     const size_t p = ( size_t )j * numberAltitudes + k;
+                  //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                     ( void )
+                     convertGeodeticToEcef
+                            (
+                              GRS80::earthEquatorialRadiusMeters,
+                              GRS80::earthEllipticitySquared,
+                              trueLatitudeRadians,
+                              longitudeRadians,
+                              trueAltitudeMeters[ k ],
+                              xEcefMeters[ p ],
+                              yEcefMeters[ p ],
+                              zEcefMeters[ p ]
+                            );
+                  };
+            };
+       //-----------------------------------------------------------------------
+          ( void )
+          pConvertBatch
+                 (
+                   GRS80::earthEquatorialRadiusMeters,
+                   GRS80::earthEllipsoidalFlatteningFactor,
+                   rowPoints,
+                   xEcefMeters.data( ),
+                   yEcefMeters.data( ),
+                   zEcefMeters.data( ),
+                   latitudeRadians.data( ),
+                   longitudeRadians.data( ),
+                   altitudeMeters.data( ),
+                   conversionStatus.data( )
+                 );
+       //-----------------------------------------------------------------------
+       // Errors of the row.
+       //-----------------------------------------------------------------------
+          double * pRowLatitudeError = NULL;
+          double * pRowAltitudeError = NULL;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( pHeatMapLatitudeErrorMicroArcSecs != NULL
+              &&
+              pHeatMapAltitudeErrorNanoMeters   != NULL )
+            {
+                pRowLatitudeError = pHeatMapLatitudeErrorMicroArcSecs +
+                                    ( size_t )i * numberAltitudes;
+                pRowAltitudeError = pHeatMapAltitudeErrorNanoMeters   +
+                                    ( size_t )i * numberAltitudes;
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                fill( pRowLatitudeError, pRowLatitudeError + numberAltitudes,
+                      0.0 );
+                fill( pRowAltitudeError, pRowAltitudeError + numberAltitudes,
+                      0.0 );
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t p = 0; p < rowPoints; p++ )
+            {
+                const int k = ( int )( p % numberAltitudes );
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                ACCURACY_SWEEP_REGION_ACCUMULATOR & rRegion =
+                        pAccumulator->regions[ latitudeBand ]
+                                             [ altitudeBand[ k ] ];
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                double latitudeError = microArcSecondsPerRadian *
+                                       fabs( trueLatitudeRadians -
+                                             latitudeRadians[ p ] );
+                double altitudeError = nanoMetersPerMeter *
+                                       fabs( trueAltitudeMeters[ k ] -
+                                             altitudeMeters[ p ] );
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                rRegion.numberPoints++;
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                if( conversionStatus[ p ] != SUCCESSFUL_CONVERSION
+                    ||
+                    !( latitudeError < INFINITY )
+                    ||
+                    !( altitudeError < INFINITY ) )
+                  {
+                     rRegion.numberFailedConversions++;
+                     latitudeError = INFINITY;
+                     altitudeError = INFINITY;
+                  };
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                rRegion.maximumLatitudeErrorMicroArcSecs =
+                     max( rRegion.maximumLatitudeErrorMicroArcSecs,
+                          latitudeError );
+                rRegion.maximumAltitudeErrorNanoMeters   =
+                     max( rRegion.maximumAltitudeErrorNanoMeters,
+                          altitudeError );
+                rRegion.latitudeErrorHistogram
+                                [ findErrorHistogramBin( latitudeError ) ]++;
+                rRegion.altitudeErrorHistogram
+                                [ findErrorHistogramBin( altitudeError ) ]++;
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                if( pRowLatitudeError != NULL )
+                  {
+                     pRowLatitudeError[ k ] = max( pRowLatitudeError[ k ],
+                                                   latitudeError );
+                     pRowAltitudeError[ k ] = max( pRowAltitudeError[ k ],
+                                                   altitudeError );
+                  };
+            };
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+static
+void
+finishAccuracySweepStatistics
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const ACCURACY_SWEEP_REGION_ACCUMULATOR
+                                  & rRegion,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+            ACCURACY_SWEEP_STATISTICS
+                                  & rStatistics
+       )
+{
+ //-----------------------------------------------------------------------------
+    const size_t n = rRegion.numberPoints;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    rStatistics.numberPoints                   = n;
+    rStatistics.numberFailedConversions        =
+                             rRegion.numberFailedConversions;
+    rStatistics.maximumLatitudeErrorMicroArcSecs =
+                  ( n > 0 ) ? rRegion.maximumLatitudeErrorMicroArcSecs : NAN;
+    rStatistics.maximumAltitudeErrorNanoMeters =
+                  ( n > 0 ) ? rRegion.maximumAltitudeErrorNanoMeters   : NAN;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    rStatistics.percentile50LatitudeErrorMicroArcSecs =
+       findErrorHistogramPercentile
+              ( rRegion.latitudeErrorHistogram, n,
+                rRegion.maximumLatitudeErrorMicroArcSecs, 0.5 );
+    rStatistics.percentile99LatitudeErrorMicroArcSecs =
+       findErrorHistogramPercentile
+              ( rRegion.latitudeErrorHistogram, n,
+                rRegion.maximumLatitudeErrorMicroArcSecs, 0.99 );
+    rStatistics.percentile999LatitudeErrorMicroArcSecs =
+       findErrorHistogramPercentile
+              ( rRegion.latitudeErrorHistogram, n,
+                rRegion.maximumLatitudeErrorMicroArcSecs, .999 );
+    rStatistics.percentile50AltitudeErrorNanoMeters =
+       findErrorHistogramPercentile
+              ( rRegion.altitudeErrorHistogram, n,
+                rRegion.maximumAltitudeErrorNanoMeters, 0.5 );
+    rStatistics.percentile99AltitudeErrorNanoMeters =
+       findErrorHistogramPercentile
+              ( rRegion.altitudeErrorHistogram, n,
+                rRegion.maximumAltitudeErrorNanoMeters, 0.99 );
+    rStatistics.percentile999AltitudeErrorNanoMeters =
+       findErrorHistogramPercentile
+              ( rRegion.altitudeErrorHistogram, n,
+                rRegion.maximumAltitudeErrorNanoMeters, .999 );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+static
+void
+mergeAccuracySweepRegion
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const ACCURACY_SWEEP_REGION_ACCUMULATOR
+                                  & rRegion,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+            ACCURACY_SWEEP_REGION_ACCUMULATOR
+                                  & rTotal
+       )
+{
+ //-----------------------------------------------------------------------------
+    rTotal.numberPoints            += rRegion.numberPoints;
+    rTotal.numberFailedConversions += rRegion.numberFailedConversions;
+    rTotal.maximumLatitudeErrorMicroArcSecs =
+                    max( rTotal.maximumLatitudeErrorMicroArcSecs,
+                         rRegion.maximumLatitudeErrorMicroArcSecs );
+    rTotal.maximumAltitudeErrorNanoMeters   =
+                    max( rTotal.maximumAltitudeErrorNanoMeters,
+                         rRegion.maximumAltitudeErrorNanoMeters );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int bin = 0; bin < ERROR_HISTOGRAM_BINS; bin++ )
+      {
+          rTotal.latitudeErrorHistogram[ bin ] +=
+                                   rRegion.latitudeErrorHistogram[ bin ];
+          rTotal.altitudeErrorHistogram[ bin ] +=
+                                   rRegion.altitudeErrorHistogram[ bin ];
+      };
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+double
+executeAccuracySweepConvertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const ACCURACY_SWEEP_SPECIFICATION
+                            & rSweepSpecification,
+            ECEF_TO_GEODETIC_BATCH_FUNCTION
+                              pConvertBatch,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+            ACCURACY_SWEEP_STATISTICS
+              regionStatistics[ NUMBER_ACCURACY_SWEEP_LATITUDE_BANDS ]
+                              [ NUMBER_ACCURACY_SWEEP_ALTITUDE_BANDS ],
+            ACCURACY_SWEEP_STATISTICS
+                            & rSweepStatistics,
+            double          * pHeatMapLatitudeErrorMicroArcSecs,
+            double          * pHeatMapAltitudeErrorNanoMeters
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    executeAccuracySweepConvertEcefToGeodetic
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Certify a batch conversion kernel over a dense grid of geodetic
+//    latitude, longitude and altitude: convert the exact ECEF coordinates
+//    of every grid point and gather the latitude and altitude errors by
+//    region of latitude and altitude, and optionally as heat maps.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    [ 1 ] The latitude rows are split into contiguous ranges, one per
+//          thread; the calling thread takes the first.  A row, all its
+//          longitudes and altitudes, is one call of pConvertBatch.
+//
+//    [ 2 ] Each thread accumulates point counts, maxima and 1/20 decade
+//          error histograms per region in its own cache line aligned
+//          accumulator.  After the join they are merged in thread order;
+//          all sums are integer and max is exact, so the statistics do
+//          not depend on the number of threads.
+//
+//    [ 3 ] Percentiles are read from the merged histograms, as the upper
+//          edge of the bin holding them, which bounds them within 12%.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The exact ECEF coordinates come from 'convertGeodeticToEcef',
+//          whose own rounding, a few tenths of a nanometer, is part of the
+//          measured error.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const auto sweepStartTime = steady_clock::now( );
+ //-----------------------------------------------------------------------------
+    const int numberLatitudes = max( 0, rSweepSpecification.numberLatitudes );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    size_t
+     sweepThreads = ( rSweepSpecification.numberThreads > 0 ) ?
+                    rSweepSpecification.numberThreads :
+                    max( 1u, thread::hardware_concurrency( ) );
+    sweepThreads = max( ( size_t )1,
+                        min( sweepThreads, ( size_t )numberLatitudes ) );
+ //-----------------------------------------------------------------------------
+ // Value initialized: all counts and maxima zero.
+ //-----------------------------------------------------------------------------
+    vector< ACCURACY_SWEEP_THREAD_ACCUMULATOR > accumulators( sweepThreads );
+    vector< thread >                            sweepWorkers;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    sweepWorkers.reserve( sweepThreads - 1 );
+ //-----------------------------------------------------------------------------
+    for( size_t k = 1; k < sweepThreads; k++ )
+      {
+          sweepWorkers.emplace_back
+                 (
+                   sweepAccuracyLatitudeRows,
+                   &rSweepSpecification,
+                   pConvertBatch,
+                   ( int )(   k       * numberLatitudes / sweepThreads ),
+                   ( int )( ( k + 1 ) * numberLatitudes / sweepThreads ),
+                   &accumulators[ k ],
+                   pHeatMapLatitudeErrorMicroArcSecs,
+                   pHeatMapAltitudeErrorNanoMeters
+                 );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    sweepAccuracyLatitudeRows
+           (
+             &rSweepSpecification,
+             pConvertBatch,
+             0,
+             ( int )( numberLatitudes / sweepThreads ),
+             &accumulators[ 0 ],
+             pHeatMapLatitudeErrorMicroArcSecs,
+             pHeatMapAltitudeErrorNanoMeters
+           );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( thread & rSweepWorker : sweepWorkers )
+      {
+          rSweepWorker.join( );
+      };
+ //-----------------------------------------------------------------------------
+ // Merge in thread order, then into the whole sweep.
+ //-----------------------------------------------------------------------------
+    ACCURACY_SWEEP_REGION_ACCUMULATOR sweepTotal = { };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int b = 0; b < NUMBER_ACCURACY_SWEEP_LATITUDE_BANDS; b++ )
+      {
+          for( int c = 0; c < NUMBER_ACCURACY_SWEEP_ALTITUDE_BANDS; c++ )
+            {
+                ACCURACY_SWEEP_REGION_ACCUMULATOR regionTotal = { };
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                for( size_t k = 0; k < sweepThreads; k++ )
+                  {
+                     mergeAccuracySweepRegion
+                            (
+                              accumulators[ k ].regions[ b ][ c ],
+                              regionTotal
+                            );
+                  };
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                finishAccuracySweepStatistics( regionTotal,
+                                               regionStatistics[ b ][ c ] );
+                mergeAccuracySweepRegion( regionTotal, sweepTotal );
+            };
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    finishAccuracySweepStatistics( sweepTotal, rSweepStatistics );
+ //-----------------------------------------------------------------------------
+    return( duration< double >( steady_clock::now( ) - sweepStartTime )
+            .count( ) );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
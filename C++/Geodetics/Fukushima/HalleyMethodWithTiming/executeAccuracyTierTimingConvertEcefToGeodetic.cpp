@@ -0,0 +1,421 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+
+//------------------------------------------------------------------------------
+struct
+ACCURACY_TIER_TIMING_RUN_DATA
+  {
+    const EARTH_ELLIPSOID_CONTEXT      * pEllipsoidContext;
+    ECEF_TO_GEODETIC_ACCURACY_TIER       accuracyTier;
+    size_t                               numberPoints;
+    const double                       * pXEcefMeters;
+    const double                       * pYEcefMeters;
+    const double                       * pZEcefMeters;
+    double                             * pGeodeticNorthLatitudeRadians;
+    double                             * pGeocentricEastLongitudeRadians;
+    double                             * pGeodeticAltitudeMeters;
+    ECEF_TO_GEODETIC_CONVERSION_STATUS * pConversionStatus;
+  };
+
+//------------------------------------------------------------------------------
+// One timed run: one scalar accuracy tier call per point.
+//------------------------------------------------------------------------------
+static
+void
+convertAccuracyTierScalarTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    ACCURACY_TIER_TIMING_RUN_DATA
+        & rRunData = *( ACCURACY_TIER_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < rRunData.numberPoints; i++ )
+      {
+          rRunData.pConversionStatus[ i ] =
+          convertEcefToGeodetic
+                 (
+                   *rRunData.pEllipsoidContext,
+                   rRunData.accuracyTier,
+                   rRunData.pXEcefMeters[ i ],
+                   rRunData.pYEcefMeters[ i ],
+                   rRunData.pZEcefMeters[ i ],
+                   rRunData.pGeodeticNorthLatitudeRadians  [ i ],
+                   rRunData.pGeocentricEastLongitudeRadians[ i ],
+                   rRunData.pGeodeticAltitudeMeters        [ i ]
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: one accuracy tier batch call over the points.
+//------------------------------------------------------------------------------
+static
+void
+convertAccuracyTierBatchTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    ACCURACY_TIER_TIMING_RUN_DATA
+        & rRunData = *( ACCURACY_TIER_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticBatch
+           (
+             *rRunData.pEllipsoidContext,
+             rRunData.accuracyTier,
+             rRunData.numberPoints,
+             rRunData.pXEcefMeters,
+             rRunData.pYEcefMeters,
+             rRunData.pZEcefMeters,
+             rRunData.pGeodeticNorthLatitudeRadians,
+             rRunData.pGeocentricEastLongitudeRadians,
+             rRunData.pGeodeticAltitudeMeters,
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+executeAccuracyTierTimingConvertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const
+            int      numberPointsExponent
+         //-------------------
+         // OUTPUT(s):
+         //           NONE
+         //-------------------
+       )
+//==============================================================================
+//|
+//| FUNCTION:
+//|
+//|   executeAccuracyTierTimingConvertEcefToGeodetic
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| PURPOSE:
+//|
+//|   To report, for each accuracy tier, the execution time per point of
+//|   the scalar and batch accuracy tier overloads of
+//|   'convertEcefToGeodetic' and 'convertEcefToGeodeticBatch', their
+//|   speedup over the full tier scalar function, and their largest
+//|   latitude, longitude and altitude errors against the error bounds of
+//|   the tier.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| INPUT(s):
+//|
+//|   numberPointsExponent
+//|     The base ten exponent of the number of points.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| METHOD:
+//|
+//|   [ 1 ]  Generate 10^numberPointsExponent true geodetic points, with
+//|          uniform latitude and longitude and altitudes from -10 km to
+//|          50000 km evenly spaced in asinh( h / 1 km ), as in the
+//|          accuracy sweep.  Every 97th point is put on a pole.
+//|
+//|   [ 2 ]  Time each tier and route with 'measureConversionTiming'.
+//|
+//|   [ 3 ]  The errors are measured against the true geodetic points.
+//|          The latitude and longitude errors are in radians, the
+//|          longitude error scaled by the cosine of the latitude, as a
+//|          distance along the surface divided by the Earth's radius.
+//|
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const
+    double
+     piRadians                           = 4.0 * atan( 1.0 );
+ //-----------------------------------------------------------------------------
+ //
+ // GRS1980 System
+ //
+ //-----------------------------------------------------------------------------
+    const
+    double
+     earthEquatorialRadiusMeters         = 6378137.0E0;
+    const
+    double
+     earthEllipsoidalFlatteningFactor    = 1.0E0 / 298.257222101E0;
+    const
+    double
+     earthEllipsoidalEccentricitySquared =
+                         ( 2.0E0 - earthEllipsoidalFlatteningFactor )
+                         *
+                         earthEllipsoidalFlatteningFactor;
+ //-----------------------------------------------------------------------------
+    const
+    int
+     NUMBER_WARM_UP_RUNS = 1;
+    const
+    int
+     NUMBER_TIMED_RUNS   = 7;
+ //-----------------------------------------------------------------------------
+    EARTH_ELLIPSOID_CONTEXT
+     ellipsoidContext;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    ( void )
+    initializeEarthEllipsoidContext
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalFlatteningFactor,
+             ellipsoidContext
+           );
+ //-----------------------------------------------------------------------------
+    size_t
+     numberPoints = 1;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int exponent = 0; exponent < numberPointsExponent; exponent++ )
+      {
+          numberPoints = 10 * numberPoints;
+      };
+ //-----------------------------------------------------------------------------
+ // Generate the true geodetic points and their ECEF coordinates.
+ //-----------------------------------------------------------------------------
+    vector< double > trueLatitudeRadians ( numberPoints );
+    vector< double > trueLongitudeRadians( numberPoints );
+    vector< double > trueAltitudeMeters  ( numberPoints );
+    vector< double > xEcefMeters         ( numberPoints );
+    vector< double > yEcefMeters         ( numberPoints );
+    vector< double > zEcefMeters         ( numberPoints );
+    vector< double > latitudeRadians     ( numberPoints );
+    vector< double > longitudeRadians    ( numberPoints );
+    vector< double > altitudeMeters      ( numberPoints );
+    vector< ECEF_TO_GEODETIC_CONVERSION_STATUS >
+                     conversionStatus    ( numberPoints );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    generateTimingGeodeticPoints
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalEccentricitySquared,
+             -1.0E4,
+             5.0E7,
+             ASINH_TIMING_ALTITUDE_SPACING,
+             97,
+             numberPoints,
+             trueLatitudeRadians .data( ),
+             trueLongitudeRadians.data( ),
+             trueAltitudeMeters  .data( ),
+             xEcefMeters         .data( ),
+             yEcefMeters         .data( ),
+             zEcefMeters         .data( ),
+             NULL
+           );
+ //-----------------------------------------------------------------------------
+    ACCURACY_TIER_TIMING_RUN_DATA
+     runData;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    runData.pEllipsoidContext               = &ellipsoidContext;
+    runData.accuracyTier                    = FULL_ACCURACY_TIER;
+    runData.numberPoints                    = numberPoints;
+    runData.pXEcefMeters                    = xEcefMeters     .data( );
+    runData.pYEcefMeters                    = yEcefMeters     .data( );
+    runData.pZEcefMeters                    = zEcefMeters     .data( );
+    runData.pGeodeticNorthLatitudeRadians   = latitudeRadians .data( );
+    runData.pGeocentricEastLongitudeRadians = longitudeRadians.data( );
+    runData.pGeodeticAltitudeMeters         = altitudeMeters  .data( );
+    runData.pConversionStatus               = conversionStatus.data( );
+ //-----------------------------------------------------------------------------
+ // The full tier is timed first, so it is the reference of the speedups.
+ //-----------------------------------------------------------------------------
+    const
+    ECEF_TO_GEODETIC_ACCURACY_TIER
+     accuracyTiers[ 3 ]     = { FULL_ACCURACY_TIER,
+                                SURVEY_ACCURACY_TIER,
+                                DISPLAY_ACCURACY_TIER };
+    const
+    char *
+     tierNames[ 3 ]         = { "Full", "Survey", "Display" };
+    const
+    double
+     angleBoundsRadians[ 3 ] = { FULL_ACCURACY_TIER_ANGLE_BOUND_RADIANS,
+                                 SURVEY_ACCURACY_TIER_ANGLE_BOUND_RADIANS,
+                                 DISPLAY_ACCURACY_TIER_ANGLE_BOUND_RADIANS };
+    const
+    double
+     altitudeBoundsMeters[ 3 ] =
+                              { FULL_ACCURACY_TIER_ALTITUDE_BOUND_METERS,
+                                SURVEY_ACCURACY_TIER_ALTITUDE_BOUND_METERS,
+                                DISPLAY_ACCURACY_TIER_ALTITUDE_BOUND_METERS };
+    const
+    char *
+     routeNames[ 2 ]        = { "scalar", "batch" };
+    void
+     ( *routeRuns[ 2 ] )( void * ) = { convertAccuracyTierScalarTimingRun,
+                                       convertAccuracyTierBatchTimingRun };
+ //-----------------------------------------------------------------------------
+ // Report header.
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "\n\n\n"
+       "%s%s\n"
+       "%s\n%s\n%s\n"
+       "%s%zu%s\n"
+       "%s\n"
+       "%s%s\n"
+       "%s%s\n"
+       "%s%s\n"
+       "%s%s\n",
+       "============================================",
+       "============================================",
+       "|",
+       "| ACCURACY TIER TIMING RESULTS:",
+       "|",
+       "|    ",
+       numberPoints,
+       " points from -10 km to 50000 km altitude",
+       "|",
+       "|-------------------------------------------",
+       "--------------------------------------------",
+       "|    Tier, route     [ns/point]      MAD  vs full  Lat/Lon err",
+       "   Alt err  Bound  Bound",
+       "|                                                      [rad]",
+       "       [m]  [rad]    [m]",
+       "|-------------------------------------------",
+       "--------------------------------------------"
+     );
+ //-----------------------------------------------------------------------------
+ // Loop over the tiers and routes.
+ //-----------------------------------------------------------------------------
+    double
+     fullScalarNanoSecondsPerPoint = NAN;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int tier = 0; tier < 3; tier++ )
+      {
+          fprintf( stdout, "|\n" );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( int route = 0; route < 2; route++ )
+            {
+             //-----------------------------------------------------------------
+                runData.accuracyTier = accuracyTiers[ tier ];
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                CONVERSION_TIMING_STATISTICS
+                 routeTiming;
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                measureConversionTiming
+                       (
+                         routeRuns[ route ],
+                         &runData,
+                         numberPoints,
+                         NUMBER_WARM_UP_RUNS,
+                         NUMBER_TIMED_RUNS,
+                         routeTiming
+                       );
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                if( ( tier == 0 ) && ( route == 0 ) )
+                  {
+                     fullScalarNanoSecondsPerPoint =
+                                       routeTiming.medianNanoSecondsPerPoint;
+                  };
+             //-----------------------------------------------------------------
+             // Errors of the last run.  A point which is not converted
+             // counts as an infinite error.
+             //-----------------------------------------------------------------
+                double maximumAngleErrorRadians   = 0.0;
+                double maximumAltitudeErrorMeters = 0.0;
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                for( size_t i = 0; i < numberPoints; i++ )
+                  {
+                     if( conversionStatus[ i ] != SUCCESSFUL_CONVERSION )
+                       {
+                          maximumAngleErrorRadians   = INFINITY;
+                          maximumAltitudeErrorMeters = INFINITY;
+                          continue;
+                       };
+                  //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                     double longitudeError = fabs( longitudeRadians    [ i ] -
+                                                   trueLongitudeRadians[ i ] );
+                  //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                     longitudeError = min( longitudeError,
+                                           2.0 * piRadians - longitudeError ) *
+                                      cos( trueLatitudeRadians[ i ] );
+                  //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                     maximumAngleErrorRadians =
+                     max( maximumAngleErrorRadians,
+                          max( fabs( latitudeRadians    [ i ] -
+                                     trueLatitudeRadians[ i ] ),
+                               longitudeError ) );
+                     maximumAltitudeErrorMeters =
+                     max( maximumAltitudeErrorMeters,
+                          fabs( altitudeMeters    [ i ] -
+                                trueAltitudeMeters[ i ] ) );
+                  };
+             //-----------------------------------------------------------------
+                fprintf
+                 (
+                   stdout,
+                   "|    %-7s %-6s %11.3f %8.3f %8.2f %11.2e %9.2e"
+                   " %6.0e %6.0e%s\n",
+                   tierNames [ tier  ],
+                   routeNames[ route ],
+                   routeTiming.medianNanoSecondsPerPoint,
+                   routeTiming.madNanoSecondsPerPoint,
+                   fullScalarNanoSecondsPerPoint /
+                   routeTiming.medianNanoSecondsPerPoint,
+                   maximumAngleErrorRadians,
+                   maximumAltitudeErrorMeters,
+                   angleBoundsRadians  [ tier ],
+                   altitudeBoundsMeters[ tier ],
+                   (
+                     ( maximumAngleErrorRadians   <=
+                       angleBoundsRadians  [ tier ] )
+                     &&
+                     ( maximumAltitudeErrorMeters <=
+                       altitudeBoundsMeters[ tier ] )
+                   ) ? "" : "  EXCEEDED"
+                 );
+             //-----------------------------------------------------------------
+            };
+      };
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "%s\n"
+       "%s%s\n"
+       "\n\n\n",
+       "|",
+       "============================================",
+       "============================================"
+     );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,628 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+
+//------------------------------------------------------------------------------
+struct
+ALTITUDE_BAND_TIMING_RUN_DATA
+  {
+    const EARTH_ELLIPSOID_CONTEXT      * pEllipsoidContext;
+    double                               minimumAltitudeMeters;
+    double                               maximumAltitudeMeters;
+    size_t                               numberPoints;
+    const double                       * pXEcefMeters;
+    const double                       * pYEcefMeters;
+    const double                       * pZEcefMeters;
+    double                             * pGeodeticNorthLatitudeRadians;
+    double                             * pGeocentricEastLongitudeRadians;
+    double                             * pGeodeticAltitudeMeters;
+    ECEF_TO_GEODETIC_CONVERSION_STATUS * pConversionStatus;
+    unsigned long long                 * pInBandBits;
+    size_t                             * pInBandIndices;
+    size_t                               numberInBandPoints;
+    size_t                               numberRefinedPoints;
+    double                               coordinateSum;
+  };
+
+//------------------------------------------------------------------------------
+// Set the in band bits of the altitudes of a run.
+//------------------------------------------------------------------------------
+static
+void
+setInBandBitsFromAltitudes
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            ALTITUDE_BAND_TIMING_RUN_DATA
+                  & rRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    fill
+     (
+       rRunData.pInBandBits,
+       rRunData.pInBandBits + ( rRunData.numberPoints + 63 ) / 64,
+       0ULL
+     );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    rRunData.numberInBandPoints  = 0;
+    rRunData.numberRefinedPoints = rRunData.numberPoints;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < rRunData.numberPoints; i++ )
+      {
+          if(
+              ( rRunData.pGeodeticAltitudeMeters[ i ] >=
+                rRunData.minimumAltitudeMeters )
+              &&
+              ( rRunData.pGeodeticAltitudeMeters[ i ] <=
+                rRunData.maximumAltitudeMeters )
+            )
+            {
+               rRunData.pInBandBits[ i / 64 ] |= 1ULL << ( i % 64 );
+               rRunData.numberInBandPoints++;
+            };
+      };
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: read the coordinates only, the memory bandwidth floor.
+//------------------------------------------------------------------------------
+static
+void
+readCoordinatesTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    ALTITUDE_BAND_TIMING_RUN_DATA
+        & rRunData = *( ALTITUDE_BAND_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    double coordinateSum = 0.0;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t i = 0; i < rRunData.numberPoints; i++ )
+      {
+          coordinateSum += rRunData.pXEcefMeters[ i ] +
+                           rRunData.pYEcefMeters[ i ] +
+                           rRunData.pZEcefMeters[ i ];
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    rRunData.coordinateSum = coordinateSum;
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: one full batch call, then the altitude comparisons.
+//------------------------------------------------------------------------------
+static
+void
+cullWithFullBatchTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    ALTITUDE_BAND_TIMING_RUN_DATA
+        & rRunData = *( ALTITUDE_BAND_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticBatch
+           (
+             *rRunData.pEllipsoidContext,
+             rRunData.numberPoints,
+             rRunData.pXEcefMeters,
+             rRunData.pYEcefMeters,
+             rRunData.pZEcefMeters,
+             rRunData.pGeodeticNorthLatitudeRadians,
+             rRunData.pGeocentricEastLongitudeRadians,
+             rRunData.pGeodeticAltitudeMeters,
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    setInBandBitsFromAltitudes( rRunData );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: one altitude only batch call, then the comparisons.
+//------------------------------------------------------------------------------
+static
+void
+cullWithAltitudeBatchTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    ALTITUDE_BAND_TIMING_RUN_DATA
+        & rRunData = *( ALTITUDE_BAND_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticAltitudeBatch
+           (
+             *rRunData.pEllipsoidContext,
+             rRunData.numberPoints,
+             rRunData.pXEcefMeters,
+             rRunData.pYEcefMeters,
+             rRunData.pZEcefMeters,
+             rRunData.pGeodeticAltitudeMeters,
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    setInBandBitsFromAltitudes( rRunData );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: one bit mask culling call.
+//------------------------------------------------------------------------------
+static
+void
+cullToBitsTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    ALTITUDE_BAND_TIMING_RUN_DATA
+        & rRunData = *( ALTITUDE_BAND_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    ( void )
+    cullEcefPointsToAltitudeBand
+           (
+             *rRunData.pEllipsoidContext,
+             rRunData.minimumAltitudeMeters,
+             rRunData.maximumAltitudeMeters,
+             rRunData.numberPoints,
+             rRunData.pXEcefMeters,
+             rRunData.pYEcefMeters,
+             rRunData.pZEcefMeters,
+             rRunData.pInBandBits,
+             rRunData.numberInBandPoints,
+             rRunData.numberRefinedPoints
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: one compacted index culling call.
+//------------------------------------------------------------------------------
+static
+void
+cullToIndicesTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    ALTITUDE_BAND_TIMING_RUN_DATA
+        & rRunData = *( ALTITUDE_BAND_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    ( void )
+    cullEcefPointsToAltitudeBandIndices
+           (
+             *rRunData.pEllipsoidContext,
+             rRunData.minimumAltitudeMeters,
+             rRunData.maximumAltitudeMeters,
+             rRunData.numberPoints,
+             rRunData.pXEcefMeters,
+             rRunData.pYEcefMeters,
+             rRunData.pZEcefMeters,
+             rRunData.pInBandIndices,
+             rRunData.numberInBandPoints,
+             rRunData.numberRefinedPoints
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+executeAltitudeBandTimingConvertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const
+            int      numberPointsExponent
+         //-------------------
+         // OUTPUT(s):
+         //           NONE
+         //-------------------
+       )
+//==============================================================================
+//|
+//| FUNCTION:
+//|
+//|   executeAltitudeBandTimingConvertEcefToGeodetic
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| PURPOSE:
+//|
+//|   To compare the execution time per point of 'cullEcefPointsToAltitudeBand'
+//|   and 'cullEcefPointsToAltitudeBandIndices' with that of a batch
+//|   conversion followed by the altitude comparisons, and with the time to
+//|   read the coordinates, and to check that they select the points whose
+//|   altitude of 'convertEcefToGeodetic' is in the band.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| INPUT(s):
+//|
+//|   numberPointsExponent
+//|     The base ten exponent of the number of points.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| METHOD:
+//|
+//|   [ 1 ] Generate 10^numberPointsExponent true geodetic points, with
+//|         uniform latitude and longitude and altitudes from -10 km to
+//|         50000 km evenly spaced in asinh( h / 1 km ).  Every 97th point
+//|         is put on a pole.
+//|
+//|   [ 2 ] For an airspace band, 0 to 20 km, a low Earth orbit band,
+//|         160 km to 2000 km, and a band open below, -INFINITY to
+//|         1000 km, time each route with 'measureConversionTiming'.  The
+//|         bandwidth is that of reading the three coordinates.
+//|
+//|   [ 3 ] Count the points whose in band bit differs from that of the
+//|         altitude of the ellipsoid context 'convertEcefToGeodetic'.
+//|
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+ //
+ // GRS1980 System
+ //
+ //-----------------------------------------------------------------------------
+    const
+    double
+     earthEquatorialRadiusMeters         = 6378137.0E0;
+    const
+    double
+     earthEllipsoidalFlatteningFactor    = 1.0E0 / 298.257222101E0;
+    const
+    double
+     earthEllipsoidalEccentricitySquared =
+                         ( 2.0E0 - earthEllipsoidalFlatteningFactor )
+                         *
+                         earthEllipsoidalFlatteningFactor;
+ //-----------------------------------------------------------------------------
+    const
+    int
+     NUMBER_WARM_UP_RUNS = 1;
+    const
+    int
+     NUMBER_TIMED_RUNS   = 7;
+ //-----------------------------------------------------------------------------
+    EARTH_ELLIPSOID_CONTEXT
+     ellipsoidContext;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    ( void )
+    initializeEarthEllipsoidContext
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalFlatteningFactor,
+             ellipsoidContext
+           );
+ //-----------------------------------------------------------------------------
+    size_t
+     numberPoints = 1;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int exponent = 0; exponent < numberPointsExponent; exponent++ )
+      {
+          numberPoints = 10 * numberPoints;
+      };
+ //-----------------------------------------------------------------------------
+ // Generate the true geodetic points and their ECEF coordinates.
+ //-----------------------------------------------------------------------------
+    vector< double > trueLatitudeRadians ( numberPoints );
+    vector< double > trueLongitudeRadians( numberPoints );
+    vector< double > trueAltitudeMeters  ( numberPoints );
+    vector< double > xEcefMeters         ( numberPoints );
+    vector< double > yEcefMeters         ( numberPoints );
+    vector< double > zEcefMeters         ( numberPoints );
+    vector< double > latitudeRadians     ( numberPoints );
+    vector< double > longitudeRadians    ( numberPoints );
+    vector< double > altitudeMeters      ( numberPoints );
+    vector< ECEF_TO_GEODETIC_CONVERSION_STATUS >
+                     conversionStatus    ( numberPoints );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    generateTimingGeodeticPoints
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalEccentricitySquared,
+             -1.0E4,
+             5.0E7,
+             ASINH_TIMING_ALTITUDE_SPACING,
+             97,
+             numberPoints,
+             trueLatitudeRadians .data( ),
+             trueLongitudeRadians.data( ),
+             trueAltitudeMeters  .data( ),
+             xEcefMeters         .data( ),
+             yEcefMeters         .data( ),
+             zEcefMeters         .data( ),
+             NULL
+           );
+ //-----------------------------------------------------------------------------
+    vector< unsigned long long > inBandBits    ( ( numberPoints + 63 ) / 64 );
+    vector< unsigned long long > exactInBandBits( ( numberPoints + 63 ) / 64 );
+    vector< size_t >             inBandIndices ( numberPoints );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    ALTITUDE_BAND_TIMING_RUN_DATA
+     runData;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    runData.pEllipsoidContext               = &ellipsoidContext;
+    runData.numberPoints                    = numberPoints;
+    runData.pXEcefMeters                    = xEcefMeters     .data( );
+    runData.pYEcefMeters                    = yEcefMeters     .data( );
+    runData.pZEcefMeters                    = zEcefMeters     .data( );
+    runData.pGeodeticNorthLatitudeRadians   = latitudeRadians .data( );
+    runData.pGeocentricEastLongitudeRadians = longitudeRadians.data( );
+    runData.pGeodeticAltitudeMeters         = altitudeMeters  .data( );
+    runData.pConversionStatus               = conversionStatus.data( );
+    runData.pInBandBits                     = inBandBits      .data( );
+    runData.pInBandIndices                  = inBandIndices   .data( );
+ //-----------------------------------------------------------------------------
+ // The bands, and the routes.  The speedups are against the full batch.
+ //-----------------------------------------------------------------------------
+    const
+    int
+     NUMBER_BANDS  = 3;
+    const
+    int
+     NUMBER_ROUTES = 5;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    char *
+     bandNames[ NUMBER_BANDS ]              = { "Airspace, 0 to 20 km",
+                                                "Low Earth orbit, "
+                                                "160 to 2000 km",
+                                                "Open below, "
+                                                "-INFINITY to 1000 km" };
+    const
+    double
+     bandLimitsMeters[ NUMBER_BANDS ][ 2 ]  = { { 0.0,     2.0E4 },
+                                                { 1.6E5,   2.0E6 },
+                                                { -INFINITY, 1.0E6 } };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    char *
+     routeNames[ NUMBER_ROUTES ] = { "Read coordinates only",
+                                     "Full batch + compare",
+                                     "Altitude batch + compare",
+                                     "Culling, bit mask",
+                                     "Culling, indices" };
+    void
+     ( *routeRuns[ NUMBER_ROUTES ] )( void * ) =
+                              { readCoordinatesTimingRun,
+                                cullWithFullBatchTimingRun,
+                                cullWithAltitudeBatchTimingRun,
+                                cullToBitsTimingRun,
+                                cullToIndicesTimingRun };
+ //-----------------------------------------------------------------------------
+ // Report header.
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "\n\n\n"
+       "%s%s\n"
+       "%s\n%s\n%s\n"
+       "%s%zu%s\n"
+       "%s\n"
+       "%s%s\n"
+       "%s%s\n"
+       "%s%s\n",
+       "============================================",
+       "============================================",
+       "|",
+       "| ALTITUDE BAND CULLING TIMING RESULTS:",
+       "|",
+       "|    ",
+       numberPoints,
+       " points from -10 km to 50000 km altitude",
+       "|",
+       "|-------------------------------------------",
+       "--------------------------------------------",
+       "|    Route                     [ns/point]     MAD  vs full    [GB/s]",
+       "  Refined  Mismatches",
+       "|-------------------------------------------",
+       "--------------------------------------------"
+     );
+ //-----------------------------------------------------------------------------
+ // Loop over the bands.
+ //-----------------------------------------------------------------------------
+    for( int band = 0; band < NUMBER_BANDS; band++ )
+      {
+       //-----------------------------------------------------------------------
+          runData.minimumAltitudeMeters = bandLimitsMeters[ band ][ 0 ];
+          runData.maximumAltitudeMeters = bandLimitsMeters[ band ][ 1 ];
+       //-----------------------------------------------------------------------
+       // The in band bits of the exact altitudes.
+       //-----------------------------------------------------------------------
+          size_t numberExactInBandPoints = 0;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          fill( exactInBandBits.begin( ), exactInBandBits.end( ), 0ULL );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+             //-----------------------------------------------------------------
+                double exactAltitudeMeters;
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                ( void )
+                convertEcefToGeodeticAltitude
+                       (
+                         ellipsoidContext,
+                         xEcefMeters[ i ],
+                         yEcefMeters[ i ],
+                         zEcefMeters[ i ],
+                         exactAltitudeMeters
+                       );
+             //-----------------------------------------------------------------
+                if(
+                    ( exactAltitudeMeters >= runData.minimumAltitudeMeters )
+                    &&
+                    ( exactAltitudeMeters <= runData.maximumAltitudeMeters )
+                  )
+                  {
+                     exactInBandBits[ i / 64 ] |= 1ULL << ( i % 64 );
+                     numberExactInBandPoints++;
+                  };
+             //-----------------------------------------------------------------
+            };
+       //-----------------------------------------------------------------------
+          fprintf
+           (
+             stdout,
+             "|  %s, %zu points in band\n",
+             bandNames[ band ],
+             numberExactInBandPoints
+           );
+       //-----------------------------------------------------------------------
+       // Loop over the routes.
+       //-----------------------------------------------------------------------
+          double
+           fullNanoSecondsPerPoint = NAN;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( int route = 0; route < NUMBER_ROUTES; route++ )
+            {
+             //-----------------------------------------------------------------
+                CONVERSION_TIMING_STATISTICS
+                 routeTiming;
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                measureConversionTiming
+                       (
+                         routeRuns[ route ],
+                         &runData,
+                         numberPoints,
+                         NUMBER_WARM_UP_RUNS,
+                         NUMBER_TIMED_RUNS,
+                         routeTiming
+                       );
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                if( route == 1 )
+                  {
+                     fullNanoSecondsPerPoint =
+                                       routeTiming.medianNanoSecondsPerPoint;
+                  };
+             //-----------------------------------------------------------------
+             // The in band bits of the indices route, then the points whose
+             // bit differs from the exact one.  The coordinate read has no
+             // selection to check.
+             //-----------------------------------------------------------------
+                if( route == 4 )
+                  {
+                     fill( inBandBits.begin( ), inBandBits.end( ), 0ULL );
+                  //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                     for( size_t k = 0; k < runData.numberInBandPoints; k++ )
+                       {
+                          inBandBits[ inBandIndices[ k ] / 64 ] |=
+                                      1ULL << ( inBandIndices[ k ] % 64 );
+                       };
+                  };
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                size_t numberMismatches = 0;
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                for( size_t word = 0; word < inBandBits.size( ); word++ )
+                  {
+                     numberMismatches +=
+                        __builtin_popcountll( inBandBits     [ word ] ^
+                                              exactInBandBits[ word ] );
+                  };
+             //-----------------------------------------------------------------
+                if( route == 0 )
+                  {
+                     fprintf
+                      (
+                        stdout,
+                        "|    %-24s %11.3f %7.3f %8s %9.2f %8s %11s\n",
+                        routeNames[ route ],
+                        routeTiming.medianNanoSecondsPerPoint,
+                        routeTiming.madNanoSecondsPerPoint,
+                        "",
+                        3.0 * sizeof( double ) /
+                        routeTiming.medianNanoSecondsPerPoint,
+                        "",
+                        ""
+                      );
+                  }
+                else
+                  {
+                     fprintf
+                      (
+                        stdout,
+                        "|    %-24s %11.3f %7.3f %8.2f %9.2f %7.3f%% %11zu\n",
+                        routeNames[ route ],
+                        routeTiming.medianNanoSecondsPerPoint,
+                        routeTiming.madNanoSecondsPerPoint,
+                        fullNanoSecondsPerPoint /
+                        routeTiming.medianNanoSecondsPerPoint,
+                        3.0 * sizeof( double ) /
+                        routeTiming.medianNanoSecondsPerPoint,
+                        100.0 * runData.numberRefinedPoints / numberPoints,
+                        numberMismatches
+                      );
+                  };
+             //-----------------------------------------------------------------
+            };
+       //-----------------------------------------------------------------------
+          if( band + 1 < NUMBER_BANDS )
+            {
+               fprintf( stdout, "|\n" );
+            };
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "%s\n"
+       "%s%s\n"
+       "\n\n\n",
+       "|",
+       "============================================",
+       "============================================"
+     );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,425 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+   using namespace std::chrono;
+
+//------------------------------------------------------------------------------
+struct
+BATCH_TIMING_RUN_DATA
+  {
+    double                               earthEquatorialRadiusMeters;
+    double                               earthEllipsoidalFlatteningFactor;
+    size_t                               batchSize;
+    size_t                               numberRepetitions;
+    const double                       * pXEcefMeters;
+    const double                       * pYEcefMeters;
+    const double                       * pZEcefMeters;
+    double                             * pGeodeticNorthLatitudeRadians;
+    double                             * pGeocentricEastLongitudeRadians;
+    double                             * pGeodeticAltitudeMeters;
+    ECEF_TO_GEODETIC_CONVERSION_STATUS * pConversionStatus;
+  };
+
+//------------------------------------------------------------------------------
+// One timed run: numberRepetitions loops of scalar calls over the batch.
+//------------------------------------------------------------------------------
+static
+void
+convertScalarTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    const
+    BATCH_TIMING_RUN_DATA
+        & rRunData = *( const BATCH_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    for( size_t r = 0; r < rRunData.numberRepetitions; r++ )
+      {
+          for( size_t i = 0; i < rRunData.batchSize; i++ )
+            {
+               rRunData.pConversionStatus[ i ] =
+               convertEcefToGeodetic
+                      (
+                        //-----------------
+                        // INPUT(s):
+                        //-----------------
+                           rRunData.earthEquatorialRadiusMeters,
+                           rRunData.earthEllipsoidalFlatteningFactor,
+                           rRunData.pXEcefMeters[ i ],
+                           rRunData.pYEcefMeters[ i ],
+                           rRunData.pZEcefMeters[ i ],
+                        //-----------------
+                        // OUTPUT(s):
+                        //-----------------
+                           rRunData.pGeodeticNorthLatitudeRadians  [ i ],
+                           rRunData.pGeocentricEastLongitudeRadians[ i ],
+                           rRunData.pGeodeticAltitudeMeters        [ i ]
+                      );
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          preventConversionTimingReordering( );
+      };
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: numberRepetitions batch calls over the batch.
+//------------------------------------------------------------------------------
+static
+void
+convertBatchTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    const
+    BATCH_TIMING_RUN_DATA
+        & rRunData = *( const BATCH_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    for( size_t r = 0; r < rRunData.numberRepetitions; r++ )
+      {
+          ( void )
+          convertEcefToGeodeticBatch
+                 (
+                   //-----------------
+                   // INPUT(s):
+                   //-----------------
+                      rRunData.earthEquatorialRadiusMeters,
+                      rRunData.earthEllipsoidalFlatteningFactor,
+                      rRunData.batchSize,
+                      rRunData.pXEcefMeters,
+                      rRunData.pYEcefMeters,
+                      rRunData.pZEcefMeters,
+                   //-----------------
+                   // OUTPUT(s):
+                   //-----------------
+                      rRunData.pGeodeticNorthLatitudeRadians,
+                      rRunData.pGeocentricEastLongitudeRadians,
+                      rRunData.pGeodeticAltitudeMeters,
+                      rRunData.pConversionStatus
+                 );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          preventConversionTimingReordering( );
+      };
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+executeBatchTimingConvertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const
+            int      maximumBatchSizeExponent
+         //-------------------
+         // OUTPUT(s):
+         //           NONE
+         //-------------------
+       )
+//==============================================================================
+//|
+//| FUNCTION:
+//|
+//|   executeBatchTimingConvertEcefToGeodetic
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| PURPOSE:
+//|
+//|   To report the execution time per converted point of the batch
+//|   'convertEcefToGeodeticBatch' function, and of a loop of scalar
+//|   'convertEcefToGeodetic' function calls over the same points, for
+//|   batch sizes of 1, 10, 100, ... 10^maximumBatchSizeExponent points.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| INPUT(s):
+//|
+//|   maximumBatchSizeExponent
+//|     The base ten exponent of the largest batch size.
+//|     Each point needs 52 bytes of input, output and status storage,
+//|     so a batch of 10^8 points needs about 5.2 gigabytes.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| METHOD:
+//|
+//|   [ 1 ]  Generate 10^maximumBatchSizeExponent true geodetic points
+//|          scattered over all latitudes, longitudes and altitudes
+//|          between -10 kilometers and 3000 kilometers, and convert them
+//|          to ECEF rectangular coordinates.
+//|
+//|   [ 2 ]  For each batch size, a run converts the first batch size
+//|          points repeatedly, until at least MINIMUM_POINTS_PER_RUN
+//|          points have been converted.  'measureConversionTiming'
+//|          times BATCH_TIMED_RUNS runs after BATCH_WARM_UP_RUNS
+//|          warm-up runs.
+//|
+//|   [ 3 ]  Report the median execution time per point, its median
+//|          absolute deviation and the median time stamp counter cycles
+//|          per point of the batch conversion, and the maximum latitude
+//|          and altitude errors of the batch conversion.
+//|
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const
+    double
+     piRadians                     = 4.0 * atan( 1.0 );
+    const
+    double
+     microArcSecondsPerRadian      = ( 180.0 / piRadians ) * 3600.0 * 1.0E6;
+    const
+    double
+     nanoMetersPerMeter            = 1.0E9;
+ //-----------------------------------------------------------------------------
+ //
+ // GRS1980 System
+ //
+ //-----------------------------------------------------------------------------
+    const
+    double
+     earthEquatorialRadiusMeters             = 6378137.0E0;
+    const
+    double
+     earthEllipsoidalFlatteningFactor        = 1.0E0 / 298.257222101E0;
+    const
+    double
+     earthEllipsoidalEccentricitySquared     =
+                         ( 2.0E0 - earthEllipsoidalFlatteningFactor )
+                         *
+                         earthEllipsoidalFlatteningFactor;
+ //-----------------------------------------------------------------------------
+    const
+    size_t
+     MINIMUM_POINTS_PER_RUN = 1000000;
+    const
+    int
+     BATCH_WARM_UP_RUNS     = 1;
+    const
+    int
+     BATCH_TIMED_RUNS       = 7;
+ //-----------------------------------------------------------------------------
+    size_t
+     maximumBatchSize = 1;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int exponent = 0; exponent < maximumBatchSizeExponent; exponent++ )
+      {
+          maximumBatchSize = 10 * maximumBatchSize;
+      };
+ //-----------------------------------------------------------------------------
+ // Generate the true geodetic points and their ECEF coordinates.
+ //-----------------------------------------------------------------------------
+    vector< double > trueLatitudeRadians ( maximumBatchSize );
+    vector< double > trueAltitudeMeters  ( maximumBatchSize );
+    vector< double > xEcefMeters         ( maximumBatchSize );
+    vector< double > yEcefMeters         ( maximumBatchSize );
+    vector< double > zEcefMeters         ( maximumBatchSize );
+    vector< double > latitudeRadians     ( maximumBatchSize );
+    vector< double > longitudeRadians    ( maximumBatchSize );
+    vector< double > altitudeMeters      ( maximumBatchSize );
+    vector< ECEF_TO_GEODETIC_CONVERSION_STATUS >
+                     conversionStatus    ( maximumBatchSize );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    generateTimingGeodeticPoints
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalEccentricitySquared,
+             -1.0E4,
+             3.0E6,
+             UNIFORM_TIMING_ALTITUDE_SPACING,
+             0,
+             maximumBatchSize,
+             trueLatitudeRadians.data( ),
+             NULL,
+             trueAltitudeMeters .data( ),
+             xEcefMeters        .data( ),
+             yEcefMeters        .data( ),
+             zEcefMeters        .data( ),
+             NULL
+           );
+ //-----------------------------------------------------------------------------
+ // Report header.
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "\n\n\n"
+       "%s%s\n"
+       "%s\n%s\n%s\n"
+       "%s%s\n"
+       "%s\n"
+       "%s\n",
+       "============================================",
+       "============================================",
+       "|",
+       "| BATCH TIMING RESULTS:",
+       "|",
+       "|-------------------------------------------",
+       "--------------------------------------------",
+       "|   Batch size  Reps/run  Scalar[ns/pt]  Batch[ns/pt]  Batch MAD"
+       "  Batch[cyc]  Speedup",
+       "|"
+     );
+ //-----------------------------------------------------------------------------
+ // Loop over the batch sizes.
+ //-----------------------------------------------------------------------------
+    double
+     maximumLatitudeAbsoluteErrorMicroArcSecs = 0.0;
+    double
+     maximumAltitudeAbsoluteErrorNanoMeters   = 0.0;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for(
+         size_t batchSize  = 1;
+                batchSize <= maximumBatchSize;
+                batchSize  = 10 * batchSize
+       )
+      {
+       //-----------------------------------------------------------------------
+          const
+          size_t
+           numberRepetitions = max(
+                                    ( size_t )1,
+                                    MINIMUM_POINTS_PER_RUN / batchSize
+                                  );
+       //-----------------------------------------------------------------------
+          BATCH_TIMING_RUN_DATA
+           runData;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          runData.earthEquatorialRadiusMeters     = earthEquatorialRadiusMeters;
+          runData.earthEllipsoidalFlatteningFactor =
+                                      earthEllipsoidalFlatteningFactor;
+          runData.batchSize                       = batchSize;
+          runData.numberRepetitions               = numberRepetitions;
+          runData.pXEcefMeters                    = xEcefMeters.data( );
+          runData.pYEcefMeters                    = yEcefMeters.data( );
+          runData.pZEcefMeters                    = zEcefMeters.data( );
+          runData.pGeodeticNorthLatitudeRadians   = latitudeRadians.data( );
+          runData.pGeocentricEastLongitudeRadians = longitudeRadians.data( );
+          runData.pGeodeticAltitudeMeters         = altitudeMeters.data( );
+          runData.pConversionStatus               = conversionStatus.data( );
+       //-----------------------------------------------------------------------
+       // Time the scalar function calls, then the batch function calls,
+       // whose results are kept for the error accumulation.
+       //-----------------------------------------------------------------------
+          CONVERSION_TIMING_STATISTICS
+           scalarTimingStatistics;
+          CONVERSION_TIMING_STATISTICS
+           batchTimingStatistics;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          measureConversionTiming
+                 (
+                   convertScalarTimingRun,
+                   &runData,
+                   numberRepetitions * batchSize,
+                   BATCH_WARM_UP_RUNS,
+                   BATCH_TIMED_RUNS,
+                   scalarTimingStatistics
+                 );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          measureConversionTiming
+                 (
+                   convertBatchTimingRun,
+                   &runData,
+                   numberRepetitions * batchSize,
+                   BATCH_WARM_UP_RUNS,
+                   BATCH_TIMED_RUNS,
+                   batchTimingStatistics
+                 );
+       //-----------------------------------------------------------------------
+          const
+          double
+           scalarNanoSecondsPerPoint =
+                            scalarTimingStatistics.medianNanoSecondsPerPoint;
+          const
+          double
+           batchNanoSecondsPerPoint  =
+                            batchTimingStatistics.medianNanoSecondsPerPoint;
+       //-----------------------------------------------------------------------
+       // Accumulate the errors of the batch conversion.
+       //-----------------------------------------------------------------------
+          for( size_t i = 0; i < batchSize; i++ )
+            {
+               if( conversionStatus[ i ] == SUCCESSFUL_CONVERSION )
+                 {
+                    maximumLatitudeAbsoluteErrorMicroArcSecs =
+                    max(
+                         maximumLatitudeAbsoluteErrorMicroArcSecs,
+                         microArcSecondsPerRadian *
+                         fabs( trueLatitudeRadians[ i ] - latitudeRadians[ i ] )
+                       );
+                    maximumAltitudeAbsoluteErrorNanoMeters =
+                    max(
+                         maximumAltitudeAbsoluteErrorNanoMeters,
+                         nanoMetersPerMeter *
+                         fabs( trueAltitudeMeters[ i ] - altitudeMeters[ i ] )
+                       );
+                 };
+            };
+       //-----------------------------------------------------------------------
+          fprintf
+           (
+             stdout,
+             "| %12zu %9zu %14.3f %13.3f %10.3f %11.2f %8.2f\n",
+             batchSize,
+             numberRepetitions,
+             scalarNanoSecondsPerPoint,
+             batchNanoSecondsPerPoint,
+             batchTimingStatistics.madNanoSecondsPerPoint,
+             batchTimingStatistics.medianCyclesPerPoint,
+             scalarNanoSecondsPerPoint / batchNanoSecondsPerPoint
+           );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "%s\n"
+       "%s\n"
+       "%s%+14.6e%s\n"
+       "%s\n"
+       "%s%+14.6e%s\n"
+       "%s\n"
+       "%s%s\n"
+       "\n\n\n",
+       "|",
+       "|    Maximum batch geodetic north latitude absolute error",
+       "|      is:-->",
+       maximumLatitudeAbsoluteErrorMicroArcSecs,
+       " [microarcseconds]",
+       "|    Maximum batch geodetic altitude absolute error",
+       "|      is:-->",
+       maximumAltitudeAbsoluteErrorNanoMeters,
+       " [nanometers]",
+       "|",
+       "============================================",
+       "============================================"
+     );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
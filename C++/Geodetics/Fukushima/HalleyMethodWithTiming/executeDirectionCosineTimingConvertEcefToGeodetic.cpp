@@ -0,0 +1,480 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+
+//------------------------------------------------------------------------------
+struct
+DIRECTION_COSINE_TIMING_RUN_DATA
+  {
+    const EARTH_ELLIPSOID_CONTEXT      * pEllipsoidContext;
+    size_t                               numberPoints;
+    const double                       * pXEcefMeters;
+    const double                       * pYEcefMeters;
+    const double                       * pZEcefMeters;
+    double                             * pGeodeticNorthLatitudeRadians;
+    double                             * pGeocentricEastLongitudeRadians;
+    double                             * pSineOfLatitude;
+    double                             * pCosineOfLatitude;
+    double                             * pSineOfLongitude;
+    double                             * pCosineOfLongitude;
+    double                             * pGeodeticAltitudeMeters;
+    ECEF_TO_GEODETIC_CONVERSION_STATUS * pConversionStatus;
+  };
+
+//------------------------------------------------------------------------------
+// One timed run: one context call per point, then sin and cos of both
+// angles, as a caller building the East North Up rotation does.
+//------------------------------------------------------------------------------
+static
+void
+convertAnglesScalarTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    DIRECTION_COSINE_TIMING_RUN_DATA
+        & rRunData = *( DIRECTION_COSINE_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < rRunData.numberPoints; i++ )
+      {
+       //-----------------------------------------------------------------------
+          double latitudeRadians;
+          double longitudeRadians;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          rRunData.pConversionStatus[ i ] =
+          convertEcefToGeodetic
+                 (
+                   *rRunData.pEllipsoidContext,
+                   rRunData.pXEcefMeters[ i ],
+                   rRunData.pYEcefMeters[ i ],
+                   rRunData.pZEcefMeters[ i ],
+                   latitudeRadians,
+                   longitudeRadians,
+                   rRunData.pGeodeticAltitudeMeters[ i ]
+                 );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          rRunData.pSineOfLatitude   [ i ] = sin( latitudeRadians  );
+          rRunData.pCosineOfLatitude [ i ] = cos( latitudeRadians  );
+          rRunData.pSineOfLongitude  [ i ] = sin( longitudeRadians );
+          rRunData.pCosineOfLongitude[ i ] = cos( longitudeRadians );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: one direction cosine call per point.
+//------------------------------------------------------------------------------
+static
+void
+convertDirectionCosinesScalarTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    DIRECTION_COSINE_TIMING_RUN_DATA
+        & rRunData = *( DIRECTION_COSINE_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < rRunData.numberPoints; i++ )
+      {
+          rRunData.pConversionStatus[ i ] =
+          convertEcefToGeodeticDirectionCosines
+                 (
+                   *rRunData.pEllipsoidContext,
+                   rRunData.pXEcefMeters[ i ],
+                   rRunData.pYEcefMeters[ i ],
+                   rRunData.pZEcefMeters[ i ],
+                   rRunData.pSineOfLatitude        [ i ],
+                   rRunData.pCosineOfLatitude      [ i ],
+                   rRunData.pSineOfLongitude       [ i ],
+                   rRunData.pCosineOfLongitude     [ i ],
+                   rRunData.pGeodeticAltitudeMeters[ i ]
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: one context batch call, then sin and cos of both angles.
+//------------------------------------------------------------------------------
+static
+void
+convertAnglesBatchTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    DIRECTION_COSINE_TIMING_RUN_DATA
+        & rRunData = *( DIRECTION_COSINE_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticBatch
+           (
+             *rRunData.pEllipsoidContext,
+             rRunData.numberPoints,
+             rRunData.pXEcefMeters,
+             rRunData.pYEcefMeters,
+             rRunData.pZEcefMeters,
+             rRunData.pGeodeticNorthLatitudeRadians,
+             rRunData.pGeocentricEastLongitudeRadians,
+             rRunData.pGeodeticAltitudeMeters,
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < rRunData.numberPoints; i++ )
+      {
+          const double latitudeRadians  =
+                         rRunData.pGeodeticNorthLatitudeRadians  [ i ];
+          const double longitudeRadians =
+                         rRunData.pGeocentricEastLongitudeRadians[ i ];
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          rRunData.pSineOfLatitude   [ i ] = sin( latitudeRadians  );
+          rRunData.pCosineOfLatitude [ i ] = cos( latitudeRadians  );
+          rRunData.pSineOfLongitude  [ i ] = sin( longitudeRadians );
+          rRunData.pCosineOfLongitude[ i ] = cos( longitudeRadians );
+      };
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: one direction cosine batch call.
+//------------------------------------------------------------------------------
+static
+void
+convertDirectionCosinesBatchTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    DIRECTION_COSINE_TIMING_RUN_DATA
+        & rRunData = *( DIRECTION_COSINE_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticDirectionCosinesBatch
+           (
+             *rRunData.pEllipsoidContext,
+             rRunData.numberPoints,
+             rRunData.pXEcefMeters,
+             rRunData.pYEcefMeters,
+             rRunData.pZEcefMeters,
+             rRunData.pSineOfLatitude,
+             rRunData.pCosineOfLatitude,
+             rRunData.pSineOfLongitude,
+             rRunData.pCosineOfLongitude,
+             rRunData.pGeodeticAltitudeMeters,
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+executeDirectionCosineTimingConvertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const
+            int      numberPointsExponent
+         //-------------------
+         // OUTPUT(s):
+         //           NONE
+         //-------------------
+       )
+//==============================================================================
+//|
+//| FUNCTION:
+//|
+//|   executeDirectionCosineTimingConvertEcefToGeodetic
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| PURPOSE:
+//|
+//|   To compare the execution time per point of the ellipsoid context
+//|   'convertEcefToGeodetic' and 'convertEcefToGeodeticBatch' followed by
+//|   sin and cos of the latitude and longitude with that of
+//|   'convertEcefToGeodeticDirectionCosines' and
+//|   'convertEcefToGeodeticDirectionCosinesBatch', and to report the
+//|   largest error of the sines and cosines of each route.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| INPUT(s):
+//|
+//|   numberPointsExponent
+//|     The base ten exponent of the number of points.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| METHOD:
+//|
+//|   [ 1 ] Generate 10^numberPointsExponent true geodetic points, with
+//|         uniform latitude and longitude and altitudes from -10 km to
+//|         50000 km evenly spaced in asinh( h / 1 km ).  Every 97th point
+//|         is put on a pole.
+//|
+//|   [ 2 ] Time each route with 'measureConversionTiming'.
+//|
+//|   [ 3 ] The sine and cosine errors are the largest differences from
+//|         the sine and cosine of the true angles; the longitude pair is
+//|         not compared at the poles, where the longitude is undefined.
+//|
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+ //
+ // GRS1980 System
+ //
+ //-----------------------------------------------------------------------------
+    const
+    double
+     earthEquatorialRadiusMeters         = 6378137.0E0;
+    const
+    double
+     earthEllipsoidalFlatteningFactor    = 1.0E0 / 298.257222101E0;
+    const
+    double
+     earthEllipsoidalEccentricitySquared =
+                         ( 2.0E0 - earthEllipsoidalFlatteningFactor )
+                         *
+                         earthEllipsoidalFlatteningFactor;
+ //-----------------------------------------------------------------------------
+    const
+    int
+     NUMBER_WARM_UP_RUNS = 1;
+    const
+    int
+     NUMBER_TIMED_RUNS   = 7;
+ //-----------------------------------------------------------------------------
+    EARTH_ELLIPSOID_CONTEXT
+     ellipsoidContext;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    ( void )
+    initializeEarthEllipsoidContext
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalFlatteningFactor,
+             ellipsoidContext
+           );
+ //-----------------------------------------------------------------------------
+    size_t
+     numberPoints = 1;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int exponent = 0; exponent < numberPointsExponent; exponent++ )
+      {
+          numberPoints = 10 * numberPoints;
+      };
+ //-----------------------------------------------------------------------------
+ // Generate the true geodetic points and their ECEF coordinates.
+ //-----------------------------------------------------------------------------
+    vector< double > trueLatitudeRadians ( numberPoints );
+    vector< double > trueLongitudeRadians( numberPoints );
+    vector< double > trueAltitudeMeters  ( numberPoints );
+    vector< double > xEcefMeters         ( numberPoints );
+    vector< double > yEcefMeters         ( numberPoints );
+    vector< double > zEcefMeters         ( numberPoints );
+    vector< double > latitudeRadians     ( numberPoints );
+    vector< double > longitudeRadians    ( numberPoints );
+    vector< double > sineOfLatitude      ( numberPoints );
+    vector< double > cosineOfLatitude    ( numberPoints );
+    vector< double > sineOfLongitude     ( numberPoints );
+    vector< double > cosineOfLongitude   ( numberPoints );
+    vector< double > altitudeMeters      ( numberPoints );
+    vector< ECEF_TO_GEODETIC_CONVERSION_STATUS >
+                     conversionStatus    ( numberPoints );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    generateTimingGeodeticPoints
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalEccentricitySquared,
+             -1.0E4,
+             5.0E7,
+             ASINH_TIMING_ALTITUDE_SPACING,
+             97,
+             numberPoints,
+             trueLatitudeRadians .data( ),
+             trueLongitudeRadians.data( ),
+             trueAltitudeMeters  .data( ),
+             xEcefMeters         .data( ),
+             yEcefMeters         .data( ),
+             zEcefMeters         .data( ),
+             NULL
+           );
+ //-----------------------------------------------------------------------------
+    DIRECTION_COSINE_TIMING_RUN_DATA
+     runData;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    runData.pEllipsoidContext               = &ellipsoidContext;
+    runData.numberPoints                    = numberPoints;
+    runData.pXEcefMeters                    = xEcefMeters      .data( );
+    runData.pYEcefMeters                    = yEcefMeters      .data( );
+    runData.pZEcefMeters                    = zEcefMeters      .data( );
+    runData.pGeodeticNorthLatitudeRadians   = latitudeRadians  .data( );
+    runData.pGeocentricEastLongitudeRadians = longitudeRadians .data( );
+    runData.pSineOfLatitude                 = sineOfLatitude   .data( );
+    runData.pCosineOfLatitude               = cosineOfLatitude .data( );
+    runData.pSineOfLongitude                = sineOfLongitude  .data( );
+    runData.pCosineOfLongitude              = cosineOfLongitude.data( );
+    runData.pGeodeticAltitudeMeters         = altitudeMeters   .data( );
+    runData.pConversionStatus               = conversionStatus .data( );
+ //-----------------------------------------------------------------------------
+ // The first route, angles then sin and cos, is the reference of the
+ // speedups.
+ //-----------------------------------------------------------------------------
+    const
+    char *
+     routeNames[ 4 ]        = { "Angles + sin/cos, scalar",
+                                "Direction cosines, scalar",
+                                "Angles + sin/cos, batch",
+                                "Direction cosines, batch" };
+    void
+     ( *routeRuns[ 4 ] )( void * ) = { convertAnglesScalarTimingRun,
+                                       convertDirectionCosinesScalarTimingRun,
+                                       convertAnglesBatchTimingRun,
+                                       convertDirectionCosinesBatchTimingRun };
+ //-----------------------------------------------------------------------------
+ // Report header.
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "\n\n\n"
+       "%s%s\n"
+       "%s\n%s\n%s\n"
+       "%s%zu%s\n"
+       "%s\n"
+       "%s%s\n"
+       "%s%s\n"
+       "%s%s\n",
+       "============================================",
+       "============================================",
+       "|",
+       "| DIRECTION COSINE TIMING RESULTS:",
+       "|",
+       "|    ",
+       numberPoints,
+       " points from -10 km to 50000 km altitude",
+       "|",
+       "|-------------------------------------------",
+       "--------------------------------------------",
+       "|    Route                        [ns/point]      MAD  vs first",
+       "  Sin/cos err",
+       "|-------------------------------------------",
+       "--------------------------------------------"
+     );
+ //-----------------------------------------------------------------------------
+ // Loop over the routes.
+ //-----------------------------------------------------------------------------
+    double
+     firstRouteNanoSecondsPerPoint = NAN;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int route = 0; route < 4; route++ )
+      {
+       //-----------------------------------------------------------------------
+          CONVERSION_TIMING_STATISTICS
+           routeTiming;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          measureConversionTiming
+                 (
+                   routeRuns[ route ],
+                   &runData,
+                   numberPoints,
+                   NUMBER_WARM_UP_RUNS,
+                   NUMBER_TIMED_RUNS,
+                   routeTiming
+                 );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( route == 0 )
+            {
+               firstRouteNanoSecondsPerPoint =
+                                       routeTiming.medianNanoSecondsPerPoint;
+            };
+       //-----------------------------------------------------------------------
+       // Errors of the last run.
+       //-----------------------------------------------------------------------
+          double maximumError = 0.0;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+             //-----------------------------------------------------------------
+                maximumError =
+                max( maximumError,
+                     max( fabs( sineOfLatitude  [ i ] -
+                                sin( trueLatitudeRadians[ i ] ) ),
+                          fabs( cosineOfLatitude[ i ] -
+                                cos( trueLatitudeRadians[ i ] ) ) ) );
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                if( i % 97 != 96 )
+                  {
+                     maximumError =
+                     max( maximumError,
+                          max( fabs( sineOfLongitude  [ i ] -
+                                     sin( trueLongitudeRadians[ i ] ) ),
+                               fabs( cosineOfLongitude[ i ] -
+                                     cos( trueLongitudeRadians[ i ] ) ) ) );
+                  };
+             //-----------------------------------------------------------------
+            };
+       //-----------------------------------------------------------------------
+          fprintf
+           (
+             stdout,
+             "|    %-27s %11.3f %8.3f %9.2f %12.2e\n",
+             routeNames[ route ],
+             routeTiming.medianNanoSecondsPerPoint,
+             routeTiming.madNanoSecondsPerPoint,
+             firstRouteNanoSecondsPerPoint /
+             routeTiming.medianNanoSecondsPerPoint,
+             maximumError
+           );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "%s\n"
+       "%s%s\n"
+       "\n\n\n",
+       "|",
+       "============================================",
+       "============================================"
+     );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,377 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+   using namespace std::chrono;
+
+//------------------------------------------------------------------------------
+void
+executeEllipsoidContextTimingConvertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const
+            int      numberPointsExponent
+         //-------------------
+         // OUTPUT(s):
+         //           NONE
+         //-------------------
+       )
+//==============================================================================
+//|
+//| FUNCTION:
+//|
+//|   executeEllipsoidContextTimingConvertEcefToGeodetic
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| PURPOSE:
+//|
+//|   To compare the two call paths of the scalar conversions:
+//|
+//|     Parameters:  'convertEcefToGeodetic' and 'convertGeodeticToEcef'
+//|                  called with the ellipsoid parameters, which are
+//|                  validated, and their functions computed, per call.
+//|
+//|     Context:     The ellipsoid context overloads, called with a context
+//|                  built once by 'initializeEarthEllipsoidContext'.
+//|
+//|   The execution time per point of each path is reported, together with
+//|   the largest difference between the results of the two paths.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| INPUT(s):
+//|
+//|   numberPointsExponent
+//|     The base ten exponent of the number of points.
+//|
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const
+    double
+     piRadians                     = 4.0 * atan( 1.0 );
+    const
+    double
+     microArcSecondsPerRadian      = ( 180.0 / piRadians ) * 3600.0 * 1.0E6;
+    const
+    double
+     nanoMetersPerMeter            = 1.0E9;
+ //-----------------------------------------------------------------------------
+ //
+ // GRS1980 System
+ //
+ //-----------------------------------------------------------------------------
+    const
+    double
+     earthEquatorialRadiusMeters             = 6378137.0E0;
+    const
+    double
+     earthEllipsoidalFlatteningFactor        = 1.0E0 / 298.257222101E0;
+    const
+    double
+     earthEllipsoidalEccentricitySquared     =
+                         ( 2.0E0 - earthEllipsoidalFlatteningFactor )
+                         *
+                         earthEllipsoidalFlatteningFactor;
+ //-----------------------------------------------------------------------------
+    const
+    size_t
+     MINIMUM_POINTS_PER_PATH = 10000000;
+ //-----------------------------------------------------------------------------
+    size_t
+     numberPoints = 1;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int exponent = 0; exponent < numberPointsExponent; exponent++ )
+      {
+          numberPoints = 10 * numberPoints;
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    size_t
+     numberRepetitions = max(
+                              ( size_t )1,
+                              MINIMUM_POINTS_PER_PATH / numberPoints
+                            );
+ //-----------------------------------------------------------------------------
+ // Build the ellipsoid context once.
+ //-----------------------------------------------------------------------------
+    EARTH_ELLIPSOID_CONTEXT
+     ellipsoidContext;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    ( void )
+    initializeEarthEllipsoidContext
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalFlatteningFactor,
+             ellipsoidContext
+           );
+ //-----------------------------------------------------------------------------
+ // Generate the geodetic points.
+ //-----------------------------------------------------------------------------
+    vector< double > latitudeRadians        ( numberPoints );
+    vector< double > longitudeRadians       ( numberPoints );
+    vector< double > altitudeMeters         ( numberPoints );
+    vector< double > xEcefMeters            ( numberPoints );
+    vector< double > yEcefMeters            ( numberPoints );
+    vector< double > zEcefMeters            ( numberPoints );
+    vector< double > contextXEcefMeters     ( numberPoints );
+    vector< double > contextYEcefMeters     ( numberPoints );
+    vector< double > contextZEcefMeters     ( numberPoints );
+    vector< double > estimatedLatitude      ( numberPoints );
+    vector< double > estimatedLongitude     ( numberPoints );
+    vector< double > estimatedAltitude      ( numberPoints );
+    vector< double > contextLatitude        ( numberPoints );
+    vector< double > contextLongitude       ( numberPoints );
+    vector< double > contextAltitude        ( numberPoints );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    generateTimingGeodeticPoints
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalEccentricitySquared,
+             -1.0E4,
+             3.0E6,
+             UNIFORM_TIMING_ALTITUDE_SPACING,
+             0,
+             numberPoints,
+             latitudeRadians .data( ),
+             longitudeRadians.data( ),
+             altitudeMeters  .data( ),
+             NULL,
+             NULL,
+             NULL,
+             NULL
+           );
+ //=============================================================================
+ //
+ // Geodetic to ECEF.
+ //
+ //=============================================================================
+    auto forwardParametersStart = steady_clock::now();
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t r = 0; r < numberRepetitions; r++ )
+      {
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+               convertGeodeticToEcef
+                      (
+                        earthEquatorialRadiusMeters,
+                        earthEllipsoidalEccentricitySquared,
+                        latitudeRadians [ i ],
+                        longitudeRadians[ i ],
+                        altitudeMeters  [ i ],
+                        xEcefMeters     [ i ],
+                        yEcefMeters     [ i ],
+                        zEcefMeters     [ i ]
+                      );
+            };
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    auto forwardParametersStop  = steady_clock::now();
+ //-----------------------------------------------------------------------------
+    auto forwardContextStart    = steady_clock::now();
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t r = 0; r < numberRepetitions; r++ )
+      {
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+               convertGeodeticToEcef
+                      (
+                        ellipsoidContext,
+                        latitudeRadians   [ i ],
+                        longitudeRadians  [ i ],
+                        altitudeMeters    [ i ],
+                        contextXEcefMeters[ i ],
+                        contextYEcefMeters[ i ],
+                        contextZEcefMeters[ i ]
+                      );
+            };
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    auto forwardContextStop     = steady_clock::now();
+ //=============================================================================
+ //
+ // ECEF to geodetic.
+ //
+ //=============================================================================
+    auto inverseParametersStart = steady_clock::now();
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t r = 0; r < numberRepetitions; r++ )
+      {
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+               ( void )
+               convertEcefToGeodetic
+                      (
+                        earthEquatorialRadiusMeters,
+                        earthEllipsoidalFlatteningFactor,
+                        xEcefMeters       [ i ],
+                        yEcefMeters       [ i ],
+                        zEcefMeters       [ i ],
+                        estimatedLatitude [ i ],
+                        estimatedLongitude[ i ],
+                        estimatedAltitude [ i ]
+                      );
+            };
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    auto inverseParametersStop  = steady_clock::now();
+ //-----------------------------------------------------------------------------
+    auto inverseContextStart    = steady_clock::now();
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t r = 0; r < numberRepetitions; r++ )
+      {
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+               ( void )
+               convertEcefToGeodetic
+                      (
+                        ellipsoidContext,
+                        xEcefMeters     [ i ],
+                        yEcefMeters     [ i ],
+                        zEcefMeters     [ i ],
+                        contextLatitude [ i ],
+                        contextLongitude[ i ],
+                        contextAltitude [ i ]
+                      );
+            };
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    auto inverseContextStop     = steady_clock::now();
+ //-----------------------------------------------------------------------------
+ // Largest differences between the two call paths.
+ //-----------------------------------------------------------------------------
+    double maximumEcefDifferenceNanoMeters          = 0.0;
+    double maximumLatitudeDifferenceMicroArcSecs    = 0.0;
+    double maximumAltitudeDifferenceNanoMeters      = 0.0;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t i = 0; i < numberPoints; i++ )
+      {
+          maximumEcefDifferenceNanoMeters =
+          max(
+               maximumEcefDifferenceNanoMeters,
+               nanoMetersPerMeter *
+               max(
+                    fabs( xEcefMeters[ i ] - contextXEcefMeters[ i ] ),
+                    max(
+                         fabs( yEcefMeters[ i ] - contextYEcefMeters[ i ] ),
+                         fabs( zEcefMeters[ i ] - contextZEcefMeters[ i ] )
+                       )
+                  )
+             );
+          maximumLatitudeDifferenceMicroArcSecs =
+          max(
+               maximumLatitudeDifferenceMicroArcSecs,
+               microArcSecondsPerRadian *
+               fabs( estimatedLatitude[ i ] - contextLatitude[ i ] )
+             );
+          maximumAltitudeDifferenceNanoMeters =
+          max(
+               maximumAltitudeDifferenceNanoMeters,
+               nanoMetersPerMeter *
+               fabs( estimatedAltitude[ i ] - contextAltitude[ i ] )
+             );
+      };
+ //-----------------------------------------------------------------------------
+    const
+    double
+     numberConvertedPoints = ( double )numberRepetitions * numberPoints;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    double
+     forwardParametersNanoSecondsPerPoint =
+       duration< double, nano >
+       ( forwardParametersStop - forwardParametersStart ).count( )
+       / numberConvertedPoints;
+    const
+    double
+     forwardContextNanoSecondsPerPoint =
+       duration< double, nano >
+       ( forwardContextStop - forwardContextStart ).count( )
+       / numberConvertedPoints;
+    const
+    double
+     inverseParametersNanoSecondsPerPoint =
+       duration< double, nano >
+       ( inverseParametersStop - inverseParametersStart ).count( )
+       / numberConvertedPoints;
+    const
+    double
+     inverseContextNanoSecondsPerPoint =
+       duration< double, nano >
+       ( inverseContextStop - inverseContextStart ).count( )
+       / numberConvertedPoints;
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "\n\n\n"
+       "%s%s\n"
+       "%s\n%s\n%s\n"
+       "%s%zu\n"
+       "%s\n"
+       "%s%s\n"
+       "%s\n"
+       "%s\n"
+       "%s%13.3f%13.3f%10.2f\n"
+       "%s%13.3f%13.3f%10.2f\n"
+       "%s\n"
+       "%s%+14.6e%s\n"
+       "%s%+14.6e%s\n"
+       "%s%+14.6e%s\n"
+       "%s\n"
+       "%s%s\n"
+       "\n\n\n",
+       "============================================",
+       "============================================",
+       "|",
+       "| ELLIPSOID CONTEXT TIMING RESULTS:",
+       "|",
+       "|    Number of points ",
+       numberPoints,
+       "|",
+       "|-------------------------------------------",
+       "--------------------------------------------",
+       "|    Conversion          Parameters      Context   Speedup",
+       "|                        [ns/point]   [ns/point]",
+       "|    convertGeodeticToEcef",
+       forwardParametersNanoSecondsPerPoint,
+       forwardContextNanoSecondsPerPoint,
+       forwardParametersNanoSecondsPerPoint /
+       forwardContextNanoSecondsPerPoint,
+       "|    convertEcefToGeodetic",
+       inverseParametersNanoSecondsPerPoint,
+       inverseContextNanoSecondsPerPoint,
+       inverseParametersNanoSecondsPerPoint /
+       inverseContextNanoSecondsPerPoint,
+       "|",
+       "|    Maximum ECEF coordinate difference between paths:      ",
+       maximumEcefDifferenceNanoMeters,
+       " [nanometers]",
+       "|    Maximum latitude difference between paths:             ",
+       maximumLatitudeDifferenceMicroArcSecs,
+       " [microarcseconds]",
+       "|    Maximum altitude difference between paths:             ",
+       maximumAltitudeDifferenceNanoMeters,
+       " [nanometers]",
+       "|",
+       "============================================",
+       "============================================"
+     );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,500 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+
+//------------------------------------------------------------------------------
+struct
+ENGINE_TIMING_RUN_DATA
+  {
+    const EARTH_ELLIPSOID_CONTEXT      * pEllipsoidContext;
+    ECEF_TO_GEODETIC_ENGINE              conversionEngine;
+    size_t                               numberPoints;
+    const double                       * pXEcefMeters;
+    const double                       * pYEcefMeters;
+    const double                       * pZEcefMeters;
+    double                             * pGeodeticNorthLatitudeRadians;
+    double                             * pGeocentricEastLongitudeRadians;
+    double                             * pGeodeticAltitudeMeters;
+    ECEF_TO_GEODETIC_CONVERSION_STATUS * pConversionStatus;
+  };
+
+//------------------------------------------------------------------------------
+// One timed run: one scalar engine call per point.
+//------------------------------------------------------------------------------
+static
+void
+engineScalarTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    ENGINE_TIMING_RUN_DATA
+        & rRunData = *( ENGINE_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < rRunData.numberPoints; i++ )
+      {
+          rRunData.pConversionStatus[ i ] =
+                 convertEcefToGeodetic
+                        (
+                          *rRunData.pEllipsoidContext,
+                          rRunData.conversionEngine,
+                          rRunData.pXEcefMeters[ i ],
+                          rRunData.pYEcefMeters[ i ],
+                          rRunData.pZEcefMeters[ i ],
+                          rRunData.pGeodeticNorthLatitudeRadians  [ i ],
+                          rRunData.pGeocentricEastLongitudeRadians[ i ],
+                          rRunData.pGeodeticAltitudeMeters        [ i ]
+                        );
+      };
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: one batch engine call.
+//------------------------------------------------------------------------------
+static
+void
+engineBatchTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    ENGINE_TIMING_RUN_DATA
+        & rRunData = *( ENGINE_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticBatch
+           (
+             *rRunData.pEllipsoidContext,
+             rRunData.conversionEngine,
+             rRunData.numberPoints,
+             rRunData.pXEcefMeters,
+             rRunData.pYEcefMeters,
+             rRunData.pZEcefMeters,
+             rRunData.pGeodeticNorthLatitudeRadians,
+             rRunData.pGeocentricEastLongitudeRadians,
+             rRunData.pGeodeticAltitudeMeters,
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+executeEngineTimingConvertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const
+            int      numberPointsExponent
+         //-------------------
+         // OUTPUT(s):
+         //           NONE
+         //-------------------
+       )
+//==============================================================================
+//|
+//| FUNCTION:
+//|
+//|   executeEngineTimingConvertEcefToGeodetic
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| PURPOSE:
+//|
+//|   To compare the conversion engines of the engine overloads of
+//|   'convertEcefToGeodetic' and 'convertEcefToGeodeticBatch' on the same
+//|   points and the same grid, so that the cheapest engine meeting an
+//|   accuracy budget can be chosen.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| INPUT(s):
+//|
+//|   numberPointsExponent
+//|     The base ten exponent of the number of timed points.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| METHOD:
+//|
+//|   [ 1 ] Generate 10^numberPointsExponent true geodetic points, with
+//|         uniform latitude and longitude and altitudes from -10 km to
+//|         50000 km evenly spaced in asinh( h / 1 km ).  Every 97th point
+//|         is put on a pole.
+//|
+//|   [ 2 ] For every engine, time the scalar overload, one call per
+//|         point, and the batch overload with 'measureConversionTiming',
+//|         and find the maximum latitude and altitude errors of the batch
+//|         against the true points.
+//|
+//|   [ 3 ] Sweep every engine over a coarser grid than the default of
+//|         'sweepAccuracyConvertEcefToGeodetic', 181 latitudes by 8
+//|         longitudes by 100 altitudes, and report the maximum errors of
+//|         each band of altitude, over all latitudes, and the 99th
+//|         percentile errors of the whole grid.
+//|
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const
+    double
+     piRadians                           = 4.0 * atan( 1.0 );
+ //-----------------------------------------------------------------------------
+ //
+ // GRS1980 System
+ //
+ //-----------------------------------------------------------------------------
+    const
+    double
+     earthEquatorialRadiusMeters         = 6378137.0E0;
+    const
+    double
+     earthEllipsoidalFlatteningFactor    = 1.0E0 / 298.257222101E0;
+    const
+    double
+     earthEllipsoidalEccentricitySquared =
+                         ( 2.0E0 - earthEllipsoidalFlatteningFactor )
+                         *
+                         earthEllipsoidalFlatteningFactor;
+ //-----------------------------------------------------------------------------
+    const
+    int
+     NUMBER_WARM_UP_RUNS = 1;
+    const
+    int
+     NUMBER_TIMED_RUNS   = 7;
+ //-----------------------------------------------------------------------------
+    EARTH_ELLIPSOID_CONTEXT
+     ellipsoidContext;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    ( void )
+    initializeEarthEllipsoidContext
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalFlatteningFactor,
+             ellipsoidContext
+           );
+ //-----------------------------------------------------------------------------
+    size_t
+     numberPoints = 1;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int exponent = 0; exponent < numberPointsExponent; exponent++ )
+      {
+          numberPoints = 10 * numberPoints;
+      };
+ //-----------------------------------------------------------------------------
+ // Generate the true geodetic points and their ECEF coordinates.
+ //-----------------------------------------------------------------------------
+    vector< double > trueLatitudeRadians ( numberPoints );
+    vector< double > trueLongitudeRadians( numberPoints );
+    vector< double > trueAltitudeMeters  ( numberPoints );
+    vector< double > xEcefMeters         ( numberPoints );
+    vector< double > yEcefMeters         ( numberPoints );
+    vector< double > zEcefMeters         ( numberPoints );
+    vector< double > latitudeRadians     ( numberPoints );
+    vector< double > longitudeRadians    ( numberPoints );
+    vector< double > altitudeMeters      ( numberPoints );
+    vector< ECEF_TO_GEODETIC_CONVERSION_STATUS >
+                     conversionStatus    ( numberPoints );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    generateTimingGeodeticPoints
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalEccentricitySquared,
+             -1.0E4,
+             5.0E7,
+             ASINH_TIMING_ALTITUDE_SPACING,
+             97,
+             numberPoints,
+             trueLatitudeRadians .data( ),
+             trueLongitudeRadians.data( ),
+             trueAltitudeMeters  .data( ),
+             xEcefMeters         .data( ),
+             yEcefMeters         .data( ),
+             zEcefMeters         .data( ),
+             NULL
+           );
+ //-----------------------------------------------------------------------------
+    ENGINE_TIMING_RUN_DATA
+     runData;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    runData.pEllipsoidContext               = &ellipsoidContext;
+    runData.numberPoints                    = numberPoints;
+    runData.pXEcefMeters                    = xEcefMeters     .data( );
+    runData.pYEcefMeters                    = yEcefMeters     .data( );
+    runData.pZEcefMeters                    = zEcefMeters     .data( );
+    runData.pGeodeticNorthLatitudeRadians   = latitudeRadians .data( );
+    runData.pGeocentricEastLongitudeRadians = longitudeRadians.data( );
+    runData.pGeodeticAltitudeMeters         = altitudeMeters  .data( );
+    runData.pConversionStatus               = conversionStatus.data( );
+ //-----------------------------------------------------------------------------
+    const
+    double
+     MICRO_ARC_SECONDS_PER_RADIAN = 180.0 * 3600.0E6 / piRadians;
+ //-----------------------------------------------------------------------------
+ // Report header.
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "\n\n\n"
+       "%s%s\n"
+       "%s\n%s\n%s\n"
+       "%s%zu%s\n"
+       "%s\n"
+       "%s%s\n"
+       "%s%s\n"
+       "%s%s\n"
+       "%s%s\n",
+       "============================================",
+       "============================================",
+       "|",
+       "| CONVERSION ENGINE TIMING RESULTS:",
+       "|",
+       "|    ",
+       numberPoints,
+       " points from -10 km to 50000 km altitude",
+       "|",
+       "|-------------------------------------------",
+       "--------------------------------------------",
+       "|    Engine                    Scalar     MAD   Batch     MAD",
+       "   Max lat  Max alt  Failed",
+       "|                          [ns/point]       [ns/point]      ",
+       "     [uas]     [nm]        ",
+       "|-------------------------------------------",
+       "--------------------------------------------"
+     );
+ //-----------------------------------------------------------------------------
+ // Loop over the engines.
+ //-----------------------------------------------------------------------------
+    for( int engine = 0; engine < NUMBER_ECEF_TO_GEODETIC_ENGINES; engine++ )
+      {
+       //-----------------------------------------------------------------------
+          runData.conversionEngine = ( ECEF_TO_GEODETIC_ENGINE )engine;
+       //-----------------------------------------------------------------------
+          CONVERSION_TIMING_STATISTICS
+           scalarTiming;
+          CONVERSION_TIMING_STATISTICS
+           batchTiming;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          measureConversionTiming
+                 (
+                   engineScalarTimingRun,
+                   &runData,
+                   numberPoints,
+                   NUMBER_WARM_UP_RUNS,
+                   NUMBER_TIMED_RUNS,
+                   scalarTiming
+                 );
+          measureConversionTiming
+                 (
+                   engineBatchTimingRun,
+                   &runData,
+                   numberPoints,
+                   NUMBER_WARM_UP_RUNS,
+                   NUMBER_TIMED_RUNS,
+                   batchTiming
+                 );
+       //-----------------------------------------------------------------------
+       // The errors of the last batch run.
+       //-----------------------------------------------------------------------
+          double maximumLatitudeErrorMicroArcSecs = 0.0;
+          double maximumAltitudeErrorNanoMeters   = 0.0;
+          size_t numberFailedConversions          = 0;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+               if( conversionStatus[ i ] != SUCCESSFUL_CONVERSION )
+                 {
+                    numberFailedConversions++;
+                    continue;
+                 };
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               maximumLatitudeErrorMicroArcSecs =
+                      max( maximumLatitudeErrorMicroArcSecs,
+                           MICRO_ARC_SECONDS_PER_RADIAN *
+                           fabs( latitudeRadians[ i ] -
+                                 trueLatitudeRadians[ i ] ) );
+               maximumAltitudeErrorNanoMeters   =
+                      max( maximumAltitudeErrorNanoMeters,
+                           1.0E9 * fabs( altitudeMeters[ i ] -
+                                         trueAltitudeMeters[ i ] ) );
+            };
+       //-----------------------------------------------------------------------
+          fprintf
+           (
+             stdout,
+             "|    %-24s %8.2f %7.3f %7.2f %7.3f %9.3g %8.3g %7zu\n",
+             ECEF_TO_GEODETIC_ENGINE_NAMES[ engine ],
+             scalarTiming.medianNanoSecondsPerPoint,
+             scalarTiming.madNanoSecondsPerPoint,
+             batchTiming.medianNanoSecondsPerPoint,
+             batchTiming.madNanoSecondsPerPoint,
+             maximumLatitudeErrorMicroArcSecs,
+             maximumAltitudeErrorNanoMeters,
+             numberFailedConversions
+           );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+ // The accuracy sweeps.
+ //-----------------------------------------------------------------------------
+    ACCURACY_SWEEP_SPECIFICATION sweepSpecification;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    sweepSpecification.numberLatitudes         = 181;
+    sweepSpecification.minimumLatitudeDegrees  = -90.0;
+    sweepSpecification.maximumLatitudeDegrees  = +90.0;
+    sweepSpecification.numberLongitudes        = 8;
+    sweepSpecification.minimumLongitudeDegrees = 0.0;
+    sweepSpecification.maximumLongitudeDegrees = 360.0;
+    sweepSpecification.numberAltitudes         = 100;
+    sweepSpecification.minimumAltitudeMeters   = -1.0E4;
+    sweepSpecification.maximumAltitudeMeters   = 5.0E7;
+    sweepSpecification.numberThreads           = 0;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    ACCURACY_SWEEP_STATISTICS
+            regionStatistics[ NUMBER_ACCURACY_SWEEP_LATITUDE_BANDS ]
+                            [ NUMBER_ACCURACY_SWEEP_ALTITUDE_BANDS ];
+    ACCURACY_SWEEP_STATISTICS
+            sweepStatistics;
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "%s\n"
+       "%s%d%s%d%s%d%s\n"
+       "%s\n"
+       "%s%s\n"
+       "%s%s\n"
+       "%s%s\n",
+       "|",
+       "| Accuracy sweeps, ",
+       sweepSpecification.numberLatitudes,
+       " x ",
+       sweepSpecification.numberLongitudes,
+       " x ",
+       sweepSpecification.numberAltitudes,
+       " points, maximum errors by altitude band [uas / nm]",
+       "|",
+       "|-------------------------------------------",
+       "--------------------------------------------",
+       "|    Engine                   subsurf   <100km      LEO      MEO",
+       "     GEO+   p99 all",
+       "|-------------------------------------------",
+       "--------------------------------------------"
+     );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int engine = 0; engine < NUMBER_ECEF_TO_GEODETIC_ENGINES; engine++ )
+      {
+       //-----------------------------------------------------------------------
+          ( void )
+          executeAccuracySweepConvertEcefToGeodetic
+                 (
+                   sweepSpecification,
+                   getEcefToGeodeticEngineBatchFunction
+                          (
+                            ( ECEF_TO_GEODETIC_ENGINE )engine
+                          ),
+                   regionStatistics,
+                   sweepStatistics,
+                   NULL,
+                   NULL
+                 );
+       //-----------------------------------------------------------------------
+       // The maxima of each altitude band over the latitude bands, the
+       // latitude errors on the first line and the altitude errors on the
+       // second.
+       //-----------------------------------------------------------------------
+          double bandMaximumLatitudeErrorMicroArcSecs
+                                   [ NUMBER_ACCURACY_SWEEP_ALTITUDE_BANDS ];
+          double bandMaximumAltitudeErrorNanoMeters
+                                   [ NUMBER_ACCURACY_SWEEP_ALTITUDE_BANDS ];
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( int band = 0; band < NUMBER_ACCURACY_SWEEP_ALTITUDE_BANDS;
+               band++ )
+            {
+               bandMaximumLatitudeErrorMicroArcSecs[ band ] = 0.0;
+               bandMaximumAltitudeErrorNanoMeters  [ band ] = 0.0;
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               for( int latitudeBand = 0;
+                    latitudeBand < NUMBER_ACCURACY_SWEEP_LATITUDE_BANDS;
+                    latitudeBand++ )
+                 {
+                    const ACCURACY_SWEEP_STATISTICS
+                          & rRegion = regionStatistics[ latitudeBand ][ band ];
+                 //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                    if( rRegion.numberPoints == 0 )
+                      {
+                         continue;
+                      };
+                 //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                    bandMaximumLatitudeErrorMicroArcSecs[ band ] =
+                         max( bandMaximumLatitudeErrorMicroArcSecs[ band ],
+                              rRegion.maximumLatitudeErrorMicroArcSecs );
+                    bandMaximumAltitudeErrorNanoMeters  [ band ] =
+                         max( bandMaximumAltitudeErrorNanoMeters  [ band ],
+                              rRegion.maximumAltitudeErrorNanoMeters );
+                 };
+            };
+       //-----------------------------------------------------------------------
+          fprintf
+           (
+             stdout,
+             "|    %-24s %8.3g %8.3g %8.3g %8.3g %8.3g %9.3g\n"
+             "|    %-24s %8.3g %8.3g %8.3g %8.3g %8.3g %9.3g\n",
+             ECEF_TO_GEODETIC_ENGINE_NAMES[ engine ],
+             bandMaximumLatitudeErrorMicroArcSecs[ 0 ],
+             bandMaximumLatitudeErrorMicroArcSecs[ 1 ],
+             bandMaximumLatitudeErrorMicroArcSecs[ 2 ],
+             bandMaximumLatitudeErrorMicroArcSecs[ 3 ],
+             bandMaximumLatitudeErrorMicroArcSecs[ 4 ],
+             sweepStatistics.percentile99LatitudeErrorMicroArcSecs,
+             "",
+             bandMaximumAltitudeErrorNanoMeters[ 0 ],
+             bandMaximumAltitudeErrorNanoMeters[ 1 ],
+             bandMaximumAltitudeErrorNanoMeters[ 2 ],
+             bandMaximumAltitudeErrorNanoMeters[ 3 ],
+             bandMaximumAltitudeErrorNanoMeters[ 4 ],
+             sweepStatistics.percentile99AltitudeErrorNanoMeters
+           );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "%s\n"
+       "%s%s\n"
+       "\n\n\n",
+       "|",
+       "============================================",
+       "============================================"
+     );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
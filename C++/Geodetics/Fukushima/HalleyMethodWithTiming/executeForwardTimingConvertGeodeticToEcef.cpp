@@ -0,0 +1,429 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+
+//------------------------------------------------------------------------------
+struct
+FORWARD_TIMING_RUN_DATA
+  {
+    ECEF_TO_GEODETIC_ISA_LEVEL           isaLevel;
+    double                               earthEquatorialRadiusMeters;
+    double                               earthEllipsoidalEccentricitySquared;
+    size_t                               batchSize;
+    size_t                               numberRepetitions;
+    const double                       * pGeodeticNorthLatitudeRadians;
+    const double                       * pGeocentricEastLongitudeRadians;
+    const double                       * pGeodeticAltitudeMeters;
+    double                             * pXEcefMeters;
+    double                             * pYEcefMeters;
+    double                             * pZEcefMeters;
+    ECEF_TO_GEODETIC_CONVERSION_STATUS * pConversionStatus;
+  };
+
+//------------------------------------------------------------------------------
+// One timed run: numberRepetitions loops of scalar calls over the batch.
+//------------------------------------------------------------------------------
+static
+void
+convertForwardScalarTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    const
+    FORWARD_TIMING_RUN_DATA
+        & rRunData = *( const FORWARD_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    for( size_t r = 0; r < rRunData.numberRepetitions; r++ )
+      {
+          for( size_t i = 0; i < rRunData.batchSize; i++ )
+            {
+               rRunData.pConversionStatus[ i ] =
+               convertGeodeticToEcef
+                      (
+                        rRunData.earthEquatorialRadiusMeters,
+                        rRunData.earthEllipsoidalEccentricitySquared,
+                        rRunData.pGeodeticNorthLatitudeRadians  [ i ],
+                        rRunData.pGeocentricEastLongitudeRadians[ i ],
+                        rRunData.pGeodeticAltitudeMeters        [ i ],
+                        rRunData.pXEcefMeters[ i ],
+                        rRunData.pYEcefMeters[ i ],
+                        rRunData.pZEcefMeters[ i ]
+                      );
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          preventConversionTimingReordering( );
+      };
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: numberRepetitions batch calls with the kernel of isaLevel.
+//------------------------------------------------------------------------------
+static
+void
+convertForwardBatchTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    const
+    FORWARD_TIMING_RUN_DATA
+        & rRunData = *( const FORWARD_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    for( size_t r = 0; r < rRunData.numberRepetitions; r++ )
+      {
+          ( void )
+          convertGeodeticToEcefBatchForIsaLevel
+                 (
+                   rRunData.isaLevel,
+                   rRunData.earthEquatorialRadiusMeters,
+                   rRunData.earthEllipsoidalEccentricitySquared,
+                   rRunData.batchSize,
+                   rRunData.pGeodeticNorthLatitudeRadians,
+                   rRunData.pGeocentricEastLongitudeRadians,
+                   rRunData.pGeodeticAltitudeMeters,
+                   rRunData.pXEcefMeters,
+                   rRunData.pYEcefMeters,
+                   rRunData.pZEcefMeters,
+                   rRunData.pConversionStatus
+                 );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          preventConversionTimingReordering( );
+      };
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+executeForwardTimingConvertGeodeticToEcef
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const
+            int      batchSizeExponent
+         //-------------------
+         // OUTPUT(s):
+         //           NONE
+         //-------------------
+       )
+//==============================================================================
+//|
+//| FUNCTION:
+//|
+//|   executeForwardTimingConvertGeodeticToEcef
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| PURPOSE:
+//|
+//|   To report the execution time per point of the forward conversion,
+//|   geodetic to ECEF:  scalar 'convertGeodeticToEcef' calls, and
+//|   'convertGeodeticToEcefBatchForIsaLevel' for each instruction set
+//|   level which the processor supports, with the largest distance of
+//|   each kernel's points from the scalar ones and the number of point
+//|   statuses which differ.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| INPUT(s):
+//|
+//|   batchSizeExponent
+//|     The base ten exponent of the timed batch size.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| METHOD:
+//|
+//|   [ 1 ]  Generate 10^batchSizeExponent random geodetic points, from
+//|          10 km below to 3000 km above the GRS80 ellipsoid, at longitudes
+//|          in [ -2 pi, 2 pi ].  Every 97th point is on a pole and every
+//|          997th point is 7000 km deep, where rho and rhoz are not both
+//|          positive, so the masks of the kernels are exercised.
+//|
+//|   [ 2 ]  Time the scalar loop and each kernel with
+//|          'measureConversionTiming', converting the batch repeatedly
+//|          until at least MINIMUM_POINTS_PER_RUN points have been
+//|          converted per run.
+//|
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const
+    double
+     nanoMetersPerMeter                  = 1.0E9;
+ //-----------------------------------------------------------------------------
+ //
+ // GRS1980 System
+ //
+ //-----------------------------------------------------------------------------
+    const
+    double
+     earthEquatorialRadiusMeters         = 6378137.0E0;
+    const
+    double
+     earthEllipsoidalFlatteningFactor    = 1.0E0 / 298.257222101E0;
+    const
+    double
+     earthEllipsoidalEccentricitySquared =
+                         ( 2.0E0 - earthEllipsoidalFlatteningFactor )
+                         *
+                         earthEllipsoidalFlatteningFactor;
+ //-----------------------------------------------------------------------------
+    const
+    size_t
+     MINIMUM_POINTS_PER_RUN = 1000000;
+    const
+    int
+     NUMBER_WARM_UP_RUNS    = 1;
+    const
+    int
+     NUMBER_TIMED_RUNS      = 7;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    char *
+     isaLevelNames[ 3 ] = { "Baseline", "AVX2+FMA", "AVX-512" };
+ //-----------------------------------------------------------------------------
+    size_t
+     batchSize = 1;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int exponent = 0; exponent < batchSizeExponent; exponent++ )
+      {
+          batchSize = 10 * batchSize;
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    size_t
+     numberRepetitions = max(
+                              ( size_t )1,
+                              MINIMUM_POINTS_PER_RUN / batchSize
+                            );
+ //-----------------------------------------------------------------------------
+ // Generate the geodetic points.
+ //-----------------------------------------------------------------------------
+    vector< double > latitudeRadians     ( batchSize );
+    vector< double > longitudeRadians    ( batchSize );
+    vector< double > altitudeMeters      ( batchSize );
+    vector< double > scalarXEcefMeters   ( batchSize );
+    vector< double > scalarYEcefMeters   ( batchSize );
+    vector< double > scalarZEcefMeters   ( batchSize );
+    vector< double > xEcefMeters         ( batchSize );
+    vector< double > yEcefMeters         ( batchSize );
+    vector< double > zEcefMeters         ( batchSize );
+    vector< ECEF_TO_GEODETIC_CONVERSION_STATUS >
+                     scalarStatus        ( batchSize );
+    vector< ECEF_TO_GEODETIC_CONVERSION_STATUS >
+                     conversionStatus    ( batchSize );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    generateTimingGeodeticPoints
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalEccentricitySquared,
+             -1.0E4,
+             3.0E6,
+             UNIFORM_TIMING_ALTITUDE_SPACING,
+             97,
+             batchSize,
+             latitudeRadians .data( ),
+             longitudeRadians.data( ),
+             altitudeMeters  .data( ),
+             NULL,
+             NULL,
+             NULL,
+             NULL
+           );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+ // Spread the longitudes over [ -2 pi, 2 pi ] and put every 997th point
+ // 7000 km deep (see METHOD [ 1 ]).
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t i = 0; i < batchSize; i++ )
+      {
+          longitudeRadians[ i ] = 2.0 * longitudeRadians[ i ];
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( i % 997 == 996 )
+            {
+               altitudeMeters [ i ] = -7.0E6;
+            };
+      };
+ //-----------------------------------------------------------------------------
+ // Time the scalar function calls, keeping their results as the reference.
+ //-----------------------------------------------------------------------------
+    FORWARD_TIMING_RUN_DATA
+     runData;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    runData.isaLevel                            = BASELINE_ISA_LEVEL;
+    runData.earthEquatorialRadiusMeters         = earthEquatorialRadiusMeters;
+    runData.earthEllipsoidalEccentricitySquared =
+                                      earthEllipsoidalEccentricitySquared;
+    runData.batchSize                           = batchSize;
+    runData.numberRepetitions                   = numberRepetitions;
+    runData.pGeodeticNorthLatitudeRadians       = latitudeRadians .data( );
+    runData.pGeocentricEastLongitudeRadians     = longitudeRadians.data( );
+    runData.pGeodeticAltitudeMeters             = altitudeMeters  .data( );
+    runData.pXEcefMeters                        = scalarXEcefMeters.data( );
+    runData.pYEcefMeters                        = scalarYEcefMeters.data( );
+    runData.pZEcefMeters                        = scalarZEcefMeters.data( );
+    runData.pConversionStatus                   = scalarStatus.data( );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    CONVERSION_TIMING_STATISTICS
+     scalarTiming;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    measureConversionTiming
+           (
+             convertForwardScalarTimingRun,
+             &runData,
+             numberRepetitions * batchSize,
+             NUMBER_WARM_UP_RUNS,
+             NUMBER_TIMED_RUNS,
+             scalarTiming
+           );
+ //-----------------------------------------------------------------------------
+ // Report header.
+ //-----------------------------------------------------------------------------
+    const
+    ECEF_TO_GEODETIC_ISA_LEVEL
+     supportedIsaLevel = detectEcefToGeodeticIsaLevel( );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    fprintf
+     (
+       stdout,
+       "\n\n\n"
+       "%s%s\n"
+       "%s\n%s\n%s\n"
+       "%s%zu%s%s\n"
+       "%s\n"
+       "%s%s\n"
+       "%s%s\n"
+       "%s\n"
+       "|    %-9s %11.3f %8.3f %9.1f\n"
+       "%s\n",
+       "============================================",
+       "============================================",
+       "|",
+       "| FORWARD (GEODETIC TO ECEF) TIMING RESULTS:",
+       "|",
+       "|    Batch size ",
+       batchSize,
+       ",  widest supported ISA level ",
+       isaLevelNames[ supportedIsaLevel ],
+       "|",
+       "|-------------------------------------------",
+       "--------------------------------------------",
+       "|    Kernel     [ns/point]      MAD  [cycles]",
+       "  vs scalar  Max diff [nm]  Status diff",
+       "|",
+       "Scalar",
+       scalarTiming.medianNanoSecondsPerPoint,
+       scalarTiming.madNanoSecondsPerPoint,
+       scalarTiming.medianCyclesPerPoint,
+       "|"
+     );
+ //-----------------------------------------------------------------------------
+ // Loop over the supported ISA levels.
+ //-----------------------------------------------------------------------------
+    runData.pXEcefMeters      = xEcefMeters.data( );
+    runData.pYEcefMeters      = yEcefMeters.data( );
+    runData.pZEcefMeters      = zEcefMeters.data( );
+    runData.pConversionStatus = conversionStatus.data( );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int level = BASELINE_ISA_LEVEL; level <= supportedIsaLevel; level++ )
+      {
+       //-----------------------------------------------------------------------
+          runData.isaLevel = ( ECEF_TO_GEODETIC_ISA_LEVEL )level;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          CONVERSION_TIMING_STATISTICS
+           batchTiming;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          measureConversionTiming
+                 (
+                   convertForwardBatchTimingRun,
+                   &runData,
+                   numberRepetitions * batchSize,
+                   NUMBER_WARM_UP_RUNS,
+                   NUMBER_TIMED_RUNS,
+                   batchTiming
+                 );
+       //-----------------------------------------------------------------------
+       // Distance from the scalar points, and status differences.  A point
+       // converted by one and not the other is a status difference only.
+       //-----------------------------------------------------------------------
+          double
+           maximumDifferenceNanoMeters = 0.0;
+          size_t
+           numberStatusDifferences     = 0;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t i = 0; i < batchSize; i++ )
+            {
+               if( conversionStatus[ i ] != scalarStatus[ i ] )
+                 {
+                    numberStatusDifferences++;
+                 }
+               else
+               if( scalarStatus[ i ] == SUCCESSFUL_CONVERSION )
+                 {
+                    maximumDifferenceNanoMeters =
+                    max(
+                         maximumDifferenceNanoMeters,
+                         nanoMetersPerMeter *
+                         sqrt(
+                               pow( xEcefMeters[ i ] - scalarXEcefMeters[ i ],
+                                    2 ) +
+                               pow( yEcefMeters[ i ] - scalarYEcefMeters[ i ],
+                                    2 ) +
+                               pow( zEcefMeters[ i ] - scalarZEcefMeters[ i ],
+                                    2 )
+                             )
+                       );
+                 };
+            };
+       //-----------------------------------------------------------------------
+          fprintf
+           (
+             stdout,
+             "|    %-9s %11.3f %8.3f %9.1f %10.2f %14.4f %12zu\n",
+             isaLevelNames[ level ],
+             batchTiming.medianNanoSecondsPerPoint,
+             batchTiming.madNanoSecondsPerPoint,
+             batchTiming.medianCyclesPerPoint,
+             scalarTiming.medianNanoSecondsPerPoint /
+             batchTiming.medianNanoSecondsPerPoint,
+             maximumDifferenceNanoMeters,
+             numberStatusDifferences
+           );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "%s\n"
+       "%s%s\n"
+       "\n\n\n",
+       "|",
+       "============================================",
+       "============================================"
+     );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
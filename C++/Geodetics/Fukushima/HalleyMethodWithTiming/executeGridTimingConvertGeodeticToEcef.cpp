@@ -0,0 +1,467 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+
+//------------------------------------------------------------------------------
+struct
+GRID_TIMING_RUN_DATA
+  {
+    double                               earthEquatorialRadiusMeters;
+    double                               earthEllipsoidalEccentricitySquared;
+    size_t                               numberRows;
+    size_t                               numberColumns;
+    double                               firstLatitudeRadians;
+    double                               latitudeStepRadians;
+    double                               firstLongitudeRadians;
+    double                               longitudeStepRadians;
+    const double                       * pCellLatitudeRadians;
+    const double                       * pCellLongitudeRadians;
+    const double                       * pGeodeticAltitudeMeters;
+    double                             * pXEcefMeters;
+    double                             * pYEcefMeters;
+    double                             * pZEcefMeters;
+    ECEF_TO_GEODETIC_CONVERSION_STATUS * pConversionStatus;
+  };
+
+//------------------------------------------------------------------------------
+// One timed run: one scalar call per grid cell.
+//------------------------------------------------------------------------------
+static
+void
+convertGridScalarTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    const
+    GRID_TIMING_RUN_DATA
+        & rRunData = *( const GRID_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    const
+    size_t
+     numberCells = rRunData.numberRows * rRunData.numberColumns;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t i = 0; i < numberCells; i++ )
+      {
+          rRunData.pConversionStatus[ i ] =
+          convertGeodeticToEcef
+                 (
+                   rRunData.earthEquatorialRadiusMeters,
+                   rRunData.earthEllipsoidalEccentricitySquared,
+                   rRunData.pCellLatitudeRadians   [ i ],
+                   rRunData.pCellLongitudeRadians  [ i ],
+                   rRunData.pGeodeticAltitudeMeters[ i ],
+                   rRunData.pXEcefMeters[ i ],
+                   rRunData.pYEcefMeters[ i ],
+                   rRunData.pZEcefMeters[ i ]
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: one batch call over the cells, with per cell angles.
+//------------------------------------------------------------------------------
+static
+void
+convertGridBatchTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    const
+    GRID_TIMING_RUN_DATA
+        & rRunData = *( const GRID_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    ( void )
+    convertGeodeticToEcefBatch
+           (
+             rRunData.earthEquatorialRadiusMeters,
+             rRunData.earthEllipsoidalEccentricitySquared,
+             rRunData.numberRows * rRunData.numberColumns,
+             rRunData.pCellLatitudeRadians,
+             rRunData.pCellLongitudeRadians,
+             rRunData.pGeodeticAltitudeMeters,
+             rRunData.pXEcefMeters,
+             rRunData.pYEcefMeters,
+             rRunData.pZEcefMeters,
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: one separable grid call.
+//------------------------------------------------------------------------------
+static
+void
+convertGridSeparableTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    const
+    GRID_TIMING_RUN_DATA
+        & rRunData = *( const GRID_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    ( void )
+    convertGeodeticGridToEcef
+           (
+             rRunData.earthEquatorialRadiusMeters,
+             rRunData.earthEllipsoidalEccentricitySquared,
+             rRunData.numberRows,
+             rRunData.numberColumns,
+             rRunData.firstLatitudeRadians,
+             rRunData.latitudeStepRadians,
+             rRunData.firstLongitudeRadians,
+             rRunData.longitudeStepRadians,
+             rRunData.pGeodeticAltitudeMeters,
+             rRunData.pXEcefMeters,
+             rRunData.pYEcefMeters,
+             rRunData.pZEcefMeters,
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+executeGridTimingConvertGeodeticToEcef
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const
+            int      numberCellsExponent
+         //-------------------
+         // OUTPUT(s):
+         //           NONE
+         //-------------------
+       )
+//==============================================================================
+//|
+//| FUNCTION:
+//|
+//|   executeGridTimingConvertGeodeticToEcef
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| PURPOSE:
+//|
+//|   To report the execution time per cell of converting a regular
+//|   latitude and longitude grid with an altitude per cell, a DEM tile,
+//|   to ECEF coordinates by three routes:  one 'convertGeodeticToEcef'
+//|   call per cell, one 'convertGeodeticToEcefBatch' call with the angles
+//|   of every cell, and one 'convertGeodeticGridToEcef' call, with the
+//|   largest distance of the last two from the scalar points.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| INPUT(s):
+//|
+//|   numberCellsExponent
+//|     The base ten exponent of the number of grid cells.  The grid has
+//|     10^ceil( exponent / 2 ) rows and 10^floor( exponent / 2 ) columns.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| METHOD:
+//|
+//|   [ 1 ] The tile spans 50 to 40 degrees north, north up, and 5 to 15
+//|         degrees east, with random altitudes from -400 to 8800 meters.
+//|         The per cell angles given to the scalar and batch routes are
+//|         computed first + index * step, as the grid routine does.
+//|
+//|   [ 2 ] 'measureConversionTiming' times each route over runs of the
+//|         whole grid.
+//|
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const
+    double
+     degreesToRadians                    = atan( 1.0 ) / 45.0;
+    const
+    double
+     nanoMetersPerMeter                  = 1.0E9;
+ //-----------------------------------------------------------------------------
+ //
+ // GRS1980 System
+ //
+ //-----------------------------------------------------------------------------
+    const
+    double
+     earthEquatorialRadiusMeters         = 6378137.0E0;
+    const
+    double
+     earthEllipsoidalFlatteningFactor    = 1.0E0 / 298.257222101E0;
+    const
+    double
+     earthEllipsoidalEccentricitySquared =
+                         ( 2.0E0 - earthEllipsoidalFlatteningFactor )
+                         *
+                         earthEllipsoidalFlatteningFactor;
+ //-----------------------------------------------------------------------------
+    const
+    int
+     NUMBER_WARM_UP_RUNS = 1;
+    const
+    int
+     NUMBER_TIMED_RUNS   = 7;
+ //-----------------------------------------------------------------------------
+    size_t
+     numberRows    = 1;
+    size_t
+     numberColumns = 1;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int exponent = 0; exponent < numberCellsExponent; exponent++ )
+      {
+          if( exponent % 2 == 0 )
+            {
+               numberRows    = 10 * numberRows;
+            }
+          else
+            {
+               numberColumns = 10 * numberColumns;
+            };
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    size_t
+     numberCells = numberRows * numberColumns;
+ //-----------------------------------------------------------------------------
+ // Generate the tile.
+ //-----------------------------------------------------------------------------
+    const
+    double
+     firstLatitudeRadians  = 50.0 * degreesToRadians;
+    const
+    double
+     latitudeStepRadians   = -10.0 * degreesToRadians / numberRows;
+    const
+    double
+     firstLongitudeRadians =  5.0 * degreesToRadians;
+    const
+    double
+     longitudeStepRadians  = 10.0 * degreesToRadians / numberColumns;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    vector< double > cellLatitudeRadians  ( numberCells );
+    vector< double > cellLongitudeRadians ( numberCells );
+    vector< double > altitudeMeters       ( numberCells );
+    vector< double > scalarXEcefMeters    ( numberCells );
+    vector< double > scalarYEcefMeters    ( numberCells );
+    vector< double > scalarZEcefMeters    ( numberCells );
+    vector< double > xEcefMeters          ( numberCells );
+    vector< double > yEcefMeters          ( numberCells );
+    vector< double > zEcefMeters          ( numberCells );
+    vector< ECEF_TO_GEODETIC_CONVERSION_STATUS >
+                     conversionStatus     ( numberCells );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    generateTimingGeodeticPoints
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalEccentricitySquared,
+             -400.0,
+             8800.0,
+             UNIFORM_TIMING_ALTITUDE_SPACING,
+             0,
+             numberCells,
+             NULL,
+             NULL,
+             altitudeMeters.data( ),
+             NULL,
+             NULL,
+             NULL,
+             NULL
+           );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t i = 0; i < numberRows; i++ )
+      {
+          for( size_t j = 0; j < numberColumns; j++ )
+            {
+               const size_t cell = i * numberColumns + j;
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               cellLatitudeRadians [ cell ] =
+                         firstLatitudeRadians  + ( double )i *
+                                                 latitudeStepRadians;
+               cellLongitudeRadians[ cell ] =
+                         firstLongitudeRadians + ( double )j *
+                                                 longitudeStepRadians;
+            };
+      };
+ //-----------------------------------------------------------------------------
+    GRID_TIMING_RUN_DATA
+     runData;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    runData.earthEquatorialRadiusMeters         = earthEquatorialRadiusMeters;
+    runData.earthEllipsoidalEccentricitySquared =
+                                      earthEllipsoidalEccentricitySquared;
+    runData.numberRows                          = numberRows;
+    runData.numberColumns                       = numberColumns;
+    runData.firstLatitudeRadians                = firstLatitudeRadians;
+    runData.latitudeStepRadians                 = latitudeStepRadians;
+    runData.firstLongitudeRadians               = firstLongitudeRadians;
+    runData.longitudeStepRadians                = longitudeStepRadians;
+    runData.pCellLatitudeRadians                = cellLatitudeRadians .data( );
+    runData.pCellLongitudeRadians               = cellLongitudeRadians.data( );
+    runData.pGeodeticAltitudeMeters             = altitudeMeters      .data( );
+    runData.pXEcefMeters                        = scalarXEcefMeters.data( );
+    runData.pYEcefMeters                        = scalarYEcefMeters.data( );
+    runData.pZEcefMeters                        = scalarZEcefMeters.data( );
+    runData.pConversionStatus                   = conversionStatus.data( );
+ //-----------------------------------------------------------------------------
+ // Time the scalar calls, keeping their results as the reference.
+ //-----------------------------------------------------------------------------
+    CONVERSION_TIMING_STATISTICS
+     scalarTiming;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    measureConversionTiming
+           (
+             convertGridScalarTimingRun,
+             &runData,
+             numberCells,
+             NUMBER_WARM_UP_RUNS,
+             NUMBER_TIMED_RUNS,
+             scalarTiming
+           );
+ //-----------------------------------------------------------------------------
+ // Report header.
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "\n\n\n"
+       "%s%s\n"
+       "%s\n%s\n%s\n"
+       "%s%zu%s%zu%s\n"
+       "%s\n"
+       "%s%s\n"
+       "%s%s\n"
+       "%s\n"
+       "|    %-9s %11.3f %8.3f %9.1f\n",
+       "============================================",
+       "============================================",
+       "|",
+       "| GRID (DEM TILE) GEODETIC TO ECEF TIMING RESULTS:",
+       "|",
+       "|    Grid of ",
+       numberRows,
+       " rows by ",
+       numberColumns,
+       " columns",
+       "|",
+       "|-------------------------------------------",
+       "--------------------------------------------",
+       "|    Route      [ns/cell]      MAD  [cycles]",
+       "  vs scalar  Max diff [nm]",
+       "|",
+       "Scalar",
+       scalarTiming.medianNanoSecondsPerPoint,
+       scalarTiming.madNanoSecondsPerPoint,
+       scalarTiming.medianCyclesPerPoint
+     );
+ //-----------------------------------------------------------------------------
+ // Time the batch and the grid routes.
+ //-----------------------------------------------------------------------------
+    runData.pXEcefMeters = xEcefMeters.data( );
+    runData.pYEcefMeters = yEcefMeters.data( );
+    runData.pZEcefMeters = zEcefMeters.data( );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    char *
+     routeNames[ 2 ] = { "Batch", "Grid" };
+    void
+     ( *routeRuns[ 2 ] )( void * ) = { convertGridBatchTimingRun,
+                                       convertGridSeparableTimingRun };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int route = 0; route < 2; route++ )
+      {
+       //-----------------------------------------------------------------------
+          CONVERSION_TIMING_STATISTICS
+           routeTiming;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          measureConversionTiming
+                 (
+                   routeRuns[ route ],
+                   &runData,
+                   numberCells,
+                   NUMBER_WARM_UP_RUNS,
+                   NUMBER_TIMED_RUNS,
+                   routeTiming
+                 );
+       //-----------------------------------------------------------------------
+          double
+           maximumDifferenceNanoMeters = 0.0;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t i = 0; i < numberCells; i++ )
+            {
+               maximumDifferenceNanoMeters =
+               max(
+                    maximumDifferenceNanoMeters,
+                    nanoMetersPerMeter *
+                    sqrt(
+                          pow( xEcefMeters[ i ] - scalarXEcefMeters[ i ], 2 ) +
+                          pow( yEcefMeters[ i ] - scalarYEcefMeters[ i ], 2 ) +
+                          pow( zEcefMeters[ i ] - scalarZEcefMeters[ i ], 2 )
+                        )
+                  );
+            };
+       //-----------------------------------------------------------------------
+          fprintf
+           (
+             stdout,
+             "|    %-9s %11.3f %8.3f %9.1f %10.2f %14.4f\n",
+             routeNames[ route ],
+             routeTiming.medianNanoSecondsPerPoint,
+             routeTiming.madNanoSecondsPerPoint,
+             routeTiming.medianCyclesPerPoint,
+             scalarTiming.medianNanoSecondsPerPoint /
+             routeTiming.medianNanoSecondsPerPoint,
+             maximumDifferenceNanoMeters
+           );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "%s\n"
+       "%s%s\n"
+       "\n\n\n",
+       "|",
+       "============================================",
+       "============================================"
+     );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
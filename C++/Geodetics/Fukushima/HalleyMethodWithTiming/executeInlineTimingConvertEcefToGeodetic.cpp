@@ -0,0 +1,594 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+#include "convertBetweenEcefAndGeodeticInline.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+
+//------------------------------------------------------------------------------
+struct
+INLINE_TIMING_RUN_DATA
+  {
+    double                               earthEquatorialRadiusMeters;
+    double                               earthEllipsoidalFlatteningFactor;
+    double                               earthEllipsoidalEccentricitySquared;
+    size_t                               numberPoints;
+    const double                       * pXEcefMeters;
+    const double                       * pYEcefMeters;
+    const double                       * pZEcefMeters;
+    const double                       * pLatitudeRadians;
+    const double                       * pLongitudeRadians;
+    const double                       * pAltitudeMeters;
+    double                             * pOutput[ 3 ];
+    ECEF_TO_GEODETIC_CONVERSION_STATUS * pConversionStatus;
+  };
+
+//------------------------------------------------------------------------------
+// One timed run:  the out-of-line 'convertEcefToGeodetic' in a caller loop.
+//------------------------------------------------------------------------------
+static
+void
+convertInverseOutOfLineTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    INLINE_TIMING_RUN_DATA
+        & rRunData = *( INLINE_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+ // Local copies, which the stores to the outputs cannot alias.
+ //-----------------------------------------------------------------------------
+    const double a = rRunData.earthEquatorialRadiusMeters;
+    const double f = rRunData.earthEllipsoidalFlatteningFactor;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < rRunData.numberPoints; i++ )
+      {
+          rRunData.pConversionStatus[ i ] =
+          convertEcefToGeodetic
+                 (
+                   a,
+                   f,
+                   rRunData.pXEcefMeters[ i ],
+                   rRunData.pYEcefMeters[ i ],
+                   rRunData.pZEcefMeters[ i ],
+                   rRunData.pOutput[ 0 ][ i ],
+                   rRunData.pOutput[ 1 ][ i ],
+                   rRunData.pOutput[ 2 ][ i ]
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run:  'convertEcefToGeodeticInline' in the same caller loop.
+//------------------------------------------------------------------------------
+static
+void
+convertInverseInlineTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    INLINE_TIMING_RUN_DATA
+        & rRunData = *( INLINE_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+ // Local copies, which the stores to the outputs cannot alias.
+ //-----------------------------------------------------------------------------
+    const double a = rRunData.earthEquatorialRadiusMeters;
+    const double f = rRunData.earthEllipsoidalFlatteningFactor;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < rRunData.numberPoints; i++ )
+      {
+          rRunData.pConversionStatus[ i ] =
+          convertEcefToGeodeticInline
+                 (
+                   a,
+                   f,
+                   rRunData.pXEcefMeters[ i ],
+                   rRunData.pYEcefMeters[ i ],
+                   rRunData.pZEcefMeters[ i ],
+                   rRunData.pOutput[ 0 ][ i ],
+                   rRunData.pOutput[ 1 ][ i ],
+                   rRunData.pOutput[ 2 ][ i ]
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run:  'convertEcefToGeodeticInline' with the GRS1980 ellipsoid as
+// constants of the loop and the statuses not stored, so that the setup and
+// the validation of the ellipsoid fold away and only the coordinate check
+// branches.
+//------------------------------------------------------------------------------
+static
+void
+convertInverseInlineConstantTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    INLINE_TIMING_RUN_DATA
+        & rRunData = *( INLINE_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    const double * __restrict__ pX         = rRunData.pXEcefMeters;
+    const double * __restrict__ pY         = rRunData.pYEcefMeters;
+    const double * __restrict__ pZ         = rRunData.pZEcefMeters;
+          double * __restrict__ pLatitude  = rRunData.pOutput[ 0 ];
+          double * __restrict__ pLongitude = rRunData.pOutput[ 1 ];
+          double * __restrict__ pAltitude  = rRunData.pOutput[ 2 ];
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < rRunData.numberPoints; i++ )
+      {
+          ( void )
+          convertEcefToGeodeticInline
+                 (
+                   6378137.0E0,
+                   1.0E0 / 298.257222101E0,
+                   pX[ i ],
+                   pY[ i ],
+                   pZ[ i ],
+                   pLatitude [ i ],
+                   pLongitude[ i ],
+                   pAltitude [ i ]
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run:  the out-of-line 'convertGeodeticToEcef' in a caller loop.
+//------------------------------------------------------------------------------
+static
+void
+convertForwardOutOfLineTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    INLINE_TIMING_RUN_DATA
+        & rRunData = *( INLINE_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+ // Local copies, which the stores to the outputs cannot alias.
+ //-----------------------------------------------------------------------------
+    const double a  = rRunData.earthEquatorialRadiusMeters;
+    const double e2 = rRunData.earthEllipsoidalEccentricitySquared;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < rRunData.numberPoints; i++ )
+      {
+          rRunData.pConversionStatus[ i ] =
+          convertGeodeticToEcef
+                 (
+                   a,
+                   e2,
+                   rRunData.pLatitudeRadians [ i ],
+                   rRunData.pLongitudeRadians[ i ],
+                   rRunData.pAltitudeMeters  [ i ],
+                   rRunData.pOutput[ 0 ][ i ],
+                   rRunData.pOutput[ 1 ][ i ],
+                   rRunData.pOutput[ 2 ][ i ]
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run:  'convertGeodeticToEcefInline' in the same caller loop.
+//------------------------------------------------------------------------------
+static
+void
+convertForwardInlineTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    INLINE_TIMING_RUN_DATA
+        & rRunData = *( INLINE_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+ // Local copies, which the stores to the outputs cannot alias.
+ //-----------------------------------------------------------------------------
+    const double a  = rRunData.earthEquatorialRadiusMeters;
+    const double e2 = rRunData.earthEllipsoidalEccentricitySquared;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < rRunData.numberPoints; i++ )
+      {
+          rRunData.pConversionStatus[ i ] =
+          convertGeodeticToEcefInline
+                 (
+                   a,
+                   e2,
+                   rRunData.pLatitudeRadians [ i ],
+                   rRunData.pLongitudeRadians[ i ],
+                   rRunData.pAltitudeMeters  [ i ],
+                   rRunData.pOutput[ 0 ][ i ],
+                   rRunData.pOutput[ 1 ][ i ],
+                   rRunData.pOutput[ 2 ][ i ]
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+executeInlineTimingConvertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const
+            int      numberPointsExponent
+         //-------------------
+         // OUTPUT(s):
+         //           NONE
+         //-------------------
+       )
+//==============================================================================
+//|
+//| FUNCTION:
+//|
+//|   executeInlineTimingConvertEcefToGeodetic
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| PURPOSE:
+//|
+//|   To compare, in a tight caller loop of one conversion per point, the
+//|   execution time per point of the out-of-line 'convertEcefToGeodetic'
+//|   and 'convertGeodeticToEcef' with that of their inline bodies of
+//|   'convertBetweenEcefAndGeodeticInline.h', and to count the points
+//|   whose results differ from those of the baseline x86-64 clones.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| INPUT(s):
+//|
+//|   numberPointsExponent
+//|     The base ten exponent of the number of points.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| METHOD:
+//|
+//|   [ 1 ]  Generate 10^numberPointsExponent geodetic points, with uniform
+//|          latitude and longitude and altitudes from -10 km to 3000 km,
+//|          and their ECEF coordinates.
+//|
+//|   [ 2 ]  Time each caller loop with 'measureConversionTiming'.  The
+//|          ellipsoid parameters are read from the run data, so the
+//|          inlined loop gains from hoisting their setup out of the loop
+//|          and from the call overhead, not from constant folding, as for
+//|          a caller whose ellipsoid is chosen at run time.  The constant
+//|          loop passes the GRS1980 ellipsoid as literals, through
+//|          restrict qualified arrays, and discards the statuses, which is
+//|          the best case for the compiler.  It is still not vectorized:
+//|          the two atan2 calls and the coordinate and polar branches
+//|          keep it scalar.
+//|
+//|   [ 3 ]  The results of each loop are compared bit for bit with those
+//|          of 'convertEcefToGeodeticBaselineClone' or
+//|          'convertGeodeticToEcefBaselineClone'.  The inline bodies,
+//|          compiled here with the baseline options, must give no
+//|          differences; the out-of-line calls are bound to the clone of
+//|          the host, whose FMA contracted arithmetic differs in the last
+//|          bits on an x86-64-v3 or x86-64-v4 host.
+//|
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+ //
+ // GRS1980 System
+ //
+ //-----------------------------------------------------------------------------
+    const
+    double
+     earthEquatorialRadiusMeters         = 6378137.0E0;
+    const
+    double
+     earthEllipsoidalFlatteningFactor    = 1.0E0 / 298.257222101E0;
+    const
+    double
+     earthEllipsoidalEccentricitySquared =
+                         computeEarthEllipticitySquared
+                                (
+                                  earthEllipsoidalFlatteningFactor
+                                );
+ //-----------------------------------------------------------------------------
+    const
+    int
+     NUMBER_WARM_UP_RUNS = 1;
+    const
+    int
+     NUMBER_TIMED_RUNS   = 7;
+ //-----------------------------------------------------------------------------
+    size_t
+     numberPoints = 1;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int exponent = 0; exponent < numberPointsExponent; exponent++ )
+      {
+          numberPoints = 10 * numberPoints;
+      };
+ //-----------------------------------------------------------------------------
+ // Generate the geodetic points and their ECEF coordinates.
+ //-----------------------------------------------------------------------------
+    vector< double > latitudeRadians ( numberPoints );
+    vector< double > longitudeRadians( numberPoints );
+    vector< double > altitudeMeters  ( numberPoints );
+    vector< double > xEcefMeters     ( numberPoints );
+    vector< double > yEcefMeters     ( numberPoints );
+    vector< double > zEcefMeters     ( numberPoints );
+    vector< double > outOfLineOutput ( 3 * numberPoints );
+    vector< double > inlineOutput    ( 3 * numberPoints );
+    vector< double > baselineOutput  ( 3 * numberPoints );
+    vector< ECEF_TO_GEODETIC_CONVERSION_STATUS >
+                     conversionStatus( numberPoints );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    generateTimingGeodeticPoints
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalEccentricitySquared,
+             -1.0E4,
+             3.0E6,
+             UNIFORM_TIMING_ALTITUDE_SPACING,
+             0,
+             numberPoints,
+             latitudeRadians .data( ),
+             longitudeRadians.data( ),
+             altitudeMeters  .data( ),
+             xEcefMeters     .data( ),
+             yEcefMeters     .data( ),
+             zEcefMeters     .data( ),
+             NULL
+           );
+ //-----------------------------------------------------------------------------
+ // The ellipsoid parameters are copied through 'volatile', so that the
+ // compiler cannot treat them as constants of the caller loops.
+ //-----------------------------------------------------------------------------
+    volatile double
+     volatileEquatorialRadiusMeters = earthEquatorialRadiusMeters;
+    volatile double
+     volatileFlatteningFactor       = earthEllipsoidalFlatteningFactor;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    INLINE_TIMING_RUN_DATA
+     runData;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    runData.earthEquatorialRadiusMeters         =
+                                         volatileEquatorialRadiusMeters;
+    runData.earthEllipsoidalFlatteningFactor    = volatileFlatteningFactor;
+    runData.earthEllipsoidalEccentricitySquared =
+                                         earthEllipsoidalEccentricitySquared;
+    runData.numberPoints                        = numberPoints;
+    runData.pXEcefMeters                        = xEcefMeters     .data( );
+    runData.pYEcefMeters                        = yEcefMeters     .data( );
+    runData.pZEcefMeters                        = zEcefMeters     .data( );
+    runData.pLatitudeRadians                    = latitudeRadians .data( );
+    runData.pLongitudeRadians                   = longitudeRadians.data( );
+    runData.pAltitudeMeters                     = altitudeMeters  .data( );
+    runData.pConversionStatus                   = conversionStatus.data( );
+ //-----------------------------------------------------------------------------
+ // Each direction is an out-of-line loop then its inline loops; the
+ // baseline clone results are computed with the first.
+ //-----------------------------------------------------------------------------
+    const
+    int
+     NUMBER_LOOPS = 5;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    char *
+     loopNames[ NUMBER_LOOPS ] = { "ECEF to geodetic, call",
+                                   "ECEF to geodetic, inline",
+                                   "ECEF to geodetic, constant",
+                                   "Geodetic to ECEF, call",
+                                   "Geodetic to ECEF, inline" };
+    const
+    bool
+     isInverseLoop[ NUMBER_LOOPS ] = { true, true, true, false, false };
+    const
+    bool
+     isInlineLoop [ NUMBER_LOOPS ] = { false, true, true, false, true };
+    void
+     ( *loopRuns[ NUMBER_LOOPS ] )( void * ) =
+                                 { convertInverseOutOfLineTimingRun,
+                                   convertInverseInlineTimingRun,
+                                   convertInverseInlineConstantTimingRun,
+                                   convertForwardOutOfLineTimingRun,
+                                   convertForwardInlineTimingRun };
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "\n\n\n"
+       "%s%s\n"
+       "%s\n%s\n%s\n"
+       "%s%zu%s\n"
+       "%s\n"
+       "%s%s\n"
+       "%s\n"
+       "%s\n"
+       "%s%s\n",
+       "============================================",
+       "============================================",
+       "|",
+       "| INLINE KERNEL TIMING RESULTS:",
+       "|",
+       "|    ",
+       numberPoints,
+       " points, one conversion per caller loop iteration",
+       "|",
+       "|-------------------------------------------",
+       "--------------------------------------------",
+       "|    Caller loop                  [ns/point]     MAD  Speedup  Differ",
+       "|                                                             [points]",
+       "|-------------------------------------------",
+       "--------------------------------------------"
+     );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    double
+     referenceNanoSecondsPerPoint = NAN;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int loop = 0; loop < NUMBER_LOOPS; loop++ )
+      {
+       //-----------------------------------------------------------------------
+          const bool isInline = isInlineLoop[ loop ];
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          double * pOutput = isInline ? inlineOutput   .data( ) :
+                                        outOfLineOutput.data( );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( int k = 0; k < 3; k++ )
+            {
+               runData.pOutput[ k ] = pOutput + k * numberPoints;
+            };
+       //-----------------------------------------------------------------------
+          CONVERSION_TIMING_STATISTICS
+           loopTiming;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          measureConversionTiming
+                 (
+                   loopRuns[ loop ],
+                   &runData,
+                   numberPoints,
+                   NUMBER_WARM_UP_RUNS,
+                   NUMBER_TIMED_RUNS,
+                   loopTiming
+                 );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( !isInline )
+            {
+               referenceNanoSecondsPerPoint =
+                                   loopTiming.medianNanoSecondsPerPoint;
+            };
+       //-----------------------------------------------------------------------
+       // The baseline x86-64 clone results of this direction, once.
+       //-----------------------------------------------------------------------
+          if( !isInline )
+            {
+               for( size_t i = 0; i < numberPoints; i++ )
+                 {
+                    if( isInverseLoop[ loop ] )
+                      {
+                         ( void )
+                         convertEcefToGeodeticBaselineClone
+                                (
+                                  earthEquatorialRadiusMeters,
+                                  earthEllipsoidalFlatteningFactor,
+                                  xEcefMeters[ i ],
+                                  yEcefMeters[ i ],
+                                  zEcefMeters[ i ],
+                                  baselineOutput[ i ],
+                                  baselineOutput[ numberPoints + i ],
+                                  baselineOutput[ 2 * numberPoints + i ]
+                                );
+                      }
+                    else
+                      {
+                         ( void )
+                         convertGeodeticToEcefBaselineClone
+                                (
+                                  earthEquatorialRadiusMeters,
+                                  earthEllipsoidalEccentricitySquared,
+                                  latitudeRadians [ i ],
+                                  longitudeRadians[ i ],
+                                  altitudeMeters  [ i ],
+                                  baselineOutput[ i ],
+                                  baselineOutput[ numberPoints + i ],
+                                  baselineOutput[ 2 * numberPoints + i ]
+                                );
+                      };
+                 };
+            };
+       //-----------------------------------------------------------------------
+       // Count the points with any result not bit for bit equal to that of
+       // the baseline clone.
+       //-----------------------------------------------------------------------
+          size_t
+           numberDifferentPoints = 0;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+               bool isDifferent = false;
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               for( int k = 0; k < 3; k++ )
+                 {
+                    const size_t j = k * numberPoints + i;
+                 //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                    isDifferent = isDifferent ||
+                                  ( pOutput[ j ] != baselineOutput[ j ] );
+                 };
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               numberDifferentPoints += isDifferent ? 1 : 0;
+            };
+       //-----------------------------------------------------------------------
+          fprintf
+           (
+             stdout,
+             "|    %-28s %10.3f %7.3f %8.2f %7zu\n",
+             loopNames[ loop ],
+             loopTiming.medianNanoSecondsPerPoint,
+             loopTiming.madNanoSecondsPerPoint,
+             referenceNanoSecondsPerPoint /
+             loopTiming.medianNanoSecondsPerPoint,
+             numberDifferentPoints
+           );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "%s\n"
+       "%s\n"
+       "%s\n"
+       "%s\n"
+       "%s\n"
+       "%s%s\n"
+       "\n\n\n",
+       "|",
+       "|    Differ:  points not bit for bit those of the baseline x86-64",
+       "|             clone; the calls bind the clone of the host.",
+       "|    Constant:  the inline body with the GRS1980 ellipsoid as",
+       "|               constants and the statuses not stored.",
+       "============================================",
+       "============================================"
+     );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,488 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+
+//------------------------------------------------------------------------------
+struct
+INTERLEAVED_TIMING_RUN_DATA
+  {
+    EARTH_ELLIPSOID_CONTEXT              ellipsoidContext;
+    size_t                               numberPoints;
+    size_t                               strideBytes;
+    size_t                               blockPoints;
+    const double                       * pRecords;
+    double                             * pOutputRecords;
+    double                             * pCoordinates[ 3 ];
+    double                             * pOutput[ 3 ];
+    ECEF_TO_GEODETIC_CONVERSION_STATUS * pConversionStatus;
+  };
+
+//------------------------------------------------------------------------------
+// One timed run:  one batch call on coordinate arrays.
+//------------------------------------------------------------------------------
+static
+void
+convertCoordinateArraysTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    INTERLEAVED_TIMING_RUN_DATA
+        & rRunData = *( INTERLEAVED_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticBatch
+           (
+             rRunData.ellipsoidContext,
+             rRunData.numberPoints,
+             rRunData.pCoordinates[ 0 ],
+             rRunData.pCoordinates[ 1 ],
+             rRunData.pCoordinates[ 2 ],
+             rRunData.pOutput     [ 0 ],
+             rRunData.pOutput     [ 1 ],
+             rRunData.pOutput     [ 2 ],
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run:  the records copied to coordinate arrays, one batch call,
+// and the outputs copied back to records.
+//------------------------------------------------------------------------------
+static
+void
+convertCopiedRecordsTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    INTERLEAVED_TIMING_RUN_DATA
+        & rRunData = *( INTERLEAVED_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    const size_t strideDoubles = rRunData.strideBytes / sizeof( double );
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < rRunData.numberPoints; i++ )
+      {
+          for( size_t k = 0; k < 3; k++ )
+            {
+               rRunData.pCoordinates[ k ][ i ] =
+                             rRunData.pRecords[ i * strideDoubles + k ];
+            };
+      };
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticBatch
+           (
+             rRunData.ellipsoidContext,
+             rRunData.numberPoints,
+             rRunData.pCoordinates[ 0 ],
+             rRunData.pCoordinates[ 1 ],
+             rRunData.pCoordinates[ 2 ],
+             rRunData.pOutput     [ 0 ],
+             rRunData.pOutput     [ 1 ],
+             rRunData.pOutput     [ 2 ],
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < rRunData.numberPoints; i++ )
+      {
+          for( size_t k = 0; k < 3; k++ )
+            {
+               rRunData.pOutputRecords[ i * strideDoubles + k ] =
+                             rRunData.pOutput[ k ][ i ];
+            };
+      };
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run:  one interleaved batch call.
+//------------------------------------------------------------------------------
+static
+void
+convertInterleavedTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    INTERLEAVED_TIMING_RUN_DATA
+        & rRunData = *( INTERLEAVED_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticInterleavedBatch
+           (
+             rRunData.ellipsoidContext,
+             rRunData.numberPoints,
+             rRunData.pRecords,
+             rRunData.strideBytes,
+             rRunData.pOutputRecords,
+             rRunData.strideBytes,
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run:  one block interleaved batch call.
+//------------------------------------------------------------------------------
+static
+void
+convertBlockInterleavedTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    INTERLEAVED_TIMING_RUN_DATA
+        & rRunData = *( INTERLEAVED_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticBlockInterleavedBatch
+           (
+             rRunData.ellipsoidContext,
+             rRunData.numberPoints,
+             rRunData.blockPoints,
+             rRunData.pRecords,
+             rRunData.pOutputRecords,
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+executeInterleavedTimingConvertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const
+            int      numberPointsExponent
+         //-------------------
+         // OUTPUT(s):
+         //           NONE
+         //-------------------
+       )
+//==============================================================================
+//|
+//| FUNCTION:
+//|
+//|   executeInterleavedTimingConvertEcefToGeodetic
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| PURPOSE:
+//|
+//|   To compare the interleaved and block interleaved batch conversions
+//|   with the batch conversion of coordinate arrays, and with records
+//|   copied to coordinate arrays and back around it, in time per point
+//|   and in results.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| INPUT(s):
+//|
+//|   numberPointsExponent
+//|     The base ten exponent of the number of points.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| METHOD:
+//|
+//|   [ 1 ] Generate 10^numberPointsExponent geodetic points, uniform in
+//|         latitude and longitude and from -10 km to 1000 km altitude, and
+//|         their ECEF coordinates.
+//|
+//|   [ 2 ] Store the points in each layout:  coordinate arrays, records
+//|         of 24, 32 and 48 bytes, the last two with payload doubles
+//|         after the coordinates, and blocks of 8 and of 6 points.  The
+//|         outputs go to a second store of the same layout.
+//|
+//|   [ 3 ] Time each layout with 'measureConversionTiming', and count the
+//|         points whose status or outputs differ from those of the
+//|         coordinate arrays.
+//|
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+ //
+ // GRS1980 System
+ //
+ //-----------------------------------------------------------------------------
+    const
+    double
+     earthEquatorialRadiusMeters         = 6378137.0E0;
+    const
+    double
+     earthEllipsoidalFlatteningFactor    = 1.0E0 / 298.257222101E0;
+ //-----------------------------------------------------------------------------
+    const
+    int
+     NUMBER_WARM_UP_RUNS = 1;
+    const
+    int
+     NUMBER_TIMED_RUNS   = 7;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+ // Each layout:  its name, its timed run, and its record stride in bytes
+ // or its points per block.  The first is the reference.
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    int
+     NUMBER_LAYOUTS = 7;
+    const
+    char
+     * layoutNames[ NUMBER_LAYOUTS ] =
+           {
+             "arrays",
+             "copied 32 B records",
+             "packed 24 B records",
+             "strided 32 B records",
+             "strided 48 B records",
+             "blocks of 8",
+             "blocks of 6"
+           };
+    void
+     ( * layoutRuns[ NUMBER_LAYOUTS ] )( void * ) =
+           {
+             convertCoordinateArraysTimingRun,
+             convertCopiedRecordsTimingRun,
+             convertInterleavedTimingRun,
+             convertInterleavedTimingRun,
+             convertInterleavedTimingRun,
+             convertBlockInterleavedTimingRun,
+             convertBlockInterleavedTimingRun
+           };
+    const
+    size_t
+     layoutStrideBytes[ NUMBER_LAYOUTS ] = { 0, 32, 24, 32, 48, 0, 0 };
+    const
+    size_t
+     layoutBlockPoints[ NUMBER_LAYOUTS ] = { 0,  0,  0,  0,  0, 8, 6 };
+ //-----------------------------------------------------------------------------
+    size_t
+     numberPoints = 1;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int exponent = 0; exponent < numberPointsExponent; exponent++ )
+      {
+          numberPoints = 10 * numberPoints;
+      };
+ //-----------------------------------------------------------------------------
+    INTERLEAVED_TIMING_RUN_DATA
+     runData;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    ( void )
+    initializeEarthEllipsoidContext
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalFlatteningFactor,
+             runData.ellipsoidContext
+           );
+ //-----------------------------------------------------------------------------
+ // Generate the points.  The record stores hold the largest layout, six
+ // doubles per point, and the blocks of 6 round up to a whole block.
+ //-----------------------------------------------------------------------------
+    vector< double > ecef             ( 3 * numberPoints );
+    vector< double > reference        ( 3 * numberPoints );
+    vector< double > output           ( 3 * numberPoints );
+    vector< double > records          ( 6 * numberPoints + 18 );
+    vector< double > outputRecords    ( 6 * numberPoints + 18 );
+    vector< ECEF_TO_GEODETIC_CONVERSION_STATUS >
+                     referenceStatus  ( numberPoints );
+    vector< ECEF_TO_GEODETIC_CONVERSION_STATUS >
+                     status           ( numberPoints );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    generateTimingGeodeticPoints
+           (
+             earthEquatorialRadiusMeters,
+             runData.ellipsoidContext.earthEllipticitySquared,
+             -1.0E4,
+             1.0E6,
+             UNIFORM_TIMING_ALTITUDE_SPACING,
+             0,
+             numberPoints,
+             NULL,
+             NULL,
+             NULL,
+             ecef.data( ),
+             ecef.data( ) +     numberPoints,
+             ecef.data( ) + 2 * numberPoints,
+             NULL
+           );
+ //-----------------------------------------------------------------------------
+    runData.numberPoints = numberPoints;
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "\n\n\n"
+       "%s%s\n"
+       "%s\n%s\n%s\n"
+       "%s%zu%s\n"
+       "%s\n"
+       "%s%s\n"
+       "%s%s\n"
+       "%s%s\n",
+       "============================================",
+       "============================================",
+       "|",
+       "| INTERLEAVED BATCH TIMING RESULTS:",
+       "|",
+       "|    Batch of ",
+       numberPoints,
+       " points in each input and output layout",
+       "|",
+       "|-------------------------------------------",
+       "--------------------------------------------",
+       "|    Layout                   Time [ns/point]    Ratio  ",
+       "Points differ",
+       "|-------------------------------------------",
+       "--------------------------------------------"
+     );
+ //-----------------------------------------------------------------------------
+    double
+     referenceNanoSecondsPerPoint = 0.0;
+ //-----------------------------------------------------------------------------
+    for( int layout = 0; layout < NUMBER_LAYOUTS; layout++ )
+      {
+       //-----------------------------------------------------------------------
+       // Store the points in the layout.  Every record and block place is
+       // first filled with a payload of -1, and every output place with
+       // NAN, so an output which is not written is counted.
+       //-----------------------------------------------------------------------
+          const size_t strideDoubles = layoutStrideBytes[ layout ] /
+                                       sizeof( double );
+          const size_t blockPoints   = layoutBlockPoints[ layout ];
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          fill( records      .begin( ), records      .end( ), -1.0 );
+          fill( outputRecords.begin( ), outputRecords.end( ), NAN  );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t i = 0; ( layout > 0 ) && ( i < numberPoints ); i++ )
+            {
+               for( size_t k = 0; k < 3; k++ )
+                 {
+                    const size_t place =
+                            ( blockPoints > 0 ) ?
+                            ( i / blockPoints ) * 3 * blockPoints +
+                            k * blockPoints + ( i % blockPoints ) :
+                            i * strideDoubles + k;
+                 //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                    records[ place ] = ecef[ k * numberPoints + i ];
+                 };
+            };
+       //-----------------------------------------------------------------------
+          const bool isReference = ( layout == 0 );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t k = 0; k < 3; k++ )
+            {
+               runData.pCoordinates[ k ] = ecef.data( ) + k * numberPoints;
+               runData.pOutput     [ k ] =
+                      ( isReference ? reference : output ).data( ) +
+                      k * numberPoints;
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          runData.strideBytes       = layoutStrideBytes[ layout ];
+          runData.blockPoints       = blockPoints;
+          runData.pRecords          = records      .data( );
+          runData.pOutputRecords    = outputRecords.data( );
+          runData.pConversionStatus = isReference ? referenceStatus.data( ) :
+                                                    status         .data( );
+       //-----------------------------------------------------------------------
+          CONVERSION_TIMING_STATISTICS timing;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          measureConversionTiming
+                 (
+                   layoutRuns[ layout ],
+                   &runData,
+                   numberPoints,
+                   NUMBER_WARM_UP_RUNS,
+                   NUMBER_TIMED_RUNS,
+                   timing
+                 );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( isReference )
+            {
+               referenceNanoSecondsPerPoint = timing.medianNanoSecondsPerPoint;
+            };
+       //-----------------------------------------------------------------------
+       // Compare the outputs, read back from the output layout, with the
+       // reference ones, bit for bit.
+       //-----------------------------------------------------------------------
+          size_t numberDifferentPoints = 0;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t i = 0; ( layout > 0 ) && ( i < numberPoints ); i++ )
+            {
+               bool differs = ( status[ i ] != referenceStatus[ i ] );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               for( size_t k = 0; k < 3; k++ )
+                 {
+                    const size_t place =
+                            ( blockPoints > 0 ) ?
+                            ( i / blockPoints ) * 3 * blockPoints +
+                            k * blockPoints + ( i % blockPoints ) :
+                            i * strideDoubles + k;
+                 //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                    differs = differs ||
+                              memcmp( &outputRecords[ place ],
+                                      &reference[ k * numberPoints + i ],
+                                      sizeof( double ) ) != 0;
+                 };
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               numberDifferentPoints += differs;
+            };
+       //-----------------------------------------------------------------------
+          fprintf
+           (
+             stdout,
+             "|    %-22s %10.3f %12.3f %14zu\n",
+             layoutNames[ layout ],
+             timing.medianNanoSecondsPerPoint,
+             timing.medianNanoSecondsPerPoint / referenceNanoSecondsPerPoint,
+             numberDifferentPoints
+           );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "%s%s\n"
+       "\n\n\n",
+       "============================================",
+       "============================================"
+     );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
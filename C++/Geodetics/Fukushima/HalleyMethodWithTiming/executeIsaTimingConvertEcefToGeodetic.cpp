@@ -0,0 +1,361 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+   using namespace std::chrono;
+
+//------------------------------------------------------------------------------
+void
+executeIsaTimingConvertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const
+            int      batchSizeExponent
+         //-------------------
+         // OUTPUT(s):
+         //           NONE
+         //-------------------
+       )
+//==============================================================================
+//|
+//| FUNCTION:
+//|
+//|   executeIsaTimingConvertEcefToGeodetic
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| PURPOSE:
+//|
+//|   To report, for each batch kernel instruction set architecture (ISA)
+//|   level which the processor supports, the execution time per converted
+//|   point of 'convertEcefToGeodeticBatchForIsaLevel', its speedup over a
+//|   loop of scalar 'convertEcefToGeodetic' calls and over the baseline
+//|   kernel, and its maximum latitude and altitude errors.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| INPUT(s):
+//|
+//|   batchSizeExponent
+//|     The base ten exponent of the timed batch size.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| METHOD:
+//|
+//|   [ 1 ]  Generate 10^batchSizeExponent true geodetic points as in
+//|          'executeBatchTimingConvertEcefToGeodetic', including points on
+//|          and near the polar axis, and convert them to ECEF rectangular
+//|          coordinates.
+//|
+//|   [ 2 ]  Time the scalar loop, then each supported kernel, converting
+//|          the batch repeatedly until at least MINIMUM_POINTS_PER_LEVEL
+//|          points have been converted.
+//|
+//|   [ 3 ]  The errors of each kernel are measured against the true
+//|          geodetic points, so the kernels are checked against the
+//|          1 microarcsecond and 3 nanometer accuracy of the scalar
+//|          function and not merely against each other.
+//|
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const
+    double
+     piRadians                     = 4.0 * atan( 1.0 );
+    const
+    double
+     microArcSecondsPerRadian      = ( 180.0 / piRadians ) * 3600.0 * 1.0E6;
+    const
+    double
+     nanoMetersPerMeter            = 1.0E9;
+ //-----------------------------------------------------------------------------
+ //
+ // GRS1980 System
+ //
+ //-----------------------------------------------------------------------------
+    const
+    double
+     earthEquatorialRadiusMeters             = 6378137.0E0;
+    const
+    double
+     earthEllipsoidalFlatteningFactor        = 1.0E0 / 298.257222101E0;
+    const
+    double
+     earthEllipsoidalEccentricitySquared     =
+                         ( 2.0E0 - earthEllipsoidalFlatteningFactor )
+                         *
+                         earthEllipsoidalFlatteningFactor;
+ //-----------------------------------------------------------------------------
+    const
+    size_t
+     MINIMUM_POINTS_PER_LEVEL = 10000000;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    char *
+     isaLevelNames[ 3 ] = { "Baseline", "AVX2+FMA", "AVX-512" };
+ //-----------------------------------------------------------------------------
+    size_t
+     batchSize = 1;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int exponent = 0; exponent < batchSizeExponent; exponent++ )
+      {
+          batchSize = 10 * batchSize;
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    size_t
+     numberRepetitions = max(
+                              ( size_t )1,
+                              MINIMUM_POINTS_PER_LEVEL / batchSize
+                            );
+ //-----------------------------------------------------------------------------
+ // Generate the true geodetic points and their ECEF coordinates.
+ //-----------------------------------------------------------------------------
+    vector< double > trueLatitudeRadians ( batchSize );
+    vector< double > trueAltitudeMeters  ( batchSize );
+    vector< double > xEcefMeters         ( batchSize );
+    vector< double > yEcefMeters         ( batchSize );
+    vector< double > zEcefMeters         ( batchSize );
+    vector< double > latitudeRadians     ( batchSize );
+    vector< double > longitudeRadians    ( batchSize );
+    vector< double > altitudeMeters      ( batchSize );
+    vector< ECEF_TO_GEODETIC_CONVERSION_STATUS >
+                     conversionStatus    ( batchSize );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+ // Every 97th point is put on a pole, so the polar axis blends of the
+ // kernels are exercised in every batch of more than 97 points.
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    generateTimingGeodeticPoints
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalEccentricitySquared,
+             -1.0E4,
+             3.0E6,
+             UNIFORM_TIMING_ALTITUDE_SPACING,
+             97,
+             batchSize,
+             trueLatitudeRadians.data( ),
+             NULL,
+             trueAltitudeMeters .data( ),
+             xEcefMeters        .data( ),
+             yEcefMeters        .data( ),
+             zEcefMeters        .data( ),
+             NULL
+           );
+ //-----------------------------------------------------------------------------
+ // Time the scalar function calls.
+ //-----------------------------------------------------------------------------
+    auto scalarStart = steady_clock::now();
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t r = 0; r < numberRepetitions; r++ )
+      {
+          for( size_t i = 0; i < batchSize; i++ )
+            {
+               conversionStatus[ i ] =
+               convertEcefToGeodetic
+                      (
+                        //-----------------
+                        // INPUT(s):
+                        //-----------------
+                           earthEquatorialRadiusMeters,
+                           earthEllipsoidalFlatteningFactor,
+                           xEcefMeters[ i ],
+                           yEcefMeters[ i ],
+                           zEcefMeters[ i ],
+                        //-----------------
+                        // OUTPUT(s):
+                        //-----------------
+                           latitudeRadians [ i ],
+                           longitudeRadians[ i ],
+                           altitudeMeters  [ i ]
+                      );
+            };
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    auto scalarStop = steady_clock::now();
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    double
+     numberConvertedPoints     = ( double )numberRepetitions * batchSize;
+    const
+    double
+     scalarNanoSecondsPerPoint =
+                  duration< double, nano >( scalarStop - scalarStart ).count( )
+                  /
+                  numberConvertedPoints;
+ //-----------------------------------------------------------------------------
+ // Report header.
+ //-----------------------------------------------------------------------------
+    const
+    ECEF_TO_GEODETIC_ISA_LEVEL
+     supportedIsaLevel = detectEcefToGeodeticIsaLevel( );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    fprintf
+     (
+       stdout,
+       "\n\n\n"
+       "%s%s\n"
+       "%s\n%s\n%s\n"
+       "%s%zu%s%s\n"
+       "%s\n"
+       "%s%s\n"
+       "%s%s\n"
+       "%s\n"
+       "%s%10.3f\n"
+       "%s\n",
+       "============================================",
+       "============================================",
+       "|",
+       "| ISA LEVEL BATCH TIMING RESULTS:",
+       "|",
+       "|    Batch size ",
+       batchSize,
+       ",  widest supported ISA level ",
+       isaLevelNames[ supportedIsaLevel ],
+       "|",
+       "|-------------------------------------------",
+       "--------------------------------------------",
+       "|    ISA level  [ns/point]  vs scalar  vs baseline",
+       "  Lat err [uas]  Alt err [nm]",
+       "|",
+       "|    Scalar     ",
+       scalarNanoSecondsPerPoint,
+       "|"
+     );
+ //-----------------------------------------------------------------------------
+ // Loop over the supported ISA levels.
+ //-----------------------------------------------------------------------------
+    EARTH_ELLIPSOID_CONTEXT
+     ellipsoidContext;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    ( void )
+    initializeEarthEllipsoidContext
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalFlatteningFactor,
+             ellipsoidContext
+           );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    double
+     baselineNanoSecondsPerPoint = 0.0;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int level = BASELINE_ISA_LEVEL; level <= supportedIsaLevel; level++ )
+      {
+       //-----------------------------------------------------------------------
+          const
+          ECEF_TO_GEODETIC_ISA_LEVEL
+           isaLevel = ( ECEF_TO_GEODETIC_ISA_LEVEL )level;
+       //-----------------------------------------------------------------------
+          auto batchStart = steady_clock::now();
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t r = 0; r < numberRepetitions; r++ )
+            {
+               convertEcefToGeodeticBatchForIsaLevel
+                      (
+                        //-----------------
+                        // INPUT(s):
+                        //-----------------
+                           isaLevel,
+                           ellipsoidContext,
+                           batchSize,
+                           xEcefMeters.data( ),
+                           yEcefMeters.data( ),
+                           zEcefMeters.data( ),
+                        //-----------------
+                        // OUTPUT(s):
+                        //-----------------
+                           latitudeRadians .data( ),
+                           longitudeRadians.data( ),
+                           altitudeMeters  .data( ),
+                           conversionStatus.data( )
+                      );
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          auto batchStop = steady_clock::now();
+       //-----------------------------------------------------------------------
+          const
+          double
+           batchNanoSecondsPerPoint =
+                  duration< double, nano >( batchStop - batchStart ).count( )
+                  /
+                  numberConvertedPoints;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( isaLevel == BASELINE_ISA_LEVEL )
+            {
+               baselineNanoSecondsPerPoint = batchNanoSecondsPerPoint;
+            };
+       //-----------------------------------------------------------------------
+       // Errors of this kernel against the true geodetic points.  A point
+       // which is not converted counts as an infinite error.
+       //-----------------------------------------------------------------------
+          double
+           maximumLatitudeAbsoluteErrorMicroArcSecs = 0.0;
+          double
+           maximumAltitudeAbsoluteErrorNanoMeters   = 0.0;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t i = 0; i < batchSize; i++ )
+            {
+               if( conversionStatus[ i ] != SUCCESSFUL_CONVERSION )
+                 {
+                    maximumLatitudeAbsoluteErrorMicroArcSecs = INFINITY;
+                    maximumAltitudeAbsoluteErrorNanoMeters   = INFINITY;
+                 }
+               else
+                 {
+                    maximumLatitudeAbsoluteErrorMicroArcSecs =
+                    max(
+                         maximumLatitudeAbsoluteErrorMicroArcSecs,
+                         microArcSecondsPerRadian *
+                         fabs( trueLatitudeRadians[ i ] - latitudeRadians[ i ] )
+                       );
+                    maximumAltitudeAbsoluteErrorNanoMeters =
+                    max(
+                         maximumAltitudeAbsoluteErrorNanoMeters,
+                         nanoMetersPerMeter *
+                         fabs( trueAltitudeMeters[ i ] - altitudeMeters[ i ] )
+                       );
+                 };
+            };
+       //-----------------------------------------------------------------------
+          fprintf
+           (
+             stdout,
+             "|    %-9s %12.3f %10.2f %12.2f %14.4f %13.4f\n",
+             isaLevelNames[ isaLevel ],
+             batchNanoSecondsPerPoint,
+             scalarNanoSecondsPerPoint   / batchNanoSecondsPerPoint,
+             baselineNanoSecondsPerPoint / batchNanoSecondsPerPoint,
+             maximumLatitudeAbsoluteErrorMicroArcSecs,
+             maximumAltitudeAbsoluteErrorNanoMeters
+           );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "%s\n"
+       "%s%s\n"
+       "\n\n\n",
+       "|",
+       "============================================",
+       "============================================"
+     );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
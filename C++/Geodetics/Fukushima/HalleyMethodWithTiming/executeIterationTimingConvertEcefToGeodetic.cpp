@@ -0,0 +1,508 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+
+//------------------------------------------------------------------------------
+struct
+ITERATION_TIMING_RUN_DATA
+  {
+    const EARTH_ELLIPSOID_CONTEXT       * pEllipsoidContext;
+    ECEF_TO_GEODETIC_ENGINE               conversionEngine;
+    int                                   maximumNumberIterations;
+    size_t                                numberPoints;
+    const double                        * pXEcefMeters;
+    const double                        * pYEcefMeters;
+    const double                        * pZEcefMeters;
+    double                              * pGeodeticNorthLatitudeRadians;
+    double                              * pGeocentricEastLongitudeRadians;
+    double                              * pGeodeticAltitudeMeters;
+    ECEF_TO_GEODETIC_CONVERSION_STATUS  * pConversionStatus;
+    ECEF_TO_GEODETIC_CONVERGENCE_REPORT * pConvergenceReports;
+  };
+
+//------------------------------------------------------------------------------
+// The altitude ranges of the workloads, and the maximum numbers of
+// iterations timed for every workload and engine.
+//------------------------------------------------------------------------------
+struct
+ITERATION_TIMING_WORKLOAD
+  {
+    const char * pName;
+    double       minimumAltitudeMeters;
+    double       maximumAltitudeMeters;
+  };
+//- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+static
+const
+ITERATION_TIMING_WORKLOAD
+ ITERATION_TIMING_WORKLOADS[ 3 ] =
+   {
+     { "Near the center, -6335 km to -6300 km", -6.335E6, -6.300E6 },
+     { "About the Earth, -10 km to 50000 km",   -1.0E4,    5.0E7   },
+     { "Lunar, 350000 km to 410000 km",          3.5E8,    4.1E8   }
+   };
+//- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+static
+const
+int
+ ITERATION_TIMING_MAXIMUM_ITERATIONS[ 6 ] = { 1, 2, 3, 4, 6, 8 };
+//- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Points of the equatorial plane within the evolute, where a Halley step
+// can leave the quadrant of the point, checked for a latitude within
+// [ -pi/2, pi/2 ].
+//- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+static
+const
+double
+ ITERATION_CHECK_X_ECEF_METERS[ 2 ] = { 1.0, 30000.0 };
+
+//------------------------------------------------------------------------------
+// One timed run: one iterated batch call, with the convergence reports.
+//------------------------------------------------------------------------------
+static
+void
+iterationBatchTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    ITERATION_TIMING_RUN_DATA
+        & rRunData = *( ITERATION_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticIteratedBatch
+           (
+             *rRunData.pEllipsoidContext,
+             rRunData.conversionEngine,
+             rRunData.maximumNumberIterations,
+             rRunData.numberPoints,
+             rRunData.pXEcefMeters,
+             rRunData.pYEcefMeters,
+             rRunData.pZEcefMeters,
+             rRunData.pGeodeticNorthLatitudeRadians,
+             rRunData.pGeocentricEastLongitudeRadians,
+             rRunData.pGeodeticAltitudeMeters,
+             rRunData.pConversionStatus,
+             rRunData.pConvergenceReports
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+executeIterationTimingConvertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const
+            int      numberPointsExponent
+         //-------------------
+         // OUTPUT(s):
+         //           NONE
+         //-------------------
+       )
+//==============================================================================
+//|
+//| FUNCTION:
+//|
+//|   executeIterationTimingConvertEcefToGeodetic
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| PURPOSE:
+//|
+//|   To measure the time per point of FUKUSHIMA_NEWTON_ENGINE and
+//|   ITERATED_HALLEY_ENGINE against their accuracy and convergence, for a
+//|   range of maximum numbers of iterations, in the domains where one
+//|   Halley step is least accurate: near the Earth's center and at lunar
+//|   distances.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| INPUT(s):
+//|
+//|   numberPointsExponent
+//|     The base ten exponent of the number of timed points per workload.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| METHOD:
+//|
+//|   [ 1 ] For each workload of ITERATION_TIMING_WORKLOADS generate
+//|         10^numberPointsExponent true geodetic points, with uniform
+//|         latitude and longitude and altitudes evenly spaced in
+//|         asinh( h / 1 km ) over the range of the workload.  Every 97th
+//|         point is put on a pole.
+//|
+//|   [ 2 ] For each iterative engine and each maximum number of
+//|         iterations of ITERATION_TIMING_MAXIMUM_ITERATIONS, time
+//|         'convertEcefToGeodeticIteratedBatch', with the reports, with
+//|         'measureConversionTiming', and report the mean number of
+//|         iterations, the fraction of the points converged, and the
+//|         maximum latitude and altitude errors against the true points.
+//|
+//|   [ 3 ] Convert the points ( x, 0, 0 ) of
+//|         ITERATION_CHECK_X_ECEF_METERS with each iterative engine, and
+//|         report their latitudes, altitudes and convergence, and the
+//|         number of latitudes outside [ -pi/2, pi/2 ].
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| NOTE(s):
+//|
+//|   [ 1 ] The points near the center reach within about 22 km of it at
+//|         the poles, inside the evolute of the ellipsoid, where a point
+//|         has several foot points and the errors are those against the
+//|         foot point from which it was generated.
+//|
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const
+    double
+     piRadians                           = 4.0 * atan( 1.0 );
+ //-----------------------------------------------------------------------------
+ //
+ // GRS1980 System
+ //
+ //-----------------------------------------------------------------------------
+    const
+    double
+     earthEquatorialRadiusMeters         = 6378137.0E0;
+    const
+    double
+     earthEllipsoidalFlatteningFactor    = 1.0E0 / 298.257222101E0;
+    const
+    double
+     earthEllipsoidalEccentricitySquared =
+                         ( 2.0E0 - earthEllipsoidalFlatteningFactor )
+                         *
+                         earthEllipsoidalFlatteningFactor;
+ //-----------------------------------------------------------------------------
+    const
+    int
+     NUMBER_WARM_UP_RUNS = 1;
+    const
+    int
+     NUMBER_TIMED_RUNS   = 7;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    int
+     NUMBER_WORKLOADS          = sizeof( ITERATION_TIMING_WORKLOADS ) /
+                                 sizeof( ITERATION_TIMING_WORKLOADS[ 0 ] );
+    const
+    int
+     NUMBER_ITERATION_MAXIMUMS =
+                         sizeof( ITERATION_TIMING_MAXIMUM_ITERATIONS ) /
+                         sizeof( ITERATION_TIMING_MAXIMUM_ITERATIONS[ 0 ] );
+    const
+    ECEF_TO_GEODETIC_ENGINE
+     ITERATIVE_ENGINES[ 2 ] = { FUKUSHIMA_NEWTON_ENGINE,
+                                ITERATED_HALLEY_ENGINE };
+ //-----------------------------------------------------------------------------
+    EARTH_ELLIPSOID_CONTEXT
+     ellipsoidContext;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    ( void )
+    initializeEarthEllipsoidContext
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalFlatteningFactor,
+             ellipsoidContext
+           );
+ //-----------------------------------------------------------------------------
+    size_t
+     numberPoints = 1;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int exponent = 0; exponent < numberPointsExponent; exponent++ )
+      {
+          numberPoints = 10 * numberPoints;
+      };
+ //-----------------------------------------------------------------------------
+    vector< double > trueLatitudeRadians ( numberPoints );
+    vector< double > trueLongitudeRadians( numberPoints );
+    vector< double > trueAltitudeMeters  ( numberPoints );
+    vector< double > xEcefMeters         ( numberPoints );
+    vector< double > yEcefMeters         ( numberPoints );
+    vector< double > zEcefMeters         ( numberPoints );
+    vector< double > latitudeRadians     ( numberPoints );
+    vector< double > longitudeRadians    ( numberPoints );
+    vector< double > altitudeMeters      ( numberPoints );
+    vector< ECEF_TO_GEODETIC_CONVERSION_STATUS >
+                     conversionStatus    ( numberPoints );
+    vector< ECEF_TO_GEODETIC_CONVERGENCE_REPORT >
+                     convergenceReports  ( numberPoints );
+ //-----------------------------------------------------------------------------
+    ITERATION_TIMING_RUN_DATA
+     runData;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    runData.pEllipsoidContext               = &ellipsoidContext;
+    runData.numberPoints                    = numberPoints;
+    runData.pXEcefMeters                    = xEcefMeters       .data( );
+    runData.pYEcefMeters                    = yEcefMeters       .data( );
+    runData.pZEcefMeters                    = zEcefMeters       .data( );
+    runData.pGeodeticNorthLatitudeRadians   = latitudeRadians   .data( );
+    runData.pGeocentricEastLongitudeRadians = longitudeRadians  .data( );
+    runData.pGeodeticAltitudeMeters         = altitudeMeters    .data( );
+    runData.pConversionStatus               = conversionStatus  .data( );
+    runData.pConvergenceReports             = convergenceReports.data( );
+ //-----------------------------------------------------------------------------
+    const
+    double
+     MICRO_ARC_SECONDS_PER_RADIAN = 180.0 * 3600.0E6 / piRadians;
+ //-----------------------------------------------------------------------------
+ // Report header.
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "\n\n\n"
+       "%s%s\n"
+       "%s\n%s\n%s\n"
+       "%s%zu%s\n"
+       "%s\n",
+       "============================================",
+       "============================================",
+       "|",
+       "| ITERATIVE ENGINE TIMING RESULTS:",
+       "|",
+       "|    ",
+       numberPoints,
+       " points per workload, batch with convergence reports",
+       "|"
+     );
+ //-----------------------------------------------------------------------------
+ // Loop over the workloads.
+ //-----------------------------------------------------------------------------
+    for( int workload = 0; workload < NUMBER_WORKLOADS; workload++ )
+      {
+       //-----------------------------------------------------------------------
+          const ITERATION_TIMING_WORKLOAD
+                & rWorkload = ITERATION_TIMING_WORKLOADS[ workload ];
+       //-----------------------------------------------------------------------
+       // Generate the true geodetic points and their ECEF coordinates.
+       //-----------------------------------------------------------------------
+          generateTimingGeodeticPoints
+                 (
+                   earthEquatorialRadiusMeters,
+                   earthEllipsoidalEccentricitySquared,
+                   rWorkload.minimumAltitudeMeters,
+                   rWorkload.maximumAltitudeMeters,
+                   ASINH_TIMING_ALTITUDE_SPACING,
+                   97,
+                   numberPoints,
+                   trueLatitudeRadians .data( ),
+                   trueLongitudeRadians.data( ),
+                   trueAltitudeMeters  .data( ),
+                   xEcefMeters         .data( ),
+                   yEcefMeters         .data( ),
+                   zEcefMeters         .data( ),
+                   NULL
+                 );
+       //-----------------------------------------------------------------------
+          fprintf
+           (
+             stdout,
+             "%s%s\n"
+             "%s%s\n"
+             "%s%s\n"
+             "%s%s\n"
+             "%s%s\n",
+             "|-------------------------------------------",
+             "--------------------------------------------",
+             "|    ",
+             rWorkload.pName,
+             "|    Engine                   Max    Batch     MAD    Mean",
+             "  Conv.   Max lat  Max alt",
+             "|                             it.  [ns/point]           it.",
+             "    [%]     [uas]     [nm]",
+             "|-------------------------------------------",
+             "--------------------------------------------"
+           );
+       //-----------------------------------------------------------------------
+       // Loop over the engines and the maximum numbers of iterations.
+       //-----------------------------------------------------------------------
+          for( int engine = 0; engine < 2; engine++ )
+            {
+               for( int maximum = 0; maximum < NUMBER_ITERATION_MAXIMUMS;
+                    maximum++ )
+                 {
+                  //------------------------------------------------------------
+                    runData.conversionEngine        =
+                                       ITERATIVE_ENGINES[ engine ];
+                    runData.maximumNumberIterations =
+                                       ITERATION_TIMING_MAXIMUM_ITERATIONS
+                                                              [ maximum ];
+                  //------------------------------------------------------------
+                    CONVERSION_TIMING_STATISTICS
+                     batchTiming;
+                  //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                    measureConversionTiming
+                           (
+                             iterationBatchTimingRun,
+                             &runData,
+                             numberPoints,
+                             NUMBER_WARM_UP_RUNS,
+                             NUMBER_TIMED_RUNS,
+                             batchTiming
+                           );
+                  //------------------------------------------------------------
+                  // The convergence and errors of the last run.
+                  //------------------------------------------------------------
+                    double maximumLatitudeErrorMicroArcSecs = 0.0;
+                    double maximumAltitudeErrorNanoMeters   = 0.0;
+                    double totalNumberIterations            = 0.0;
+                    size_t numberConverged                  = 0;
+                  //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                    for( size_t i = 0; i < numberPoints; i++ )
+                      {
+                         totalNumberIterations +=
+                                   convergenceReports[ i ].numberIterations;
+                         numberConverged       +=
+                                   convergenceReports[ i ].isConverged ? 1 : 0;
+                      //- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                         maximumLatitudeErrorMicroArcSecs =
+                                max( maximumLatitudeErrorMicroArcSecs,
+                                     MICRO_ARC_SECONDS_PER_RADIAN *
+                                     fabs( latitudeRadians[ i ] -
+                                           trueLatitudeRadians[ i ] ) );
+                         maximumAltitudeErrorNanoMeters   =
+                                max( maximumAltitudeErrorNanoMeters,
+                                     1.0E9 * fabs( altitudeMeters[ i ] -
+                                                   trueAltitudeMeters[ i ] ) );
+                      };
+                  //------------------------------------------------------------
+                    fprintf
+                     (
+                       stdout,
+                       "|    %-24s %4d %8.2f %7.3f %7.2f %6.2f %9.3g %8.3g\n",
+                       ( maximum == 0 ) ?
+                              ECEF_TO_GEODETIC_ENGINE_NAMES
+                                       [ ITERATIVE_ENGINES[ engine ] ] : "",
+                       runData.maximumNumberIterations,
+                       batchTiming.medianNanoSecondsPerPoint,
+                       batchTiming.madNanoSecondsPerPoint,
+                       totalNumberIterations / numberPoints,
+                       100.0 * numberConverged / numberPoints,
+                       maximumLatitudeErrorMicroArcSecs,
+                       maximumAltitudeErrorNanoMeters
+                     );
+                  //------------------------------------------------------------
+                 };
+            };
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+ // The points of the equatorial plane within the evolute.
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "%s%s\n"
+       "%s\n"
+       "%s%s\n"
+       "%s%s\n",
+       "|-------------------------------------------",
+       "--------------------------------------------",
+       "|    Equatorial plane within the evolute, y = z = 0",
+       "|    Engine                   x [m]    Lat [rad]",
+       "         Alt [m]  Conv.",
+       "|-------------------------------------------",
+       "--------------------------------------------"
+     );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    int
+     NUMBER_CHECK_POINTS = sizeof( ITERATION_CHECK_X_ECEF_METERS ) /
+                           sizeof( ITERATION_CHECK_X_ECEF_METERS[ 0 ] );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    int
+     numberLatitudesOutOfRange = 0;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int engine = 0; engine < 2; engine++ )
+      {
+          for( int point = 0; point < NUMBER_CHECK_POINTS; point++ )
+            {
+             //-----------------------------------------------------------------
+                double
+                 latitude,
+                 longitude,
+                 altitude;
+                ECEF_TO_GEODETIC_CONVERGENCE_REPORT
+                 convergenceReport;
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                ( void )
+                convertEcefToGeodeticIterated
+                       (
+                         ellipsoidContext,
+                         ITERATIVE_ENGINES[ engine ],
+                         ITERATED_ENGINE_DEFAULT_MAXIMUM_ITERATIONS,
+                         ITERATION_CHECK_X_ECEF_METERS[ point ],
+                         0.0,
+                         0.0,
+                         latitude,
+                         longitude,
+                         altitude,
+                         convergenceReport
+                       );
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                if( !( fabs( latitude ) <= 0.5 * piRadians ) )
+                  {
+                     numberLatitudesOutOfRange++;
+                  };
+             //-----------------------------------------------------------------
+                fprintf
+                 (
+                   stdout,
+                   "|    %-24s %5.0f %12.4e %15.3f  %5s\n",
+                   ( point == 0 ) ?
+                          ECEF_TO_GEODETIC_ENGINE_NAMES
+                                   [ ITERATIVE_ENGINES[ engine ] ] : "",
+                   ITERATION_CHECK_X_ECEF_METERS[ point ],
+                   latitude,
+                   altitude,
+                   convergenceReport.isConverged ? "yes" : "no"
+                 );
+             //-----------------------------------------------------------------
+            };
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    fprintf
+     (
+       stdout,
+       "|\n"
+       "|    Latitudes outside [ -pi/2, pi/2 ]:  %d\n",
+       numberLatitudesOutOfRange
+     );
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "%s\n"
+       "%s%s\n"
+       "\n\n\n",
+       "|",
+       "============================================",
+       "============================================"
+     );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -10,10 +10,97 @@
 #include <vector>
 
 #include "conversionBetweenEcefAndGeodetic.h"
+#include "convertEcefToGeodeticForEllipsoid.h"
 //------------------------------------------------------------------------------
    using namespace std;
    using namespace std::chrono;
 
+//------------------------------------------------------------------------------
+// Each timed run converts the points of the trial TRIAL_REPETITIONS_PER_RUN
+// times, about 90 microseconds of work, so the steady clock resolution and
+// the clock overhead are small beside it.
+//------------------------------------------------------------------------------
+static const int TRIAL_REPETITIONS_PER_RUN = 32;
+static const int TRIAL_WARM_UP_RUNS        =  2;
+static const int TRIAL_TIMED_RUNS          =  9;
+
+//------------------------------------------------------------------------------
+struct
+TRIAL_TIMING_RUN_DATA
+  {
+    double                               earthEquatorialRadiusMeters;
+    double                               earthEllipsoidalFlatteningFactor;
+    int                                  numberPoints;
+    const double                       * pXEcefMeters;
+    const double                       * pYEcefMeters;
+    const double                       * pZEcefMeters;
+    double                             * pGeodeticNorthLatitudeRadians;
+    double                             * pGeocentricEastLongitudeRadians;
+    double                             * pGeodeticAltitudeMeters;
+    ECEF_TO_GEODETIC_CONVERSION_STATUS * pConversionStatus;
+  };
+
+//------------------------------------------------------------------------------
+static
+void
+convertTrialTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    convertTrialTimingRun
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    One timed run of 'executeOneTrialConvertEcefToGeodetic': the scalar
+//    'convertEcefToGeodetic' calls for every point of the trial, repeated
+//    TRIAL_REPETITIONS_PER_RUN times, with the results stored.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const
+    TRIAL_TIMING_RUN_DATA
+        & rRunData = *( const TRIAL_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    for( int r = 0; r < TRIAL_REPETITIONS_PER_RUN; r++ )
+      {
+          for( int i = 0; i < rRunData.numberPoints; i++ )
+            {
+               rRunData.pConversionStatus[ i ] =
+               convertEcefToGeodetic
+                      (
+                        //-----------------
+                        // INPUT(s):
+                        //-----------------
+                           rRunData.earthEquatorialRadiusMeters,
+                           rRunData.earthEllipsoidalFlatteningFactor,
+                           rRunData.pXEcefMeters[ i ],
+                           rRunData.pYEcefMeters[ i ],
+                           rRunData.pZEcefMeters[ i ],
+                        //-----------------
+                        // OUTPUT(s):
+                        //-----------------
+                           rRunData.pGeodeticNorthLatitudeRadians  [ i ],
+                           rRunData.pGeocentricEastLongitudeRadians[ i ],
+                           rRunData.pGeodeticAltitudeMeters        [ i ]
+                      );
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          preventConversionTimingReordering( );
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+
 //------------------------------------------------------------------------------
 void
 executeOneTrialConvertEcefToGeodetic
@@ -26,7 +113,10 @@ executeOneTrialConvertEcefToGeodetic
          //-------------------
          // OUTPUT(s):
          //-------------------
-            double   &rExecutionTimeOfTrialFunctionCallsMicroSeconds,
+            TRIAL_POINT_RESULT
+                     *pTrialPointResults,
+            CONVERSION_TIMING_STATISTICS
+                     &rTrialTimingStatistics,
             double   &rMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs,
             double   &rMaximumGeodeticAltitudeAbsoluteErrorNanoMeters
        )
@@ -57,11 +147,15 @@ executeOneTrialConvertEcefToGeodetic
 //|
 //| OUTPUT(s):
 //|
-//|   rExecutionTimeOfTrialFunctionCallsMicroSeconds
-//|     A reference to a variable which will contain the sum of the
-//|     execution times of each of the 'convertEcefToGeodetic'
-//|     function calls in the current timing trial.
-//|     UNIT(s):  [microseconds]
+//|   pTrialPointResults
+//|     Pointer to NUMBER_POINTS_PER_TRIAL preallocated point results,
+//|     which will contain the true values, the residuals and the
+//|     conversion status of each conversion of the trial.
+//|
+//|   rTrialTimingStatistics
+//|     A reference to a variable which will contain the timing per call
+//|     of the 'convertEcefToGeodetic' function calls in the current
+//|     timing trial, from 'measureConversionTiming'.
 //|
 //|   rMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs
 //|     A reference to a variable which will contain the maximum
@@ -91,6 +185,12 @@ executeOneTrialConvertEcefToGeodetic
 //|   [ 3 ]  At each latitude, perform the conversion at four
 //|          different geodetic altitudes.
 //|
+//|   [ 4 ]  The 32 conversions are timed together, repeated in runs of
+//|          TRIAL_REPETITIONS_PER_RUN, by 'measureConversionTiming'; the
+//|          residuals are computed after the timing into the point
+//|          results.  Nothing is written: the caller formats the results
+//|          with 'reportOneTrialConvertEcefToGeodetic', when it chooses.
+//|
 //|-----------------------------------------------------------------------------
 //|
 //|  METHOD OF EACH ECEF TO GEODETIC CONVERSION:
@@ -106,7 +206,7 @@ executeOneTrialConvertEcefToGeodetic
 //|          significantly accelerates the backward transformation
 //|          without degrading the precision.
 //|
-//|   [ 4 ]  Report the differences between the defined true
+//|   [ 4 ]  Record the differences between the defined true
 //|          geodetic values and the estimated geodetic
 //|          values.
 //|
@@ -163,8 +263,6 @@ executeOneTrialConvertEcefToGeodetic
 //|
 //==============================================================================
 {
- //-----------------------------------------------------------------------------
-    rExecutionTimeOfTrialFunctionCallsMicroSeconds = NAN;
  //-----------------------------------------------------------------------------
     const
     double
@@ -196,46 +294,29 @@ executeOneTrialConvertEcefToGeodetic
     const
     double
      nanoMetersPerMeter            = 1.0E9;
-    const
-    double
-     microSecondsPerSecond         = 1.0E6;
  //-----------------------------------------------------------------------------
  //
- // GRS1980 System
+ // GRS1980 System, from the compile time ellipsoid.
  //
+ //-----------------------------------------------------------------------------
+    typedef ELLIPSOID_CONSTANTS< GRS80_ELLIPSOID > GRS80;
  //-----------------------------------------------------------------------------
     const
     double
-     earthEquatorialRadiusMeters             = 6378137.0E0;
-    const
-    double
-     inverseEarthEllipsoidalFlatteningFactor =     298.257222101E0;
- //-----------------------------------------------------------------------------
+     earthEquatorialRadiusMeters         = GRS80::earthEquatorialRadiusMeters;
     const
     double
-     earthEllipsoidalFlatteningFactor        =
-                         1.0E0 / inverseEarthEllipsoidalFlatteningFactor;
+     earthEllipsoidalFlatteningFactor    =
+                         GRS80::earthEllipsoidalFlatteningFactor;
     const
     double
-     earthEllipsoidalEccentricitySquared =
-                         ( 2.0E0 - earthEllipsoidalFlatteningFactor )
-                         *
-                         earthEllipsoidalFlatteningFactor;
+     earthEllipsoidalEccentricitySquared = GRS80::earthEllipticitySquared;
  //-----------------------------------------------------------------------------
     const
     double
      specifiedFixedTrueGeocentricEastLongitudeRadians =
                          radiansPerDegree *
                          specifiedFixedTrueGeocentricEastLongitudeDegrees;
- //-----------------------------------------------------------------------------
- //
- // Generate header for output.
- //
- //-----------------------------------------------------------------------------
-    generateTestProgramOutputHeader
-            (
-              specifiedFixedTrueGeocentricEastLongitudeDegrees
-            );
  //-----------------------------------------------------------------------------
     const
     double
@@ -267,11 +348,37 @@ executeOneTrialConvertEcefToGeodetic
     double
      maximumTrueGeodeticLatitudeDegrees = 89.999999999E0;
  //-----------------------------------------------------------------------------
-     double
-     totalTrialTimeMicroSeconds = 0.0;
+    const
+    int
+     NUMBER_TRIAL_POINTS  = ( maximumLatitudeIndex - minimumLatitudeIndex + 1 )
+                            *
+                            ( maximumAltitudeIndex - minimumAltitudeIndex + 1 );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    static_assert( NUMBER_TRIAL_POINTS == NUMBER_POINTS_PER_TRIAL,
+                   "trial grid does not match NUMBER_POINTS_PER_TRIAL" );
+ //-----------------------------------------------------------------------------
+    double trueGeodeticNorthLatitudeDegrees[ NUMBER_TRIAL_POINTS ];
+    double trueGeodeticNorthLatitudeRadians[ NUMBER_TRIAL_POINTS ];
+    double trueGeodeticAltitudeMeters      [ NUMBER_TRIAL_POINTS ];
+    double xTrueEcefMeters                 [ NUMBER_TRIAL_POINTS ];
+    double yTrueEcefMeters                 [ NUMBER_TRIAL_POINTS ];
+    double zTrueEcefMeters                 [ NUMBER_TRIAL_POINTS ];
+    double estimatedGeodeticNorthLatitudeRadians  [ NUMBER_TRIAL_POINTS ];
+    double estimatedGeocentricEastLongitudeRadians[ NUMBER_TRIAL_POINTS ];
+    double estimatedGeodeticAltitudeMeters        [ NUMBER_TRIAL_POINTS ];
+    ECEF_TO_GEODETIC_CONVERSION_STATUS
+           functionReturnedStatus                 [ NUMBER_TRIAL_POINTS ];
  //-----------------------------------------------------------------------------
     rMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs = 0.0;
     rMaximumGeodeticAltitudeAbsoluteErrorNanoMeters        = 0.0;
+ //=============================================================================
+ //
+ // Generate the true geodetic points of the trial and their ECEF
+ // coordinates.
+ //
+ //=============================================================================
+    int
+     pointIndex = 0;
  //-----------------------------------------------------------------------------
  // Loop over Geodetic Latitude values.
  //-----------------------------------------------------------------------------
@@ -281,26 +388,19 @@ executeOneTrialConvertEcefToGeodetic
             latitudeIndex  = latitudeIndex + 1
       )
       {
-       //-----------------------------------------------------------------------
-          double
-           trueGeodeticNorthLatitudeDegrees = latitudeIndex *
-                                              deltaLatitudeDegrees;
        //-----------------------------------------------------------------------
        // Include Near-Equator/Polar Cases 
        //-----------------------------------------------------------------------
-          trueGeodeticNorthLatitudeDegrees =
+          const
+          double
+           latitudeDegrees =
                       min(
                            maximumTrueGeodeticLatitudeDegrees,
                            max(
-                                trueGeodeticNorthLatitudeDegrees,
+                                latitudeIndex * deltaLatitudeDegrees,
                                 minimumTrueGeodeticLatitudeDegrees
                               )
                             );
-       //-----------------------------------------------------------------------
-          const
-          double
-           trueGeodeticNorthLatitudeRadians = radiansPerDegree *
-                                              trueGeodeticNorthLatitudeDegrees;
        //-----------------------------------------------------------------------
        // Loop over Geodetic Altitude values.
        //-----------------------------------------------------------------------
@@ -311,362 +411,142 @@ executeOneTrialConvertEcefToGeodetic
             )
             {
              //-----------------------------------------------------------------
-                double
-                 trueGeodeticAltitudeMeters = 0.0;
+                trueGeodeticNorthLatitudeDegrees[ pointIndex ] =
+                                       latitudeDegrees;
+                trueGeodeticNorthLatitudeRadians[ pointIndex ] =
+                                       radiansPerDegree * latitudeDegrees;
              //-----------------------------------------------------------------
-                if( altitudeIndex == minimumAltitudeIndex )
-                  {
-                   //-----------------------------------------------------------
-                   // At minimum altitude index.
-                   //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-                   // Set the current true geodetic altitude to a minimum value.
-                   //-----------------------------------------------------------
-                      trueGeodeticAltitudeMeters = -10000.0E0;
-                   //-----------------------------------------------------------
-                  }
-                else
-                  {
-                   //-----------------------------------------------------------
-                   // Not at minimum altitude index.
-                   //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-                   // Set the current true geodetic altitude to indexed value.
-                   //-----------------------------------------------------------
-                      trueGeodeticAltitudeMeters = altitudeIndex * 1000000.0E0;
-                   //-----------------------------------------------------------
-                  };
+             // The minimum altitude index is 10 kilometers below the
+             // ellipsoid, the others are at multiples of 1000 kilometers.
+             //-----------------------------------------------------------------
+                trueGeodeticAltitudeMeters[ pointIndex ] =
+                         ( altitudeIndex == minimumAltitudeIndex ) ?
+                                 -TEN_KILOMETER_IN_METERS :
+                                 altitudeIndex *
+                                 ONE_THOUSAND_KILOMETERS_IN_METERS;
              //-----------------------------------------------------------------
              // Convert the true geodetic coordinates into Earth Centered Earth
              // Fixed (ECEF) noninertial coordinates.
              //-----------------------------------------------------------------
-                 double xTrueEcefMeters = NAN;
-                 double yTrueEcefMeters = NAN;
-                 double zTrueEcefMeters = NAN;
-              //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - 
-                 ( void )
-                 convertGeodeticToEcef
-                        (
-                         //----------------
-                         // INPUT(s):
-                         //----------------
-                            earthEquatorialRadiusMeters,
-                            earthEllipsoidalEccentricitySquared,
-                            trueGeodeticNorthLatitudeRadians,
-                            specifiedFixedTrueGeocentricEastLongitudeRadians,
-                            trueGeodeticAltitudeMeters,
-                         //----------------
-                         // OUTPUT(s):
-                         //----------------
-                            xTrueEcefMeters,
-                            yTrueEcefMeters,
-                            zTrueEcefMeters
-                        );
-              //----------------------------------------------------------------
-              // Get starting timepoint.
-              //----------------------------------------------------------------
-                 auto timingStart = high_resolution_clock::now();
+                ( void )
+                convertGeodeticToEcef
+                       (
+                        //----------------
+                        // INPUT(s):
+                        //----------------
+                           earthEquatorialRadiusMeters,
+                           earthEllipsoidalEccentricitySquared,
+                           trueGeodeticNorthLatitudeRadians[ pointIndex ],
+                           specifiedFixedTrueGeocentricEastLongitudeRadians,
+                           trueGeodeticAltitudeMeters      [ pointIndex ],
+                        //----------------
+                        // OUTPUT(s):
+                        //----------------
+                           xTrueEcefMeters[ pointIndex ],
+                           yTrueEcefMeters[ pointIndex ],
+                           zTrueEcefMeters[ pointIndex ]
+                       );
              //-----------------------------------------------------------------
-             // Use Halley's third order iterative method
-             // (applying only one iteration) to approximate the solution of
-             // the fourth order nonlinear algebraic geodetic equations.
+                pointIndex++;
              //-----------------------------------------------------------------
-                 double estimatedGeodeticNorthLatitudeRadians   = 0.0;
-                 double estimatedGeocentricEastLongitudeRadians = 0.0;
-                 double estimatedGeodeticAltitudeMeters         = 0.0;
-              //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - 
-                 ECEF_TO_GEODETIC_CONVERSION_STATUS
-                   functionReturnedStatus =
-                   convertEcefToGeodetic
-                          (
-                            //-----------------
-                            // INPUT(s):
-                            //-----------------
-                               earthEquatorialRadiusMeters,
-                               earthEllipsoidalFlatteningFactor,
-                               xTrueEcefMeters,
-                               yTrueEcefMeters,
-                               zTrueEcefMeters,
-                            //-----------------
-                            // OUTPUT(s):
-                            //-----------------
-                               estimatedGeodeticNorthLatitudeRadians,
-                               estimatedGeocentricEastLongitudeRadians,
-                               estimatedGeodeticAltitudeMeters
-                          );
-              //----------------------------------------------------------------
-              // Get stopping timepoint.
-              //----------------------------------------------------------------
-                 auto timingStop = high_resolution_clock::now();
-              //----------------------------------------------------------------
-              // Get current duration.
-              //----------------------------------------------------------------
-                 auto currentTrialTimeMicroSeconds =
-                                        duration_cast
-                                        <microseconds>
-                                              ( timingStop - timingStart );
-              //----------------------------------------------------------------
-                 totalTrialTimeMicroSeconds =
-                      totalTrialTimeMicroSeconds +
-                      currentTrialTimeMicroSeconds.count( );
-              //----------------------------------------------------------------
-                 if( functionReturnedStatus == SUCCESSFUL_CONVERSION )
-                   {
-                    //----------------------------------------------------------
-                    // Geocentric to Geodetic conversion was successful.
-                    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-                    //
-                    // Compute the residuals:
-                    //
-                    //----------------------------------------------------------
-                       const
-                       double
-                        deltaGeodeticLatitudeRadians =
-                                     trueGeodeticNorthLatitudeRadians -
-                                     estimatedGeodeticNorthLatitudeRadians;
-                        const
-                        double
-                         deltaGeodeticLatitudeMicroArcSec = 
-                                      microArcSecondsPerRadian  *
-                                      deltaGeodeticLatitudeRadians;
-                    //- - - - - - - - - - - - - - - - - - - - - - - - - -
-                        const
-                        double
-                         deltaGeodeticAltitudeMeters =
-                                      trueGeodeticAltitudeMeters -
-                                      estimatedGeodeticAltitudeMeters;
-                        const
-                        double
-                         deltaGeodeticAltitudeNanoMeters  =
-                                      nanoMetersPerMeter *
-                                      deltaGeodeticAltitudeMeters;
-                    //----------------------------------------------------------
-                        rMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs =
-                        std::max
-                        (
-                         rMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs,
-                         abs( deltaGeodeticLatitudeMicroArcSec )
-                        );
-                    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-                        rMaximumGeodeticAltitudeAbsoluteErrorNanoMeters =
-                        std::max
-                        (
-                         rMaximumGeodeticAltitudeAbsoluteErrorNanoMeters,
-                         abs( deltaGeodeticAltitudeNanoMeters )
-                        );
-                    //----------------------------------------------------------
-                    // Output results.
-                    //----------------------------------------------------------
-                       fprintf
-                         (       
-                           stdout,
-                           "%+19.10f %+18.5f  %+19.10e  %+18.10e\n",
-                           trueGeodeticNorthLatitudeDegrees,
-                           trueGeodeticAltitudeMeters,
-                           deltaGeodeticLatitudeMicroArcSec,
-                           deltaGeodeticAltitudeNanoMeters
-                         );
-                    //----------------------------------------------------------
-                   }
-                 else
-                   {
-                    //----------------------------------------------------------
-                    // Geocentric to Geodetic conversion has failed.
-                    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-                    // Generate an error message.
-                    //----------------------------------------------------------
-                       if(
-                           functionReturnedStatus
-                           ==
-                           INVALID_ELLIPSOIDAL_FLATTENING
-                         )
-                         {
-                          //----------------------------------------------------
-                          // Encountered invalid ellipsoidal
-                          // flattening value.
-                          //- - - - - - - - - - - - - - - - - - - - - - - - - -
-                          // Generate an error message.
-                          //----------------------------------------------------
-                             fprintf
-                              (
-                                stdout,
-                                "\n\n\n"
-                                "%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n"
-                                "%s\n%s\n%s\n"
-                                "%s%+20e\n"
-                                "%s\n%s\n"
-                                "\n\n\n",
-                                "---------------------------------------------",
-                                "|",
-                                "| ERROR:",
-                                "|",
-                                "|   Encountered invalid Earth ellipsoidal",
-                                "|   flattening value.",       
-                                "|",
-                                "|   The Earth ellipsoidal flattening values",
-                                "|   should be in the interval:",
-                                "|     [ 0.0, 1.0 ).",
-                                "|",
-                                "|   The Earth ellipsoidal flattening value",
-                                "|   was:   ",
-                                earthEllipsoidalFlatteningFactor,
-                                "|",
-                                "---------------------------------------------"
-                              );
-                          //----------------------------------------------------
-                         }
-                       else
-                       if
-                         (
-                           functionReturnedStatus
-                           ==
-                           INVALID_EQUATORIAL_RADIUS
-                         )
-                         {
-                          //----------------------------------------------------
-                          // Encountered invalid Earth equatorial radius.
-                          //- - - - - - - - - - - - - - - - - - - - - - - - - -
-                          // Generate an error message.
-                          //----------------------------------------------------
-                             fprintf
+            };
+      };
+ //=============================================================================
+ //
+ // Time the conversions of the trial.
+ //
+ //=============================================================================
+    TRIAL_TIMING_RUN_DATA
+     runData;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    runData.earthEquatorialRadiusMeters        = earthEquatorialRadiusMeters;
+    runData.earthEllipsoidalFlatteningFactor   =
+                                   earthEllipsoidalFlatteningFactor;
+    runData.numberPoints                       = NUMBER_TRIAL_POINTS;
+    runData.pXEcefMeters                       = xTrueEcefMeters;
+    runData.pYEcefMeters                       = yTrueEcefMeters;
+    runData.pZEcefMeters                       = zTrueEcefMeters;
+    runData.pGeodeticNorthLatitudeRadians      =
+                                   estimatedGeodeticNorthLatitudeRadians;
+    runData.pGeocentricEastLongitudeRadians    =
+                                   estimatedGeocentricEastLongitudeRadians;
+    runData.pGeodeticAltitudeMeters            =
+                                   estimatedGeodeticAltitudeMeters;
+    runData.pConversionStatus                  = functionReturnedStatus;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    measureConversionTiming
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                convertTrialTimingRun,
+                &runData,
+                ( size_t )NUMBER_TRIAL_POINTS * TRIAL_REPETITIONS_PER_RUN,
+                TRIAL_WARM_UP_RUNS,
+                TRIAL_TIMED_RUNS,
+             //-------------------
+             // OUTPUT(s):
+             //-------------------
+                rTrialTimingStatistics
+           );
+ //=============================================================================
+ //
+ // Compute the residuals of the last run, outside of the timing, into the
+ // results of the trial.
+ //
+ //=============================================================================
+    for( pointIndex = 0; pointIndex < NUMBER_TRIAL_POINTS; pointIndex++ )
+      {
+       //-----------------------------------------------------------------------
+          TRIAL_POINT_RESULT
+              & rPointResult = pTrialPointResults[ pointIndex ];
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          rPointResult.trueGeodeticNorthLatitudeDegrees =
+                               trueGeodeticNorthLatitudeDegrees[ pointIndex ];
+          rPointResult.trueGeodeticAltitudeMeters       =
+                               trueGeodeticAltitudeMeters      [ pointIndex ];
+          rPointResult.conversionStatus                 =
+                               functionReturnedStatus          [ pointIndex ];
+          rPointResult.deltaGeodeticLatitudeMicroArcSecs = NAN;
+          rPointResult.deltaGeodeticAltitudeNanoMeters   = NAN;
+       //-----------------------------------------------------------------------
+          if( functionReturnedStatus[ pointIndex ] == SUCCESSFUL_CONVERSION )
+            {
+             //-----------------------------------------------------------------
+                rPointResult.deltaGeodeticLatitudeMicroArcSecs =
+                              microArcSecondsPerRadian *
                               (
-                                stdout,
-                                "\n\n\n"
-                                "%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n"
-                                "%s\n%s\n"
-                                "%s%+20e%s\n"
-                                "%s\n%s\n"
-                                "\n\n\n",
-                                "---------------------------------------------",
-                                "|",
-                                "| ERROR:",
-                                "|",
-                                "|   Encountered invalid Earth",       
-                                "|   equatorial radius value.",
-                                "|",
-                                "|   The Earth equatorial radius",
-                                "|   value should be strictly positive.",
-                                "|",
-                                "|   The Earth equatorial radius value",
-                                "|   was:   ",
-                                earthEquatorialRadiusMeters,
-                                " [meters]",                    
-                                "|",
-                                "---------------------------------------------"
+                                trueGeodeticNorthLatitudeRadians[ pointIndex ] -
+                                estimatedGeodeticNorthLatitudeRadians
+                                                                [ pointIndex ]
                               );
-                          //----------------------------------------------------
-                         }
-                       else
-                         {
-                          //----------------------------------------------------
-                          // Encountered undetermined Geodetic
-                          // conversion error.
-                          //- - - - - - - - - - - - - - - - - - - - - - - - - -
-                          // Generate an error message.
-                          //----------------------------------------------------
-                             fprintf
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                rPointResult.deltaGeodeticAltitudeNanoMeters   =
+                              nanoMetersPerMeter *
                               (
-                                stdout,
-                                "\n\n\n"
-                                "%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n"
-                                "\n\n\n",
-                                "---------------------------------------------",
-                                "|",
-                                "| ERROR:",
-                                "|",
-                                "|   Encountered undetermined Geodetic",
-                                "|   conversion error.",
-                                "|",
-                                "---------------------------------------------"
+                                trueGeodeticAltitudeMeters     [ pointIndex ] -
+                                estimatedGeodeticAltitudeMeters[ pointIndex ]
                               );
-                          //----------------------------------------------------
-                         };
-                    //----------------------------------------------------------
-                   };
-              //----------------------------------------------------------------
-              // End of altitude loop.
-              //----------------------------------------------------------------
+             //-----------------------------------------------------------------
+                rMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs =
+                std::max
+                (
+                 rMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs,
+                 abs( rPointResult.deltaGeodeticLatitudeMicroArcSecs )
+                );
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                rMaximumGeodeticAltitudeAbsoluteErrorNanoMeters =
+                std::max
+                (
+                 rMaximumGeodeticAltitudeAbsoluteErrorNanoMeters,
+                 abs( rPointResult.deltaGeodeticAltitudeNanoMeters )
+                );
+             //-----------------------------------------------------------------
             };
        //-----------------------------------------------------------------------
-       // End of latitude loop.
-       //-----------------------------------------------------------------------
       };
- //-----------------------------------------------------------------------------
- // Finish the output report.
- //-----------------------------------------------------------------------------
-    fprintf
-     (
-       stdout,
-       "%s%s\n\n\n",
-       "============================================",
-       "============================================"
-     );
- //-----------------------------------------------------------------------------
-    rExecutionTimeOfTrialFunctionCallsMicroSeconds =
-                        totalTrialTimeMicroSeconds;
- //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-    fprintf
-     (
-       stdout,
-       "\n\n\n"              
-       "%s%s\n"              
-       "%s\n%s\n%s\n%s\n"    
-       "%s%+14.6e%s\n"       
-       "%s\n"                
-       "%s%s\n"              
-       "\n\n\n",
-       "==================================================================",
-       "======================",
-       "|",
-       "| TRIAL TIMING RESULTS:",
-       "|",
-       "|   Cumulative execution time over all",
-       "|     'convertEcefToGeodetic' function calls in trial:-->",
-       rExecutionTimeOfTrialFunctionCallsMicroSeconds,
-       " [microseconds]",
-       "|",
-       "==================================================================",
-       "======================"
-     );
- //-----------------------------------------------------------------------------
-    fprintf
-     (
-       stdout,
-         "\n\n\n"
-         "%s%s\n"
-         "%s\n%s\n%s\n%s\n"
-         "%s%+14.6e%s\n"
-         "%s\n%s\n"
-         "%s%+14.6e%s\n"
-         "%s\n"
-         "%s%s\n"
-         "\n\n\n",
-       "============================================",
-       "============================================",
-       "|",
-       "|  MAXIMUM ABSOLUTE ERRORS OVER ONE TRIAL:",
-       "|",
-       "|    Maximum geodetic north latitude absolute error",
-       "|      is:-->",
-       rMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs,
-       " [microarcseconds]",
-       "|",
-       "|    Maximum geodetic altitude absolute error",
-       "|      is:-->",
-       rMaximumGeodeticAltitudeAbsoluteErrorNanoMeters,
-       " [nanometers]",
-       "|",
-       "============================================",
-       "============================================"
-     );
  //-----------------------------------------------------------------------------
     return;
  //-----------------------------------------------------------------------------
 }
 //==============================================================================
-
-
-
-
-
-
-
-
@@ -0,0 +1,627 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+
+//------------------------------------------------------------------------------
+struct
+OUTPUT_SELECTION_TIMING_RUN_DATA
+  {
+    const EARTH_ELLIPSOID_CONTEXT      * pEllipsoidContext;
+    size_t                               numberPoints;
+    const double                       * pXEcefMeters;
+    const double                       * pYEcefMeters;
+    const double                       * pZEcefMeters;
+    double                             * pGeodeticNorthLatitudeRadians;
+    double                             * pGeocentricEastLongitudeRadians;
+    double                             * pGeodeticAltitudeMeters;
+    ECEF_TO_GEODETIC_CONVERSION_STATUS * pConversionStatus;
+  };
+
+//------------------------------------------------------------------------------
+// One timed run: one full context call per point.
+//------------------------------------------------------------------------------
+static
+void
+convertFullScalarTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    OUTPUT_SELECTION_TIMING_RUN_DATA
+        & rRunData = *( OUTPUT_SELECTION_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < rRunData.numberPoints; i++ )
+      {
+          rRunData.pConversionStatus[ i ] =
+          convertEcefToGeodetic
+                 (
+                   *rRunData.pEllipsoidContext,
+                   rRunData.pXEcefMeters[ i ],
+                   rRunData.pYEcefMeters[ i ],
+                   rRunData.pZEcefMeters[ i ],
+                   rRunData.pGeodeticNorthLatitudeRadians  [ i ],
+                   rRunData.pGeocentricEastLongitudeRadians[ i ],
+                   rRunData.pGeodeticAltitudeMeters        [ i ]
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: one altitude only call per point.
+//------------------------------------------------------------------------------
+static
+void
+convertAltitudeScalarTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    OUTPUT_SELECTION_TIMING_RUN_DATA
+        & rRunData = *( OUTPUT_SELECTION_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < rRunData.numberPoints; i++ )
+      {
+          rRunData.pConversionStatus[ i ] =
+          convertEcefToGeodeticAltitude
+                 (
+                   *rRunData.pEllipsoidContext,
+                   rRunData.pXEcefMeters[ i ],
+                   rRunData.pYEcefMeters[ i ],
+                   rRunData.pZEcefMeters[ i ],
+                   rRunData.pGeodeticAltitudeMeters[ i ]
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: one latitude and longitude only call per point.
+//------------------------------------------------------------------------------
+static
+void
+convertLatitudeLongitudeScalarTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    OUTPUT_SELECTION_TIMING_RUN_DATA
+        & rRunData = *( OUTPUT_SELECTION_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < rRunData.numberPoints; i++ )
+      {
+          rRunData.pConversionStatus[ i ] =
+          convertEcefToGeodeticLatitudeLongitude
+                 (
+                   *rRunData.pEllipsoidContext,
+                   rRunData.pXEcefMeters[ i ],
+                   rRunData.pYEcefMeters[ i ],
+                   rRunData.pZEcefMeters[ i ],
+                   rRunData.pGeodeticNorthLatitudeRadians  [ i ],
+                   rRunData.pGeocentricEastLongitudeRadians[ i ]
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: one latitude only call per point.
+//------------------------------------------------------------------------------
+static
+void
+convertLatitudeScalarTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    OUTPUT_SELECTION_TIMING_RUN_DATA
+        & rRunData = *( OUTPUT_SELECTION_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < rRunData.numberPoints; i++ )
+      {
+          rRunData.pConversionStatus[ i ] =
+          convertEcefToGeodeticLatitude
+                 (
+                   *rRunData.pEllipsoidContext,
+                   rRunData.pXEcefMeters[ i ],
+                   rRunData.pYEcefMeters[ i ],
+                   rRunData.pZEcefMeters[ i ],
+                   rRunData.pGeodeticNorthLatitudeRadians[ i ]
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: one full context batch call.
+//------------------------------------------------------------------------------
+static
+void
+convertFullBatchTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    OUTPUT_SELECTION_TIMING_RUN_DATA
+        & rRunData = *( OUTPUT_SELECTION_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticBatch
+           (
+             *rRunData.pEllipsoidContext,
+             rRunData.numberPoints,
+             rRunData.pXEcefMeters,
+             rRunData.pYEcefMeters,
+             rRunData.pZEcefMeters,
+             rRunData.pGeodeticNorthLatitudeRadians,
+             rRunData.pGeocentricEastLongitudeRadians,
+             rRunData.pGeodeticAltitudeMeters,
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: one altitude only batch call.
+//------------------------------------------------------------------------------
+static
+void
+convertAltitudeBatchTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    OUTPUT_SELECTION_TIMING_RUN_DATA
+        & rRunData = *( OUTPUT_SELECTION_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticAltitudeBatch
+           (
+             *rRunData.pEllipsoidContext,
+             rRunData.numberPoints,
+             rRunData.pXEcefMeters,
+             rRunData.pYEcefMeters,
+             rRunData.pZEcefMeters,
+             rRunData.pGeodeticAltitudeMeters,
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: one latitude and longitude only batch call.
+//------------------------------------------------------------------------------
+static
+void
+convertLatitudeLongitudeBatchTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    OUTPUT_SELECTION_TIMING_RUN_DATA
+        & rRunData = *( OUTPUT_SELECTION_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticLatitudeLongitudeBatch
+           (
+             *rRunData.pEllipsoidContext,
+             rRunData.numberPoints,
+             rRunData.pXEcefMeters,
+             rRunData.pYEcefMeters,
+             rRunData.pZEcefMeters,
+             rRunData.pGeodeticNorthLatitudeRadians,
+             rRunData.pGeocentricEastLongitudeRadians,
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: one latitude only batch call.
+//------------------------------------------------------------------------------
+static
+void
+convertLatitudeBatchTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    OUTPUT_SELECTION_TIMING_RUN_DATA
+        & rRunData = *( OUTPUT_SELECTION_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticLatitudeBatch
+           (
+             *rRunData.pEllipsoidContext,
+             rRunData.numberPoints,
+             rRunData.pXEcefMeters,
+             rRunData.pYEcefMeters,
+             rRunData.pZEcefMeters,
+             rRunData.pGeodeticNorthLatitudeRadians,
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+executeOutputSelectionTimingConvertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const
+            int      numberPointsExponent
+         //-------------------
+         // OUTPUT(s):
+         //           NONE
+         //-------------------
+       )
+//==============================================================================
+//|
+//| FUNCTION:
+//|
+//|   executeOutputSelectionTimingConvertEcefToGeodetic
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| PURPOSE:
+//|
+//|   To compare the execution time per point of the altitude only, the
+//|   latitude and longitude only and the latitude only conversions with
+//|   that of the full ellipsoid context 'convertEcefToGeodetic' and
+//|   'convertEcefToGeodeticBatch', and to check that their outputs are
+//|   those of the full conversions.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| INPUT(s):
+//|
+//|   numberPointsExponent
+//|     The base ten exponent of the number of points.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| METHOD:
+//|
+//|   [ 1 ] Generate 10^numberPointsExponent true geodetic points, with
+//|         uniform latitude and longitude and altitudes from -10 km to
+//|         50000 km evenly spaced in asinh( h / 1 km ).  Every 97th point
+//|         is put on a pole.
+//|
+//|   [ 2 ] Time each route with 'measureConversionTiming'.  The speedup
+//|         of a scalar route is against the full scalar conversion, and
+//|         that of a batch route against the full batch conversion.
+//|
+//|   [ 3 ] Count the outputs of each route which are not bit for bit
+//|         those of the full conversion of the same form.
+//|
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+ //
+ // GRS1980 System
+ //
+ //-----------------------------------------------------------------------------
+    const
+    double
+     earthEquatorialRadiusMeters         = 6378137.0E0;
+    const
+    double
+     earthEllipsoidalFlatteningFactor    = 1.0E0 / 298.257222101E0;
+    const
+    double
+     earthEllipsoidalEccentricitySquared =
+                         ( 2.0E0 - earthEllipsoidalFlatteningFactor )
+                         *
+                         earthEllipsoidalFlatteningFactor;
+ //-----------------------------------------------------------------------------
+    const
+    int
+     NUMBER_WARM_UP_RUNS = 1;
+    const
+    int
+     NUMBER_TIMED_RUNS   = 7;
+ //-----------------------------------------------------------------------------
+    EARTH_ELLIPSOID_CONTEXT
+     ellipsoidContext;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    ( void )
+    initializeEarthEllipsoidContext
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalFlatteningFactor,
+             ellipsoidContext
+           );
+ //-----------------------------------------------------------------------------
+    size_t
+     numberPoints = 1;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int exponent = 0; exponent < numberPointsExponent; exponent++ )
+      {
+          numberPoints = 10 * numberPoints;
+      };
+ //-----------------------------------------------------------------------------
+ // Generate the true geodetic points and their ECEF coordinates.
+ //-----------------------------------------------------------------------------
+    vector< double > trueLatitudeRadians ( numberPoints );
+    vector< double > trueLongitudeRadians( numberPoints );
+    vector< double > trueAltitudeMeters  ( numberPoints );
+    vector< double > xEcefMeters         ( numberPoints );
+    vector< double > yEcefMeters         ( numberPoints );
+    vector< double > zEcefMeters         ( numberPoints );
+    vector< double > latitudeRadians     ( numberPoints );
+    vector< double > longitudeRadians    ( numberPoints );
+    vector< double > altitudeMeters      ( numberPoints );
+    vector< ECEF_TO_GEODETIC_CONVERSION_STATUS >
+                     conversionStatus    ( numberPoints );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    generateTimingGeodeticPoints
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalEccentricitySquared,
+             -1.0E4,
+             5.0E7,
+             ASINH_TIMING_ALTITUDE_SPACING,
+             97,
+             numberPoints,
+             trueLatitudeRadians .data( ),
+             trueLongitudeRadians.data( ),
+             trueAltitudeMeters  .data( ),
+             xEcefMeters         .data( ),
+             yEcefMeters         .data( ),
+             zEcefMeters         .data( ),
+             NULL
+           );
+ //-----------------------------------------------------------------------------
+    OUTPUT_SELECTION_TIMING_RUN_DATA
+     runData;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    runData.pEllipsoidContext               = &ellipsoidContext;
+    runData.numberPoints                    = numberPoints;
+    runData.pXEcefMeters                    = xEcefMeters     .data( );
+    runData.pYEcefMeters                    = yEcefMeters     .data( );
+    runData.pZEcefMeters                    = zEcefMeters     .data( );
+    runData.pGeodeticNorthLatitudeRadians   = latitudeRadians .data( );
+    runData.pGeocentricEastLongitudeRadians = longitudeRadians.data( );
+    runData.pGeodeticAltitudeMeters         = altitudeMeters  .data( );
+    runData.pConversionStatus               = conversionStatus.data( );
+ //-----------------------------------------------------------------------------
+ // Outputs of the full scalar and batch conversions, against which the
+ // outputs of the partial conversions are checked.
+ //-----------------------------------------------------------------------------
+    vector< double > fullLatitudeRadians [ 2 ];
+    vector< double > fullLongitudeRadians[ 2 ];
+    vector< double > fullAltitudeMeters  [ 2 ];
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    convertFullScalarTimingRun( &runData );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    fullLatitudeRadians [ 0 ] = latitudeRadians;
+    fullLongitudeRadians[ 0 ] = longitudeRadians;
+    fullAltitudeMeters  [ 0 ] = altitudeMeters;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    convertFullBatchTimingRun( &runData );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    fullLatitudeRadians [ 1 ] = latitudeRadians;
+    fullLongitudeRadians[ 1 ] = longitudeRadians;
+    fullAltitudeMeters  [ 1 ] = altitudeMeters;
+ //-----------------------------------------------------------------------------
+ // The routes: the first four are scalar and the last four batch, each
+ // form starting with its full conversion.  The flags tell which of the
+ // latitude, longitude and altitude a route computes.
+ //-----------------------------------------------------------------------------
+    const
+    int
+     NUMBER_ROUTES = 8;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    char *
+     routeNames[ NUMBER_ROUTES ] = { "Full, scalar",
+                                     "Altitude only, scalar",
+                                     "Latitude/longitude, scalar",
+                                     "Latitude only, scalar",
+                                     "Full, batch",
+                                     "Altitude only, batch",
+                                     "Latitude/longitude, batch",
+                                     "Latitude only, batch" };
+    void
+     ( *routeRuns[ NUMBER_ROUTES ] )( void * ) =
+                              { convertFullScalarTimingRun,
+                                convertAltitudeScalarTimingRun,
+                                convertLatitudeLongitudeScalarTimingRun,
+                                convertLatitudeScalarTimingRun,
+                                convertFullBatchTimingRun,
+                                convertAltitudeBatchTimingRun,
+                                convertLatitudeLongitudeBatchTimingRun,
+                                convertLatitudeBatchTimingRun };
+    const
+    bool
+     routeOutputs[ NUMBER_ROUTES ][ 3 ] = { { true,  true,  true  },
+                                            { false, false, true  },
+                                            { true,  true,  false },
+                                            { true,  false, false },
+                                            { true,  true,  true  },
+                                            { false, false, true  },
+                                            { true,  true,  false },
+                                            { true,  false, false } };
+ //-----------------------------------------------------------------------------
+ // Report header.
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "\n\n\n"
+       "%s%s\n"
+       "%s\n%s\n%s\n"
+       "%s%zu%s\n"
+       "%s\n"
+       "%s%s\n"
+       "%s%s\n"
+       "%s%s\n",
+       "============================================",
+       "============================================",
+       "|",
+       "| OUTPUT SELECTION TIMING RESULTS:",
+       "|",
+       "|    ",
+       numberPoints,
+       " points from -10 km to 50000 km altitude",
+       "|",
+       "|-------------------------------------------",
+       "--------------------------------------------",
+       "|    Route                        [ns/point]      MAD   vs full",
+       "   Mismatches",
+       "|-------------------------------------------",
+       "--------------------------------------------"
+     );
+ //-----------------------------------------------------------------------------
+ // Loop over the routes.
+ //-----------------------------------------------------------------------------
+    double
+     fullNanoSecondsPerPoint = NAN;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int route = 0; route < NUMBER_ROUTES; route++ )
+      {
+       //-----------------------------------------------------------------------
+          const int form = route / 4;
+       //-----------------------------------------------------------------------
+       // Outputs which a route does not write stay NAN.
+       //-----------------------------------------------------------------------
+          fill( latitudeRadians .begin( ), latitudeRadians .end( ), NAN );
+          fill( longitudeRadians.begin( ), longitudeRadians.end( ), NAN );
+          fill( altitudeMeters  .begin( ), altitudeMeters  .end( ), NAN );
+       //-----------------------------------------------------------------------
+          CONVERSION_TIMING_STATISTICS
+           routeTiming;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          measureConversionTiming
+                 (
+                   routeRuns[ route ],
+                   &runData,
+                   numberPoints,
+                   NUMBER_WARM_UP_RUNS,
+                   NUMBER_TIMED_RUNS,
+                   routeTiming
+                 );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( route % 4 == 0 )
+            {
+               fullNanoSecondsPerPoint = routeTiming.medianNanoSecondsPerPoint;
+            };
+       //-----------------------------------------------------------------------
+       // Outputs of the last run which are not those of the full
+       // conversion to the last bit.
+       //-----------------------------------------------------------------------
+          size_t numberMismatches = 0;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+             //-----------------------------------------------------------------
+                if( routeOutputs[ route ][ 0 ] &&
+                    memcmp( &latitudeRadians[ i ],
+                            &fullLatitudeRadians[ form ][ i ],
+                            sizeof( double ) ) != 0 )
+                  {
+                     numberMismatches++;
+                  };
+                if( routeOutputs[ route ][ 1 ] &&
+                    memcmp( &longitudeRadians[ i ],
+                            &fullLongitudeRadians[ form ][ i ],
+                            sizeof( double ) ) != 0 )
+                  {
+                     numberMismatches++;
+                  };
+                if( routeOutputs[ route ][ 2 ] &&
+                    memcmp( &altitudeMeters[ i ],
+                            &fullAltitudeMeters[ form ][ i ],
+                            sizeof( double ) ) != 0 )
+                  {
+                     numberMismatches++;
+                  };
+             //-----------------------------------------------------------------
+            };
+       //-----------------------------------------------------------------------
+          fprintf
+           (
+             stdout,
+             "|    %-27s %11.3f %8.3f %9.2f %12zu\n",
+             routeNames[ route ],
+             routeTiming.medianNanoSecondsPerPoint,
+             routeTiming.madNanoSecondsPerPoint,
+             fullNanoSecondsPerPoint /
+             routeTiming.medianNanoSecondsPerPoint,
+             numberMismatches
+           );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "%s\n"
+       "%s%s\n"
+       "\n\n\n",
+       "|",
+       "============================================",
+       "============================================"
+     );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,320 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+   using namespace std::chrono;
+
+//------------------------------------------------------------------------------
+void
+executeParallelTimingConvertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const
+            int      numberPointsExponent,
+            const
+            size_t   maximumNumberThreads,
+            const
+            size_t   chunkSizePoints
+         //-------------------
+         // OUTPUT(s):
+         //           NONE
+         //-------------------
+       )
+//==============================================================================
+//|
+//| FUNCTION:
+//|
+//|   executeParallelTimingConvertEcefToGeodetic
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| PURPOSE:
+//|
+//|   To report the scaling of 'convertEcefToGeodeticParallelBatch' over
+//|   1, 2, ... maximumNumberThreads threads: the execution time per point,
+//|   the throughput, the speedup over one thread and the parallel
+//|   efficiency.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| METHOD:
+//|
+//|   [ 1 ]  Generate a batch of random GRS80 points and convert it once
+//|          with the single threaded context batch as the reference.
+//|
+//|   [ 2 ]  For each thread count create a pool, convert the batch once to
+//|          start the threads, then time repeated conversions until at
+//|          least MINIMUM_POINTS_PER_COUNT points have been converted.
+//|
+//|   [ 3 ]  Count the points whose results differ from the reference in
+//|          any bit; there should be none.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| INPUT(s):
+//|
+//|   numberPointsExponent
+//|     The base ten exponent of the batch size.
+//|
+//|   maximumNumberThreads
+//|     The largest thread count timed.
+//|
+//|   chunkSizePoints
+//|     The chunk size passed to 'convertEcefToGeodeticParallelBatch'
+//|     (zero for the default).
+//|
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+ //
+ // GRS1980 System
+ //
+ //-----------------------------------------------------------------------------
+    const
+    double
+     earthEquatorialRadiusMeters             = 6378137.0E0;
+    const
+    double
+     earthEllipsoidalFlatteningFactor        = 1.0E0 / 298.257222101E0;
+ //-----------------------------------------------------------------------------
+    const
+    size_t
+     MINIMUM_POINTS_PER_COUNT = 20000000;
+ //-----------------------------------------------------------------------------
+    size_t
+     numberPoints = 1;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int exponent = 0; exponent < numberPointsExponent; exponent++ )
+      {
+          numberPoints = 10 * numberPoints;
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    size_t
+     numberRepetitions = max(
+                              ( size_t )1,
+                              MINIMUM_POINTS_PER_COUNT / numberPoints
+                            );
+ //-----------------------------------------------------------------------------
+    EARTH_ELLIPSOID_CONTEXT
+     ellipsoidContext;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    ( void )
+    initializeEarthEllipsoidContext
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalFlatteningFactor,
+             ellipsoidContext
+           );
+ //-----------------------------------------------------------------------------
+ // Generate the ECEF points.
+ //-----------------------------------------------------------------------------
+    vector< double > xEcefMeters            ( numberPoints );
+    vector< double > yEcefMeters            ( numberPoints );
+    vector< double > zEcefMeters            ( numberPoints );
+    vector< double > referenceLatitude      ( numberPoints );
+    vector< double > referenceLongitude     ( numberPoints );
+    vector< double > referenceAltitude      ( numberPoints );
+    vector< double > latitudeRadians        ( numberPoints );
+    vector< double > longitudeRadians       ( numberPoints );
+    vector< double > altitudeMeters         ( numberPoints );
+    vector< ECEF_TO_GEODETIC_CONVERSION_STATUS >
+                     referenceStatus        ( numberPoints );
+    vector< ECEF_TO_GEODETIC_CONVERSION_STATUS >
+                     conversionStatus       ( numberPoints );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    generateTimingGeodeticPoints
+           (
+             ellipsoidContext.earthEquatorialRadiusMeters,
+             ellipsoidContext.earthEllipticitySquared,
+             -1.0E4,
+             3.0E6,
+             UNIFORM_TIMING_ALTITUDE_SPACING,
+             0,
+             numberPoints,
+             NULL,
+             NULL,
+             NULL,
+             xEcefMeters.data( ),
+             yEcefMeters.data( ),
+             zEcefMeters.data( ),
+             NULL
+           );
+ //-----------------------------------------------------------------------------
+ // Single threaded reference.
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticBatch
+           (
+             ellipsoidContext,
+             numberPoints,
+             xEcefMeters.data( ),
+             yEcefMeters.data( ),
+             zEcefMeters.data( ),
+             referenceLatitude.data( ),
+             referenceLongitude.data( ),
+             referenceAltitude.data( ),
+             referenceStatus.data( )
+           );
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "\n\n\n"
+       "%s%s\n"
+       "%s\n%s\n%s\n"
+       "%s%zu\n"
+       "%s%zu\n"
+       "%s\n"
+       "%s%s\n"
+       "%s\n"
+       "%s\n",
+       "============================================",
+       "============================================",
+       "|",
+       "| PARALLEL BATCH SCALING RESULTS:",
+       "|",
+       "|    Number of points per batch ",
+       numberPoints,
+       "|    Chunk size [points]        ",
+       ( chunkSizePoints > 0 ) ? chunkSizePoints :
+                                 DEFAULT_ECEF_TO_GEODETIC_CHUNK_POINTS,
+       "|",
+       "|-------------------------------------------",
+       "--------------------------------------------",
+       "|    Threads      Time   Throughput   Speedup  Efficiency  Mismatches",
+       "|          [ns/point]   [Mpoint/s]"
+     );
+ //-----------------------------------------------------------------------------
+    double oneThreadNanoSecondsPerPoint = 0.0;
+ //-----------------------------------------------------------------------------
+    for(
+         size_t numberThreads  = 1;
+                numberThreads <= maximumNumberThreads;
+                numberThreads++
+       )
+      {
+       //-----------------------------------------------------------------------
+          ECEF_TO_GEODETIC_THREAD_POOL
+               * pThreadPool = createEcefToGeodeticThreadPool( numberThreads );
+       //-----------------------------------------------------------------------
+       // Untimed conversion, so the pool threads are running.
+       //-----------------------------------------------------------------------
+          convertEcefToGeodeticParallelBatch
+                 (
+                   *pThreadPool,
+                   ellipsoidContext,
+                   chunkSizePoints,
+                   numberPoints,
+                   xEcefMeters.data( ),
+                   yEcefMeters.data( ),
+                   zEcefMeters.data( ),
+                   latitudeRadians.data( ),
+                   longitudeRadians.data( ),
+                   altitudeMeters.data( ),
+                   conversionStatus.data( )
+                 );
+       //-----------------------------------------------------------------------
+          auto timingStart = steady_clock::now();
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t r = 0; r < numberRepetitions; r++ )
+            {
+               convertEcefToGeodeticParallelBatch
+                      (
+                        *pThreadPool,
+                        ellipsoidContext,
+                        chunkSizePoints,
+                        numberPoints,
+                        xEcefMeters.data( ),
+                        yEcefMeters.data( ),
+                        zEcefMeters.data( ),
+                        latitudeRadians.data( ),
+                        longitudeRadians.data( ),
+                        altitudeMeters.data( ),
+                        conversionStatus.data( )
+                      );
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          auto timingStop  = steady_clock::now();
+       //-----------------------------------------------------------------------
+          destroyEcefToGeodeticThreadPool( pThreadPool );
+       //-----------------------------------------------------------------------
+          size_t numberMismatches = 0;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+               if(
+                   ( memcmp( &latitudeRadians [ i ],
+                             &referenceLatitude [ i ], sizeof( double ) ) != 0 )
+                   ||
+                   ( memcmp( &longitudeRadians[ i ],
+                             &referenceLongitude[ i ], sizeof( double ) ) != 0 )
+                   ||
+                   ( memcmp( &altitudeMeters  [ i ],
+                             &referenceAltitude [ i ], sizeof( double ) ) != 0 )
+                   ||
+                   ( conversionStatus[ i ] != referenceStatus[ i ] )
+                 )
+                 {
+                    numberMismatches++;
+                 };
+            };
+       //-----------------------------------------------------------------------
+          const
+          double
+           nanoSecondsPerPoint =
+             duration< double, nano >( timingStop - timingStart ).count( )
+             /
+             ( ( double )numberRepetitions * numberPoints );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( numberThreads == 1 )
+            {
+               oneThreadNanoSecondsPerPoint = nanoSecondsPerPoint;
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          const
+          double
+           speedup = oneThreadNanoSecondsPerPoint / nanoSecondsPerPoint;
+       //-----------------------------------------------------------------------
+          fprintf
+           (
+             stdout,
+             "%s%7zu%11.3f%13.2f%10.2f%11.1f%%%12zu\n",
+             "|    ",
+             numberThreads,
+             nanoSecondsPerPoint,
+             1.0E3 / nanoSecondsPerPoint,
+             speedup,
+             100.0 * speedup / numberThreads,
+             numberMismatches
+           );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "%s\n"
+       "%s%s\n"
+       "\n\n\n",
+       "|",
+       "============================================",
+       "============================================"
+     );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
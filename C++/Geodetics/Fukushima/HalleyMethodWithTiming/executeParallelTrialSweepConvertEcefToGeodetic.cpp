@@ -0,0 +1,274 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+
+//------------------------------------------------------------------------------
+// The running maxima of one sweep thread, on its own cache line so that the
+// threads never write to a shared line.
+//------------------------------------------------------------------------------
+struct
+alignas( 64 )
+TRIAL_SWEEP_ACCUMULATOR
+  {
+    double maximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs;
+    double maximumGeodeticAltitudeAbsoluteErrorNanoMeters;
+  };
+
+//------------------------------------------------------------------------------
+static
+void
+executeTrialSweepRange
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const int     firstTrialIndex,
+            const int     endTrialIndex,
+            const double  startingEastGeocentricLongitudeDegrees,
+            const double  deltaEastGeocentricLongitudeDegrees,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+            TRIAL_POINT_RESULT
+                        * pTrialPointResults,
+            CONVERSION_TIMING_STATISTICS
+                        * pTrialTimingStatistics,
+            double      * pTrialMaximumLatitudeErrorMicroArcSecs,
+            double      * pTrialMaximumAltitudeErrorNanoMeters,
+            TRIAL_SWEEP_ACCUMULATOR
+                        & rAccumulator
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    executeTrialSweepRange
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Run the trials [ firstTrialIndex, endTrialIndex ) of a sweep on the
+//    calling thread, writing each into its own slots of the sweep buffers
+//    and its maxima into the accumulator of the thread.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    rAccumulator.maximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs = 0.0;
+    rAccumulator.maximumGeodeticAltitudeAbsoluteErrorNanoMeters        = 0.0;
+ //-----------------------------------------------------------------------------
+    for( int t = firstTrialIndex; t < endTrialIndex; t++ )
+      {
+       //-----------------------------------------------------------------------
+       // The longitude of a trial depends on its index only, exactly as in
+       // the serial loop of the test program.
+       //-----------------------------------------------------------------------
+          executeOneTrialConvertEcefToGeodetic
+                 (
+                   //-------------------
+                   // INPUT(s):
+                   //-------------------
+                      startingEastGeocentricLongitudeDegrees
+                      +
+                      ( t * deltaEastGeocentricLongitudeDegrees ),
+                   //-------------------
+                   // OUTPUT(s):
+                   //-------------------
+                      &pTrialPointResults[ ( size_t )t *
+                                           NUMBER_POINTS_PER_TRIAL ],
+                      pTrialTimingStatistics               [ t ],
+                      pTrialMaximumLatitudeErrorMicroArcSecs[ t ],
+                      pTrialMaximumAltitudeErrorNanoMeters  [ t ]
+                 );
+       //-----------------------------------------------------------------------
+          rAccumulator.maximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs =
+          max(
+               rAccumulator.
+               maximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs,
+               pTrialMaximumLatitudeErrorMicroArcSecs[ t ]
+             );
+          rAccumulator.maximumGeodeticAltitudeAbsoluteErrorNanoMeters =
+          max(
+               rAccumulator.maximumGeodeticAltitudeAbsoluteErrorNanoMeters,
+               pTrialMaximumAltitudeErrorNanoMeters[ t ]
+             );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+executeParallelTrialSweepConvertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const int    numberTrials,
+            const double startingEastGeocentricLongitudeDegrees,
+            const double deltaEastGeocentricLongitudeDegrees,
+            const size_t numberThreads,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+            TRIAL_POINT_RESULT
+                       * pTrialPointResults,
+            CONVERSION_TIMING_STATISTICS
+                       * pTrialTimingStatistics,
+            double     * pTrialMaximumLatitudeErrorMicroArcSecs,
+            double     * pTrialMaximumAltitudeErrorNanoMeters,
+            double     & rMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs,
+            double     & rMaximumGeodeticAltitudeAbsoluteErrorNanoMeters
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    executeParallelTrialSweepConvertEcefToGeodetic
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Run the numberTrials independent trials of a longitude sweep of
+//    'executeOneTrialConvertEcefToGeodetic' over numberThreads threads,
+//    with results identical to those of the serial sweep.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    [ 1 ] The trials are split into numberThreads contiguous ranges of
+//          nearly equal length; the calling thread runs the first range.
+//          Every trial has the same 32 conversions, so a static split is
+//          balanced and needs no synchronization but the final join.
+//
+//    [ 2 ] Each trial writes only its own slots of the preallocated
+//          buffers, which are therefore the same whatever the number of
+//          threads, and each thread keeps its running maxima in its own
+//          cache line aligned accumulator.
+//
+//    [ 3 ] After the join the accumulators are reduced in thread order.
+//
+//------------------------------------------------------------------------------
+//
+//  INPUTS:
+//
+//     numberTrials
+//       Number of trials; trial t is at longitude
+//       startingEastGeocentricLongitudeDegrees +
+//       t * deltaEastGeocentricLongitudeDegrees.
+//
+//     numberThreads
+//       Number of threads, limited to numberTrials; 0 means the number of
+//       hardware threads.
+//
+//------------------------------------------------------------------------------
+//
+//  OUTPUTS:
+//
+//     pTrialPointResults
+//       numberTrials * NUMBER_POINTS_PER_TRIAL point results.
+//
+//     pTrialTimingStatistics
+//     pTrialMaximumLatitudeErrorMicroArcSecs
+//     pTrialMaximumAltitudeErrorNanoMeters
+//       numberTrials timing statistics and maxima, one per trial.
+//
+//     rMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs
+//     rMaximumGeodeticAltitudeAbsoluteErrorNanoMeters
+//       The maxima over all trials.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The residuals and maxima are bit for bit those of the serial
+//          sweep.  The timings are not: threads sharing a core, or its
+//          caches, slow each other's trials.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    size_t
+     sweepThreads = ( numberThreads > 0 ) ?
+                    numberThreads :
+                    max( 1u, thread::hardware_concurrency( ) );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    sweepThreads = max( ( size_t )1,
+                        min( sweepThreads, ( size_t )max( 0, numberTrials ) ) );
+ //-----------------------------------------------------------------------------
+    vector< TRIAL_SWEEP_ACCUMULATOR > accumulators( sweepThreads );
+    vector< thread >                  sweepWorkers;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    sweepWorkers.reserve( sweepThreads - 1 );
+ //-----------------------------------------------------------------------------
+ // Range k is [ k n / T, ( k + 1 ) n / T ).
+ //-----------------------------------------------------------------------------
+    for( size_t k = sweepThreads - 1; k >= 1; k-- )
+      {
+          sweepWorkers.emplace_back
+                 (
+                   executeTrialSweepRange,
+                   ( int )(   k       * numberTrials / sweepThreads ),
+                   ( int )( ( k + 1 ) * numberTrials / sweepThreads ),
+                   startingEastGeocentricLongitudeDegrees,
+                   deltaEastGeocentricLongitudeDegrees,
+                   pTrialPointResults,
+                   pTrialTimingStatistics,
+                   pTrialMaximumLatitudeErrorMicroArcSecs,
+                   pTrialMaximumAltitudeErrorNanoMeters,
+                   ref( accumulators[ k ] )
+                 );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    executeTrialSweepRange
+           (
+             0,
+             ( int )( numberTrials / sweepThreads ),
+             startingEastGeocentricLongitudeDegrees,
+             deltaEastGeocentricLongitudeDegrees,
+             pTrialPointResults,
+             pTrialTimingStatistics,
+             pTrialMaximumLatitudeErrorMicroArcSecs,
+             pTrialMaximumAltitudeErrorNanoMeters,
+             accumulators[ 0 ]
+           );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( thread & rSweepWorker : sweepWorkers )
+      {
+          rSweepWorker.join( );
+      };
+ //-----------------------------------------------------------------------------
+ // Reduce the accumulators in thread order.
+ //-----------------------------------------------------------------------------
+    rMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs = 0.0;
+    rMaximumGeodeticAltitudeAbsoluteErrorNanoMeters        = 0.0;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t k = 0; k < sweepThreads; k++ )
+      {
+          rMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs =
+          max(
+               rMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs,
+               accumulators[ k ].
+               maximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs
+             );
+          rMaximumGeodeticAltitudeAbsoluteErrorNanoMeters =
+          max(
+               rMaximumGeodeticAltitudeAbsoluteErrorNanoMeters,
+               accumulators[ k ].maximumGeodeticAltitudeAbsoluteErrorNanoMeters
+             );
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,509 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+
+//------------------------------------------------------------------------------
+struct
+SCALAR_CLONE_TIMING_RUN_DATA
+  {
+    CONVERT_ECEF_TO_GEODETIC_FUNCTION    pConvertEcefToGeodetic;
+    CONVERT_GEODETIC_TO_ECEF_FUNCTION    pConvertGeodeticToEcef;
+    double                               earthEquatorialRadiusMeters;
+    double                               earthEllipsoidalFlatteningFactor;
+    double                               earthEllipsoidalEccentricitySquared;
+    size_t                               numberPoints;
+    const double                       * pXEcefMeters;
+    const double                       * pYEcefMeters;
+    const double                       * pZEcefMeters;
+    const double                       * pLatitudeRadians;
+    const double                       * pLongitudeRadians;
+    const double                       * pAltitudeMeters;
+    double                             * pOutput[ 3 ];
+    ECEF_TO_GEODETIC_CONVERSION_STATUS * pConversionStatus;
+  };
+
+//------------------------------------------------------------------------------
+// One timed run:  a caller loop of one inverse conversion per point, through
+// the clone or entry point of the run data.
+//------------------------------------------------------------------------------
+static
+void
+convertInverseCloneTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    SCALAR_CLONE_TIMING_RUN_DATA
+        & rRunData = *( SCALAR_CLONE_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    const
+    CONVERT_ECEF_TO_GEODETIC_FUNCTION
+     pConvert = rRunData.pConvertEcefToGeodetic;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const double a = rRunData.earthEquatorialRadiusMeters;
+    const double f = rRunData.earthEllipsoidalFlatteningFactor;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < rRunData.numberPoints; i++ )
+      {
+          rRunData.pConversionStatus[ i ] =
+          pConvert
+                 (
+                   a,
+                   f,
+                   rRunData.pXEcefMeters[ i ],
+                   rRunData.pYEcefMeters[ i ],
+                   rRunData.pZEcefMeters[ i ],
+                   rRunData.pOutput[ 0 ][ i ],
+                   rRunData.pOutput[ 1 ][ i ],
+                   rRunData.pOutput[ 2 ][ i ]
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run:  as 'convertInverseCloneTimingRun', for the forward
+// conversion.
+//------------------------------------------------------------------------------
+static
+void
+convertForwardCloneTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    SCALAR_CLONE_TIMING_RUN_DATA
+        & rRunData = *( SCALAR_CLONE_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    const
+    CONVERT_GEODETIC_TO_ECEF_FUNCTION
+     pConvert = rRunData.pConvertGeodeticToEcef;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const double a  = rRunData.earthEquatorialRadiusMeters;
+    const double e2 = rRunData.earthEllipsoidalEccentricitySquared;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < rRunData.numberPoints; i++ )
+      {
+          rRunData.pConversionStatus[ i ] =
+          pConvert
+                 (
+                   a,
+                   e2,
+                   rRunData.pLatitudeRadians [ i ],
+                   rRunData.pLongitudeRadians[ i ],
+                   rRunData.pAltitudeMeters  [ i ],
+                   rRunData.pOutput[ 0 ][ i ],
+                   rRunData.pOutput[ 1 ][ i ],
+                   rRunData.pOutput[ 2 ][ i ]
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+executeScalarCloneTimingConvertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const
+            int      numberPointsExponent
+         //-------------------
+         // OUTPUT(s):
+         //           NONE
+         //-------------------
+       )
+//==============================================================================
+//|
+//| FUNCTION:
+//|
+//|   executeScalarCloneTimingConvertEcefToGeodetic
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| PURPOSE:
+//|
+//|   To report, for each clone of the scalar 'convertEcefToGeodetic' and
+//|   'convertGeodeticToEcef' which the host supports, and for the entry
+//|   points themselves as bound at load time, the execution time per
+//|   point in a caller loop, the speedup over the baseline x86-64 clone,
+//|   and the largest errors against the full accuracy tier bounds.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| INPUT(s):
+//|
+//|   numberPointsExponent
+//|     The base ten exponent of the number of points.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| METHOD:
+//|
+//|   [ 1 ]  Generate 10^numberPointsExponent true geodetic points, with
+//|          uniform latitude and longitude and altitudes from -10 km to
+//|          50000 km, evenly spaced in asinh( h / 1 km ), every 97th on a
+//|          pole, and their ECEF coordinates from the baseline clone.
+//|
+//|   [ 2 ]  Time each caller loop with 'measureConversionTiming'.  Every
+//|          loop calls through a function pointer, as a caller of the
+//|          entry point does through its indirect function binding.
+//|
+//|   [ 3 ]  The inverse latitude and altitude errors are against the true
+//|          geodetic points, the forward coordinate error against the
+//|          baseline clone; all are checked against
+//|          FULL_ACCURACY_TIER_ANGLE_BOUND_RADIANS and
+//|          FULL_ACCURACY_TIER_ALTITUDE_BOUND_METERS.
+//|
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const
+    double
+     piRadians                           = 4.0 * atan( 1.0 );
+    const
+    double
+     microArcSecondsPerRadian            = 180.0 * 3600.0E6 / piRadians;
+    const
+    double
+     nanoMetersPerMeter                  = 1.0E9;
+ //-----------------------------------------------------------------------------
+ //
+ // GRS1980 System
+ //
+ //-----------------------------------------------------------------------------
+    const
+    double
+     earthEquatorialRadiusMeters         = 6378137.0E0;
+    const
+    double
+     earthEllipsoidalFlatteningFactor    = 1.0E0 / 298.257222101E0;
+    const
+    double
+     earthEllipsoidalEccentricitySquared =
+                         ( 2.0E0 - earthEllipsoidalFlatteningFactor )
+                         *
+                         earthEllipsoidalFlatteningFactor;
+ //-----------------------------------------------------------------------------
+    const
+    int
+     NUMBER_WARM_UP_RUNS = 1;
+    const
+    int
+     NUMBER_TIMED_RUNS   = 7;
+ //-----------------------------------------------------------------------------
+ // The clones, in increasing level, and the entry points.
+ //-----------------------------------------------------------------------------
+    const
+    int
+     NUMBER_CLONES = 3;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    char *
+     cloneNames[ NUMBER_CLONES + 1 ] = { "baseline x86-64",
+                                         "x86-64-v3",
+                                         "x86-64-v4",
+                                         "entry point" };
+    const
+    CONVERT_ECEF_TO_GEODETIC_FUNCTION
+     inverseClones[ NUMBER_CLONES + 1 ] =
+                            { convertEcefToGeodeticBaselineClone,
+                              convertEcefToGeodeticX8664V3Clone,
+                              convertEcefToGeodeticX8664V4Clone,
+                              convertEcefToGeodetic };
+    const
+    CONVERT_GEODETIC_TO_ECEF_FUNCTION
+     forwardClones[ NUMBER_CLONES + 1 ] =
+                            { convertGeodeticToEcefBaselineClone,
+                              convertGeodeticToEcefX8664V3Clone,
+                              convertGeodeticToEcefX8664V4Clone,
+                              convertGeodeticToEcef };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    int
+     supportedCloneLevel = ( int )detectEcefToGeodeticScalarCloneLevel( );
+ //-----------------------------------------------------------------------------
+    size_t
+     numberPoints = 1;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int exponent = 0; exponent < numberPointsExponent; exponent++ )
+      {
+          numberPoints = 10 * numberPoints;
+      };
+ //-----------------------------------------------------------------------------
+ // Generate the true geodetic points and their ECEF coordinates.
+ //-----------------------------------------------------------------------------
+    vector< double > latitudeRadians ( numberPoints );
+    vector< double > longitudeRadians( numberPoints );
+    vector< double > altitudeMeters  ( numberPoints );
+    vector< double > xEcefMeters     ( numberPoints );
+    vector< double > yEcefMeters     ( numberPoints );
+    vector< double > zEcefMeters     ( numberPoints );
+    vector< double > output          ( 3 * numberPoints );
+    vector< ECEF_TO_GEODETIC_CONVERSION_STATUS >
+                     conversionStatus( numberPoints );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    generateTimingGeodeticPoints
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalEccentricitySquared,
+             -1.0E4,
+             5.0E7,
+             ASINH_TIMING_ALTITUDE_SPACING,
+             97,
+             numberPoints,
+             latitudeRadians .data( ),
+             longitudeRadians.data( ),
+             altitudeMeters  .data( ),
+             xEcefMeters     .data( ),
+             yEcefMeters     .data( ),
+             zEcefMeters     .data( ),
+             NULL
+           );
+ //-----------------------------------------------------------------------------
+    SCALAR_CLONE_TIMING_RUN_DATA
+     runData;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    runData.earthEquatorialRadiusMeters         = earthEquatorialRadiusMeters;
+    runData.earthEllipsoidalFlatteningFactor    =
+                                         earthEllipsoidalFlatteningFactor;
+    runData.earthEllipsoidalEccentricitySquared =
+                                         earthEllipsoidalEccentricitySquared;
+    runData.numberPoints                        = numberPoints;
+    runData.pXEcefMeters                        = xEcefMeters     .data( );
+    runData.pYEcefMeters                        = yEcefMeters     .data( );
+    runData.pZEcefMeters                        = zEcefMeters     .data( );
+    runData.pLatitudeRadians                    = latitudeRadians .data( );
+    runData.pLongitudeRadians                   = longitudeRadians.data( );
+    runData.pAltitudeMeters                     = altitudeMeters  .data( );
+    runData.pConversionStatus                   = conversionStatus.data( );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int k = 0; k < 3; k++ )
+      {
+          runData.pOutput[ k ] = output.data( ) + k * numberPoints;
+      };
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "\n\n\n"
+       "%s%s\n"
+       "%s\n%s\n%s\n"
+       "%s%zu%s\n"
+       "%s%s\n"
+       "%s\n"
+       "%s%s\n"
+       "%s%s\n"
+       "%s%s\n"
+       "%s%s\n",
+       "============================================",
+       "============================================",
+       "|",
+       "| SCALAR CLONE TIMING RESULTS:",
+       "|",
+       "|    ",
+       numberPoints,
+       " points from -10 km to 50000 km altitude",
+       "|    Entry points bound to the clone:  ",
+       cloneNames[ supportedCloneLevel ],
+       "|",
+       "|-------------------------------------------",
+       "--------------------------------------------",
+       "|    Clone                  [ns/point]     MAD  Speedup   Lat err",
+       "  Alt err",
+       "|                                                           [uas]",
+       "     [nm]",
+       "|-------------------------------------------",
+       "--------------------------------------------"
+     );
+ //-----------------------------------------------------------------------------
+ // ECEF to geodetic.
+ //-----------------------------------------------------------------------------
+    fprintf( stdout, "|\n|  ECEF to geodetic:\n" );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    double
+     referenceNanoSecondsPerPoint = NAN;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int clone = 0; clone <= NUMBER_CLONES; clone++ )
+      {
+       //-----------------------------------------------------------------------
+          if( ( clone < NUMBER_CLONES ) && ( clone > supportedCloneLevel ) )
+            {
+               fprintf( stdout, "|    %-22s %10s\n",
+                        cloneNames[ clone ], "not supported" );
+               continue;
+            };
+       //-----------------------------------------------------------------------
+          CONVERSION_TIMING_STATISTICS
+           cloneTiming;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          runData.pConvertEcefToGeodetic = inverseClones[ clone ];
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          measureConversionTiming
+                 (
+                   convertInverseCloneTimingRun,
+                   &runData,
+                   numberPoints,
+                   NUMBER_WARM_UP_RUNS,
+                   NUMBER_TIMED_RUNS,
+                   cloneTiming
+                 );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( clone == 0 )
+            {
+               referenceNanoSecondsPerPoint =
+                                   cloneTiming.medianNanoSecondsPerPoint;
+            };
+       //-----------------------------------------------------------------------
+          double maximumLatitudeErrorRadians = 0.0;
+          double maximumAltitudeErrorMeters  = 0.0;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+               if( conversionStatus[ i ] != SUCCESSFUL_CONVERSION )
+                 {
+                    maximumLatitudeErrorRadians = INFINITY;
+                    maximumAltitudeErrorMeters  = INFINITY;
+                    continue;
+                 };
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               maximumLatitudeErrorRadians =
+               max( maximumLatitudeErrorRadians,
+                    fabs( runData.pOutput[ 0 ][ i ] - latitudeRadians[ i ] ) );
+               maximumAltitudeErrorMeters  =
+               max( maximumAltitudeErrorMeters,
+                    fabs( runData.pOutput[ 2 ][ i ] - altitudeMeters[ i ] ) );
+            };
+       //-----------------------------------------------------------------------
+          const bool isWithinBounds =
+                       ( maximumLatitudeErrorRadians <=
+                         FULL_ACCURACY_TIER_ANGLE_BOUND_RADIANS   ) &&
+                       ( maximumAltitudeErrorMeters  <=
+                         FULL_ACCURACY_TIER_ALTITUDE_BOUND_METERS );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          fprintf
+           (
+             stdout,
+             "|    %-22s %10.3f %7.3f %8.2f %9.3f %8.3f%s\n",
+             cloneNames[ clone ],
+             cloneTiming.medianNanoSecondsPerPoint,
+             cloneTiming.madNanoSecondsPerPoint,
+             referenceNanoSecondsPerPoint /
+             cloneTiming.medianNanoSecondsPerPoint,
+             maximumLatitudeErrorRadians * microArcSecondsPerRadian,
+             maximumAltitudeErrorMeters  * nanoMetersPerMeter,
+             isWithinBounds ? "" : "  EXCEEDED"
+           );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+ // Geodetic to ECEF.  The largest coordinate difference from the baseline
+ // clone is reported in the altitude column.
+ //-----------------------------------------------------------------------------
+    fprintf( stdout, "|\n|  Geodetic to ECEF, largest coordinate error:\n" );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int clone = 0; clone <= NUMBER_CLONES; clone++ )
+      {
+       //-----------------------------------------------------------------------
+          if( ( clone < NUMBER_CLONES ) && ( clone > supportedCloneLevel ) )
+            {
+               fprintf( stdout, "|    %-22s %10s\n",
+                        cloneNames[ clone ], "not supported" );
+               continue;
+            };
+       //-----------------------------------------------------------------------
+          CONVERSION_TIMING_STATISTICS
+           cloneTiming;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          runData.pConvertGeodeticToEcef = forwardClones[ clone ];
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          measureConversionTiming
+                 (
+                   convertForwardCloneTimingRun,
+                   &runData,
+                   numberPoints,
+                   NUMBER_WARM_UP_RUNS,
+                   NUMBER_TIMED_RUNS,
+                   cloneTiming
+                 );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( clone == 0 )
+            {
+               referenceNanoSecondsPerPoint =
+                                   cloneTiming.medianNanoSecondsPerPoint;
+            };
+       //-----------------------------------------------------------------------
+          double maximumCoordinateErrorMeters = 0.0;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+               if( conversionStatus[ i ] != SUCCESSFUL_CONVERSION )
+                 {
+                    maximumCoordinateErrorMeters = INFINITY;
+                    continue;
+                 };
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               maximumCoordinateErrorMeters =
+               max( maximumCoordinateErrorMeters,
+                    max( fabs( runData.pOutput[ 0 ][ i ] - xEcefMeters[ i ] ),
+                         max( fabs( runData.pOutput[ 1 ][ i ] -
+                                    yEcefMeters[ i ] ),
+                              fabs( runData.pOutput[ 2 ][ i ] -
+                                    zEcefMeters[ i ] ) ) ) );
+            };
+       //-----------------------------------------------------------------------
+          fprintf
+           (
+             stdout,
+             "|    %-22s %10.3f %7.3f %8.2f %9s %8.3f%s\n",
+             cloneNames[ clone ],
+             cloneTiming.medianNanoSecondsPerPoint,
+             cloneTiming.madNanoSecondsPerPoint,
+             referenceNanoSecondsPerPoint /
+             cloneTiming.medianNanoSecondsPerPoint,
+             "",
+             maximumCoordinateErrorMeters * nanoMetersPerMeter,
+             ( maximumCoordinateErrorMeters <=
+               FULL_ACCURACY_TIER_ALTITUDE_BOUND_METERS ) ? "" : "  EXCEEDED"
+           );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "%s\n"
+       "%s%s\n"
+       "\n\n\n",
+       "|",
+       "============================================",
+       "============================================"
+     );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
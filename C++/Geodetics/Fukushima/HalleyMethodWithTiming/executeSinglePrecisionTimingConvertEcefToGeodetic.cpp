@@ -0,0 +1,605 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+
+//------------------------------------------------------------------------------
+struct
+SINGLE_PRECISION_TIMING_RUN_DATA
+  {
+    const EARTH_ELLIPSOID_CONTEXT      * pEllipsoidContext;
+    size_t                               numberPoints;
+    const double                       * pXEcefMeters;
+    const double                       * pYEcefMeters;
+    const double                       * pZEcefMeters;
+    const double                       * pTrueLatitudeRadians;
+    const double                       * pTrueLongitudeRadians;
+    const double                       * pTrueAltitudeMeters;
+    double                             * pGeodeticNorthLatitudeRadians;
+    double                             * pGeocentricEastLongitudeRadians;
+    double                             * pGeodeticAltitudeMeters;
+    double                             * pOutputXEcefMeters;
+    double                             * pOutputYEcefMeters;
+    double                             * pOutputZEcefMeters;
+    ECEF_TO_GEODETIC_CONVERSION_STATUS * pConversionStatus;
+  };
+
+//------------------------------------------------------------------------------
+// One timed run: the double ellipsoid context batch.
+//------------------------------------------------------------------------------
+static
+void
+convertInverseDoubleTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    SINGLE_PRECISION_TIMING_RUN_DATA
+        & rRunData = *( SINGLE_PRECISION_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticBatch
+           (
+             *rRunData.pEllipsoidContext,
+             rRunData.numberPoints,
+             rRunData.pXEcefMeters,
+             rRunData.pYEcefMeters,
+             rRunData.pZEcefMeters,
+             rRunData.pGeodeticNorthLatitudeRadians,
+             rRunData.pGeocentricEastLongitudeRadians,
+             rRunData.pGeodeticAltitudeMeters,
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: the double survey tier batch, the same Halley step and
+// polynomial atan2 as the single precision batch.
+//------------------------------------------------------------------------------
+static
+void
+convertInverseSurveyTierTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    SINGLE_PRECISION_TIMING_RUN_DATA
+        & rRunData = *( SINGLE_PRECISION_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticBatch
+           (
+             *rRunData.pEllipsoidContext,
+             SURVEY_ACCURACY_TIER,
+             rRunData.numberPoints,
+             rRunData.pXEcefMeters,
+             rRunData.pYEcefMeters,
+             rRunData.pZEcefMeters,
+             rRunData.pGeodeticNorthLatitudeRadians,
+             rRunData.pGeocentricEastLongitudeRadians,
+             rRunData.pGeodeticAltitudeMeters,
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: the single precision inverse batch.
+//------------------------------------------------------------------------------
+static
+void
+convertInverseSingleTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    SINGLE_PRECISION_TIMING_RUN_DATA
+        & rRunData = *( SINGLE_PRECISION_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticBatchInSinglePrecision
+           (
+             *rRunData.pEllipsoidContext,
+             rRunData.numberPoints,
+             rRunData.pXEcefMeters,
+             rRunData.pYEcefMeters,
+             rRunData.pZEcefMeters,
+             rRunData.pGeodeticNorthLatitudeRadians,
+             rRunData.pGeocentricEastLongitudeRadians,
+             rRunData.pGeodeticAltitudeMeters,
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: the double forward batch.
+//------------------------------------------------------------------------------
+static
+void
+convertForwardDoubleTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    SINGLE_PRECISION_TIMING_RUN_DATA
+        & rRunData = *( SINGLE_PRECISION_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    ( void )
+    convertGeodeticToEcefBatch
+           (
+             rRunData.pEllipsoidContext->earthEquatorialRadiusMeters,
+             rRunData.pEllipsoidContext->earthEllipticitySquared,
+             rRunData.numberPoints,
+             rRunData.pTrueLatitudeRadians,
+             rRunData.pTrueLongitudeRadians,
+             rRunData.pTrueAltitudeMeters,
+             rRunData.pOutputXEcefMeters,
+             rRunData.pOutputYEcefMeters,
+             rRunData.pOutputZEcefMeters,
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: the single precision forward batch.
+//------------------------------------------------------------------------------
+static
+void
+convertForwardSingleTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    SINGLE_PRECISION_TIMING_RUN_DATA
+        & rRunData = *( SINGLE_PRECISION_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    ( void )
+    convertGeodeticToEcefBatchInSinglePrecision
+           (
+             *rRunData.pEllipsoidContext,
+             rRunData.numberPoints,
+             rRunData.pTrueLatitudeRadians,
+             rRunData.pTrueLongitudeRadians,
+             rRunData.pTrueAltitudeMeters,
+             rRunData.pOutputXEcefMeters,
+             rRunData.pOutputYEcefMeters,
+             rRunData.pOutputZEcefMeters,
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+executeSinglePrecisionTimingConvertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const
+            int      numberPointsExponent
+         //-------------------
+         // OUTPUT(s):
+         //           NONE
+         //-------------------
+       )
+//==============================================================================
+//|
+//| FUNCTION:
+//|
+//|   executeSinglePrecisionTimingConvertEcefToGeodetic
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| PURPOSE:
+//|
+//|   To compare the execution time per point of
+//|   'convertEcefToGeodeticBatchInSinglePrecision' with that of the double
+//|   ellipsoid context and survey tier batches, and of
+//|   'convertGeodeticToEcefBatchInSinglePrecision' with that of
+//|   'convertGeodeticToEcefBatch', and to report the largest errors of
+//|   each against the error bounds of the single precision batches.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| INPUT(s):
+//|
+//|   numberPointsExponent
+//|     The base ten exponent of the number of points.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| METHOD:
+//|
+//|   [ 1 ]  Generate 10^numberPointsExponent true geodetic points, with
+//|          uniform latitude and longitude and low Earth orbit altitudes,
+//|          from -10 km to 2000 km, evenly spaced in asinh( h / 1 km ).
+//|          Every 97th point is put on a pole.  Their ECEF coordinates
+//|          from the scalar 'convertGeodeticToEcef' are the true
+//|          coordinates of the forward conversion.
+//|
+//|   [ 2 ]  Time each batch with 'measureConversionTiming'.
+//|
+//|   [ 3 ]  The latitude and longitude errors are in micro arc seconds,
+//|          the longitude error scaled by the cosine of the latitude, the
+//|          altitude and coordinate errors in millimeters.  A point which
+//|          is not converted counts as an infinite error.
+//|
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const
+    double
+     piRadians                           = 4.0 * atan( 1.0 );
+    const
+    double
+     microArcSecondsPerRadian            = 180.0 * 3600.0E6 / piRadians;
+ //-----------------------------------------------------------------------------
+ //
+ // GRS1980 System
+ //
+ //-----------------------------------------------------------------------------
+    const
+    double
+     earthEquatorialRadiusMeters         = 6378137.0E0;
+    const
+    double
+     earthEllipsoidalFlatteningFactor    = 1.0E0 / 298.257222101E0;
+    const
+    double
+     earthEllipsoidalEccentricitySquared =
+                         ( 2.0E0 - earthEllipsoidalFlatteningFactor )
+                         *
+                         earthEllipsoidalFlatteningFactor;
+ //-----------------------------------------------------------------------------
+    const
+    int
+     NUMBER_WARM_UP_RUNS = 1;
+    const
+    int
+     NUMBER_TIMED_RUNS   = 7;
+ //-----------------------------------------------------------------------------
+    EARTH_ELLIPSOID_CONTEXT
+     ellipsoidContext;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    ( void )
+    initializeEarthEllipsoidContext
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalFlatteningFactor,
+             ellipsoidContext
+           );
+ //-----------------------------------------------------------------------------
+    size_t
+     numberPoints = 1;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int exponent = 0; exponent < numberPointsExponent; exponent++ )
+      {
+          numberPoints = 10 * numberPoints;
+      };
+ //-----------------------------------------------------------------------------
+ // Generate the true geodetic points and their ECEF coordinates.
+ //-----------------------------------------------------------------------------
+    vector< double > trueLatitudeRadians ( numberPoints );
+    vector< double > trueLongitudeRadians( numberPoints );
+    vector< double > trueAltitudeMeters  ( numberPoints );
+    vector< double > xEcefMeters         ( numberPoints );
+    vector< double > yEcefMeters         ( numberPoints );
+    vector< double > zEcefMeters         ( numberPoints );
+    vector< double > latitudeRadians     ( numberPoints );
+    vector< double > longitudeRadians    ( numberPoints );
+    vector< double > altitudeMeters      ( numberPoints );
+    vector< double > outputXEcefMeters   ( numberPoints );
+    vector< double > outputYEcefMeters   ( numberPoints );
+    vector< double > outputZEcefMeters   ( numberPoints );
+    vector< ECEF_TO_GEODETIC_CONVERSION_STATUS >
+                     conversionStatus    ( numberPoints );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    generateTimingGeodeticPoints
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalEccentricitySquared,
+             -1.0E4,
+             2.0E6,
+             ASINH_TIMING_ALTITUDE_SPACING,
+             97,
+             numberPoints,
+             trueLatitudeRadians .data( ),
+             trueLongitudeRadians.data( ),
+             trueAltitudeMeters  .data( ),
+             xEcefMeters         .data( ),
+             yEcefMeters         .data( ),
+             zEcefMeters         .data( ),
+             NULL
+           );
+ //-----------------------------------------------------------------------------
+    SINGLE_PRECISION_TIMING_RUN_DATA
+     runData;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    runData.pEllipsoidContext               = &ellipsoidContext;
+    runData.numberPoints                    = numberPoints;
+    runData.pXEcefMeters                    = xEcefMeters         .data( );
+    runData.pYEcefMeters                    = yEcefMeters         .data( );
+    runData.pZEcefMeters                    = zEcefMeters         .data( );
+    runData.pTrueLatitudeRadians            = trueLatitudeRadians .data( );
+    runData.pTrueLongitudeRadians           = trueLongitudeRadians.data( );
+    runData.pTrueAltitudeMeters             = trueAltitudeMeters  .data( );
+    runData.pGeodeticNorthLatitudeRadians   = latitudeRadians     .data( );
+    runData.pGeocentricEastLongitudeRadians = longitudeRadians    .data( );
+    runData.pGeodeticAltitudeMeters         = altitudeMeters      .data( );
+    runData.pOutputXEcefMeters              = outputXEcefMeters   .data( );
+    runData.pOutputYEcefMeters              = outputYEcefMeters   .data( );
+    runData.pOutputZEcefMeters              = outputZEcefMeters   .data( );
+    runData.pConversionStatus               = conversionStatus    .data( );
+ //-----------------------------------------------------------------------------
+ // The first batch of each direction is the reference of the speedups;
+ // the last is the single precision batch, checked against its bounds.
+ //-----------------------------------------------------------------------------
+    const
+    char *
+     inverseNames[ 3 ]      = { "double, context",
+                                "double, survey tier",
+                                "float" };
+    void
+     ( *inverseRuns[ 3 ] )( void * ) = { convertInverseDoubleTimingRun,
+                                         convertInverseSurveyTierTimingRun,
+                                         convertInverseSingleTimingRun };
+    const
+    char *
+     forwardNames[ 2 ]      = { "double",
+                                "float" };
+    void
+     ( *forwardRuns[ 2 ] )( void * ) = { convertForwardDoubleTimingRun,
+                                         convertForwardSingleTimingRun };
+ //-----------------------------------------------------------------------------
+ // Report header.
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "\n\n\n"
+       "%s%s\n"
+       "%s\n%s\n%s\n"
+       "%s%zu%s\n"
+       "%s%.1f%s%.4f%s\n"
+       "%s%.1f%s\n"
+       "%s\n"
+       "%s%s\n"
+       "%s%s\n"
+       "%s%s\n"
+       "%s%s\n",
+       "============================================",
+       "============================================",
+       "|",
+       "| SINGLE PRECISION TIMING RESULTS:",
+       "|",
+       "|    ",
+       numberPoints,
+       " points from -10 km to 2000 km altitude",
+       "|    Bounds:  ",
+       SINGLE_PRECISION_ANGLE_BOUND_RADIANS * microArcSecondsPerRadian,
+       " uas angle, ",
+       SINGLE_PRECISION_ALTITUDE_BOUND_METERS * 1000.0,
+       " mm altitude,",
+       "|             ",
+       SINGLE_PRECISION_FORWARD_BOUND_METERS * 1000.0,
+       " mm forward coordinate",
+       "|",
+       "|-------------------------------------------",
+       "--------------------------------------------",
+       "|    Batch                  [ns/point]     MAD  Speedup   Lat err",
+       "   Lon err  Alt err",
+       "|                                                           [uas]",
+       "     [uas]     [mm]",
+       "|-------------------------------------------",
+       "--------------------------------------------"
+     );
+ //-----------------------------------------------------------------------------
+ // ECEF to geodetic.
+ //-----------------------------------------------------------------------------
+    fprintf( stdout, "|\n|  ECEF to geodetic:\n" );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    double
+     referenceNanoSecondsPerPoint = NAN;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int batch = 0; batch < 3; batch++ )
+      {
+       //-----------------------------------------------------------------------
+          CONVERSION_TIMING_STATISTICS
+           batchTiming;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          measureConversionTiming
+                 (
+                   inverseRuns[ batch ],
+                   &runData,
+                   numberPoints,
+                   NUMBER_WARM_UP_RUNS,
+                   NUMBER_TIMED_RUNS,
+                   batchTiming
+                 );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( batch == 0 )
+            {
+               referenceNanoSecondsPerPoint =
+                                   batchTiming.medianNanoSecondsPerPoint;
+            };
+       //-----------------------------------------------------------------------
+          double maximumLatitudeErrorRadians  = 0.0;
+          double maximumLongitudeErrorRadians = 0.0;
+          double maximumAltitudeErrorMeters   = 0.0;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+               if( conversionStatus[ i ] != SUCCESSFUL_CONVERSION )
+                 {
+                    maximumLatitudeErrorRadians  = INFINITY;
+                    maximumLongitudeErrorRadians = INFINITY;
+                    maximumAltitudeErrorMeters   = INFINITY;
+                    continue;
+                 };
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               double longitudeError = fabs( longitudeRadians    [ i ] -
+                                             trueLongitudeRadians[ i ] );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               longitudeError = min( longitudeError,
+                                     2.0 * piRadians - longitudeError ) *
+                                cos( trueLatitudeRadians[ i ] );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               maximumLatitudeErrorRadians  =
+               max( maximumLatitudeErrorRadians,
+                    fabs( latitudeRadians    [ i ] -
+                          trueLatitudeRadians[ i ] ) );
+               maximumLongitudeErrorRadians =
+               max( maximumLongitudeErrorRadians, longitudeError );
+               maximumAltitudeErrorMeters   =
+               max( maximumAltitudeErrorMeters,
+                    fabs( altitudeMeters    [ i ] -
+                          trueAltitudeMeters[ i ] ) );
+            };
+       //-----------------------------------------------------------------------
+          const bool isWithinBounds =
+                       ( maximumLatitudeErrorRadians  <=
+                         SINGLE_PRECISION_ANGLE_BOUND_RADIANS   ) &&
+                       ( maximumLongitudeErrorRadians <=
+                         SINGLE_PRECISION_ANGLE_BOUND_RADIANS   ) &&
+                       ( maximumAltitudeErrorMeters   <=
+                         SINGLE_PRECISION_ALTITUDE_BOUND_METERS );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          fprintf
+           (
+             stdout,
+             "|    %-22s %10.3f %7.3f %8.2f %9.1f %9.1f %8.4f%s\n",
+             inverseNames[ batch ],
+             batchTiming.medianNanoSecondsPerPoint,
+             batchTiming.madNanoSecondsPerPoint,
+             referenceNanoSecondsPerPoint /
+             batchTiming.medianNanoSecondsPerPoint,
+             maximumLatitudeErrorRadians  * microArcSecondsPerRadian,
+             maximumLongitudeErrorRadians * microArcSecondsPerRadian,
+             maximumAltitudeErrorMeters   * 1000.0,
+             ( ( batch < 2 ) || isWithinBounds ) ? "" : "  EXCEEDED"
+           );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+ // Geodetic to ECEF.  The largest error of the three coordinates is
+ // reported in the altitude column.
+ //-----------------------------------------------------------------------------
+    fprintf( stdout, "|\n|  Geodetic to ECEF, largest coordinate error:\n" );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int batch = 0; batch < 2; batch++ )
+      {
+       //-----------------------------------------------------------------------
+          CONVERSION_TIMING_STATISTICS
+           batchTiming;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          measureConversionTiming
+                 (
+                   forwardRuns[ batch ],
+                   &runData,
+                   numberPoints,
+                   NUMBER_WARM_UP_RUNS,
+                   NUMBER_TIMED_RUNS,
+                   batchTiming
+                 );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( batch == 0 )
+            {
+               referenceNanoSecondsPerPoint =
+                                   batchTiming.medianNanoSecondsPerPoint;
+            };
+       //-----------------------------------------------------------------------
+          double maximumCoordinateErrorMeters = 0.0;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+               if( conversionStatus[ i ] != SUCCESSFUL_CONVERSION )
+                 {
+                    maximumCoordinateErrorMeters = INFINITY;
+                    continue;
+                 };
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               maximumCoordinateErrorMeters =
+               max( maximumCoordinateErrorMeters,
+                    max( fabs( outputXEcefMeters[ i ] - xEcefMeters[ i ] ),
+                         max( fabs( outputYEcefMeters[ i ] -
+                                    yEcefMeters[ i ] ),
+                              fabs( outputZEcefMeters[ i ] -
+                                    zEcefMeters[ i ] ) ) ) );
+            };
+       //-----------------------------------------------------------------------
+          fprintf
+           (
+             stdout,
+             "|    %-22s %10.3f %7.3f %8.2f %9s %9s %8.4f%s\n",
+             forwardNames[ batch ],
+             batchTiming.medianNanoSecondsPerPoint,
+             batchTiming.madNanoSecondsPerPoint,
+             referenceNanoSecondsPerPoint /
+             batchTiming.medianNanoSecondsPerPoint,
+             "",
+             "",
+             maximumCoordinateErrorMeters * 1000.0,
+             (
+               ( batch == 0 ) ||
+               ( maximumCoordinateErrorMeters <=
+                 SINGLE_PRECISION_FORWARD_BOUND_METERS )
+             ) ? "" : "  EXCEEDED"
+           );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "%s\n"
+       "%s%s\n"
+       "\n\n\n",
+       "|",
+       "============================================",
+       "============================================"
+     );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
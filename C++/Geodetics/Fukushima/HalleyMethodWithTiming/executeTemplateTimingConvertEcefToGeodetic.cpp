@@ -0,0 +1,542 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+#include "convertEcefToGeodeticForEllipsoid.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+   using namespace std::chrono;
+
+//------------------------------------------------------------------------------
+void
+executeTemplateTimingConvertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const
+            int      numberPointsExponent
+         //-------------------
+         // OUTPUT(s):
+         //           NONE
+         //-------------------
+       )
+//==============================================================================
+//|
+//| FUNCTION:
+//|
+//|   executeTemplateTimingConvertEcefToGeodetic
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| PURPOSE:
+//|
+//|   To compare the runtime parameter kernels with the compile time
+//|   ellipsoid kernels of 'convertEcefToGeodeticForEllipsoid.h':
+//|
+//|     Parameters:  'convertEcefToGeodetic' and 'convertGeodeticToEcef'
+//|                  called with the ellipsoid parameters.
+//|
+//|     Context:     The ellipsoid context overloads.
+//|
+//|     Template:    'convertEcefToGeodeticForEllipsoid' and
+//|                  'convertGeodeticToEcefForEllipsoid', inlined into the
+//|                  timing loop with the ellipsoid constants folded.
+//|
+//|   GRS80 points are converted on all three paths, and points about a
+//|   sphere are converted by the parameter kernels with a zero flattening
+//|   factor and by the sphere specialization.  The execution time per point
+//|   of each path is reported, together with the largest difference between
+//|   the template and parameter results.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| INPUT(s):
+//|
+//|   numberPointsExponent
+//|     The base ten exponent of the number of points.
+//|
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const
+    double
+     piRadians                     = 4.0 * atan( 1.0 );
+    const
+    double
+     microArcSecondsPerRadian      = ( 180.0 / piRadians ) * 3600.0 * 1.0E6;
+    const
+    double
+     nanoMetersPerMeter            = 1.0E9;
+ //-----------------------------------------------------------------------------
+ // Runtime copies of the compile time ellipsoids, passed to the parameter
+ // kernels.  'volatile' keeps the compiler from propagating them into the
+ // out-of-line calls, which it cannot do for a real caller either.
+ //-----------------------------------------------------------------------------
+    typedef ELLIPSOID_CONSTANTS< GRS80_ELLIPSOID  > GRS80;
+    typedef ELLIPSOID_CONSTANTS< SPHERE_ELLIPSOID > SPHERE;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    volatile double volatileGrs80Radius     =
+                                        GRS80::earthEquatorialRadiusMeters;
+    volatile double volatileGrs80Flattening =
+                                        GRS80::earthEllipsoidalFlatteningFactor;
+    volatile double volatileSphereRadius    =
+                                        SPHERE::earthEquatorialRadiusMeters;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    double
+     earthEquatorialRadiusMeters         = volatileGrs80Radius;
+    const
+    double
+     earthEllipsoidalFlatteningFactor    = volatileGrs80Flattening;
+    const
+    double
+     earthEllipsoidalEccentricitySquared =
+                         ( 2.0E0 - earthEllipsoidalFlatteningFactor )
+                         *
+                         earthEllipsoidalFlatteningFactor;
+    const
+    double
+     sphereRadiusMeters                  = volatileSphereRadius;
+ //-----------------------------------------------------------------------------
+    const
+    size_t
+     MINIMUM_POINTS_PER_PATH = 10000000;
+ //-----------------------------------------------------------------------------
+    size_t
+     numberPoints = 1;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int exponent = 0; exponent < numberPointsExponent; exponent++ )
+      {
+          numberPoints = 10 * numberPoints;
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    size_t
+     numberRepetitions = max(
+                              ( size_t )1,
+                              MINIMUM_POINTS_PER_PATH / numberPoints
+                            );
+ //-----------------------------------------------------------------------------
+    EARTH_ELLIPSOID_CONTEXT
+     ellipsoidContext;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    ( void )
+    initializeEarthEllipsoidContext
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalFlatteningFactor,
+             ellipsoidContext
+           );
+ //-----------------------------------------------------------------------------
+ // Generate the geodetic points.
+ //-----------------------------------------------------------------------------
+    vector< double > latitudeRadians        ( numberPoints );
+    vector< double > longitudeRadians       ( numberPoints );
+    vector< double > altitudeMeters         ( numberPoints );
+    vector< double > xEcefMeters            ( numberPoints );
+    vector< double > yEcefMeters            ( numberPoints );
+    vector< double > zEcefMeters            ( numberPoints );
+    vector< double > xSphereMeters          ( numberPoints );
+    vector< double > ySphereMeters          ( numberPoints );
+    vector< double > zSphereMeters          ( numberPoints );
+    vector< double > templateXEcefMeters    ( numberPoints );
+    vector< double > templateYEcefMeters    ( numberPoints );
+    vector< double > templateZEcefMeters    ( numberPoints );
+    vector< double > estimatedLatitude      ( numberPoints );
+    vector< double > estimatedLongitude     ( numberPoints );
+    vector< double > estimatedAltitude      ( numberPoints );
+    vector< double > templateLatitude       ( numberPoints );
+    vector< double > templateLongitude      ( numberPoints );
+    vector< double > templateAltitude       ( numberPoints );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    generateTimingGeodeticPoints
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalEccentricitySquared,
+             -1.0E4,
+             3.0E6,
+             UNIFORM_TIMING_ALTITUDE_SPACING,
+             0,
+             numberPoints,
+             latitudeRadians .data( ),
+             longitudeRadians.data( ),
+             altitudeMeters  .data( ),
+             NULL,
+             NULL,
+             NULL,
+             NULL
+           );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t i = 0; i < numberPoints; i++ )
+      {
+          const double r = ( sphereRadiusMeters + altitudeMeters[ i ] ) *
+                           cos( latitudeRadians[ i ] );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          xSphereMeters[ i ] = r * cos( longitudeRadians[ i ] );
+          ySphereMeters[ i ] = r * sin( longitudeRadians[ i ] );
+          zSphereMeters[ i ] = ( sphereRadiusMeters + altitudeMeters[ i ] ) *
+                               sin( latitudeRadians[ i ] );
+      };
+ //=============================================================================
+ //
+ // GRS80 geodetic to ECEF.
+ //
+ //=============================================================================
+    auto forwardParametersStart = steady_clock::now();
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t r = 0; r < numberRepetitions; r++ )
+      {
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+               convertGeodeticToEcef
+                      (
+                        earthEquatorialRadiusMeters,
+                        earthEllipsoidalEccentricitySquared,
+                        latitudeRadians [ i ],
+                        longitudeRadians[ i ],
+                        altitudeMeters  [ i ],
+                        xEcefMeters     [ i ],
+                        yEcefMeters     [ i ],
+                        zEcefMeters     [ i ]
+                      );
+            };
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    auto forwardParametersStop  = steady_clock::now();
+ //-----------------------------------------------------------------------------
+    auto forwardContextStart    = steady_clock::now();
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t r = 0; r < numberRepetitions; r++ )
+      {
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+               convertGeodeticToEcef
+                      (
+                        ellipsoidContext,
+                        latitudeRadians    [ i ],
+                        longitudeRadians   [ i ],
+                        altitudeMeters     [ i ],
+                        templateXEcefMeters[ i ],
+                        templateYEcefMeters[ i ],
+                        templateZEcefMeters[ i ]
+                      );
+            };
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    auto forwardContextStop     = steady_clock::now();
+ //-----------------------------------------------------------------------------
+    auto forwardTemplateStart   = steady_clock::now();
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t r = 0; r < numberRepetitions; r++ )
+      {
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+               convertGeodeticToEcefForEllipsoid< GRS80_ELLIPSOID >
+                      (
+                        latitudeRadians    [ i ],
+                        longitudeRadians   [ i ],
+                        altitudeMeters     [ i ],
+                        templateXEcefMeters[ i ],
+                        templateYEcefMeters[ i ],
+                        templateZEcefMeters[ i ]
+                      );
+            };
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    auto forwardTemplateStop    = steady_clock::now();
+ //=============================================================================
+ //
+ // GRS80 ECEF to geodetic.
+ //
+ //=============================================================================
+    auto inverseParametersStart = steady_clock::now();
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t r = 0; r < numberRepetitions; r++ )
+      {
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+               ( void )
+               convertEcefToGeodetic
+                      (
+                        earthEquatorialRadiusMeters,
+                        earthEllipsoidalFlatteningFactor,
+                        xEcefMeters       [ i ],
+                        yEcefMeters       [ i ],
+                        zEcefMeters       [ i ],
+                        estimatedLatitude [ i ],
+                        estimatedLongitude[ i ],
+                        estimatedAltitude [ i ]
+                      );
+            };
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    auto inverseParametersStop  = steady_clock::now();
+ //-----------------------------------------------------------------------------
+    auto inverseContextStart    = steady_clock::now();
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t r = 0; r < numberRepetitions; r++ )
+      {
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+               ( void )
+               convertEcefToGeodetic
+                      (
+                        ellipsoidContext,
+                        xEcefMeters      [ i ],
+                        yEcefMeters      [ i ],
+                        zEcefMeters      [ i ],
+                        templateLatitude [ i ],
+                        templateLongitude[ i ],
+                        templateAltitude [ i ]
+                      );
+            };
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    auto inverseContextStop     = steady_clock::now();
+ //-----------------------------------------------------------------------------
+    auto inverseTemplateStart   = steady_clock::now();
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t r = 0; r < numberRepetitions; r++ )
+      {
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+               ( void )
+               convertEcefToGeodeticForEllipsoid< GRS80_ELLIPSOID >
+                      (
+                        xEcefMeters      [ i ],
+                        yEcefMeters      [ i ],
+                        zEcefMeters      [ i ],
+                        templateLatitude [ i ],
+                        templateLongitude[ i ],
+                        templateAltitude [ i ]
+                      );
+            };
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    auto inverseTemplateStop    = steady_clock::now();
+ //-----------------------------------------------------------------------------
+ // Largest differences between the template and parameter results.
+ //-----------------------------------------------------------------------------
+    double maximumEcefDifferenceNanoMeters          = 0.0;
+    double maximumLatitudeDifferenceMicroArcSecs    = 0.0;
+    double maximumAltitudeDifferenceNanoMeters      = 0.0;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t i = 0; i < numberPoints; i++ )
+      {
+          maximumEcefDifferenceNanoMeters =
+          max(
+               maximumEcefDifferenceNanoMeters,
+               nanoMetersPerMeter *
+               max(
+                    fabs( xEcefMeters[ i ] - templateXEcefMeters[ i ] ),
+                    max(
+                         fabs( yEcefMeters[ i ] - templateYEcefMeters[ i ] ),
+                         fabs( zEcefMeters[ i ] - templateZEcefMeters[ i ] )
+                       )
+                  )
+             );
+          maximumLatitudeDifferenceMicroArcSecs =
+          max(
+               maximumLatitudeDifferenceMicroArcSecs,
+               microArcSecondsPerRadian *
+               fabs( estimatedLatitude[ i ] - templateLatitude[ i ] )
+             );
+          maximumAltitudeDifferenceNanoMeters =
+          max(
+               maximumAltitudeDifferenceNanoMeters,
+               nanoMetersPerMeter *
+               fabs( estimatedAltitude[ i ] - templateAltitude[ i ] )
+             );
+      };
+ //=============================================================================
+ //
+ // Sphere ECEF to geodetic.
+ //
+ //=============================================================================
+    auto sphereParametersStart  = steady_clock::now();
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t r = 0; r < numberRepetitions; r++ )
+      {
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+               ( void )
+               convertEcefToGeodetic
+                      (
+                        sphereRadiusMeters,
+                        0.0,
+                        xSphereMeters     [ i ],
+                        ySphereMeters     [ i ],
+                        zSphereMeters     [ i ],
+                        estimatedLatitude [ i ],
+                        estimatedLongitude[ i ],
+                        estimatedAltitude [ i ]
+                      );
+            };
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    auto sphereParametersStop   = steady_clock::now();
+ //-----------------------------------------------------------------------------
+    auto sphereTemplateStart    = steady_clock::now();
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t r = 0; r < numberRepetitions; r++ )
+      {
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+               ( void )
+               convertEcefToGeodeticForEllipsoid< SPHERE_ELLIPSOID >
+                      (
+                        xSphereMeters    [ i ],
+                        ySphereMeters    [ i ],
+                        zSphereMeters    [ i ],
+                        templateLatitude [ i ],
+                        templateLongitude[ i ],
+                        templateAltitude [ i ]
+                      );
+            };
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    auto sphereTemplateStop     = steady_clock::now();
+ //-----------------------------------------------------------------------------
+    double maximumSphereLatitudeDifferenceMicroArcSecs = 0.0;
+    double maximumSphereAltitudeDifferenceNanoMeters   = 0.0;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t i = 0; i < numberPoints; i++ )
+      {
+          maximumSphereLatitudeDifferenceMicroArcSecs =
+          max(
+               maximumSphereLatitudeDifferenceMicroArcSecs,
+               microArcSecondsPerRadian *
+               fabs( estimatedLatitude[ i ] - templateLatitude[ i ] )
+             );
+          maximumSphereAltitudeDifferenceNanoMeters =
+          max(
+               maximumSphereAltitudeDifferenceNanoMeters,
+               nanoMetersPerMeter *
+               fabs( estimatedAltitude[ i ] - templateAltitude[ i ] )
+             );
+      };
+ //-----------------------------------------------------------------------------
+    const
+    double
+     numberConvertedPoints = ( double )numberRepetitions * numberPoints;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const double forwardParametersNanoSecondsPerPoint =
+       duration< double, nano >
+       ( forwardParametersStop - forwardParametersStart ).count( )
+       / numberConvertedPoints;
+    const double forwardContextNanoSecondsPerPoint =
+       duration< double, nano >
+       ( forwardContextStop - forwardContextStart ).count( )
+       / numberConvertedPoints;
+    const double forwardTemplateNanoSecondsPerPoint =
+       duration< double, nano >
+       ( forwardTemplateStop - forwardTemplateStart ).count( )
+       / numberConvertedPoints;
+    const double inverseParametersNanoSecondsPerPoint =
+       duration< double, nano >
+       ( inverseParametersStop - inverseParametersStart ).count( )
+       / numberConvertedPoints;
+    const double inverseContextNanoSecondsPerPoint =
+       duration< double, nano >
+       ( inverseContextStop - inverseContextStart ).count( )
+       / numberConvertedPoints;
+    const double inverseTemplateNanoSecondsPerPoint =
+       duration< double, nano >
+       ( inverseTemplateStop - inverseTemplateStart ).count( )
+       / numberConvertedPoints;
+    const double sphereParametersNanoSecondsPerPoint =
+       duration< double, nano >
+       ( sphereParametersStop - sphereParametersStart ).count( )
+       / numberConvertedPoints;
+    const double sphereTemplateNanoSecondsPerPoint =
+       duration< double, nano >
+       ( sphereTemplateStop - sphereTemplateStart ).count( )
+       / numberConvertedPoints;
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "\n\n\n"
+       "%s%s\n"
+       "%s\n%s\n%s\n"
+       "%s%zu\n"
+       "%s\n"
+       "%s%s\n"
+       "%s\n"
+       "%s\n"
+       "%s%11.3f%11.3f%11.3f%10.2f\n"
+       "%s%11.3f%11.3f%11.3f%10.2f\n"
+       "%s%11.3f%11s%11.3f%10.2f\n"
+       "%s\n"
+       "%s%+14.6e%s\n"
+       "%s%+14.6e%s\n"
+       "%s%+14.6e%s\n"
+       "%s%+14.6e%s\n"
+       "%s%+14.6e%s\n"
+       "%s\n"
+       "%s%s\n"
+       "\n\n\n",
+       "============================================",
+       "============================================",
+       "|",
+       "| COMPILE TIME ELLIPSOID TIMING RESULTS:",
+       "|",
+       "|    Number of points ",
+       numberPoints,
+       "|",
+       "|-------------------------------------------",
+       "--------------------------------------------",
+       "|    Conversion            Parameters    Context   Template   Speedup",
+       "|                          [ns/point] [ns/point] [ns/point]",
+       "|    GRS80 geodetic to ECEF ",
+       forwardParametersNanoSecondsPerPoint,
+       forwardContextNanoSecondsPerPoint,
+       forwardTemplateNanoSecondsPerPoint,
+       forwardParametersNanoSecondsPerPoint /
+       forwardTemplateNanoSecondsPerPoint,
+       "|    GRS80 ECEF to geodetic ",
+       inverseParametersNanoSecondsPerPoint,
+       inverseContextNanoSecondsPerPoint,
+       inverseTemplateNanoSecondsPerPoint,
+       inverseParametersNanoSecondsPerPoint /
+       inverseTemplateNanoSecondsPerPoint,
+       "|    Sphere ECEF to geodetic",
+       sphereParametersNanoSecondsPerPoint,
+       "-",
+       sphereTemplateNanoSecondsPerPoint,
+       sphereParametersNanoSecondsPerPoint /
+       sphereTemplateNanoSecondsPerPoint,
+       "|",
+       "|    GRS80  maximum ECEF difference, template - parameters: ",
+       maximumEcefDifferenceNanoMeters,
+       " [nanometers]",
+       "|    GRS80  maximum latitude difference:                    ",
+       maximumLatitudeDifferenceMicroArcSecs,
+       " [microarcseconds]",
+       "|    GRS80  maximum altitude difference:                    ",
+       maximumAltitudeDifferenceNanoMeters,
+       " [nanometers]",
+       "|    Sphere maximum latitude difference:                    ",
+       maximumSphereLatitudeDifferenceMicroArcSecs,
+       " [microarcseconds]",
+       "|    Sphere maximum altitude difference:                    ",
+       maximumSphereAltitudeDifferenceNanoMeters,
+       " [nanometers]",
+       "|",
+       "============================================",
+       "============================================"
+     );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
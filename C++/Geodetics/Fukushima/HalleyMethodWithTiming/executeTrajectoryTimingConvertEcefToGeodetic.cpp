@@ -0,0 +1,656 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+
+//------------------------------------------------------------------------------
+struct
+TRAJECTORY_TIMING_RUN_DATA
+  {
+    const EARTH_ELLIPSOID_CONTEXT      * pEllipsoidContext;
+    size_t                               numberPoints;
+    const double                       * pXEcefMeters;
+    const double                       * pYEcefMeters;
+    const double                       * pZEcefMeters;
+    double                             * pGeodeticNorthLatitudeRadians;
+    double                             * pGeocentricEastLongitudeRadians;
+    double                             * pGeodeticAltitudeMeters;
+    ECEF_TO_GEODETIC_CONVERSION_STATUS * pConversionStatus;
+    ECEF_TO_GEODETIC_TRAJECTORY_STATE    trajectoryState;
+  };
+
+//------------------------------------------------------------------------------
+// One timed run: one stateless context call per track point.
+//------------------------------------------------------------------------------
+static
+void
+convertTrajectoryScalarTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    TRAJECTORY_TIMING_RUN_DATA
+        & rRunData = *( TRAJECTORY_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < rRunData.numberPoints; i++ )
+      {
+          rRunData.pConversionStatus[ i ] =
+          convertEcefToGeodetic
+                 (
+                   *rRunData.pEllipsoidContext,
+                   rRunData.pXEcefMeters[ i ],
+                   rRunData.pYEcefMeters[ i ],
+                   rRunData.pZEcefMeters[ i ],
+                   rRunData.pGeodeticNorthLatitudeRadians  [ i ],
+                   rRunData.pGeocentricEastLongitudeRadians[ i ],
+                   rRunData.pGeodeticAltitudeMeters        [ i ]
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: one stateless batch call over the track.
+//------------------------------------------------------------------------------
+static
+void
+convertTrajectoryBatchTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    TRAJECTORY_TIMING_RUN_DATA
+        & rRunData = *( TRAJECTORY_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    ( void )
+    convertEcefToGeodeticBatch
+           (
+             rRunData.pEllipsoidContext->earthEquatorialRadiusMeters,
+             rRunData.pEllipsoidContext->earthEllipsoidalFlatteningFactor,
+             rRunData.numberPoints,
+             rRunData.pXEcefMeters,
+             rRunData.pYEcefMeters,
+             rRunData.pZEcefMeters,
+             rRunData.pGeodeticNorthLatitudeRadians,
+             rRunData.pGeocentricEastLongitudeRadians,
+             rRunData.pGeodeticAltitudeMeters,
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run: the track as one trajectory, from a fresh state.
+//------------------------------------------------------------------------------
+static
+void
+convertTrajectoryWarmTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    TRAJECTORY_TIMING_RUN_DATA
+        & rRunData = *( TRAJECTORY_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    initializeEcefToGeodeticTrajectoryState( rRunData.trajectoryState );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    ( void )
+    convertEcefToGeodeticTrajectory
+           (
+             *rRunData.pEllipsoidContext,
+             rRunData.numberPoints,
+             rRunData.pXEcefMeters,
+             rRunData.pYEcefMeters,
+             rRunData.pZEcefMeters,
+             rRunData.trajectoryState,
+             rRunData.pGeodeticNorthLatitudeRadians,
+             rRunData.pGeocentricEastLongitudeRadians,
+             rRunData.pGeodeticAltitudeMeters,
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+executeTrajectoryTimingConvertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const
+            int      numberPointsExponent
+         //-------------------
+         // OUTPUT(s):
+         //           NONE
+         //-------------------
+       )
+//==============================================================================
+//|
+//| FUNCTION:
+//|
+//|   executeTrajectoryTimingConvertEcefToGeodetic
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| PURPOSE:
+//|
+//|   To compare, on three synthetic time ordered tracks, the execution time
+//|   per point and the maximum errors of the stateless conversions, one
+//|   'convertEcefToGeodetic' call per point and one
+//|   'convertEcefToGeodeticBatch' call, with those of the warm started
+//|   'convertEcefToGeodeticTrajectory', and to report how many track
+//|   points took each path of the trajectory conversion, and to check the
+//|   status of a track with a non finite point.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| INPUT(s):
+//|
+//|   numberPointsExponent
+//|     The base ten exponent of the number of points of each track.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| METHOD:
+//|
+//|   [ 1 ] Aircraft:  100 Hz samples of a 250 m/s flight from 35 degrees
+//|         north, 120 degrees west, weaving 0.5 radians about a heading
+//|         of 0.3 radians with a period of 600 s, at 10 km altitude
+//|         rising and falling 1.5 km with a period of 900 s.
+//|
+//|   [ 2 ] LEO:  1 Hz samples of a circular 500 km orbit inclined 97.4
+//|         degrees, seen from the rotating Earth.  Its geodetic track is
+//|         the stateless conversion of the orbit points.
+//|
+//|   [ 3 ] Hops:  1 Hz samples of ballistic hops from 45 degrees north,
+//|         10 degrees east to 800 km altitude and back, with a period of
+//|         600 s, drifting 100 m/s east.  Their steps of up to 4 km of
+//|         altitude take the Halley step and the stateless fallback.
+//|
+//|   [ 4 ] Each true geodetic track is converted to ECEF with
+//|         'convertGeodeticToEcef', and the routes are timed on those
+//|         points with 'measureConversionTiming'.  The errors are the
+//|         largest differences from the true geodetic track.
+//|
+//|   [ 5 ] The middle point of the hops track is made NAN.  The
+//|         trajectory conversion must return INVALID_ECEF_COORDINATES,
+//|         set that status for that point only, and anchor the next one.
+//|
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const
+    double
+     piRadians                           = 4.0 * atan( 1.0 );
+    const
+    double
+     degreesToRadians                    = piRadians / 180.0;
+    const
+    double
+     microArcSecondsPerRadian            = ( 180.0 / piRadians ) *
+                                           3600.0 * 1.0E6;
+    const
+    double
+     nanoMetersPerMeter                  = 1.0E9;
+ //-----------------------------------------------------------------------------
+ //
+ // GRS1980 System
+ //
+ //-----------------------------------------------------------------------------
+    const
+    double
+     earthEquatorialRadiusMeters         = 6378137.0E0;
+    const
+    double
+     earthEllipsoidalFlatteningFactor    = 1.0E0 / 298.257222101E0;
+    const
+    double
+     earthEllipsoidalEccentricitySquared =
+                         ( 2.0E0 - earthEllipsoidalFlatteningFactor )
+                         *
+                         earthEllipsoidalFlatteningFactor;
+    const
+    double
+     earthGravitationalParameter         = 3.986005E14;
+    const
+    double
+     earthRotationRateRadiansPerSecond   = 7.292115E-5;
+ //-----------------------------------------------------------------------------
+    const
+    int
+     NUMBER_WARM_UP_RUNS = 1;
+    const
+    int
+     NUMBER_TIMED_RUNS   = 7;
+ //-----------------------------------------------------------------------------
+    EARTH_ELLIPSOID_CONTEXT
+     ellipsoidContext;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    ( void )
+    initializeEarthEllipsoidContext
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalFlatteningFactor,
+             ellipsoidContext
+           );
+ //-----------------------------------------------------------------------------
+    size_t
+     numberPoints = 1;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int exponent = 0; exponent < numberPointsExponent; exponent++ )
+      {
+          numberPoints = 10 * numberPoints;
+      };
+ //-----------------------------------------------------------------------------
+    vector< double > trueLatitudeRadians ( numberPoints );
+    vector< double > trueLongitudeRadians( numberPoints );
+    vector< double > trueAltitudeMeters  ( numberPoints );
+    vector< double > xEcefMeters         ( numberPoints );
+    vector< double > yEcefMeters         ( numberPoints );
+    vector< double > zEcefMeters         ( numberPoints );
+    vector< double > latitudeRadians     ( numberPoints );
+    vector< double > longitudeRadians    ( numberPoints );
+    vector< double > altitudeMeters      ( numberPoints );
+    vector< ECEF_TO_GEODETIC_CONVERSION_STATUS >
+                     conversionStatus    ( numberPoints );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    TRAJECTORY_TIMING_RUN_DATA
+     runData;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    runData.pEllipsoidContext               = &ellipsoidContext;
+    runData.numberPoints                    = numberPoints;
+    runData.pXEcefMeters                    = xEcefMeters     .data( );
+    runData.pYEcefMeters                    = yEcefMeters     .data( );
+    runData.pZEcefMeters                    = zEcefMeters     .data( );
+    runData.pGeodeticNorthLatitudeRadians   = latitudeRadians .data( );
+    runData.pGeocentricEastLongitudeRadians = longitudeRadians.data( );
+    runData.pGeodeticAltitudeMeters         = altitudeMeters  .data( );
+    runData.pConversionStatus               = conversionStatus.data( );
+ //-----------------------------------------------------------------------------
+    const
+    int
+     NUMBER_TRACKS = 3;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    char *
+     trackNames[ NUMBER_TRACKS ] = { "100 Hz aircraft",
+                                     "1 Hz LEO",
+                                     "1 Hz ballistic hops" };
+    const
+    char *
+     routeNames[ 3 ] = { "Scalar", "Batch", "Trajectory" };
+    void
+     ( *routeRuns[ 3 ] )( void * ) = { convertTrajectoryScalarTimingRun,
+                                       convertTrajectoryBatchTimingRun,
+                                       convertTrajectoryWarmTimingRun };
+ //-----------------------------------------------------------------------------
+ // Report header.
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "\n\n\n"
+       "%s%s\n"
+       "%s\n%s\n%s\n"
+       "%s%zu%s\n"
+       "%s\n"
+       "%s%s\n"
+       "%s%s\n"
+       "%s%s\n",
+       "============================================",
+       "============================================",
+       "|",
+       "| TRAJECTORY (WARM START) TIMING RESULTS:",
+       "|",
+       "|    Tracks of ",
+       numberPoints,
+       " points",
+       "|",
+       "|-------------------------------------------",
+       "--------------------------------------------",
+       "|    Route       [ns/point]      MAD  [cycles]  vs scalar",
+       "   Lat [uas]   Lon [uas]   Alt [nm]",
+       "|-------------------------------------------",
+       "--------------------------------------------"
+     );
+ //-----------------------------------------------------------------------------
+ // Loop over the tracks.
+ //-----------------------------------------------------------------------------
+    for( int track = 0; track < NUMBER_TRACKS; track++ )
+      {
+       //=======================================================================
+       //
+       // Generate the true geodetic track.
+       //
+       //=======================================================================
+          if( track == 0 )
+            {
+             //-----------------------------------------------------------------
+             // [ 1 ] Aircraft.
+             //-----------------------------------------------------------------
+                const double timeStepSeconds = 0.01;
+                const double speedMetersPerSecond = 250.0;
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                double latitude  =   35.0 * degreesToRadians;
+                double longitude = -120.0 * degreesToRadians;
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                for( size_t i = 0; i < numberPoints; i++ )
+                  {
+                     const double t        = timeStepSeconds * ( double )i;
+                     const double heading  = 0.3 + 0.5 *
+                                             sin( 2.0 * piRadians * t / 600.0 );
+                     const double altitude = 10000.0 + 1500.0 *
+                                             sin( 2.0 * piRadians * t / 900.0 );
+                  //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                     trueLatitudeRadians [ i ] = latitude;
+                     trueLongitudeRadians[ i ] = longitude;
+                     trueAltitudeMeters  [ i ] = altitude;
+                  //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                     const double sineLatitude = sin( latitude );
+                     const double w            =
+                                  1.0 - earthEllipsoidalEccentricitySquared *
+                                        sineLatitude * sineLatitude;
+                     const double N            =
+                                  earthEquatorialRadiusMeters / sqrt( w );
+                     const double M            =
+                                  N * ( 1.0 -
+                                        earthEllipsoidalEccentricitySquared ) /
+                                  w;
+                  //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                     latitude  += speedMetersPerSecond * timeStepSeconds *
+                                  cos( heading ) / ( M + altitude );
+                     longitude += speedMetersPerSecond * timeStepSeconds *
+                                  sin( heading ) /
+                                  ( ( N + altitude ) * cos( latitude ) );
+                  };
+             //-----------------------------------------------------------------
+            }
+          else
+          if( track == 1 )
+            {
+             //-----------------------------------------------------------------
+             // [ 2 ] LEO.
+             //-----------------------------------------------------------------
+                const double orbitRadiusMeters =
+                                       earthEquatorialRadiusMeters + 500.0E3;
+                const double meanMotionRadiansPerSecond =
+                                       sqrt( earthGravitationalParameter /
+                                             pow( orbitRadiusMeters, 3 ) );
+                const double inclinationRadians = 97.4 * degreesToRadians;
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                for( size_t i = 0; i < numberPoints; i++ )
+                  {
+                     const double t = ( double )i;
+                     const double u = meanMotionRadiansPerSecond * t;
+                     const double theta =
+                                  earthRotationRateRadiansPerSecond * t;
+                  //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                     const double X = orbitRadiusMeters * cos( u );
+                     const double Y = orbitRadiusMeters * sin( u ) *
+                                      cos( inclinationRadians );
+                     const double Z = orbitRadiusMeters * sin( u ) *
+                                      sin( inclinationRadians );
+                  //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                     ( void )
+                     convertEcefToGeodetic
+                            (
+                              ellipsoidContext,
+                              (  X * cos( theta ) ) + ( Y * sin( theta ) ),
+                              ( -X * sin( theta ) ) + ( Y * cos( theta ) ),
+                              Z,
+                              trueLatitudeRadians [ i ],
+                              trueLongitudeRadians[ i ],
+                              trueAltitudeMeters  [ i ]
+                            );
+                  };
+             //-----------------------------------------------------------------
+            }
+          else
+            {
+             //-----------------------------------------------------------------
+             // [ 3 ] Hops.
+             //-----------------------------------------------------------------
+                const double latitude = 45.0 * degreesToRadians;
+                const double eastSpeedRadiansPerSecond =
+                             100.0 / ( earthEquatorialRadiusMeters *
+                                       cos( latitude ) );
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                for( size_t i = 0; i < numberPoints; i++ )
+                  {
+                     const double t = ( double )i;
+                  //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                     trueLatitudeRadians [ i ] = latitude;
+                     trueLongitudeRadians[ i ] =
+                                  remainder( 10.0 * degreesToRadians +
+                                             eastSpeedRadiansPerSecond * t,
+                                             2.0 * piRadians );
+                     trueAltitudeMeters  [ i ] =
+                                  400.0E3 *
+                                  ( 1.0 - cos( 2.0 * piRadians * t / 600.0 ) );
+                  };
+             //-----------------------------------------------------------------
+            };
+       //-----------------------------------------------------------------------
+       // [ 4 ] ECEF points of the true track.
+       //-----------------------------------------------------------------------
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+               ( void )
+               convertGeodeticToEcef
+                      (
+                        earthEquatorialRadiusMeters,
+                        earthEllipsoidalEccentricitySquared,
+                        trueLatitudeRadians [ i ],
+                        trueLongitudeRadians[ i ],
+                        trueAltitudeMeters  [ i ],
+                        xEcefMeters[ i ],
+                        yEcefMeters[ i ],
+                        zEcefMeters[ i ]
+                      );
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          fprintf
+           (
+             stdout,
+             "%s\n"
+             "|    %s:\n",
+             "|",
+             trackNames[ track ]
+           );
+       //=======================================================================
+       //
+       // Time each route.
+       //
+       //=======================================================================
+          double
+           scalarNanoSecondsPerPoint = NAN;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( int route = 0; route < 3; route++ )
+            {
+             //-----------------------------------------------------------------
+                CONVERSION_TIMING_STATISTICS
+                 routeTiming;
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                measureConversionTiming
+                       (
+                         routeRuns[ route ],
+                         &runData,
+                         numberPoints,
+                         NUMBER_WARM_UP_RUNS,
+                         NUMBER_TIMED_RUNS,
+                         routeTiming
+                       );
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                if( route == 0 )
+                  {
+                     scalarNanoSecondsPerPoint =
+                                       routeTiming.medianNanoSecondsPerPoint;
+                  };
+             //-----------------------------------------------------------------
+             // Errors of the last run.
+             //-----------------------------------------------------------------
+                double maximumLatitudeErrorMicroArcSecs  = 0.0;
+                double maximumLongitudeErrorMicroArcSecs = 0.0;
+                double maximumAltitudeErrorNanoMeters    = 0.0;
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                for( size_t i = 0; i < numberPoints; i++ )
+                  {
+                     double longitudeError = fabs( longitudeRadians    [ i ] -
+                                                   trueLongitudeRadians[ i ] );
+                  //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                     longitudeError = min( longitudeError,
+                                           2.0 * piRadians - longitudeError );
+                  //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                     maximumLatitudeErrorMicroArcSecs =
+                     max( maximumLatitudeErrorMicroArcSecs,
+                          microArcSecondsPerRadian *
+                          fabs( latitudeRadians    [ i ] -
+                                trueLatitudeRadians[ i ] ) );
+                     maximumLongitudeErrorMicroArcSecs =
+                     max( maximumLongitudeErrorMicroArcSecs,
+                          microArcSecondsPerRadian * longitudeError );
+                     maximumAltitudeErrorNanoMeters =
+                     max( maximumAltitudeErrorNanoMeters,
+                          nanoMetersPerMeter *
+                          fabs( altitudeMeters    [ i ] -
+                                trueAltitudeMeters[ i ] ) );
+                  };
+             //-----------------------------------------------------------------
+                fprintf
+                 (
+                   stdout,
+                   "|    %-11s %11.3f %8.3f %9.1f %10.2f"
+                   " %11.4f %11.4f %10.4f\n",
+                   routeNames[ route ],
+                   routeTiming.medianNanoSecondsPerPoint,
+                   routeTiming.madNanoSecondsPerPoint,
+                   routeTiming.medianCyclesPerPoint,
+                   scalarNanoSecondsPerPoint /
+                   routeTiming.medianNanoSecondsPerPoint,
+                   maximumLatitudeErrorMicroArcSecs,
+                   maximumLongitudeErrorMicroArcSecs,
+                   maximumAltitudeErrorNanoMeters
+                 );
+             //-----------------------------------------------------------------
+            };
+       //-----------------------------------------------------------------------
+       // Paths taken by the trajectory points of the last run.
+       //-----------------------------------------------------------------------
+          fprintf
+           (
+             stdout,
+             "|    %-11s %zu Newton, %zu Halley, %zu full solution points\n",
+             "",
+             runData.trajectoryState.numberNewtonPoints,
+             runData.trajectoryState.numberHalleyPoints,
+             runData.trajectoryState.numberFullSolutionPoints
+           );
+       //-----------------------------------------------------------------------
+      };
+ //=============================================================================
+ //
+ // [ 5 ] A non finite point in the middle of the hops track.
+ //
+ //=============================================================================
+    const size_t invalidIndex = numberPoints / 2;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    xEcefMeters[ invalidIndex ] = NAN;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    initializeEcefToGeodeticTrajectoryState( runData.trajectoryState );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const ECEF_TO_GEODETIC_CONVERSION_STATUS
+     trajectoryStatus = convertEcefToGeodeticTrajectory
+                               (
+                                 ellipsoidContext,
+                                 numberPoints,
+                                 xEcefMeters     .data( ),
+                                 yEcefMeters     .data( ),
+                                 zEcefMeters     .data( ),
+                                 runData.trajectoryState,
+                                 latitudeRadians .data( ),
+                                 longitudeRadians.data( ),
+                                 altitudeMeters  .data( ),
+                                 conversionStatus.data( )
+                               );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    size_t numberStatusMismatches = 0;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t i = 0; i < numberPoints; i++ )
+      {
+          if(
+              conversionStatus[ i ] !=
+              ( ( i == invalidIndex ) ? INVALID_ECEF_COORDINATES :
+                                        SUCCESSFUL_CONVERSION )
+            )
+            {
+               numberStatusMismatches++;
+            };
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    double nextLatitudeErrorMicroArcSecs = NAN;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( invalidIndex + 1 < numberPoints )
+      {
+         nextLatitudeErrorMicroArcSecs =
+                      microArcSecondsPerRadian *
+                      fabs( latitudeRadians    [ invalidIndex + 1 ] -
+                            trueLatitudeRadians[ invalidIndex + 1 ] );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    fprintf
+     (
+       stdout,
+       "%s\n"
+       "|    NAN hops point %zu:  returned %s, %zu status mismatches,\n"
+       "|    next point latitude error %.4f [uas]\n",
+       "|",
+       invalidIndex,
+       ( trajectoryStatus == INVALID_ECEF_COORDINATES ) ?
+       "INVALID_ECEF_COORDINATES" : "WRONG STATUS",
+       numberStatusMismatches,
+       nextLatitudeErrorMicroArcSecs
+     );
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "%s\n"
+       "%s%s\n"
+       "\n\n\n",
+       "|",
+       "============================================",
+       "============================================"
+     );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,584 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+
+//------------------------------------------------------------------------------
+struct
+VALIDITY_TIMING_RUN_DATA
+  {
+    EARTH_ELLIPSOID_CONTEXT              ellipsoidContext;
+    size_t                               numberPoints;
+    const double                       * pInput[ 3 ];
+    double                             * pOutput[ 3 ];
+    ECEF_TO_GEODETIC_CONVERSION_STATUS * pConversionStatus;
+    unsigned long long                 * pValidBits;
+    ECEF_TO_GEODETIC_BATCH_VALIDITY      batchValidity;
+  };
+
+//------------------------------------------------------------------------------
+// One timed run:  one inverse batch call with a status per point.
+//------------------------------------------------------------------------------
+static
+void
+convertInverseStatusTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    VALIDITY_TIMING_RUN_DATA
+        & rRunData = *( VALIDITY_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticBatch
+           (
+             rRunData.ellipsoidContext,
+             rRunData.numberPoints,
+             rRunData.pInput [ 0 ],
+             rRunData.pInput [ 1 ],
+             rRunData.pInput [ 2 ],
+             rRunData.pOutput[ 0 ],
+             rRunData.pOutput[ 1 ],
+             rRunData.pOutput[ 2 ],
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run:  one inverse batch call with validity bits.
+//------------------------------------------------------------------------------
+static
+void
+convertInverseValidityBitsTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    VALIDITY_TIMING_RUN_DATA
+        & rRunData = *( VALIDITY_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    convertEcefToGeodeticBatchWithValidityBits
+           (
+             rRunData.ellipsoidContext,
+             rRunData.numberPoints,
+             rRunData.pInput [ 0 ],
+             rRunData.pInput [ 1 ],
+             rRunData.pInput [ 2 ],
+             rRunData.pOutput[ 0 ],
+             rRunData.pOutput[ 1 ],
+             rRunData.pOutput[ 2 ],
+             rRunData.pValidBits,
+             rRunData.batchValidity
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run:  one forward batch call with a status per point.
+//------------------------------------------------------------------------------
+static
+void
+convertForwardStatusTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    VALIDITY_TIMING_RUN_DATA
+        & rRunData = *( VALIDITY_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    ( void )
+    convertGeodeticToEcefBatch
+           (
+             rRunData.ellipsoidContext.earthEquatorialRadiusMeters,
+             rRunData.ellipsoidContext.earthEllipticitySquared,
+             rRunData.numberPoints,
+             rRunData.pInput [ 0 ],
+             rRunData.pInput [ 1 ],
+             rRunData.pInput [ 2 ],
+             rRunData.pOutput[ 0 ],
+             rRunData.pOutput[ 1 ],
+             rRunData.pOutput[ 2 ],
+             rRunData.pConversionStatus
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// One timed run:  one forward batch call with validity bits.
+//------------------------------------------------------------------------------
+static
+void
+convertForwardValidityBitsTimingRun
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void * pRunData
+       )
+{
+ //-----------------------------------------------------------------------------
+    VALIDITY_TIMING_RUN_DATA
+        & rRunData = *( VALIDITY_TIMING_RUN_DATA * )pRunData;
+ //-----------------------------------------------------------------------------
+    convertGeodeticToEcefBatchWithValidityBits
+           (
+             rRunData.ellipsoidContext.earthEquatorialRadiusMeters,
+             rRunData.ellipsoidContext.earthEllipticitySquared,
+             rRunData.numberPoints,
+             rRunData.pInput [ 0 ],
+             rRunData.pInput [ 1 ],
+             rRunData.pInput [ 2 ],
+             rRunData.pOutput[ 0 ],
+             rRunData.pOutput[ 1 ],
+             rRunData.pOutput[ 2 ],
+             rRunData.pValidBits,
+             rRunData.batchValidity
+           );
+ //-----------------------------------------------------------------------------
+    preventConversionTimingReordering( );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// The number of points whose validity bit is not that of their status and
+// finite inputs, or whose outputs of the two batch calls differ where the
+// bit is set, or are not NAN where it is clear.
+//------------------------------------------------------------------------------
+static
+size_t
+countValidityMismatches
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const size_t   numberPoints,
+            const double * const
+                         * pInput,
+            const ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus,
+            const unsigned long long
+                         * pValidBits,
+            const double * pStatusOutput,
+            const double * pValidityBitsOutput
+       )
+{
+ //-----------------------------------------------------------------------------
+    size_t numberMismatches = 0;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < numberPoints; i++ )
+      {
+       //-----------------------------------------------------------------------
+          const bool validBit =
+                       ( ( pValidBits[ i / 64 ] >> ( i % 64 ) ) & 1ULL ) != 0;
+          const bool finiteInputs =
+                       std::isfinite( pInput[ 0 ][ i ] ) &&
+                       std::isfinite( pInput[ 1 ][ i ] ) &&
+                       std::isfinite( pInput[ 2 ][ i ] );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          bool isMismatch =
+                 ( validBit !=
+                   ( finiteInputs &&
+                     ( pConversionStatus[ i ] == SUCCESSFUL_CONVERSION ) ) );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t k = 0; k < 3; k++ )
+            {
+               const double a = pStatusOutput      [ k * numberPoints + i ];
+               const double b = pValidityBitsOutput[ k * numberPoints + i ];
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               isMismatch = isMismatch ||
+                            ( validBit ? ( a != b ) : !std::isnan( b ) );
+            };
+       //-----------------------------------------------------------------------
+          numberMismatches += isMismatch;
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    return( numberMismatches );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+executeValidityTimingConvertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const
+            int      numberPointsExponent
+         //-------------------
+         // OUTPUT(s):
+         //           NONE
+         //-------------------
+       )
+//==============================================================================
+//|
+//| FUNCTION:
+//|
+//|   executeValidityTimingConvertEcefToGeodetic
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| PURPOSE:
+//|
+//|   To compare the batch conversions of both directions which return a
+//|   status per point with those which return validity bits and summary
+//|   counts, in time per point, for batches in which a share of the
+//|   records are missing fixes:  coordinates which are NAN or infinite.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| INPUT(s):
+//|
+//|   numberPointsExponent
+//|     The base ten exponent of the number of points.
+//|
+//|-----------------------------------------------------------------------------
+//|
+//| METHOD:
+//|
+//|   [ 1 ] Generate 10^numberPointsExponent geodetic points, uniform in
+//|         latitude and longitude and from -10 km to 1000 km altitude, and
+//|         their ECEF coordinates.
+//|
+//|   [ 2 ] For each share of 0, 0.1, 1 and 10 percent, replace that
+//|         share of randomly chosen records by a NAN x, an infinite z,
+//|         or all three NAN in turn (inverse), and by a NAN latitude, an
+//|         infinite longitude, or all three NAN in turn (forward).
+//|
+//|   [ 3 ] Time the four batch calls with 'measureConversionTiming' on
+//|         those records.  Report the not finite count of the summary
+//|         of each direction, and the number of points whose validity bit
+//|         differs from their status, or whose outputs differ between
+//|         the two calls.
+//|
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+ //
+ // GRS1980 System
+ //
+ //-----------------------------------------------------------------------------
+    const
+    double
+     earthEquatorialRadiusMeters         = 6378137.0E0;
+    const
+    double
+     earthEllipsoidalFlatteningFactor    = 1.0E0 / 298.257222101E0;
+ //-----------------------------------------------------------------------------
+    const
+    int
+     NUMBER_WARM_UP_RUNS = 1;
+    const
+    int
+     NUMBER_TIMED_RUNS   = 7;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    int
+     NUMBER_SHARES = 4;
+    const
+    double
+     notFiniteShares[ NUMBER_SHARES ] = { 0.0, 0.001, 0.01, 0.1 };
+ //-----------------------------------------------------------------------------
+    size_t
+     numberPoints = 1;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int exponent = 0; exponent < numberPointsExponent; exponent++ )
+      {
+          numberPoints = 10 * numberPoints;
+      };
+ //-----------------------------------------------------------------------------
+    VALIDITY_TIMING_RUN_DATA
+     runData;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    ( void )
+    initializeEarthEllipsoidContext
+           (
+             earthEquatorialRadiusMeters,
+             earthEllipsoidalFlatteningFactor,
+             runData.ellipsoidContext
+           );
+ //-----------------------------------------------------------------------------
+ // Generate the points.
+ //-----------------------------------------------------------------------------
+    vector< double > geodetic        ( 3 * numberPoints );
+    vector< double > ecef            ( 3 * numberPoints );
+    vector< double > badGeodetic     ( 3 * numberPoints );
+    vector< double > badEcef         ( 3 * numberPoints );
+    vector< double > statusOutput    ( 3 * numberPoints );
+    vector< double > validBitsOutput ( 3 * numberPoints );
+    vector< ECEF_TO_GEODETIC_CONVERSION_STATUS >
+                     conversionStatus( numberPoints );
+    vector< unsigned long long >
+                     validBits       ( ( numberPoints + 63 ) / 64 );
+    vector< double > uniformDeviates ( numberPoints );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    generateTimingGeodeticPoints
+           (
+             earthEquatorialRadiusMeters,
+             runData.ellipsoidContext.earthEllipticitySquared,
+             -1.0E4,
+             1.0E6,
+             UNIFORM_TIMING_ALTITUDE_SPACING,
+             0,
+             numberPoints,
+             geodetic.data( ),
+             geodetic.data( ) +     numberPoints,
+             geodetic.data( ) + 2 * numberPoints,
+             ecef    .data( ),
+             ecef    .data( ) +     numberPoints,
+             ecef    .data( ) + 2 * numberPoints,
+             uniformDeviates.data( )
+           );
+ //-----------------------------------------------------------------------------
+    runData.numberPoints      = numberPoints;
+    runData.pConversionStatus = conversionStatus.data( );
+    runData.pValidBits        = validBits       .data( );
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "\n\n\n"
+       "%s%s\n"
+       "%s\n%s\n%s\n"
+       "%s%zu%s\n"
+       "%s\n"
+       "%s%s\n"
+       "%s%s\n"
+       "%s%s\n"
+       "%s%s\n",
+       "============================================",
+       "============================================",
+       "|",
+       "| VALIDITY BITS TIMING RESULTS:",
+       "|",
+       "|    Batch of ",
+       numberPoints,
+       " points with a share of NAN or infinite records",
+       "|",
+       "|-------------------------------------------",
+       "--------------------------------------------",
+       "|    Not finite   ECEF to geodetic [ns/point]   Geodetic to ECEF",
+       " [ns/point]",
+       "|    share [%]      status     bits  counted      status     bits",
+       "  counted",
+       "|-------------------------------------------",
+       "--------------------------------------------"
+     );
+ //-----------------------------------------------------------------------------
+    size_t
+     numberMismatches = 0;
+ //-----------------------------------------------------------------------------
+    for( int share = 0; share < NUMBER_SHARES; share++ )
+      {
+       //-----------------------------------------------------------------------
+       // Replace the share of records by missing fixes.
+       //-----------------------------------------------------------------------
+          badGeodetic = geodetic;
+          badEcef     = ecef;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          size_t numberNotFinitePoints = 0;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t i = 0; i < numberPoints; i++ )
+            {
+               if( !( uniformDeviates[ i ] < notFiniteShares[ share ] ) )
+                 {
+                    continue;
+                 };
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               const size_t kind = numberNotFinitePoints % 3;
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               if( kind == 0 )
+                 {
+                    badEcef    [ i ]                = NAN;
+                    badGeodetic[ i ]                = NAN;
+                 }
+               else
+               if( kind == 1 )
+                 {
+                    badEcef    [ 2 * numberPoints + i ] = INFINITY;
+                    badGeodetic[     numberPoints + i ] = INFINITY;
+                 }
+               else
+                 {
+                    for( size_t k = 0; k < 3; k++ )
+                      {
+                         badEcef    [ k * numberPoints + i ] = NAN;
+                         badGeodetic[ k * numberPoints + i ] = NAN;
+                      };
+                 };
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               numberNotFinitePoints++;
+            };
+       //-----------------------------------------------------------------------
+       // ECEF to geodetic.
+       //-----------------------------------------------------------------------
+          CONVERSION_TIMING_STATISTICS inverseStatusTiming;
+          CONVERSION_TIMING_STATISTICS inverseValidityBitsTiming;
+          CONVERSION_TIMING_STATISTICS forwardStatusTiming;
+          CONVERSION_TIMING_STATISTICS forwardValidityBitsTiming;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t k = 0; k < 3; k++ )
+            {
+               runData.pInput[ k ] = badEcef.data( ) + k * numberPoints;
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t k = 0; k < 3; k++ )
+            {
+               runData.pOutput[ k ] = statusOutput.data( ) + k * numberPoints;
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          measureConversionTiming
+                 (
+                   convertInverseStatusTimingRun,
+                   &runData,
+                   numberPoints,
+                   NUMBER_WARM_UP_RUNS,
+                   NUMBER_TIMED_RUNS,
+                   inverseStatusTiming
+                 );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t k = 0; k < 3; k++ )
+            {
+               runData.pOutput[ k ] = validBitsOutput.data( ) +
+                                      k * numberPoints;
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          measureConversionTiming
+                 (
+                   convertInverseValidityBitsTimingRun,
+                   &runData,
+                   numberPoints,
+                   NUMBER_WARM_UP_RUNS,
+                   NUMBER_TIMED_RUNS,
+                   inverseValidityBitsTiming
+                 );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          const
+          size_t
+           numberInverseNotFinitePoints =
+                             runData.batchValidity.numberNotFinitePoints;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          numberMismatches +=
+          countValidityMismatches
+                 (
+                   numberPoints,
+                   runData.pInput,
+                   conversionStatus.data( ),
+                   validBits       .data( ),
+                   statusOutput    .data( ),
+                   validBitsOutput .data( )
+                 );
+       //-----------------------------------------------------------------------
+       // Geodetic to ECEF.
+       //-----------------------------------------------------------------------
+          for( size_t k = 0; k < 3; k++ )
+            {
+               runData.pInput[ k ] = badGeodetic.data( ) + k * numberPoints;
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t k = 0; k < 3; k++ )
+            {
+               runData.pOutput[ k ] = statusOutput.data( ) + k * numberPoints;
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          measureConversionTiming
+                 (
+                   convertForwardStatusTimingRun,
+                   &runData,
+                   numberPoints,
+                   NUMBER_WARM_UP_RUNS,
+                   NUMBER_TIMED_RUNS,
+                   forwardStatusTiming
+                 );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( size_t k = 0; k < 3; k++ )
+            {
+               runData.pOutput[ k ] = validBitsOutput.data( ) +
+                                      k * numberPoints;
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          measureConversionTiming
+                 (
+                   convertForwardValidityBitsTimingRun,
+                   &runData,
+                   numberPoints,
+                   NUMBER_WARM_UP_RUNS,
+                   NUMBER_TIMED_RUNS,
+                   forwardValidityBitsTiming
+                 );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          numberMismatches +=
+          countValidityMismatches
+                 (
+                   numberPoints,
+                   runData.pInput,
+                   conversionStatus.data( ),
+                   validBits       .data( ),
+                   statusOutput    .data( ),
+                   validBitsOutput .data( )
+                 );
+       //-----------------------------------------------------------------------
+          fprintf
+           (
+             stdout,
+             "|    %9.1f %11.3f %8.3f %8zu %11.3f %8.3f %8zu%s\n",
+             100.0 * notFiniteShares[ share ],
+             inverseStatusTiming      .medianNanoSecondsPerPoint,
+             inverseValidityBitsTiming.medianNanoSecondsPerPoint,
+             numberInverseNotFinitePoints,
+             forwardStatusTiming      .medianNanoSecondsPerPoint,
+             forwardValidityBitsTiming.medianNanoSecondsPerPoint,
+             runData.batchValidity.numberNotFinitePoints,
+             ( ( numberInverseNotFinitePoints == numberNotFinitePoints ) &&
+               ( runData.batchValidity.numberNotFinitePoints ==
+                 numberNotFinitePoints ) ) ? "" : "  MISCOUNTED"
+           );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "%s\n"
+       "%s%zu\n"
+       "%s%s\n"
+       "\n\n\n",
+       "|",
+       "|    Points whose bit or outputs differ from the status call:  ",
+       numberMismatches,
+       "============================================",
+       "============================================"
+     );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
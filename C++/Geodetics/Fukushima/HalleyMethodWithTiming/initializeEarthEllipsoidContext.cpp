@@ -0,0 +1,174 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+initializeEarthEllipsoidContext
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double  earthEquatorialRadiusMeters,
+            const double  earthEllipsoidalFlatteningFactor,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  EARTH_ELLIPSOID_CONTEXT
+                         &rEllipsoidContext
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    initializeEarthEllipsoidContext
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Validate the parameters of a reference ellipsoid and compute every
+//    function of them used by the conversions, once, into an ellipsoid
+//    context.
+//
+//------------------------------------------------------------------------------
+//
+//  INPUTS:
+//     earthEquatorialRadiusMeters
+//       Length of Earth equatorial radius.
+//       Also length of Earth ellipsoid semi-major axis.
+//       UNITS:  [meters]
+//
+//     earthEllipsoidalFlatteningFactor
+//       Value of Earth ellipsoidal flattening factor.
+//       UNITS:  [nondimensional]
+//
+//------------------------------------------------------------------------------
+//
+//  OUTPUT:
+//
+//     rEllipsoidContext
+//       Reference to the ellipsoid context to initialize.  When the
+//       parameters are invalid every member is set to NAN, so a context
+//       which is used in spite of the returned status gives NAN results.
+//
+//------------------------------------------------------------------------------
+//
+//  RETURNED VALUE:
+//     Validation status:
+//        SUCCESSFUL_CONVERSION
+//        INVALID_ELLIPSOIDAL_FLATTENING
+//        INVALID_EQUATORIAL_RADIUS
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The validation is that of 'convertEcefToGeodetic', without the
+//          diagnostic messages.  A flattening factor in [ 0, 1 ) makes
+//          ec^2 = ( 1 - f )^2 strictly positive, so it needs no separate
+//          check here.
+//
+//    [ 2 ] The comparisons are written so that NAN parameters fail them.
+//
+//------------------------------------------------------------------------------
+//
+//  USAGE:
+//
+//    EARTH_ELLIPSOID_CONTEXT
+//     ellipsoidContext;
+//
+//    ecefToGeodeticConversionStatus =
+//    initializeEarthEllipsoidContext
+//           (
+//             //-------------------
+//             // INPUT(s):
+//             //-------------------
+//                earthEquatorialRadiusMeters,
+//                earthEllipsoidalFlatteningFactor,
+//             //-------------------
+//             // OUTPUT(s):
+//             //-------------------
+//                ellipsoidContext
+//           );
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    ECEF_TO_GEODETIC_CONVERSION_STATUS
+            returnValue = SUCCESSFUL_CONVERSION;
+ //-----------------------------------------------------------------------------
+    if(
+        !(
+           ( earthEllipsoidalFlatteningFactor >= 0.0 )
+           &&
+           ( earthEllipsoidalFlatteningFactor <  1.0 )
+         )
+      )
+      {
+          returnValue = INVALID_ELLIPSOIDAL_FLATTENING;
+      }
+    else
+    if( !( earthEquatorialRadiusMeters > 0.0 ) )
+      {
+          returnValue = INVALID_EQUATORIAL_RADIUS;
+      };
+ //-----------------------------------------------------------------------------
+    if( returnValue != SUCCESSFUL_CONVERSION )
+      {
+       //-----------------------------------------------------------------------
+          rEllipsoidContext.earthEquatorialRadiusMeters          = NAN;
+          rEllipsoidContext.earthEllipsoidalFlatteningFactor     = NAN;
+          rEllipsoidContext.earthEllipticitySquared              = NAN;
+          rEllipsoidContext.oneAndHalf_e4                        = NAN;
+          rEllipsoidContext.complimentaryEarthEllipticitySquared = NAN;
+          rEllipsoidContext.complimentaryEarthEllipticity        = NAN;
+          rEllipsoidContext.earthPolarRadiusMeters               = NAN;
+          rEllipsoidContext.inverseEarthEquatorialRadius         = NAN;
+          rEllipsoidContext.aEpsSquared                          = NAN;
+       //-----------------------------------------------------------------------
+          return( returnValue );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+ // Determine functions of the ellipsoid parameters.
+ //-----------------------------------------------------------------------------
+    const double eps           = 1.0e-16;
+    const double aEps          = earthEquatorialRadiusMeters * eps;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const double earthEllipticitySquared =
+                         ( 2.0 - earthEllipsoidalFlatteningFactor ) *
+                                 earthEllipsoidalFlatteningFactor;
+    const double complimentaryEarthEllipticitySquared
+                               = 1.0 - earthEllipticitySquared;
+    const double complimentaryEarthEllipticity
+                               = sqrt( complimentaryEarthEllipticitySquared );
+ //-----------------------------------------------------------------------------
+    rEllipsoidContext.earthEquatorialRadiusMeters =
+                                 earthEquatorialRadiusMeters;
+    rEllipsoidContext.earthEllipsoidalFlatteningFactor =
+                                 earthEllipsoidalFlatteningFactor;
+    rEllipsoidContext.earthEllipticitySquared =
+                                 earthEllipticitySquared;
+    rEllipsoidContext.oneAndHalf_e4 =
+                                 1.5 *
+                                 earthEllipticitySquared *
+                                 earthEllipticitySquared;
+    rEllipsoidContext.complimentaryEarthEllipticitySquared =
+                                 complimentaryEarthEllipticitySquared;
+    rEllipsoidContext.complimentaryEarthEllipticity =
+                                 complimentaryEarthEllipticity;
+    rEllipsoidContext.earthPolarRadiusMeters =
+                                 complimentaryEarthEllipticity *
+                                 earthEquatorialRadiusMeters;
+    rEllipsoidContext.inverseEarthEquatorialRadius =
+                                 1.0 / earthEquatorialRadiusMeters;
+    rEllipsoidContext.aEpsSquared =
+                                 aEps * aEps;
+ //-----------------------------------------------------------------------------
+    return( returnValue );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,486 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#if defined( __x86_64__ ) || defined( __i386__ )
+#   include <x86intrin.h>
+#endif
+
+#include "conversionBetweenEcefAndGeodetic.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+   using namespace std::chrono;
+
+//------------------------------------------------------------------------------
+// Serialized time stamp counter reads: no earlier instruction is still in
+// flight when the start is read, and none of the timed work is still in
+// flight when the stop is read.  Zero where there is no time stamp counter.
+//------------------------------------------------------------------------------
+static
+inline
+unsigned long long
+readStartTimeStampCounter(  )
+{
+#if defined( __x86_64__ ) || defined( __i386__ )
+    _mm_lfence( );
+    const unsigned long long timeStamp = __rdtsc( );
+    _mm_lfence( );
+    return( timeStamp );
+#else
+    return( 0 );
+#endif
+}
+//- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+static
+inline
+unsigned long long
+readStopTimeStampCounter(  )
+{
+#if defined( __x86_64__ ) || defined( __i386__ )
+    unsigned int processorIdentifier = 0;
+    const unsigned long long timeStamp = __rdtscp( &processorIdentifier );
+    _mm_lfence( );
+    return( timeStamp );
+#else
+    return( 0 );
+#endif
+}
+
+//------------------------------------------------------------------------------
+static
+double
+computeMedian
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            vector< double > values
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    computeMedian
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The median of a non-empty set of values, which is taken by value
+//    since it is partially sorted.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const size_t middle = values.size( ) / 2;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    nth_element( values.begin( ), values.begin( ) + middle, values.end( ) );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const double upperMedian = values[ middle ];
+ //-----------------------------------------------------------------------------
+    if( values.size( ) % 2 == 1 )
+      {
+          return( upperMedian );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const double lowerMedian = *max_element( values.begin( ),
+                                             values.begin( ) + middle );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    return( 0.5 * ( lowerMedian + upperMedian ) );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+static
+double
+computeMedianAbsoluteDeviation
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const vector< double > & rValues,
+            const double             median
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    computeMedianAbsoluteDeviation
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    The median of the absolute deviations of the values from their median.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    vector< double > absoluteDeviations( rValues.size( ) );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( size_t i = 0; i < rValues.size( ); i++ )
+      {
+          absoluteDeviations[ i ] = fabs( rValues[ i ] - median );
+      };
+ //-----------------------------------------------------------------------------
+    return( computeMedian( absoluteDeviations ) );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+measureConversionTiming
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            void        ( * pConvertRun )( void * pRunData ),
+            void          * pRunData,
+            const size_t    pointsPerRun,
+            const int       numberWarmUpRuns,
+            const int       numberTimedRuns,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+            CONVERSION_TIMING_STATISTICS
+                          & rTimingStatistics
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    measureConversionTiming
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Measure the execution time per point of a run of conversions, with
+//    the clock overhead removed, as robust statistics over repeated runs.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    [ 1 ] The overhead of a pair of clock reads, the steady clock and
+//          the time stamp counter together, is the median over
+//          TIMER_OVERHEAD_SAMPLES empty intervals.
+//
+//    [ 2 ] The run is called numberWarmUpRuns times untimed, to bring
+//          code and data into the caches and the processor out of its
+//          idle states, then numberTimedRuns times timed.
+//
+//    [ 3 ] A compiler barrier on each side of the run keeps the compiler
+//          from moving work into or out of the timed interval, and the
+//          run is called through a pointer, so it can not be removed.
+//          The run must store its results to memory.
+//
+//    [ 4 ] Each timed interval less the overhead is divided by
+//          pointsPerRun.  The median and the median absolute deviation
+//          (MAD) of these per point times are reported, being insensitive
+//          to the occasional run interrupted by the operating system.
+//
+//------------------------------------------------------------------------------
+//
+//  INPUTS:
+//
+//     pConvertRun
+//       Function converting one run of pointsPerRun points.
+//
+//     pRunData
+//       Argument passed to pConvertRun.
+//
+//     pointsPerRun
+//       Number of conversions in one run.  A run should last at least
+//       some tens of microseconds, so the clock resolution and overhead
+//       are small beside it.
+//
+//     numberWarmUpRuns
+//     numberTimedRuns
+//       Number of untimed and of timed runs; numberTimedRuns >= 1.
+//
+//------------------------------------------------------------------------------
+//
+//  OUTPUT:
+//
+//     rTimingStatistics
+//       The statistics; see CONVERSION_TIMING_STATISTICS.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The cycle counts are time stamp counter ticks, which run at the
+//          nominal frequency of the processor whatever its current clock,
+//          and are NAN where there is no time stamp counter.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const
+    int
+     TIMER_OVERHEAD_SAMPLES = 1001;
+ //-----------------------------------------------------------------------------
+ // Overhead of the clock reads around an empty interval.
+ //-----------------------------------------------------------------------------
+    vector< double > overheadNanoSeconds( TIMER_OVERHEAD_SAMPLES );
+    vector< double > overheadCycles     ( TIMER_OVERHEAD_SAMPLES );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int s = 0; s < TIMER_OVERHEAD_SAMPLES; s++ )
+      {
+          const auto               startTime   = steady_clock::now( );
+          const unsigned long long startCycles = readStartTimeStampCounter( );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          preventConversionTimingReordering( );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          const unsigned long long stopCycles  = readStopTimeStampCounter( );
+          const auto               stopTime    = steady_clock::now( );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          overheadNanoSeconds[ s ] =
+                  duration< double, nano >( stopTime - startTime ).count( );
+          overheadCycles     [ s ] = ( double )( stopCycles - startCycles );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const double
+     timerOverheadNanoSeconds = computeMedian( overheadNanoSeconds );
+    const double
+     timerOverheadCycles      = computeMedian( overheadCycles      );
+ //-----------------------------------------------------------------------------
+ // Warm-up runs.
+ //-----------------------------------------------------------------------------
+    for( int r = 0; r < numberWarmUpRuns; r++ )
+      {
+          pConvertRun( pRunData );
+      };
+ //-----------------------------------------------------------------------------
+ // Timed runs.
+ //-----------------------------------------------------------------------------
+    vector< double > nanoSecondsPerPoint( numberTimedRuns );
+    vector< double > cyclesPerPoint     ( numberTimedRuns );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int r = 0; r < numberTimedRuns; r++ )
+      {
+          const auto               startTime   = steady_clock::now( );
+          const unsigned long long startCycles = readStartTimeStampCounter( );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          preventConversionTimingReordering( );
+          pConvertRun( pRunData );
+          preventConversionTimingReordering( );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          const unsigned long long stopCycles  = readStopTimeStampCounter( );
+          const auto               stopTime    = steady_clock::now( );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          nanoSecondsPerPoint[ r ] =
+                  max(
+                       0.0,
+                       duration< double, nano >( stopTime - startTime ).count( )
+                       - timerOverheadNanoSeconds
+                     )
+                  / pointsPerRun;
+          cyclesPerPoint     [ r ] =
+                  max(
+                       0.0,
+                       ( double )( stopCycles - startCycles )
+                       - timerOverheadCycles
+                     )
+                  / pointsPerRun;
+      };
+ //-----------------------------------------------------------------------------
+    rTimingStatistics.pointsPerRun              = pointsPerRun;
+    rTimingStatistics.numberTimedRuns           = numberTimedRuns;
+    rTimingStatistics.timerOverheadNanoSeconds  = timerOverheadNanoSeconds;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    rTimingStatistics.medianNanoSecondsPerPoint =
+                          computeMedian( nanoSecondsPerPoint );
+    rTimingStatistics.madNanoSecondsPerPoint    =
+                          computeMedianAbsoluteDeviation
+                                 (
+                                   nanoSecondsPerPoint,
+                                   rTimingStatistics.medianNanoSecondsPerPoint
+                                 );
+    rTimingStatistics.minimumNanoSecondsPerPoint =
+                          *min_element( nanoSecondsPerPoint.begin( ),
+                                        nanoSecondsPerPoint.end( ) );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+#if defined( __x86_64__ ) || defined( __i386__ )
+    rTimingStatistics.medianCyclesPerPoint      =
+                          computeMedian( cyclesPerPoint );
+    rTimingStatistics.madCyclesPerPoint         =
+                          computeMedianAbsoluteDeviation
+                                 (
+                                   cyclesPerPoint,
+                                   rTimingStatistics.medianCyclesPerPoint
+                                 );
+#else
+    rTimingStatistics.medianCyclesPerPoint      = NAN;
+    rTimingStatistics.madCyclesPerPoint         = NAN;
+#endif
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
+
+//------------------------------------------------------------------------------
+void
+generateTimingGeodeticPoints
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double    earthEquatorialRadiusMeters,
+            const double    earthEllipsoidalEccentricitySquared,
+            const double    minimumAltitudeMeters,
+            const double    maximumAltitudeMeters,
+            const TIMING_ALTITUDE_SPACING
+                            altitudeSpacing,
+            const size_t    polePointInterval,
+            const size_t    numberPoints,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double  * pGeodeticNorthLatitudeRadians,
+                  double  * pGeocentricEastLongitudeRadians,
+                  double  * pGeodeticAltitudeMeters,
+                  double  * pXEcefMeters,
+                  double  * pYEcefMeters,
+                  double  * pZEcefMeters,
+                  double  * pExtraUniformDeviates
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    generateTimingGeodeticPoints
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Generate the points which the timing sections convert, the same
+//    points from run to run and from host to host.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    [ 1 ] Three uniform deviates in [ 0, 1 ) per point, four when
+//          pExtraUniformDeviates is not NULL, from a xorshift generator
+//          with a fixed seed.
+//
+//    [ 2 ] The latitude is uniform in [ -pi/2, pi/2 ) and the longitude
+//          in [ -pi, pi ).  The altitude is uniform in
+//          [ minimumAltitudeMeters, maximumAltitudeMeters ), or for
+//          ASINH_TIMING_ALTITUDE_SPACING uniform in asinh of the altitude
+//          in km over that range.
+//
+//    [ 3 ] When polePointInterval is not 0, every polePointInterval-th
+//          point is moved to the pole of its hemisphere, at longitude 0,
+//          so the polar branches of the conversions are timed too.
+//
+//    [ 4 ] The ECEF coordinates are from
+//          'convertGeodeticToEcefBaselineClone' rather than the indirect
+//          function 'convertGeodeticToEcef', so the points do not depend
+//          on the host CPU.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const
+    double
+     piRadians            = 4.0 * atan( 1.0 );
+    const
+    double
+     minimumAsinhAltitude = asinh( minimumAltitudeMeters / 1000.0 );
+    const
+    double
+     maximumAsinhAltitude = asinh( maximumAltitudeMeters / 1000.0 );
+    const
+    int
+     numberDeviates       = ( pExtraUniformDeviates != NULL ) ? 4 : 3;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    unsigned long long
+     randomState = 88172645463325252ULL;
+ //-----------------------------------------------------------------------------
+    for( size_t i = 0; i < numberPoints; i++ )
+      {
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          double uniformDeviate[ 4 ];
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( int k = 0; k < numberDeviates; k++ )
+            {
+               randomState ^= randomState << 13;
+               randomState ^= randomState >>  7;
+               randomState ^= randomState << 17;
+               uniformDeviate[ k ] = ( randomState >> 11 ) * 0x1.0p-53;
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          double latitudeRadians  = piRadians * ( uniformDeviate[ 0 ] - 0.5 );
+          double longitudeRadians = piRadians *
+                                    ( 2.0 * uniformDeviate[ 1 ] - 1.0 );
+          double altitudeMeters;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( altitudeSpacing == ASINH_TIMING_ALTITUDE_SPACING )
+            {
+               altitudeMeters = 1000.0 *
+                                sinh( minimumAsinhAltitude +
+                                      ( maximumAsinhAltitude -
+                                        minimumAsinhAltitude ) *
+                                      uniformDeviate[ 2 ] );
+            }
+          else
+            {
+               altitudeMeters = minimumAltitudeMeters +
+                                ( maximumAltitudeMeters -
+                                  minimumAltitudeMeters ) *
+                                uniformDeviate[ 2 ];
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( ( polePointInterval > 0 ) &&
+              ( i % polePointInterval == polePointInterval - 1 ) )
+            {
+               latitudeRadians  = copysign( 0.5 * piRadians, latitudeRadians );
+               longitudeRadians = 0.0;
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( pGeodeticNorthLatitudeRadians != NULL )
+            {
+               pGeodeticNorthLatitudeRadians[ i ] = latitudeRadians;
+            };
+          if( pGeocentricEastLongitudeRadians != NULL )
+            {
+               pGeocentricEastLongitudeRadians[ i ] = longitudeRadians;
+            };
+          if( pGeodeticAltitudeMeters != NULL )
+            {
+               pGeodeticAltitudeMeters[ i ] = altitudeMeters;
+            };
+          if( pExtraUniformDeviates != NULL )
+            {
+               pExtraUniformDeviates[ i ] = uniformDeviate[ 3 ];
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          if( pXEcefMeters != NULL )
+            {
+               ( void )
+               convertGeodeticToEcefBaselineClone
+                      (
+                        earthEquatorialRadiusMeters,
+                        earthEllipsoidalEccentricitySquared,
+                        latitudeRadians,
+                        longitudeRadians,
+                        altitudeMeters,
+                        pXEcefMeters[ i ],
+                        pYEcefMeters[ i ],
+                        pZEcefMeters[ i ]
+                      );
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
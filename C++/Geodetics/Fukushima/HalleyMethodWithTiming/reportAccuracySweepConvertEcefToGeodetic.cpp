@@ -0,0 +1,196 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+// Short names of the latitude and altitude bands of the report.
+//------------------------------------------------------------------------------
+static const char * const LATITUDE_BAND_NAMES
+                              [ NUMBER_ACCURACY_SWEEP_LATITUDE_BANDS ] =
+                              { "0-15", "15-60", "60-85", "85-90" };
+static const char * const ALTITUDE_BAND_NAMES
+                              [ NUMBER_ACCURACY_SWEEP_ALTITUDE_BANDS ] =
+                              { "subsurf", "<100km", "LEO", "MEO", "GEO+" };
+
+//------------------------------------------------------------------------------
+static
+void
+reportAccuracySweepRow
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const char * pLatitudeBandName,
+            const char * pAltitudeBandName,
+            const ACCURACY_SWEEP_STATISTICS
+                       & rStatistics,
+            const bool   isLatitudeError
+       )
+{
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "| %6s %-8s %11zu %6zu %10.4g %10.4g %10.4g %10.4g\n",
+       pLatitudeBandName,
+       pAltitudeBandName,
+       rStatistics.numberPoints,
+       rStatistics.numberFailedConversions,
+       isLatitudeError ? rStatistics.percentile50LatitudeErrorMicroArcSecs :
+                         rStatistics.percentile50AltitudeErrorNanoMeters,
+       isLatitudeError ? rStatistics.percentile99LatitudeErrorMicroArcSecs :
+                         rStatistics.percentile99AltitudeErrorNanoMeters,
+       isLatitudeError ? rStatistics.percentile999LatitudeErrorMicroArcSecs :
+                         rStatistics.percentile999AltitudeErrorNanoMeters,
+       isLatitudeError ? rStatistics.maximumLatitudeErrorMicroArcSecs :
+                         rStatistics.maximumAltitudeErrorNanoMeters
+     );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+void
+reportAccuracySweepConvertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const char      * pKernelName,
+            const ACCURACY_SWEEP_SPECIFICATION
+                            & rSweepSpecification,
+            const ACCURACY_SWEEP_STATISTICS
+              regionStatistics[ NUMBER_ACCURACY_SWEEP_LATITUDE_BANDS ]
+                              [ NUMBER_ACCURACY_SWEEP_ALTITUDE_BANDS ],
+            const ACCURACY_SWEEP_STATISTICS
+                            & rSweepStatistics,
+            const double      elapsedSeconds
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    reportAccuracySweepConvertEcefToGeodetic
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Write the grid, the throughput, and for each region of absolute
+//    latitude [degrees] by altitude, and for the whole sweep, the number
+//    of points and failed conversions and the 50th, 99th and 99.9th
+//    percentiles and maximum of the latitude and altitude errors.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The percentiles are upper bounds within 12% (see
+//          'executeAccuracySweepConvertEcefToGeodetic'); the maxima are
+//          exact.  A failed conversion is an infinite error.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "\n\n\n"
+       "%s%s\n"
+       "%s\n"
+       "| ACCURACY SWEEP RESULTS:  %s\n"
+       "%s\n"
+       "|    Latitudes  %6d  from %+10.4f to %+10.4f [degrees]\n"
+       "|    Longitudes %6d  from %+10.4f to %+10.4f [degrees], exclusive\n"
+       "|    Altitudes  %6d  from %+14.1f to %+14.1f [meters]\n"
+       "|    %zu points in %.3f seconds, %.2f Mpoint/s\n",
+       "============================================",
+       "============================================",
+       "|",
+       pKernelName,
+       "|",
+       rSweepSpecification.numberLatitudes,
+       rSweepSpecification.minimumLatitudeDegrees,
+       rSweepSpecification.maximumLatitudeDegrees,
+       rSweepSpecification.numberLongitudes,
+       rSweepSpecification.minimumLongitudeDegrees,
+       rSweepSpecification.maximumLongitudeDegrees,
+       rSweepSpecification.numberAltitudes,
+       rSweepSpecification.minimumAltitudeMeters,
+       rSweepSpecification.maximumAltitudeMeters,
+       rSweepStatistics.numberPoints,
+       elapsedSeconds,
+       1.0E-6 * rSweepStatistics.numberPoints / elapsedSeconds
+     );
+ //-----------------------------------------------------------------------------
+ // One table for the latitude errors, one for the altitude errors.
+ //-----------------------------------------------------------------------------
+    for( int table = 0; table < 2; table++ )
+      {
+       //-----------------------------------------------------------------------
+          const bool isLatitudeError = ( table == 0 );
+       //-----------------------------------------------------------------------
+          fprintf
+           (
+             stdout,
+             "%s\n"
+             "%s%s\n"
+             "%s\n"
+             "%s\n"
+             "%s\n",
+             "|",
+             "|-------------------------------------------",
+             "--------------------------------------------",
+             isLatitudeError ?
+             "|  Latitude error [microarcseconds]" :
+             "|  Altitude error [nanometers]",
+             "|   |lat| altitude      points failed     p50 <=     p99 <="
+             "   p99.9 <=    maximum",
+             "|"
+           );
+       //-----------------------------------------------------------------------
+          for( int b = 0; b < NUMBER_ACCURACY_SWEEP_LATITUDE_BANDS; b++ )
+            {
+                for( int c = 0; c < NUMBER_ACCURACY_SWEEP_ALTITUDE_BANDS; c++ )
+                  {
+                     if( regionStatistics[ b ][ c ].numberPoints > 0 )
+                       {
+                          reportAccuracySweepRow
+                                 (
+                                   LATITUDE_BAND_NAMES[ b ],
+                                   ALTITUDE_BAND_NAMES[ c ],
+                                   regionStatistics[ b ][ c ],
+                                   isLatitudeError
+                                 );
+                       };
+                  };
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          fprintf( stdout, "%s\n", "|" );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          reportAccuracySweepRow
+                 (
+                   "all",
+                   "",
+                   rSweepStatistics,
+                   isLatitudeError
+                 );
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "%s\n"
+       "%s%s\n"
+       "\n\n\n",
+       "|",
+       "============================================",
+       "============================================"
+     );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
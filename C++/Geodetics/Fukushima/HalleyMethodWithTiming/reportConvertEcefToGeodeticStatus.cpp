@@ -0,0 +1,189 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+void
+reportConvertEcefToGeodeticStatus
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const ECEF_TO_GEODETIC_CONVERSION_STATUS
+                          conversionStatus,
+            const double  earthEquatorialRadiusMeters,
+            const double  earthEllipsoidalFlatteningFactor
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    reportConvertEcefToGeodeticStatus
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Write the purpose, usage and error messages describing a failed
+//    conversion by 'convertEcefToGeodetic' to stdout.
+//
+//------------------------------------------------------------------------------
+//
+//  INPUTS:
+//
+//     conversionStatus
+//       The status returned by 'convertEcefToGeodetic', or an element of
+//       the status array of 'convertEcefToGeodeticBatch'.
+//
+//     earthEquatorialRadiusMeters
+//     earthEllipsoidalFlatteningFactor
+//       The ellipsoid parameters passed to the conversion.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The conversion functions write no messages, so that they are
+//          reentrant and small enough to inline.  This is the cold path
+//          which formerly lived in their error branches; a caller which
+//          wants the messages calls it with the returned status.
+//
+//    [ 2 ] Nothing is written for SUCCESSFUL_CONVERSION.
+//
+//------------------------------------------------------------------------------
+//
+//  USAGE:
+//
+//    if( ecefToGeodeticConversionStatus != SUCCESSFUL_CONVERSION )
+//      {
+//         reportConvertEcefToGeodeticStatus
+//                (
+//                  ecefToGeodeticConversionStatus,
+//                  earthEquatorialRadiusMeters,
+//                  earthEllipsoidalFlatteningFactor
+//                );
+//      };
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    if( conversionStatus == SUCCESSFUL_CONVERSION )
+      {
+          return;
+      };
+ //-----------------------------------------------------------------------------
+ // Generate the purpose and usage messages.
+ //-----------------------------------------------------------------------------
+    generateConvertEcefToGeodeticPurposeMessage(  );
+    generateConvertEcefToGeodeticUsageMessage(  );
+ //-----------------------------------------------------------------------------
+ // Generate an error message.
+ //-----------------------------------------------------------------------------
+    if( conversionStatus == INVALID_ELLIPSOIDAL_FLATTENING )
+      {
+          fprintf
+          (
+            stdout,
+            "\n\n\n"
+            "%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n"
+            "%s\n"
+            "%s%14.6e\n"
+            "%s\n%s\n%s\n%s\n"
+            "\n\n\n",
+            "============================================================",
+            "|",
+            "|  ERROR:",
+            "|",
+            "|    The specified Earth ellipsoidal flattening factor",
+            "|    parameter value is invalid.",
+            "|",
+            "|    Expected Earth ellipsoidal flattening factor",
+            "|    parameter value to be in the interval:  [ 0.0, 1.0 ).",
+            "|",
+            "|    Specified Earth ellipsoidal flattening factor",
+            "|    parameter value is:-->",
+            earthEllipsoidalFlatteningFactor,
+            "|",
+            "|    This is an error.",
+            "|",
+            "============================================================"
+          );
+      }
+    else
+    if( conversionStatus == INVALID_EQUATORIAL_RADIUS )
+      {
+          fprintf
+          (
+            stdout,
+            "\n\n\n"
+            "%s%s\n"
+            "%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n"
+            "%s%14.6e\n"
+            "%s\n%s\n%s\n"
+            "%s%s\n"
+            "\n\n\n",
+            "======================================================",
+            "======",
+            "|",
+            "|  ERROR:",
+            "|",
+            "|    The specified Earth equatorial radius (major",
+            "|    semiaxis length) parameter value is invalid.",
+            "|",
+            "|    Expected Earth equatorial radius value to be",
+            "|    strictly positive.",
+            "|",
+            "|    Specified Earth equatorial radius parameter",
+            "|    value is:-->",
+            earthEquatorialRadiusMeters,
+            "|",
+            "|    This is an error.",
+            "|",
+            "======================================================",
+            "======"
+          );
+      }
+    else
+    if( conversionStatus == INVALID_ECEF_COORDINATES )
+      {
+          fprintf
+          (
+            stdout,
+            "\n\n\n"
+            "%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n%s\n"
+            "\n\n\n",
+            "============================================================",
+            "|",
+            "|  ERROR:",
+            "|",
+            "|    The specified ECEF coordinates are not all finite.",
+            "|",
+            "|    This is an error.",
+            "|",
+            "============================================================"
+          );
+      }
+    else
+      {
+          fprintf
+          (
+            stdout,
+            "\n\n\n"
+            "%s\n%s\n%s\n%s\n%s\n%s\n%s\n"
+            "\n\n\n",
+            "============================================================",
+            "|",
+            "|  ERROR:",
+            "|",
+            "|    Encountered undetermined Geodetic conversion error.",
+            "|",
+            "============================================================"
+          );
+      };
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,123 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+void
+reportConvertGeodeticToEcefStatus
+       (
+        //----------------
+        // INPUT(s):
+        //----------------
+           const ECEF_TO_GEODETIC_CONVERSION_STATUS
+                          conversionStatus,
+           const double   earthEquatorialRadiusMeters,
+           const double   earthEllipsoidalEccentricitySquared,
+           const double   geodeticNorthLatitudeRadians,
+           const double   geodeticAltitudeMeters
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    reportConvertGeodeticToEcefStatus
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Write the purpose, usage and error messages describing a failed
+//    conversion by 'convertGeodeticToEcef' to stdout.
+//
+//------------------------------------------------------------------------------
+//
+//  INPUTS:
+//
+//     conversionStatus
+//       The status returned by 'convertGeodeticToEcef'.
+//
+//     earthEquatorialRadiusMeters
+//     earthEllipsoidalEccentricitySquared
+//     geodeticNorthLatitudeRadians
+//     geodeticAltitudeMeters
+//       The inputs passed to the conversion, from which the length
+//       quantities rho and rhoz are recomputed for the message.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] Nothing is written for SUCCESSFUL_CONVERSION.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    if( conversionStatus == SUCCESSFUL_CONVERSION )
+      {
+          return;
+      };
+ //-----------------------------------------------------------------------------
+ // Recompute the length quantities as in 'convertGeodeticToEcef'.
+ //-----------------------------------------------------------------------------
+    const
+    double
+        sineOfGeodeticNorthLatitude   = sin( geodeticNorthLatitudeRadians );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    double
+      N    = earthEquatorialRadiusMeters /
+             sqrt(
+                   1.0E0 +
+                   (
+                     -earthEllipsoidalEccentricitySquared *
+                      sineOfGeodeticNorthLatitude         *
+                      sineOfGeodeticNorthLatitude
+                   )
+                 );
+    const
+    double
+      rho  = N + geodeticAltitudeMeters;
+    const
+    double
+      rhoz = ( ( 1.0E0 - earthEllipsoidalEccentricitySquared ) * N ) +
+             geodeticAltitudeMeters;
+ //-----------------------------------------------------------------------------
+ // Generate the purpose and usage messages.
+ //-----------------------------------------------------------------------------
+    generateConvertGeodeticToEcefPurposeMessage(  );
+    generateConvertGeodeticToEcefUsageMessage(  );
+ //-----------------------------------------------------------------------------
+ // Generate an error message.
+ //-----------------------------------------------------------------------------
+    fprintf
+    (
+      stdout,
+      "\n\n\n"
+      "%s\n%s\n%s\n%s\n%s\n%s\n%s\n"
+      "%s%14.6e\n"
+      "%s%14.6e\n"
+      "%s\n%s\n%s\n%s\n"
+      "\n\n\n",
+      "============================================================",
+      "|",
+      "|  ERROR:",
+      "|",
+      "|    The computed length quantities rho and rhoz are",
+      "|    not both positive.",
+      "|",
+      "|    Computed value for rho  is:-->",
+      rho,
+      "|    Computed value for rhoz is:-->",
+      rhoz,
+      "|",
+      "|    This is an error.",
+      "|",
+      "============================================================"
+    );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,204 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include "conversionBetweenEcefAndGeodetic.h"
+#include "convertEcefToGeodeticForEllipsoid.h"
+
+//------------------------------------------------------------------------------
+void
+reportOneTrialConvertEcefToGeodetic
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double  specifiedFixedTrueGeocentricEastLongitudeDegrees,
+            const TRIAL_POINT_RESULT
+                        * pTrialPointResults,
+            const CONVERSION_TIMING_STATISTICS
+                        & rTrialTimingStatistics,
+            const double  maximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs,
+            const double  maximumGeodeticAltitudeAbsoluteErrorNanoMeters
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    reportOneTrialConvertEcefToGeodetic
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Write the output header, the residuals of each point, the timing and
+//    the maximum errors of one trial of 'executeOneTrialConvertEcefToGeodetic'
+//    to stdout.
+//
+//------------------------------------------------------------------------------
+//
+//  INPUTS:
+//
+//     specifiedFixedTrueGeocentricEastLongitudeDegrees
+//       The true geocentric East longitude of the trial.
+//       UNIT(s):  [degrees]
+//
+//     pTrialPointResults
+//     rTrialTimingStatistics
+//     maximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs
+//     maximumGeodeticAltitudeAbsoluteErrorNanoMeters
+//       The outputs of 'executeOneTrialConvertEcefToGeodetic' for the trial.
+//
+//------------------------------------------------------------------------------
+//
+//  NOTE(s):
+//
+//    [ 1 ] The trial itself writes nothing, so no formatting or stdout
+//          traffic runs between its timed conversions.  The caller writes
+//          the report after each trial, after all trials, or not at all.
+//
+//    [ 2 ] The messages of a failed conversion are written for the GRS80
+//          ellipsoid of the trials.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    typedef ELLIPSOID_CONSTANTS< GRS80_ELLIPSOID > GRS80;
+ //-----------------------------------------------------------------------------
+ //
+ // Generate header for output.
+ //
+ //-----------------------------------------------------------------------------
+    generateTestProgramOutputHeader
+            (
+              specifiedFixedTrueGeocentricEastLongitudeDegrees
+            );
+ //-----------------------------------------------------------------------------
+ // Output the residuals, or the messages of a failed conversion.
+ //-----------------------------------------------------------------------------
+    for( int pointIndex = 0;
+             pointIndex < NUMBER_POINTS_PER_TRIAL;
+             pointIndex++ )
+      {
+       //-----------------------------------------------------------------------
+          const
+          TRIAL_POINT_RESULT
+              & rPointResult = pTrialPointResults[ pointIndex ];
+       //-----------------------------------------------------------------------
+          if( rPointResult.conversionStatus == SUCCESSFUL_CONVERSION )
+            {
+             //-----------------------------------------------------------------
+                fprintf
+                  (       
+                    stdout,
+                    "%+19.10f %+18.5f  %+19.10e  %+18.10e\n",
+                    rPointResult.trueGeodeticNorthLatitudeDegrees,
+                    rPointResult.trueGeodeticAltitudeMeters,
+                    rPointResult.deltaGeodeticLatitudeMicroArcSecs,
+                    rPointResult.deltaGeodeticAltitudeNanoMeters
+                  );
+             //-----------------------------------------------------------------
+            }
+          else
+            {
+             //-----------------------------------------------------------------
+                reportConvertEcefToGeodeticStatus
+                       (
+                         rPointResult.conversionStatus,
+                         GRS80::earthEquatorialRadiusMeters,
+                         GRS80::earthEllipsoidalFlatteningFactor
+                       );
+             //-----------------------------------------------------------------
+            };
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+ // Finish the output report.
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "%s%s\n\n\n",
+       "============================================",
+       "============================================"
+     );
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+       "\n\n\n"
+       "%s%s\n"
+       "%s\n%s\n%s\n"
+       "%s%d%s%zu%s\n"
+       "%s%10.3f%s%8.3f%s\n"
+       "%s%10.3f%s%8.3f%s\n"
+       "%s%10.3f%s\n"
+       "%s%10.3f%s\n"
+       "%s\n"
+       "%s%s\n"
+       "\n\n\n",
+       "==================================================================",
+       "======================",
+       "|",
+       "| TRIAL TIMING RESULTS:",
+       "|",
+       "|   Timed runs of 'convertEcefToGeodetic' calls:  ",
+       rTrialTimingStatistics.numberTimedRuns,
+       " x ",
+       rTrialTimingStatistics.pointsPerRun,
+       " calls",
+       "|   Median time per call:        ",
+       rTrialTimingStatistics.medianNanoSecondsPerPoint,
+       " [nanoseconds]  MAD ",
+       rTrialTimingStatistics.madNanoSecondsPerPoint,
+       " [nanoseconds]",
+       "|   Median cycles per call:      ",
+       rTrialTimingStatistics.medianCyclesPerPoint,
+       " [cycles]       MAD ",
+       rTrialTimingStatistics.madCyclesPerPoint,
+       " [cycles]",
+       "|   Minimum time per call:       ",
+       rTrialTimingStatistics.minimumNanoSecondsPerPoint,
+       " [nanoseconds]",
+       "|   Subtracted timer overhead:   ",
+       rTrialTimingStatistics.timerOverheadNanoSeconds,
+       " [nanoseconds per run]",
+       "|",
+       "==================================================================",
+       "======================"
+     );
+ //-----------------------------------------------------------------------------
+    fprintf
+     (
+       stdout,
+         "\n\n\n"
+         "%s%s\n"
+         "%s\n%s\n%s\n%s\n"
+         "%s%+14.6e%s\n"
+         "%s\n%s\n"
+         "%s%+14.6e%s\n"
+         "%s\n"
+         "%s%s\n"
+         "\n\n\n",
+       "============================================",
+       "============================================",
+       "|",
+       "|  MAXIMUM ABSOLUTE ERRORS OVER ONE TRIAL:",
+       "|",
+       "|    Maximum geodetic north latitude absolute error",
+       "|      is:-->",
+       maximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs,
+       " [microarcseconds]",
+       "|",
+       "|    Maximum geodetic altitude absolute error",
+       "|      is:-->",
+       maximumGeodeticAltitudeAbsoluteErrorNanoMeters,
+       " [nanometers]",
+       "|",
+       "============================================",
+       "============================================"
+     );
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
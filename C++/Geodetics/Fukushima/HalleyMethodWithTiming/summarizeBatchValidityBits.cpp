@@ -0,0 +1,117 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <float.h>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+void
+summarizeBatchValidityBits
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const size_t   numberPoints,
+            const double * pInput0,
+            const double * pInput1,
+            const double * pInput2,
+            const unsigned long long
+                         * pValidBits,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  ECEF_TO_GEODETIC_BATCH_VALIDITY
+                         & rBatchValidity
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    summarizeBatchValidityBits
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Count the points of a batch conversion with validity bits which are
+//    converted and which are not, and, of the latter, those with an input
+//    coordinate which is NAN or infinite.
+//
+//------------------------------------------------------------------------------
+//
+//  INPUTS:
+//     numberPoints
+//       Number of points in the batch.
+//
+//     pInput0
+//     pInput1
+//     pInput2
+//       The three input coordinate arrays of the batch conversion.
+//
+//     pValidBits
+//       The ( numberPoints + 63 ) / 64 words of validity bits of the batch,
+//       bit i % 64 of word i / 64 for point i.  The bits of the last word
+//       past numberPoints must be clear.
+//
+//------------------------------------------------------------------------------
+//
+//  OUTPUT:
+//     rBatchValidity
+//       The summary counts of the batch.
+//
+//------------------------------------------------------------------------------
+//
+//  METHOD:
+//
+//    [ 1 ] The converted points are the population count of the words.
+//
+//    [ 2 ] Only the clear bits of a word are visited, lowest first, to
+//          test their inputs; a word with every bit set costs a compare.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const size_t numberWords = ( numberPoints + 63 ) / 64;
+ //-----------------------------------------------------------------------------
+    size_t numberValidPoints     = 0;
+    size_t numberNotFinitePoints = 0;
+ //-----------------------------------------------------------------------------
+    for( size_t word = 0; word < numberWords; word++ )
+      {
+       //-----------------------------------------------------------------------
+          const size_t wordPoints = ( numberPoints - 64 * word < 64 ) ?
+                                    ( numberPoints - 64 * word ) : 64;
+       //-----------------------------------------------------------------------
+          numberValidPoints += __builtin_popcountll( pValidBits[ word ] );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          unsigned long long
+           invalidBits = ~pValidBits[ word ] &
+                         ( ( wordPoints == 64 ) ?
+                           ~0ULL : ( ( 1ULL << wordPoints ) - 1ULL ) );
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          while( invalidBits != 0 )
+            {
+               const size_t i = 64 * word + __builtin_ctzll( invalidBits );
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               invalidBits &= invalidBits - 1;
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+               numberNotFinitePoints +=
+                    !(
+                       ( fabs( pInput0[ i ] ) <= DBL_MAX ) &&
+                       ( fabs( pInput1[ i ] ) <= DBL_MAX ) &&
+                       ( fabs( pInput2[ i ] ) <= DBL_MAX )
+                     );
+            };
+       //-----------------------------------------------------------------------
+      };
+ //-----------------------------------------------------------------------------
+    rBatchValidity.numberValidPoints     = numberValidPoints;
+    rBatchValidity.numberInvalidPoints   = numberPoints - numberValidPoints;
+    rBatchValidity.numberNotFinitePoints = numberNotFinitePoints;
+ //-----------------------------------------------------------------------------
+    return;
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
@@ -0,0 +1,422 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+//------------------------------------------------------------------------------
+   using namespace std;
+
+//------------------------------------------------------------------------------
+// The accuracy tier batches with the signature of an
+// ECEF_TO_GEODETIC_BATCH_FUNCTION.
+//------------------------------------------------------------------------------
+template< ECEF_TO_GEODETIC_ACCURACY_TIER TIER >
+static
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertEcefToGeodeticBatchForTier
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double   earthEquatorialRadiusMeters,
+            const double   earthEllipsoidalFlatteningFactor,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pGeodeticNorthLatitudeRadians,
+                  double * pGeocentricEastLongitudeRadians,
+                  double * pGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+{
+ //-----------------------------------------------------------------------------
+    EARTH_ELLIPSOID_CONTEXT
+            ellipsoidContext;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    ECEF_TO_GEODETIC_CONVERSION_STATUS
+            returnValue = initializeEarthEllipsoidContext
+                                 (
+                                   earthEquatorialRadiusMeters,
+                                   earthEllipsoidalFlatteningFactor,
+                                   ellipsoidContext
+                                 );
+ //-----------------------------------------------------------------------------
+    if( returnValue == SUCCESSFUL_CONVERSION )
+      {
+          convertEcefToGeodeticBatch
+                 (
+                   ellipsoidContext,
+                   TIER,
+                   numberPoints,
+                   pXEcefMeters,
+                   pYEcefMeters,
+                   pZEcefMeters,
+                   pGeodeticNorthLatitudeRadians,
+                   pGeocentricEastLongitudeRadians,
+                   pGeodeticAltitudeMeters,
+                   pConversionStatus
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    return( returnValue );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+// The single precision batch with the signature of an
+// ECEF_TO_GEODETIC_BATCH_FUNCTION.
+//------------------------------------------------------------------------------
+static
+ECEF_TO_GEODETIC_CONVERSION_STATUS
+convertEcefToGeodeticBatchForSinglePrecision
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const double   earthEquatorialRadiusMeters,
+            const double   earthEllipsoidalFlatteningFactor,
+            const size_t   numberPoints,
+            const double * pXEcefMeters,
+            const double * pYEcefMeters,
+            const double * pZEcefMeters,
+         //-------------------
+         // OUTPUT(s):
+         //-------------------
+                  double * pGeodeticNorthLatitudeRadians,
+                  double * pGeocentricEastLongitudeRadians,
+                  double * pGeodeticAltitudeMeters,
+                  ECEF_TO_GEODETIC_CONVERSION_STATUS
+                         * pConversionStatus
+       )
+{
+ //-----------------------------------------------------------------------------
+    EARTH_ELLIPSOID_CONTEXT
+            ellipsoidContext;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    ECEF_TO_GEODETIC_CONVERSION_STATUS
+            returnValue = initializeEarthEllipsoidContext
+                                 (
+                                   earthEquatorialRadiusMeters,
+                                   earthEllipsoidalFlatteningFactor,
+                                   ellipsoidContext
+                                 );
+ //-----------------------------------------------------------------------------
+    if( returnValue == SUCCESSFUL_CONVERSION )
+      {
+          convertEcefToGeodeticBatchInSinglePrecision
+                 (
+                   ellipsoidContext,
+                   numberPoints,
+                   pXEcefMeters,
+                   pYEcefMeters,
+                   pZEcefMeters,
+                   pGeodeticNorthLatitudeRadians,
+                   pGeocentricEastLongitudeRadians,
+                   pGeodeticAltitudeMeters,
+                   pConversionStatus
+                 );
+      };
+ //-----------------------------------------------------------------------------
+    return( returnValue );
+ //-----------------------------------------------------------------------------
+}
+
+//------------------------------------------------------------------------------
+int
+main
+ (
+   //-------------------
+   // INPUT(s):
+   //-------------------
+      const int    numberCommandLineArguments,
+      const char *pVectorCommandLineArguments[ ]
+   //-------------------
+   // OUTPUT(s):
+   //           NONE
+   //-------------------
+ )
+//==============================================================================
+//
+// MAIN PROGRAM:
+//
+//   sweepAccuracyConvertEcefToGeodetic
+//
+//------------------------------------------------------------------------------
+//
+// PURPOSE:
+//
+//    Measure the accuracy of 'convertEcefToGeodeticBatch' over a dense
+//    grid of geodetic latitude, longitude and altitude on the GRS80
+//    ellipsoid, in parallel, and report the maximum and percentile
+//    latitude and altitude errors of each region of latitude and
+//    altitude.  Optionally write the maximum errors over longitude as a
+//    latitude by altitude heat map, or sweep the batch of one of the
+//    accuracy tiers, the single precision batch or the batch of one of
+//    the conversion engines instead.
+//
+//------------------------------------------------------------------------------
+//
+// METHOD:
+//
+//   [ 1 ]  Generate the exact ECEF coordinates of every grid point with
+//          'convertGeodeticToEcef'.
+//
+//   [ 2 ]  Convert them back, one latitude row at a time, with the batch
+//          conversion, and accumulate the errors of each region, see
+//          'executeAccuracySweepConvertEcefToGeodetic'.
+//
+//------------------------------------------------------------------------------
+//
+// USAGE:
+//
+//   sweepAccuracyConvertEcefToGeodetic [ numberLatitudes
+//                                        [ numberLongitudes
+//                                          [ numberAltitudes
+//                                            [ minimumAltitudeMeters
+//                                              [ maximumAltitudeMeters
+//                                                [ numberThreads
+//                                                  [ heatMapFileName
+//                                                    [ kernel ]]]]]]]]
+//
+//     numberLatitudes
+//       Latitudes from -90 to +90 degrees, both included.
+//       The default value is 721, 0.25 degree steps.
+//
+//     numberLongitudes
+//       Longitudes from 0 to 360 degrees, 360 excluded.
+//       The default value is 72, 5 degree steps.
+//
+//     numberAltitudes
+//       Altitudes from minimumAltitudeMeters to maximumAltitudeMeters,
+//       both included, evenly spaced in asinh( h / 1 km ).
+//       The default values are 200, from -10000 to 50000000 meters.
+//
+//     numberThreads
+//       0 for the number of hardware threads, the default value.
+//
+//     heatMapFileName
+//       If given, the heat maps are written to this file, as comma
+//       separated values if its name ends in ".csv", otherwise as binary.
+//       "-" writes no heat map, the default.
+//
+//     kernel
+//       "display", "survey" or "full", the default:  sweep the accuracy
+//       tier overload of 'convertEcefToGeodeticBatch' for that tier.
+//       "float":  sweep 'convertEcefToGeodeticBatchInSinglePrecision'.
+//       "fukushima", "olson", "bowring1", "bowring2", "vermeille",
+//       "heikkinen", "newton" or "halley":  sweep the engine overload for
+//       that engine, see ECEF_TO_GEODETIC_ENGINE_KEYWORDS.
+//
+//   The default grid has 10382400 points.
+//
+//------------------------------------------------------------------------------
+//
+// RETURNED VALUE:
+//
+//     0 on success, 1 if the heat map could not be written or the
+//     kernel is unknown.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    int mainProgramReturnValue = 0;
+ //-----------------------------------------------------------------------------
+    ACCURACY_SWEEP_SPECIFICATION sweepSpecification;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    sweepSpecification.numberLatitudes         = 721;
+    sweepSpecification.minimumLatitudeDegrees  = -90.0;
+    sweepSpecification.maximumLatitudeDegrees  = +90.0;
+    sweepSpecification.numberLongitudes        = 72;
+    sweepSpecification.minimumLongitudeDegrees = 0.0;
+    sweepSpecification.maximumLongitudeDegrees = 360.0;
+    sweepSpecification.numberAltitudes         = 200;
+    sweepSpecification.minimumAltitudeMeters   = -1.0E4;
+    sweepSpecification.maximumAltitudeMeters   = 5.0E7;
+    sweepSpecification.numberThreads           = 0;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const char * pHeatMapFileName              = NULL;
+ //-----------------------------------------------------------------------------
+ //
+ // Get the optional command line arguments.
+ //
+ //-----------------------------------------------------------------------------
+    if( numberCommandLineArguments > 1 )
+      {
+          sweepSpecification.numberLatitudes =
+                     max( 1, atoi( pVectorCommandLineArguments[ 1 ] ) );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( numberCommandLineArguments > 2 )
+      {
+          sweepSpecification.numberLongitudes =
+                     max( 1, atoi( pVectorCommandLineArguments[ 2 ] ) );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( numberCommandLineArguments > 3 )
+      {
+          sweepSpecification.numberAltitudes =
+                     max( 1, atoi( pVectorCommandLineArguments[ 3 ] ) );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( numberCommandLineArguments > 4 )
+      {
+          sweepSpecification.minimumAltitudeMeters =
+                     atof( pVectorCommandLineArguments[ 4 ] );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( numberCommandLineArguments > 5 )
+      {
+          sweepSpecification.maximumAltitudeMeters =
+                     atof( pVectorCommandLineArguments[ 5 ] );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( numberCommandLineArguments > 6 )
+      {
+          sweepSpecification.numberThreads =
+                     max( 0, atoi( pVectorCommandLineArguments[ 6 ] ) );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( numberCommandLineArguments > 7 )
+      {
+          if( strcmp( pVectorCommandLineArguments[ 7 ], "-" ) != 0 )
+            {
+                pHeatMapFileName = pVectorCommandLineArguments[ 7 ];
+            };
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    ECEF_TO_GEODETIC_BATCH_FUNCTION
+                 pConvertBatch = convertEcefToGeodeticBatch;
+    const char * pKernelName   = "convertEcefToGeodeticBatch, GRS80";
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( numberCommandLineArguments > 8 )
+      {
+          if( strcmp( pVectorCommandLineArguments[ 8 ], "display" ) == 0 )
+            {
+                pConvertBatch =
+                convertEcefToGeodeticBatchForTier< DISPLAY_ACCURACY_TIER >;
+                pKernelName   =
+                "convertEcefToGeodeticBatch, display tier, GRS80";
+            }
+          else
+          if( strcmp( pVectorCommandLineArguments[ 8 ], "survey" ) == 0 )
+            {
+                pConvertBatch =
+                convertEcefToGeodeticBatchForTier< SURVEY_ACCURACY_TIER >;
+                pKernelName   =
+                "convertEcefToGeodeticBatch, survey tier, GRS80";
+            }
+          else
+          if( strcmp( pVectorCommandLineArguments[ 8 ], "float" ) == 0 )
+            {
+                pConvertBatch =
+                convertEcefToGeodeticBatchForSinglePrecision;
+                pKernelName   =
+                "convertEcefToGeodeticBatchInSinglePrecision, GRS80";
+            }
+          else
+          if( strcmp( pVectorCommandLineArguments[ 8 ], "full" ) != 0 )
+            {
+             //-----------------------------------------------------------------
+                int engine = 0;
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                while( ( engine < NUMBER_ECEF_TO_GEODETIC_ENGINES ) &&
+                       ( strcmp( pVectorCommandLineArguments[ 8 ],
+                                 ECEF_TO_GEODETIC_ENGINE_KEYWORDS[ engine ] )
+                         != 0 ) )
+                  {
+                      engine++;
+                  };
+             //-----------------------------------------------------------------
+                if( engine == NUMBER_ECEF_TO_GEODETIC_ENGINES )
+                  {
+                      fprintf( stderr, "ERROR: unknown kernel '%s'.\n",
+                               pVectorCommandLineArguments[ 8 ] );
+                      return( 1 );
+                  };
+             //-----------------------------------------------------------------
+                pConvertBatch = getEcefToGeodeticEngineBatchFunction
+                                       (
+                                         ( ECEF_TO_GEODETIC_ENGINE )engine
+                                       );
+                pKernelName   = ECEF_TO_GEODETIC_ENGINE_NAMES[ engine ];
+             //-----------------------------------------------------------------
+            };
+      };
+ //-----------------------------------------------------------------------------
+    const size_t numberHeatMapCells =
+                     ( size_t )sweepSpecification.numberLatitudes *
+                     sweepSpecification.numberAltitudes;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    vector< double > heatMapLatitudeErrorMicroArcSecs( numberHeatMapCells );
+    vector< double > heatMapAltitudeErrorNanoMeters  ( numberHeatMapCells );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    ACCURACY_SWEEP_STATISTICS
+            regionStatistics[ NUMBER_ACCURACY_SWEEP_LATITUDE_BANDS ]
+                            [ NUMBER_ACCURACY_SWEEP_ALTITUDE_BANDS ];
+    ACCURACY_SWEEP_STATISTICS
+            sweepStatistics;
+ //-----------------------------------------------------------------------------
+    const double
+    elapsedSeconds = executeAccuracySweepConvertEcefToGeodetic
+                            (
+                              //-------------------
+                              // INPUT(s):
+                              //-------------------
+                                 sweepSpecification,
+                                 pConvertBatch,
+                              //-------------------
+                              // OUTPUT(s):
+                              //-------------------
+                                 regionStatistics,
+                                 sweepStatistics,
+                                 heatMapLatitudeErrorMicroArcSecs.data( ),
+                                 heatMapAltitudeErrorNanoMeters.data( )
+                            );
+ //-----------------------------------------------------------------------------
+    reportAccuracySweepConvertEcefToGeodetic
+           (
+             pKernelName,
+             sweepSpecification,
+             regionStatistics,
+             sweepStatistics,
+             elapsedSeconds
+           );
+ //-----------------------------------------------------------------------------
+    if( pHeatMapFileName != NULL )
+      {
+          if( writeAccuracySweepHeatMap
+                     (
+                       pHeatMapFileName,
+                       sweepSpecification,
+                       heatMapLatitudeErrorMicroArcSecs.data( ),
+                       heatMapAltitudeErrorNanoMeters.data( )
+                     ) )
+            {
+                fprintf( stdout, "Heat map written to '%s'.\n\n",
+                         pHeatMapFileName );
+            }
+          else
+            {
+                fprintf( stderr, "ERROR: could not write heat map '%s'.\n",
+                         pHeatMapFileName );
+                mainProgramReturnValue = 1;
+            };
+      };
+ //-----------------------------------------------------------------------------
+    return( mainProgramReturnValue );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================
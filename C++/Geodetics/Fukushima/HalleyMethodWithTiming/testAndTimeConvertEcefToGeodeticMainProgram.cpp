@@ -5,7 +5,10 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <thread>
 #include <vector>
 
 #include "conversionBetweenEcefAndGeodetic.h"
@@ -105,10 +108,127 @@ main
 //            perform seperate geodetic coordinate conversions
 //            at each of four specified true geodetic altitudes.
 //
-//   Report the sum of the execution times over each of
-//   the coordinate conversion function calls involved in
-//   the 32 ECEF rectangular coorindates conversions to
-//   geodetic coordinates.
+//   The 32 ECEF rectangular coorindates conversions to geodetic
+//   coordinates of a trial are timed together, in repeated runs after
+//   warm-up runs, by 'measureConversionTiming', which subtracts the
+//   clock overhead and reports the median and median absolute deviation
+//   of the time and of the time stamp counter cycles per call.
+//
+//   Report the median over all trials of the trial median time per call.
+//
+//------------------------------------------------------------------------------
+//
+// BATCH CONVERSION TIMING:
+//
+//   After the trials, report the execution time per point of the
+//   'convertEcefToGeodeticBatch' function for batch sizes of
+//   1, 10, 100, ... 10^maximumBatchSizeExponent points.
+//
+//   Then report, for each batch kernel instruction set level which the
+//   processor supports (baseline, AVX2 and FMA, AVX-512), the execution
+//   time per point and the maximum errors of a batch of
+//   10^min( 5, maximumBatchSizeExponent ) points.
+//
+//   Then time the forward conversion, geodetic to ECEF, of the same
+//   number of points with scalar 'convertGeodeticToEcef' calls and with
+//   the 'convertGeodeticToEcefBatch' kernel of each supported level.
+//
+//   Then time the conversion of a DEM tile of
+//   10^min( 6, maximumBatchSizeExponent ) cells, one scalar call per cell,
+//   one batch call, and one separable 'convertGeodeticGridToEcef' call.
+//
+//   Then compare the stateless conversions with the warm started
+//   'convertEcefToGeodeticTrajectory' on 100 Hz aircraft, 1 Hz low Earth
+//   orbit and 1 Hz ballistic hop tracks of
+//   10^min( 5, maximumBatchSizeExponent ) points.
+//
+//   Then time the display, survey and full accuracy tiers, scalar and
+//   batch, on 10^min( 5, maximumBatchSizeExponent ) points, and check their
+//   maximum errors against the error bounds of each tier.
+//
+//   Then compare the angle conversions followed by sin and cos of both
+//   angles with the direction cosine conversions, scalar and batch.
+//
+//   Then compare the full conversions with the altitude only, latitude and
+//   longitude only and latitude only conversions, scalar and batch.
+//
+//   Then compare the altitude band culling, as a bit mask and as indices,
+//   with the batch conversions followed by an altitude comparison.
+//
+//   Then compare the time per point and the errors of the Fukushima,
+//   Olson, Bowring, Vermeille, Heikkinen and iterative conversion engines
+//   on the same points, and sweep the accuracy of each over a coarse grid.
+//
+//   Then time the Fukushima 1999 Newton and iterated Halley engines for
+//   1 to 8 iterations at most, near the Earth's center, about the Earth
+//   and at lunar distances, with their convergence and errors.
+//
+//   Then compare the single precision batches of both conversion
+//   directions with the double batches, in time per point and in their
+//   largest errors for low Earth orbit altitudes.
+//
+//   Then compare the time per point of the scalar conversions called with
+//   the ellipsoid parameters and called with a prebuilt ellipsoid context.
+//
+//   Then compare both with the compile time ellipsoid kernels of
+//   'convertEcefToGeodeticForEllipsoid.h', for GRS80 and for a sphere.
+//
+//   Then compare the out-of-line scalar conversions with their inline
+//   bodies of 'convertBetweenEcefAndGeodeticInline.h' in a caller loop.
+//
+//   Then compare the baseline x86-64, x86-64-v3 and x86-64-v4 clones of
+//   the scalar conversions, and the clone bound to the entry points at
+//   load time, in time per point and in their largest errors.
+//
+//   Then compare the batch conversions returning a status per point with
+//   those returning validity bits and summary counts, for batches with 0
+//   to 10 percent of NAN or infinite records.
+//
+//   Then compare the interleaved and block interleaved batch conversions
+//   of records and blocks of points with the batch conversion of
+//   coordinate arrays, with and without copies of the records.
+//
+//   Then report the scaling of 'convertEcefToGeodeticParallelBatch' over
+//   1, 2, ... maximumNumberThreads threads for a batch of
+//   10^min( 6, maximumBatchSizeExponent ) points.
+//
+//------------------------------------------------------------------------------
+//
+// USAGE:
+//
+//   testAndTimeConvertEcefToGeodetic [ maximumBatchSizeExponent
+//                                      [ maximumNumberThreads
+//                                        [ trialOutputMode
+//                                          [ numberSweepThreads
+//                                            [ numberTrials ] ] ] ] ]
+//
+//     maximumBatchSizeExponent
+//       The base ten exponent of the largest timed batch size,
+//       in the interval [ 0, 8 ].  The default value is 8.
+//       A batch of 10^8 points needs about 5.2 gigabytes.
+//
+//     maximumNumberThreads
+//       The largest thread count of the parallel scaling report.
+//       The default value is the number of hardware threads.
+//
+//     trialOutputMode
+//       When the per point report of each trial is written:
+//         immediate  after each trial (the default),
+//         deferred   after all trials, which run back to back,
+//         quiet      never; only the summaries are written.
+//       The trials themselves only record their results, so no
+//       formatting runs between the timed conversions in any mode.
+//
+//     numberSweepThreads
+//       The number of threads running the trials, 0 for the number of
+//       hardware threads.  The default value 1 runs them serially.
+//       The trials of a parallel sweep are independent and write their
+//       own results, so every error in the report is the same as in
+//       the serial sweep; immediate output becomes deferred output.
+//
+//     numberTrials
+//       The number of trials, at longitude steps of 360 / numberTrials
+//       degrees.  The default value is 1440, 0.25 degree steps.
 //
 //------------------------------------------------------------------------------
 //
@@ -166,17 +286,82 @@ main
  //-----------------------------------------------------------------------------
     int     mainProgramReturnValue                 = 0;
  //-----------------------------------------------------------------------------
-    const
     int     numberTrials                           = 4 * 360;
  //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
     const
     double  startingEastGeocentricLongitudeDegrees =   0.0;
-    const
-    double     deltaEastGeocentricLongitudeDegrees = 360.0 / numberTrials;
  //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-    double  totalTrialsExecutionTimeMicroSeconds                       = 0.0;
+    double  minimumTrialNanoSecondsPerCall                         = INFINITY;
     double  totalMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs = 0.0;
     double  totalMaximumGeodeticAltitudeAbsoluteErrorNanoMeter         = 0.0;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    int     maximumBatchSizeExponent                                   = 8;
+    size_t  maximumNumberThreads                                       =
+                     max( 1u, thread::hardware_concurrency( ) );
+    TRIAL_OUTPUT_MODE
+            trialOutputMode                         = IMMEDIATE_TRIAL_OUTPUT;
+    size_t  numberSweepThreads                      = 1;
+ //-----------------------------------------------------------------------------
+ //
+ // Get the optional command line arguments.
+ //
+ //-----------------------------------------------------------------------------
+    if( numberCommandLineArguments > 1 )
+      {
+          maximumBatchSizeExponent =
+                     min( 8, max( 0, atoi( pVectorCommandLineArguments[ 1 ] ) ) );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( numberCommandLineArguments > 2 )
+      {
+          maximumNumberThreads =
+                     max( 1, atoi( pVectorCommandLineArguments[ 2 ] ) );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( numberCommandLineArguments > 3 )
+      {
+          if( strcmp( pVectorCommandLineArguments[ 3 ], "deferred" ) == 0 )
+            {
+                trialOutputMode = DEFERRED_TRIAL_OUTPUT;
+            }
+          else if( strcmp( pVectorCommandLineArguments[ 3 ], "quiet" ) == 0 )
+            {
+                trialOutputMode = QUIET_TRIAL_OUTPUT;
+            };
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( numberCommandLineArguments > 4 )
+      {
+          numberSweepThreads =
+                     max( 0, atoi( pVectorCommandLineArguments[ 4 ] ) );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( numberCommandLineArguments > 5 )
+      {
+          numberTrials =
+                     max( 1, atoi( pVectorCommandLineArguments[ 5 ] ) );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    double     deltaEastGeocentricLongitudeDegrees = 360.0 / numberTrials;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( numberSweepThreads != 1 && trialOutputMode == IMMEDIATE_TRIAL_OUTPUT )
+      {
+          trialOutputMode = DEFERRED_TRIAL_OUTPUT;
+      };
+ //-----------------------------------------------------------------------------
+ // Preallocated results of every trial, so that no allocation and, unless
+ // the output is immediate, no formatting runs between the trials.
+ //-----------------------------------------------------------------------------
+    vector< TRIAL_POINT_RESULT >
+            trialPointResults( ( size_t )numberTrials *
+                               NUMBER_POINTS_PER_TRIAL );
+    vector< CONVERSION_TIMING_STATISTICS >
+            trialTimingStatistics                   ( numberTrials );
+    vector< double >
+            trialMaximumLatitudeErrorMicroArcSecs   ( numberTrials );
+    vector< double >
+            trialMaximumAltitudeErrorNanoMeters     ( numberTrials );
  //-----------------------------------------------------------------------------
  //
  // Generate purpose message.
@@ -188,76 +373,160 @@ main
  // Loop over all timing trials.
  //
  //-----------------------------------------------------------------------------
-    for(
-         int trialIndex  = 1;
-             trialIndex <= numberTrials;
-             trialIndex  = trialIndex + 1
-       )
-       {
-        //----------------------------------------------------------------------
-           double
-           trialExecutionTimeMicroSeconds = 0.0;
-        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-           const
-           double
-           specifiedFixedTrueEastGeocentricLongitudeDegrees =
-                    startingEastGeocentricLongitudeDegrees
-                    +
-                    (
-                      ( trialIndex - 1 )
-                      *
-                      deltaEastGeocentricLongitudeDegrees
-                    );
-        //----------------------------------------------------------------------
-        // Compute coordinate conversions over the specified geocentric meridian.
-        //----------------------------------------------------------------------
-           double executionTimeOfTrialFunctionCallsMicroSeconds         = 0.0;
-           double maximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs = 0.0;
-           double maximumGeodeticAltitudeAbsoluteErrorNanoMeters        = 0.0;
-        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-           executeOneTrialConvertEcefToGeodetic
-                  (
-                    //-------------------
-                    // INPUT(s):
-                    //-------------------
-                       specifiedFixedTrueEastGeocentricLongitudeDegrees,
-                    //-------------------
-                    // OUTPUT(s):
-                    //-------------------
-                       executionTimeOfTrialFunctionCallsMicroSeconds,
-                       maximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs,
-                       maximumGeodeticAltitudeAbsoluteErrorNanoMeters
-                  );
-        //----------------------------------------------------------------------
-           totalTrialsExecutionTimeMicroSeconds =
-                               totalTrialsExecutionTimeMicroSeconds
-                               +
-                               executionTimeOfTrialFunctionCallsMicroSeconds;
-        //----------------------------------------------------------------------
-           totalMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs =
-           std::max
-            (
-              totalMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs,
-              maximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs
-            );
-        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-           totalMaximumGeodeticAltitudeAbsoluteErrorNanoMeter =
-           std::max
-            (
-              totalMaximumGeodeticAltitudeAbsoluteErrorNanoMeter,
-              maximumGeodeticAltitudeAbsoluteErrorNanoMeters
-            );
+    const auto trialsStartTime = steady_clock::now( );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( numberSweepThreads != 1 )
+      {
        //-----------------------------------------------------------------------
-       // End of loop over trials.
+       // Parallel sweep: the same trials, spread over the threads.
        //-----------------------------------------------------------------------
+          executeParallelTrialSweepConvertEcefToGeodetic
+                 (
+                   //-------------------
+                   // INPUT(s):
+                   //-------------------
+                      numberTrials,
+                      startingEastGeocentricLongitudeDegrees,
+                      deltaEastGeocentricLongitudeDegrees,
+                      numberSweepThreads,
+                   //-------------------
+                   // OUTPUT(s):
+                   //-------------------
+                      trialPointResults.data( ),
+                      trialTimingStatistics.data( ),
+                      trialMaximumLatitudeErrorMicroArcSecs.data( ),
+                      trialMaximumAltitudeErrorNanoMeters.data( ),
+                    totalMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs,
+                    totalMaximumGeodeticAltitudeAbsoluteErrorNanoMeter
+                 );
+       //-----------------------------------------------------------------------
+      }
+    else
+      {
+       //-----------------------------------------------------------------------
+       // Serial sweep.
+       //-----------------------------------------------------------------------
+          for( int t = 0; t < numberTrials; t++ )
+            {
+             //-----------------------------------------------------------------
+                const
+                double
+                specifiedFixedTrueEastGeocentricLongitudeDegrees =
+                         startingEastGeocentricLongitudeDegrees
+                         +
+                         ( t * deltaEastGeocentricLongitudeDegrees );
+             //-----------------------------------------------------------------
+             // Compute coordinate conversions over the specified geocentric
+             // meridian.
+             //-----------------------------------------------------------------
+                executeOneTrialConvertEcefToGeodetic
+                       (
+                         //-------------------
+                         // INPUT(s):
+                         //-------------------
+                            specifiedFixedTrueEastGeocentricLongitudeDegrees,
+                         //-------------------
+                         // OUTPUT(s):
+                         //-------------------
+                            &trialPointResults[ ( size_t )t *
+                                                NUMBER_POINTS_PER_TRIAL ],
+                            trialTimingStatistics                [ t ],
+                            trialMaximumLatitudeErrorMicroArcSecs[ t ],
+                            trialMaximumAltitudeErrorNanoMeters  [ t ]
+                       );
+             //-----------------------------------------------------------------
+                if( trialOutputMode == IMMEDIATE_TRIAL_OUTPUT )
+                  {
+                     reportOneTrialConvertEcefToGeodetic
+                            (
+                              specifiedFixedTrueEastGeocentricLongitudeDegrees,
+                              &trialPointResults[ ( size_t )t *
+                                                  NUMBER_POINTS_PER_TRIAL ],
+                              trialTimingStatistics                [ t ],
+                              trialMaximumLatitudeErrorMicroArcSecs[ t ],
+                              trialMaximumAltitudeErrorNanoMeters  [ t ]
+                            );
+                  };
+             //-----------------------------------------------------------------
+                totalMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs =
+                std::max
+                 (
+                   totalMaximumGeodeticNorthLatitudeAbsoluteErrorMicroArcSecs,
+                   trialMaximumLatitudeErrorMicroArcSecs[ t ]
+                 );
+             //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                totalMaximumGeodeticAltitudeAbsoluteErrorNanoMeter =
+                std::max
+                 (
+                   totalMaximumGeodeticAltitudeAbsoluteErrorNanoMeter,
+                   trialMaximumAltitudeErrorNanoMeters[ t ]
+                 );
+             //-----------------------------------------------------------------
+             // End of loop over trials.
+             //-----------------------------------------------------------------
+            };
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    double
+    trialsElapsedMilliSeconds =
+          duration< double, milli >( steady_clock::now( ) - trialsStartTime )
+          .count( );
+ //-----------------------------------------------------------------------------
+ // Deferred output: format the recorded results now that every trial has
+ // been timed.
+ //-----------------------------------------------------------------------------
+    if( trialOutputMode == DEFERRED_TRIAL_OUTPUT )
+      {
+          for( int t = 0; t < numberTrials; t++ )
+            {
+                reportOneTrialConvertEcefToGeodetic
+                       (
+                         startingEastGeocentricLongitudeDegrees
+                         +
+                         ( t * deltaEastGeocentricLongitudeDegrees ),
+                         &trialPointResults[ ( size_t )t *
+                                             NUMBER_POINTS_PER_TRIAL ],
+                         trialTimingStatistics[ t ],
+                         trialMaximumLatitudeErrorMicroArcSecs[ t ],
+                         trialMaximumAltitudeErrorNanoMeters  [ t ]
+                       );
+            };
       };
  //-----------------------------------------------------------------------------
+ // Median over the trials of the median time per call of each trial.
+ //-----------------------------------------------------------------------------
+    vector< double > trialMedianNanoSecondsPerCall( numberTrials );
+    vector< double > trialMedianCyclesPerCall     ( numberTrials );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    for( int t = 0; t < numberTrials; t++ )
+      {
+          trialMedianNanoSecondsPerCall[ t ] =
+                         trialTimingStatistics[ t ].medianNanoSecondsPerPoint;
+          trialMedianCyclesPerCall     [ t ] =
+                         trialTimingStatistics[ t ].medianCyclesPerPoint;
+          minimumTrialNanoSecondsPerCall =
+                   min( minimumTrialNanoSecondsPerCall,
+                        trialTimingStatistics[ t ].minimumNanoSecondsPerPoint );
+      };
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    sort( trialMedianNanoSecondsPerCall.begin( ),
+          trialMedianNanoSecondsPerCall.end( ) );
+    sort( trialMedianCyclesPerCall.begin( ),
+          trialMedianCyclesPerCall.end( ) );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const
+    double
+    medianTrialNanoSecondsPerCall = trialMedianNanoSecondsPerCall
+                                                    [ numberTrials / 2 ];
+    const
+    double
+    medianTrialCyclesPerCall      = trialMedianCyclesPerCall
+                                                    [ numberTrials / 2 ];
     const
     double
-    averageTrialExecutionTimeMicroSeconds =
-          totalTrialsExecutionTimeMicroSeconds
-          /
-          numberTrials;
+    upperDecileTrialNanoSecondsPerCall = trialMedianNanoSecondsPerCall
+                                                    [ 9 * numberTrials / 10 ];
 //-----------------------------------------------------------------------------
     fprintf
     (
@@ -266,21 +535,41 @@ main
       "%s%s\n"            
       "%s\n%s\n%s\n"      
       "%s% d%s\n"         
-      "%s%+14.6e%s\n"     
+      "%s%10.3f%s\n"     
+      "%s%10.3f%s\n"     
+      "%s%10.3f%s\n"     
+      "%s%10.3f%s\n"     
+      "%s%10.3f%s\n"     
+      "%s%6zu\n"     
       "%s\n"              
       "%s%s\n"            
       "\n\n\n",
       "==================================================================",
       "======================",
       "|",
-      "| AVERAGE TRIAL TIMING RESULTS:",
+      "| TRIAL TIMING RESULTS OVER ALL TRIALS:",
       "|",
-      "|   Average execution time over ",
+      "|   Per call times of 'convertEcefToGeodetic' over ",
       numberTrials,
-      " trial(s) of",
-      "|     'convertEcefToGeodetic' function calls:-->",
-      averageTrialExecutionTimeMicroSeconds,
-      " [microseconds]",
+      " trial(s):",
+      "|     Median of the trial medians:           ",
+      medianTrialNanoSecondsPerCall,
+      " [nanoseconds]",
+      "|     90th percentile of the trial medians:  ",
+      upperDecileTrialNanoSecondsPerCall,
+      " [nanoseconds]",
+      "|     Minimum over all timed runs:           ",
+      minimumTrialNanoSecondsPerCall,
+      " [nanoseconds]",
+      "|     Median of the trial median cycles:     ",
+      medianTrialCyclesPerCall,
+      " [cycles]",
+      "|     Elapsed time of the trial loop:        ",
+      trialsElapsedMilliSeconds,
+      " [milliseconds]",
+      "|     Threads running the trials:                ",
+      ( numberSweepThreads > 0 ) ? numberSweepThreads :
+                        ( size_t )max( 1u, thread::hardware_concurrency( ) ),
       "|",
       "==================================================================",
       "======================"
@@ -316,6 +605,239 @@ main
       "============================================",
       "============================================"
     );
+ //-----------------------------------------------------------------------------
+ //
+ // Time the batch conversion.
+ //
+ //-----------------------------------------------------------------------------
+    executeBatchTimingConvertEcefToGeodetic
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                maximumBatchSizeExponent
+           );
+ //-----------------------------------------------------------------------------
+ //
+ // Time the batch conversion kernel of each supported ISA level.
+ //
+ //-----------------------------------------------------------------------------
+    executeIsaTimingConvertEcefToGeodetic
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                min( 5, maximumBatchSizeExponent )
+           );
+ //-----------------------------------------------------------------------------
+ //
+ // Time the forward conversion, scalar and batch kernels.
+ //
+ //-----------------------------------------------------------------------------
+    executeForwardTimingConvertGeodeticToEcef
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                min( 5, maximumBatchSizeExponent )
+           );
+ //-----------------------------------------------------------------------------
+ //
+ // Time the grid (DEM tile) conversion routes.
+ //
+ //-----------------------------------------------------------------------------
+    executeGridTimingConvertGeodeticToEcef
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                min( 6, maximumBatchSizeExponent )
+           );
+ //-----------------------------------------------------------------------------
+ //
+ // Time the warm started trajectory conversion.
+ //
+ //-----------------------------------------------------------------------------
+    executeTrajectoryTimingConvertEcefToGeodetic
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                min( 5, maximumBatchSizeExponent )
+           );
+ //-----------------------------------------------------------------------------
+ //
+ // Time the accuracy tiers.
+ //
+ //-----------------------------------------------------------------------------
+    executeAccuracyTierTimingConvertEcefToGeodetic
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                min( 5, maximumBatchSizeExponent )
+           );
+ //-----------------------------------------------------------------------------
+ //
+ // Time the direction cosine conversions.
+ //
+ //-----------------------------------------------------------------------------
+    executeDirectionCosineTimingConvertEcefToGeodetic
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                min( 5, maximumBatchSizeExponent )
+           );
+ //-----------------------------------------------------------------------------
+ //
+ // Time the altitude only, latitude and longitude only and latitude only
+ // conversions.
+ //
+ //-----------------------------------------------------------------------------
+    executeOutputSelectionTimingConvertEcefToGeodetic
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                min( 5, maximumBatchSizeExponent )
+           );
+ //-----------------------------------------------------------------------------
+ //
+ // Time the altitude band culling.
+ //
+ //-----------------------------------------------------------------------------
+    executeAltitudeBandTimingConvertEcefToGeodetic
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                min( 6, maximumBatchSizeExponent )
+           );
+ //-----------------------------------------------------------------------------
+ //
+ // Compare the conversion engines.
+ //
+ //-----------------------------------------------------------------------------
+    executeEngineTimingConvertEcefToGeodetic
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                min( 5, maximumBatchSizeExponent )
+           );
+ //-----------------------------------------------------------------------------
+ //
+ // Time the iterative engines against their number of iterations.
+ //
+ //-----------------------------------------------------------------------------
+    executeIterationTimingConvertEcefToGeodetic
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                min( 5, maximumBatchSizeExponent )
+           );
+ //-----------------------------------------------------------------------------
+ //
+ // Time the single precision batches against the double batches.
+ //
+ //-----------------------------------------------------------------------------
+    executeSinglePrecisionTimingConvertEcefToGeodetic
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                min( 5, maximumBatchSizeExponent )
+           );
+ //-----------------------------------------------------------------------------
+ //
+ // Time the ellipsoid parameter and ellipsoid context call paths.
+ //
+ //-----------------------------------------------------------------------------
+    executeEllipsoidContextTimingConvertEcefToGeodetic
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                min( 5, maximumBatchSizeExponent )
+           );
+ //-----------------------------------------------------------------------------
+ //
+ // Time the compile time ellipsoid kernels against the runtime parameter
+ // kernels.
+ //
+ //-----------------------------------------------------------------------------
+    executeTemplateTimingConvertEcefToGeodetic
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                min( 5, maximumBatchSizeExponent )
+           );
+ //-----------------------------------------------------------------------------
+ //
+ // Time the out-of-line scalar kernels against their inline bodies in a
+ // caller loop.
+ //
+ //-----------------------------------------------------------------------------
+    executeInlineTimingConvertEcefToGeodetic
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                min( 5, maximumBatchSizeExponent )
+           );
+ //-----------------------------------------------------------------------------
+ //
+ // Compare the x86-64 level clones of the scalar conversions.
+ //
+ //-----------------------------------------------------------------------------
+    executeScalarCloneTimingConvertEcefToGeodetic
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                min( 5, maximumBatchSizeExponent )
+           );
+ //-----------------------------------------------------------------------------
+ //
+ // Compare the status and validity bits batch conversions on bad records.
+ //
+ //-----------------------------------------------------------------------------
+    executeValidityTimingConvertEcefToGeodetic
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                min( 5, maximumBatchSizeExponent )
+           );
+ //-----------------------------------------------------------------------------
+ //
+ // Compare the interleaved batch conversions with coordinate arrays.
+ //
+ //-----------------------------------------------------------------------------
+    executeInterleavedTimingConvertEcefToGeodetic
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                min( 5, maximumBatchSizeExponent )
+           );
+ //-----------------------------------------------------------------------------
+ //
+ // Time the parallel batch conversion over 1 .. maximumNumberThreads threads.
+ //
+ //-----------------------------------------------------------------------------
+    executeParallelTimingConvertEcefToGeodetic
+           (
+             //-------------------
+             // INPUT(s):
+             //-------------------
+                min( 6, maximumBatchSizeExponent ),
+                maximumNumberThreads,
+                DEFAULT_ECEF_TO_GEODETIC_CHUNK_POINTS
+           );
  //-----------------------------------------------------------------------------
     return( mainProgramReturnValue );
  //-----------------------------------------------------------------------------
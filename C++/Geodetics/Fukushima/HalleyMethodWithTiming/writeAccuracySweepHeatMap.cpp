@@ -0,0 +1,158 @@
+//==============================================================================
+//       1         2         3         4         5         6         7         8
+//345678901234567890123456789012345678901234567890123456789012345678901234567890
+//==============================================================================
+
+#include <cstdint>
+#include <cstring>
+
+#include "conversionBetweenEcefAndGeodetic.h"
+
+//------------------------------------------------------------------------------
+bool
+writeAccuracySweepHeatMap
+       (
+         //-------------------
+         // INPUT(s):
+         //-------------------
+            const char      * pFileName,
+            const ACCURACY_SWEEP_SPECIFICATION
+                            & rSweepSpecification,
+            const double    * pHeatMapLatitudeErrorMicroArcSecs,
+            const double    * pHeatMapAltitudeErrorNanoMeters
+       )
+//==============================================================================
+//
+//  FUNCTION:
+//    writeAccuracySweepHeatMap
+//
+//------------------------------------------------------------------------------
+//
+//  PURPOSE:
+//
+//    Write the latitude by altitude heat maps of the maximum errors over
+//    longitude of an accuracy sweep to a file.
+//
+//------------------------------------------------------------------------------
+//
+//  FILE FORMATS:
+//
+//    [ 1 ] If pFileName ends in ".csv", comma separated values with a
+//          header line, one line per grid cell, latitude major:
+//
+//            latitudeDegrees,altitudeMeters,
+//            latitudeErrorMicroArcSecs,altitudeErrorNanoMeters
+//
+//    [ 2 ] Otherwise binary, in the byte order of the host:
+//
+//            char    magic[ 8 ]                 "ECEFHMAP"
+//            int32   numberLatitudes            nLat
+//            int32   numberAltitudes            nAlt
+//            float64 latitudeDegrees[ nLat ]
+//            float64 altitudeMeters [ nAlt ]
+//            float64 latitudeErrorMicroArcSecs[ nLat ][ nAlt ]
+//            float64 altitudeErrorNanoMeters  [ nLat ][ nAlt ]
+//
+//          For example numpy.fromfile with offsets 16, 16 + 8 nLat, ...
+//
+//    A failed conversion is written as inf.
+//
+//------------------------------------------------------------------------------
+//
+//  RETURNED VALUE:
+//
+//     true if the whole file was written.
+//
+//==============================================================================
+{
+ //-----------------------------------------------------------------------------
+    const int    numberLatitudes = rSweepSpecification.numberLatitudes;
+    const int    numberAltitudes = rSweepSpecification.numberAltitudes;
+    const size_t numberCells     = ( size_t )numberLatitudes * numberAltitudes;
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    const size_t fileNameLength  = strlen( pFileName );
+    const bool   isCsv           = fileNameLength >= 4
+                                   &&
+                                   strcmp( pFileName + fileNameLength - 4,
+                                           ".csv" ) == 0;
+ //-----------------------------------------------------------------------------
+    FILE * pHeatMapFile = fopen( pFileName, isCsv ? "w" : "wb" );
+ //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    if( pHeatMapFile == NULL )
+      {
+          return( false );
+      };
+ //-----------------------------------------------------------------------------
+    bool isWritten = true;
+ //-----------------------------------------------------------------------------
+    if( isCsv )
+      {
+          isWritten = fprintf( pHeatMapFile,
+                               "latitudeDegrees,altitudeMeters,"
+                               "latitudeErrorMicroArcSecs,"
+                               "altitudeErrorNanoMeters\n" ) > 0;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( int i = 0; i < numberLatitudes && isWritten; i++ )
+            {
+                for( int k = 0; k < numberAltitudes && isWritten; k++ )
+                  {
+                     const size_t cell = ( size_t )i * numberAltitudes + k;
+                  //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                     isWritten =
+                        fprintf
+                          (
+                            pHeatMapFile,
+                            "%.10g,%.10g,%.6g,%.6g\n",
+                            computeAccuracySweepLatitudeDegrees
+                                            ( rSweepSpecification, i ),
+                            computeAccuracySweepAltitudeMeters
+                                            ( rSweepSpecification, k ),
+                            pHeatMapLatitudeErrorMicroArcSecs[ cell ],
+                            pHeatMapAltitudeErrorNanoMeters  [ cell ]
+                          ) > 0;
+                  };
+            };
+      }
+    else
+      {
+          const int32_t dimensions[ 2 ] = { numberLatitudes, numberAltitudes };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          isWritten = fwrite( "ECEFHMAP", 1, 8, pHeatMapFile ) == 8
+                      &&
+                      fwrite( dimensions, sizeof( int32_t ), 2,
+                              pHeatMapFile ) == 2;
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          for( int i = 0; i < numberLatitudes && isWritten; i++ )
+            {
+                const double latitudeDegrees =
+                   computeAccuracySweepLatitudeDegrees
+                                            ( rSweepSpecification, i );
+                isWritten = fwrite( &latitudeDegrees, sizeof( double ), 1,
+                                    pHeatMapFile ) == 1;
+            };
+          for( int k = 0; k < numberAltitudes && isWritten; k++ )
+            {
+                const double altitudeMeters =
+                   computeAccuracySweepAltitudeMeters
+                                            ( rSweepSpecification, k );
+                isWritten = fwrite( &altitudeMeters, sizeof( double ), 1,
+                                    pHeatMapFile ) == 1;
+            };
+       //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+          isWritten = isWritten
+                      &&
+                      fwrite( pHeatMapLatitudeErrorMicroArcSecs,
+                              sizeof( double ), numberCells,
+                              pHeatMapFile ) == numberCells
+                      &&
+                      fwrite( pHeatMapAltitudeErrorNanoMeters,
+                              sizeof( double ), numberCells,
+                              pHeatMapFile ) == numberCells;
+      };
+ //-----------------------------------------------------------------------------
+    isWritten = ( fclose( pHeatMapFile ) == 0 ) && isWritten;
+ //-----------------------------------------------------------------------------
+    return( isWritten );
+ //-----------------------------------------------------------------------------
+}
+//==============================================================================